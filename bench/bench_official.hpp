@@ -0,0 +1,249 @@
+#pragma once
+#include "aead.hpp"
+#include "bench/perf_counters.hpp"
+#include "hash.hpp"
+#include "utils.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+// NIST LWC entry points of official Photon-Beetle implementation ( as shipped
+// in submission package, fetched into third_party/photon-beetle ), one set per
+// variant, renamed when those are built, so that all of them can live in same
+// program, see scripts/build_official.sh
+extern "C"
+{
+  int official_aead32_encrypt(unsigned char*,
+                              unsigned long long*,
+                              const unsigned char*,
+                              unsigned long long,
+                              const unsigned char*,
+                              unsigned long long,
+                              const unsigned char*,
+                              const unsigned char*,
+                              const unsigned char*);
+
+  int official_aead32_decrypt(unsigned char*,
+                              unsigned long long*,
+                              unsigned char*,
+                              const unsigned char*,
+                              unsigned long long,
+                              const unsigned char*,
+                              unsigned long long,
+                              const unsigned char*,
+                              const unsigned char*);
+
+  int official_aead128_encrypt(unsigned char*,
+                               unsigned long long*,
+                               const unsigned char*,
+                               unsigned long long,
+                               const unsigned char*,
+                               unsigned long long,
+                               const unsigned char*,
+                               const unsigned char*,
+                               const unsigned char*);
+
+  int official_aead128_decrypt(unsigned char*,
+                               unsigned long long*,
+                               unsigned char*,
+                               const unsigned char*,
+                               unsigned long long,
+                               const unsigned char*,
+                               unsigned long long,
+                               const unsigned char*,
+                               const unsigned char*);
+
+  int official_hash(unsigned char*, const unsigned char*, unsigned long long);
+}
+
+// Benchmark official implementation of Photon-Beetle-{Hash, AEAD}, using same
+// setup as library benchmarks in bench_hash.hpp & bench_aead.hpp, so that
+// speed-up of library over official code can be computed per input size, see
+// bench/compare.cpp. Before timing, each case checks that official code
+// produces same output as library does.
+namespace bench_official {
+
+// Entry points of official Photon-Beetle-AEAD[R * 8]
+template<const size_t R>
+constexpr auto official_encrypt =
+  R == 4 ? official_aead32_encrypt : official_aead128_encrypt;
+
+template<const size_t R>
+constexpr auto official_decrypt =
+  R == 4 ? official_aead32_decrypt : official_aead128_decrypt;
+
+// Benchmarks official Photon-Beetle-Hash for random input of length N (>=0)
+// -bytes
+inline void
+hash(benchmark::State& state)
+{
+  using namespace bench_photon_beetle;
+
+  const size_t mlen = static_cast<size_t>(state.range(0));
+
+  std::vector<uint8_t> msg(mlen), out(32), expected(32);
+  photon_utils::random_data(msg.data(), msg.size());
+
+  photon_beetle::hash(msg.data(), mlen, expected.data());
+  official_hash(out.data(), msg.data(), mlen);
+  if (out != expected) {
+    state.SkipWithError("official hash doesn't match library");
+    return;
+  }
+
+  perf_counters counters;
+  counters.start();
+
+  for (auto _ : state) {
+    official_hash(out.data(), msg.data(), mlen);
+
+    benchmark::DoNotOptimize(msg.data());
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  counters.stop();
+
+  state.SetBytesProcessed(static_cast<int64_t>(mlen * state.iterations()));
+  counters.report(state, mlen);
+}
+
+// Benchmarks official Photon-Beetle-AEAD[32, 128] encrypt routine, for random
+// associated data & plain text of given lengths
+template<const size_t R>
+void
+aead_encrypt(benchmark::State& state)
+{
+  using namespace bench_photon_beetle;
+
+  const size_t dlen = static_cast<size_t>(state.range(0));
+  const size_t mlen = static_cast<size_t>(state.range(1));
+
+  std::vector<uint8_t> key(16), nonce(16), data(dlen), txt(mlen);
+  std::vector<uint8_t> enc(mlen + 16), expected(mlen + 16);
+  unsigned long long clen = 0;
+
+  photon_utils::random_data(key.data(), key.size());
+  photon_utils::random_data(nonce.data(), nonce.size());
+  photon_utils::random_data(data.data(), data.size());
+  photon_utils::random_data(txt.data(), txt.size());
+
+  photon_beetle::encrypt<R>(key.data(),
+                            nonce.data(),
+                            data.data(),
+                            dlen,
+                            txt.data(),
+                            expected.data(),
+                            mlen,
+                            expected.data() + mlen);
+  official_encrypt<R>(enc.data(),
+                      &clen,
+                      txt.data(),
+                      mlen,
+                      data.data(),
+                      dlen,
+                      nullptr,
+                      nonce.data(),
+                      key.data());
+  if (enc != expected || clen != mlen + 16) {
+    state.SkipWithError("official encryption doesn't match library");
+    return;
+  }
+
+  perf_counters counters;
+  counters.start();
+
+  for (auto _ : state) {
+    official_encrypt<R>(enc.data(),
+                        &clen,
+                        txt.data(),
+                        mlen,
+                        data.data(),
+                        dlen,
+                        nullptr,
+                        nonce.data(),
+                        key.data());
+
+    benchmark::DoNotOptimize(txt.data());
+    benchmark::DoNotOptimize(enc.data());
+    benchmark::DoNotOptimize(clen);
+    benchmark::ClobberMemory();
+  }
+
+  counters.stop();
+
+  const size_t per_itr = mlen + dlen;
+  state.SetBytesProcessed(static_cast<int64_t>(per_itr * state.iterations()));
+  counters.report(state, per_itr);
+}
+
+// Benchmarks official Photon-Beetle-AEAD[32, 128] decrypt routine, for random
+// associated data & cipher text of given lengths
+template<const size_t R>
+void
+aead_decrypt(benchmark::State& state)
+{
+  using namespace bench_photon_beetle;
+
+  const size_t dlen = static_cast<size_t>(state.range(0));
+  const size_t mlen = static_cast<size_t>(state.range(1));
+
+  std::vector<uint8_t> key(16), nonce(16), data(dlen), txt(mlen);
+  std::vector<uint8_t> enc(mlen + 16), dec(mlen);
+  unsigned long long len = 0;
+
+  photon_utils::random_data(key.data(), key.size());
+  photon_utils::random_data(nonce.data(), nonce.size());
+  photon_utils::random_data(data.data(), data.size());
+  photon_utils::random_data(txt.data(), txt.size());
+
+  photon_beetle::encrypt<R>(key.data(),
+                            nonce.data(),
+                            data.data(),
+                            dlen,
+                            txt.data(),
+                            enc.data(),
+                            mlen,
+                            enc.data() + mlen);
+
+  const int ret = official_decrypt<R>(dec.data(),
+                                      &len,
+                                      nullptr,
+                                      enc.data(),
+                                      mlen + 16,
+                                      data.data(),
+                                      dlen,
+                                      nonce.data(),
+                                      key.data());
+  if (ret != 0 || dec != txt || len != mlen) {
+    state.SkipWithError("official decryption doesn't match library");
+    return;
+  }
+
+  perf_counters counters;
+  counters.start();
+
+  for (auto _ : state) {
+    official_decrypt<R>(dec.data(),
+                        &len,
+                        nullptr,
+                        enc.data(),
+                        mlen + 16,
+                        data.data(),
+                        dlen,
+                        nonce.data(),
+                        key.data());
+
+    benchmark::DoNotOptimize(enc.data());
+    benchmark::DoNotOptimize(dec.data());
+    benchmark::DoNotOptimize(len);
+    benchmark::ClobberMemory();
+  }
+
+  counters.stop();
+
+  const size_t per_itr = mlen + dlen;
+  state.SetBytesProcessed(static_cast<int64_t>(per_itr * state.iterations()));
+  counters.report(state, per_itr);
+}
+
+}
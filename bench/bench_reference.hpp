@@ -0,0 +1,185 @@
+#pragma once
+#include "bench/perf_counters.hpp"
+#include "reference.hpp"
+#include "utils.hpp"
+#include <benchmark/benchmark.h>
+#include <cassert>
+
+// Benchmark reference implementation of Photon-Beetle-{Hash, AEAD}, living in
+// test/reference.hpp, using same setup as library benchmarks in
+// bench_hash.hpp & bench_aead.hpp, so that speed-up of library over reference
+// code can be computed per input size, see bench/compare.cpp
+namespace bench_reference {
+
+// Benchmarks reference Photon-Beetle-Hash for random input of length N (>=0)
+// -bytes
+inline void
+hash(benchmark::State& state)
+{
+  using namespace bench_photon_beetle;
+
+  const size_t mlen = static_cast<size_t>(state.range(0));
+
+  uint8_t* msg = static_cast<uint8_t*>(std::malloc(mlen));
+  uint8_t* out = static_cast<uint8_t*>(std::malloc(32));
+
+  photon_utils::random_data(msg, mlen);
+
+  perf_counters counters;
+  counters.start();
+
+  for (auto _ : state) {
+    photon_reference::hash(msg, mlen, out);
+
+    benchmark::DoNotOptimize(msg);
+    benchmark::DoNotOptimize(out);
+    benchmark::ClobberMemory();
+  }
+
+  counters.stop();
+
+  state.SetBytesProcessed(static_cast<int64_t>(mlen * state.iterations()));
+  counters.report(state, mlen);
+
+  std::free(msg);
+  std::free(out);
+}
+
+// Benchmarks reference Photon-Beetle-AEAD[32, 128] encrypt routine, for random
+// associated data & plain text of given lengths
+template<const size_t R>
+void
+aead_encrypt(benchmark::State& state)
+{
+  using namespace bench_photon_beetle;
+
+  const size_t dlen = static_cast<size_t>(state.range(0));
+  const size_t mlen = static_cast<size_t>(state.range(1));
+
+  uint8_t* key = static_cast<uint8_t*>(std::malloc(16));
+  uint8_t* nonce = static_cast<uint8_t*>(std::malloc(16));
+  uint8_t* tag = static_cast<uint8_t*>(std::malloc(16));
+  uint8_t* data = static_cast<uint8_t*>(std::malloc(dlen));
+  uint8_t* txt = static_cast<uint8_t*>(std::malloc(mlen));
+  uint8_t* enc = static_cast<uint8_t*>(std::malloc(mlen));
+  uint8_t* dec = static_cast<uint8_t*>(std::malloc(mlen));
+
+  photon_utils::random_data(key, 16);
+  photon_utils::random_data(nonce, 16);
+  photon_utils::random_data(data, dlen);
+  photon_utils::random_data(txt, mlen);
+
+  perf_counters counters;
+  counters.start();
+
+  for (auto _ : state) {
+    photon_reference::encrypt(R, key, nonce, data, dlen, txt, enc, mlen, tag);
+
+    benchmark::DoNotOptimize(key);
+    benchmark::DoNotOptimize(nonce);
+    benchmark::DoNotOptimize(data);
+    benchmark::DoNotOptimize(txt);
+    benchmark::DoNotOptimize(enc);
+    benchmark::DoNotOptimize(tag);
+    benchmark::ClobberMemory();
+  }
+
+  counters.stop();
+
+  // --- test correctness ---
+  bool f0 = false;
+  f0 =
+    photon_reference::decrypt(R, key, nonce, tag, data, dlen, enc, dec, mlen);
+
+  assert(f0);
+
+  bool f1 = false;
+  for (size_t i = 0; i < mlen; i++) {
+    f1 |= static_cast<bool>(txt[i] ^ dec[i]);
+  }
+
+  assert(!f1);
+  // --- test correctness ---
+
+  const size_t per_itr = mlen + dlen;
+  state.SetBytesProcessed(static_cast<int64_t>(per_itr * state.iterations()));
+  counters.report(state, per_itr);
+
+  std::free(key);
+  std::free(nonce);
+  std::free(tag);
+  std::free(data);
+  std::free(txt);
+  std::free(enc);
+  std::free(dec);
+}
+
+// Benchmarks reference Photon-Beetle-AEAD[32, 128] decrypt routine, for random
+// associated data & cipher text of given lengths
+template<const size_t R>
+void
+aead_decrypt(benchmark::State& state)
+{
+  using namespace bench_photon_beetle;
+
+  const size_t dlen = static_cast<size_t>(state.range(0));
+  const size_t mlen = static_cast<size_t>(state.range(1));
+
+  uint8_t* key = static_cast<uint8_t*>(std::malloc(16));
+  uint8_t* nonce = static_cast<uint8_t*>(std::malloc(16));
+  uint8_t* tag = static_cast<uint8_t*>(std::malloc(16));
+  uint8_t* data = static_cast<uint8_t*>(std::malloc(dlen));
+  uint8_t* txt = static_cast<uint8_t*>(std::malloc(mlen));
+  uint8_t* enc = static_cast<uint8_t*>(std::malloc(mlen));
+  uint8_t* dec = static_cast<uint8_t*>(std::malloc(mlen));
+
+  photon_utils::random_data(key, 16);
+  photon_utils::random_data(nonce, 16);
+  photon_utils::random_data(data, dlen);
+  photon_utils::random_data(txt, mlen);
+
+  photon_reference::encrypt(R, key, nonce, data, dlen, txt, enc, mlen, tag);
+
+  perf_counters counters;
+  counters.start();
+
+  for (auto _ : state) {
+    bool f0 = false;
+    f0 =
+      photon_reference::decrypt(R, key, nonce, tag, data, dlen, enc, dec, mlen);
+    assert(f0);
+
+    benchmark::DoNotOptimize(key);
+    benchmark::DoNotOptimize(nonce);
+    benchmark::DoNotOptimize(tag);
+    benchmark::DoNotOptimize(data);
+    benchmark::DoNotOptimize(enc);
+    benchmark::DoNotOptimize(dec);
+    benchmark::ClobberMemory();
+  }
+
+  counters.stop();
+
+  // --- test correctness ---
+  bool f = false;
+  for (size_t i = 0; i < mlen; i++) {
+    f |= static_cast<bool>(txt[i] ^ dec[i]);
+  }
+
+  assert(!f);
+  // --- test correctness ---
+
+  const size_t per_itr = mlen + dlen;
+  state.SetBytesProcessed(static_cast<int64_t>(per_itr * state.iterations()));
+  counters.report(state, per_itr);
+
+  std::free(key);
+  std::free(nonce);
+  std::free(tag);
+  std::free(data);
+  std::free(txt);
+  std::free(enc);
+  std::free(dec);
+}
+
+}
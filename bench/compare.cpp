@@ -0,0 +1,223 @@
+#include "bench/bench_aead.hpp"
+#include "bench/bench_hash.hpp"
+#include "bench_reference.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#if defined PHOTON_OFFICIAL
+#include "bench_official.hpp"
+#endif
+
+// Compares Photon-Beetle-{Hash, AEAD} implementation of this library against
+// reference implementation ( see test/reference.hpp ) and, when it's built in
+// ( see `make compare` ), official implementation shipped in NIST LWC
+// submission package ( see bench/bench_official.hpp ), running all of them
+// through same google-benchmark cases, one after another, and finally printing
+// speed-up of library over each of them, for each input size.
+//
+// --lens=L,L,...  message lengths in bytes ( default: 0,16,64,256,1024,4096 ),
+//                 benchmarked with --ad_len -bytes associated data
+// --ad_len=N      associated data length in bytes ( default: 32 )
+//
+// Rest of arguments are forwarded to google-benchmark, say
+// --benchmark_filter='hash' or --benchmark_repetitions=5
+
+// Console reporter, which also remembers per iteration CPU time of each case,
+// so that library, reference & official runs of same case can be paired up,
+// once all of them are done
+class speedup_reporter : public benchmark::ConsoleReporter
+{
+private:
+  // Name prefix of benchmark cases of library, reference & official code
+  static constexpr const char* IMPLS[]{ "bench_photon_beetle::",
+                                        "bench_reference::",
+                                        "bench_official::" };
+  static constexpr size_t LIB = 0, REF = 1, OFF = 2;
+
+  struct timing
+  {
+    double sum[3]{};
+    size_t cnt[3]{};
+
+    // Mean CPU time per iteration of given implementation, or 0, if it wasn't
+    // run
+    double mean(const size_t impl) const
+    {
+      return cnt[impl] > 0 ? sum[impl] / static_cast<double>(cnt[impl]) : 0.;
+    }
+  };
+
+  std::vector<std::string> order;
+  std::map<std::string, timing> cases;
+  bool has_official = false;
+
+public:
+  void ReportRuns(const std::vector<Run>& reports) override
+  {
+    benchmark::ConsoleReporter::ReportRuns(reports);
+
+    for (const Run& run : reports) {
+      if (run.error_occurred || run.run_type != Run::RT_Iteration) {
+        continue;
+      }
+
+      const std::string name = run.benchmark_name();
+      const auto it = std::find_if(
+        std::begin(IMPLS), std::end(IMPLS), [&](const char* const pre) {
+          return name.starts_with(pre);
+        });
+      if (it == std::end(IMPLS)) {
+        continue;
+      }
+
+      const size_t impl = static_cast<size_t>(it - std::begin(IMPLS));
+      const std::string key = name.substr(std::strlen(*it));
+      if (!cases.contains(key)) {
+        order.push_back(key);
+      }
+
+      timing& t = cases[key];
+      t.sum[impl] += run.GetAdjustedCPUTime();
+      t.cnt[impl]++;
+      has_official |= impl == OFF;
+    }
+  }
+
+  void Finalize() override
+  {
+    benchmark::ConsoleReporter::Finalize();
+
+    std::printf("\n%-32s %16s %16s %10s",
+                "Case",
+                "Library ( ns )",
+                "Reference ( ns )",
+                "Speed-up");
+    if (has_official) {
+      std::printf(" %16s %10s", "Official ( ns )", "Speed-up");
+    }
+    std::printf("\n");
+
+    for (const std::string& key : order) {
+      const timing& t = cases[key];
+      if (t.cnt[LIB] == 0 || t.cnt[REF] == 0) {
+        continue;
+      }
+
+      const double lib = t.mean(LIB);
+      const double ref = t.mean(REF);
+      std::printf(
+        "%-32s %16.0f %16.0f %9.2fx", key.c_str(), lib, ref, ref / lib);
+
+      if (has_official && t.cnt[OFF] > 0) {
+        const double off = t.mean(OFF);
+        std::printf(" %16.0f %9.2fx", off, off / lib);
+      }
+      std::printf("\n");
+    }
+  }
+};
+
+// Parses comma separated list of lengths
+static std::vector<int64_t>
+parse_lens(const std::string& s)
+{
+  std::vector<int64_t> lens;
+
+  size_t beg = 0;
+  while (beg < s.size()) {
+    const size_t end = std::min(s.find(',', beg), s.size());
+    if (end > beg) {
+      lens.push_back(std::stoll(s.substr(beg, end - beg)));
+    }
+    beg = end + 1;
+  }
+
+  return lens;
+}
+
+// Registers library, reference ( & official ) implementation of
+// Photon-Beetle-AEAD[32, 128] encrypt/ decrypt routines, with given associated
+// data & message lengths
+template<const size_t R>
+static void
+register_aead(const int64_t dlen, const int64_t mlen)
+{
+  const std::string rate = std::to_string(R);
+  const std::string enc = "aead_encrypt<" + rate + ">";
+  const std::string dec = "aead_decrypt<" + rate + ">";
+
+  benchmark::RegisterBenchmark(("bench_photon_beetle::" + enc).c_str(),
+                               bench_photon_beetle::aead_encrypt<R>)
+    ->Args({ dlen, mlen });
+  benchmark::RegisterBenchmark(("bench_reference::" + enc).c_str(),
+                               bench_reference::aead_encrypt<R>)
+    ->Args({ dlen, mlen });
+  benchmark::RegisterBenchmark(("bench_photon_beetle::" + dec).c_str(),
+                               bench_photon_beetle::aead_decrypt<R>)
+    ->Args({ dlen, mlen });
+  benchmark::RegisterBenchmark(("bench_reference::" + dec).c_str(),
+                               bench_reference::aead_decrypt<R>)
+    ->Args({ dlen, mlen });
+
+#if defined PHOTON_OFFICIAL
+  benchmark::RegisterBenchmark(("bench_official::" + enc).c_str(),
+                               bench_official::aead_encrypt<R>)
+    ->Args({ dlen, mlen });
+  benchmark::RegisterBenchmark(("bench_official::" + dec).c_str(),
+                               bench_official::aead_decrypt<R>)
+    ->Args({ dlen, mlen });
+#endif
+}
+
+int
+main(int argc, char** argv)
+{
+  std::vector<int64_t> lens{ 0, 16, 64, 256, 1024, 4096 };
+  int64_t ad_len = 32;
+
+  int j = 1;
+  for (int i = 1; i < argc; i++) {
+    const std::string arg(argv[i]);
+
+    if (arg.starts_with("--lens=")) {
+      lens = parse_lens(arg.substr(7));
+    } else if (arg.starts_with("--ad_len=")) {
+      ad_len = std::stoll(arg.substr(9));
+    } else {
+      argv[j++] = argv[i];
+    }
+  }
+  argc = j;
+
+  for (const int64_t len : lens) {
+    benchmark::RegisterBenchmark("bench_photon_beetle::hash",
+                                 bench_photon_beetle::hash)
+      ->Arg(len);
+    benchmark::RegisterBenchmark("bench_reference::hash",
+                                 bench_reference::hash)
+      ->Arg(len);
+#if defined PHOTON_OFFICIAL
+    benchmark::RegisterBenchmark("bench_official::hash", bench_official::hash)
+      ->Arg(len);
+#endif
+  }
+  for (const int64_t len : lens) {
+    register_aead<4>(ad_len, len);
+    register_aead<16>(ad_len, len);
+  }
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return EXIT_FAILURE;
+  }
+
+  speedup_reporter reporter;
+  benchmark::RunSpecifiedBenchmarks(&reporter);
+  benchmark::Shutdown();
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,200 @@
+#include "mmap.hpp"
+#include "uring.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <string>
+
+// Benchmarks Photon-Beetle-Hash over a ( large ) local file, comparing
+// different ways of getting file contents into hasher
+//
+// - plain `read()` into a fixed size buffer, feeding incremental hasher
+// - `mmap()` with sequential access hint, hashing mapping in one go
+// - io_uring, keeping several reads in flight, feeding incremental hasher
+// - io_uring with O_DIRECT, bypassing page cache
+//
+// If file doesn't exist, it's created, filled with N MiB random bytes. Before
+// each run, file's pages are evicted from page cache ( best effort, using
+// `posix_fadvise` ), unless `--warm` is passed.
+//
+// Compile it with
+//
+// make bench/file_hash.out
+//
+// And run it as
+//
+// ./bench/file_hash.out PATH [N ( = 1024 )] [--warm]
+
+// Length of each read request, in bytes
+constexpr size_t BLK_LEN = 1ul << 20;
+
+// Number of reads, io_uring keeps in flight
+constexpr unsigned QDEPTH = 8;
+
+// Creates file of N -bytes, filled with random bytes, if it doesn't exist
+static bool
+ensure_file(const char* const path, const size_t flen)
+{
+  if (access(path, F_OK) == 0) {
+    return true;
+  }
+
+  const int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    return false;
+  }
+
+  std::vector<uint8_t> buf(BLK_LEN);
+  for (size_t off = 0; off < flen; off += buf.size()) {
+    const size_t len = std::min(buf.size(), flen - off);
+    photon_utils::random_data(buf.data(), len);
+
+    if (write(fd, buf.data(), len) != static_cast<ssize_t>(len)) {
+      close(fd);
+      return false;
+    }
+  }
+
+  fsync(fd);
+  close(fd);
+  return true;
+}
+
+// Evicts file's pages from page cache, best effort
+static void
+evict(const char* const path)
+{
+  const int fd = open(path, O_RDONLY);
+  if (fd >= 0) {
+    fdatasync(fd);
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    close(fd);
+  }
+}
+
+static bool
+hash_read(const char* const path, uint8_t* const digest)
+{
+  const int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+
+  std::vector<uint8_t> buf(BLK_LEN);
+  photon_beetle::hasher h;
+
+  while (true) {
+    const ssize_t n = read(fd, buf.data(), buf.size());
+    if (n < 0) {
+      close(fd);
+      return false;
+    }
+    if (n == 0) {
+      break;
+    }
+
+    h.absorb(buf.data(), static_cast<size_t>(n));
+  }
+
+  close(fd);
+  h.finalize(digest);
+  return true;
+}
+
+static bool
+hash_mmap(const char* const path, uint8_t* const digest)
+{
+  photon_utils::mapped_file f;
+  if (!f.open(path)) {
+    return false;
+  }
+
+  photon_beetle::hash(f.data(), f.size(), digest);
+  return true;
+}
+
+int
+main(int argc, char** argv)
+{
+  if (argc < 2) {
+    std::fprintf(stderr, "Usage: %s PATH [MiB ( = 1024 )] [--warm]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  const char* const path = argv[1];
+  size_t mib = 1024;
+  bool warm = false;
+
+  for (int i = 2; i < argc; i++) {
+    if (std::strcmp(argv[i], "--warm") == 0) {
+      warm = true;
+    } else {
+      mib = std::strtoul(argv[i], nullptr, 10);
+    }
+  }
+
+  if (!ensure_file(path, mib << 20)) {
+    std::perror("can't create input file");
+    return EXIT_FAILURE;
+  }
+
+  struct stat st;
+  stat(path, &st);
+  const double mb = static_cast<double>(st.st_size) / 1e6;
+
+  photon_utils::uring_reader ring;
+  const bool has_uring = ring.init(QDEPTH);
+
+  using method = std::function<bool(uint8_t*)>;
+  const std::pair<const char*, method> methods[]{
+    { "read", [&](uint8_t* d) { return hash_read(path, d); } },
+    { "mmap", [&](uint8_t* d) { return hash_mmap(path, d); } },
+    { "io_uring",
+      [&](uint8_t* d) {
+        return has_uring && ring.hash_file(path, d, BLK_LEN, false);
+      } },
+    { "io_uring+O_DIRECT",
+      [&](uint8_t* d) {
+        return has_uring && ring.hash_file(path, d, BLK_LEN, true);
+      } },
+  };
+
+  uint8_t expected[photon_beetle::DIGEST_LEN]{};
+  bool have_expected = false;
+  int status = EXIT_SUCCESS;
+
+  std::printf("%-20s %12s %12s  %s\n", "method", "seconds", "MB/s", "digest");
+
+  for (const auto& [name, fn] : methods) {
+    if (!warm) {
+      evict(path);
+    }
+
+    uint8_t digest[photon_beetle::DIGEST_LEN];
+
+    const auto t0 = std::chrono::steady_clock::now();
+    const bool ok = fn(digest);
+    const auto t1 = std::chrono::steady_clock::now();
+
+    if (!ok) {
+      std::printf("%-20s %12s %12s  %s\n", name, "-", "-", "unavailable");
+      continue;
+    }
+
+    const double secs = std::chrono::duration<double>(t1 - t0).count();
+    const auto hex = photon_utils::to_hex(digest, sizeof(digest));
+    const double mbps = mb / secs;
+    std::printf("%-20s %12.3f %12.2f  %s\n", name, secs, mbps, hex.c_str());
+
+    if (!have_expected) {
+      std::memcpy(expected, digest, sizeof(digest));
+      have_expected = true;
+    } else if (std::memcmp(expected, digest, sizeof(digest)) != 0) {
+      std::fprintf(stderr, "digest mismatch for %s\n", name);
+      status = EXIT_FAILURE;
+    }
+  }
+
+  return status;
+}
@@ -0,0 +1,444 @@
+#include "aead.hpp"
+#include "hash.hpp"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <getopt.h>
+#include <pthread.h>
+#include <sched.h>
+
+#if defined __x86_64__ || defined __i386__
+#include <x86intrin.h>
+#endif
+
+// Measures latency distribution of individual Photon-Beetle-Hash &
+// Photon-Beetle-AEAD[32, 128] encrypt/ decrypt calls, across message lengths,
+// reporting median and tail latencies ( p50, p90, p99, p999 ), which mean
+// throughput, reported by google-benchmark, hides.
+//
+// Each call is timed on its own, using serialized time stamp counter reads
+// ( calibrated against steady clock ) on x86, or steady clock elsewhere, and
+// recorded into a log-linear histogram, which keeps ~3% relative precision.
+//
+// In warm cache mode ( default ), same buffers are used for each call, after a
+// few warm up calls. In cold cache mode, input/ output buffers & permutation's
+// lookup tables are flushed out of cache hierarchy before each call.
+//
+// Compile it with
+//
+// make bench/latency.out
+//
+// And run it as
+//
+// ./bench/latency.out [-n SAMPLES] [-m LEN,LEN,...] [-a ADLEN] [-c CPU]
+// [--cold]
+
+// Low overhead timer, reading time stamp counter on x86, serialized so that
+// timed call neither starts before first reading nor finishes after second one
+struct timer
+{
+  double ns_per_tick = 1.;
+
+  inline static uint64_t start()
+  {
+#if defined __x86_64__ || defined __i386__
+    _mm_lfence();
+    const uint64_t t = __rdtsc();
+    _mm_lfence();
+    return t;
+#else
+    return now();
+#endif
+  }
+
+  inline static uint64_t stop()
+  {
+#if defined __x86_64__ || defined __i386__
+    unsigned aux;
+    const uint64_t t = __rdtscp(&aux);
+    _mm_lfence();
+    return t;
+#else
+    return now();
+#endif
+  }
+
+  inline static uint64_t now()
+  {
+    using namespace std::chrono;
+
+    const auto t = steady_clock::now().time_since_epoch();
+    return static_cast<uint64_t>(duration_cast<nanoseconds>(t).count());
+  }
+
+  // Estimates how many nanoseconds each timer tick takes, by comparing timer
+  // against steady clock over ~100 ms
+  inline void calibrate()
+  {
+#if defined __x86_64__ || defined __i386__
+    const uint64_t n0 = now();
+    const uint64_t t0 = start();
+
+    while (now() - n0 < 100'000'000ul) {
+    }
+
+    const uint64_t n1 = now();
+    const uint64_t t1 = stop();
+
+    ns_per_tick = static_cast<double>(n1 - n0) / static_cast<double>(t1 - t0);
+#endif
+  }
+};
+
+// Log-linear histogram of ( timer tick ) samples, where each power of 2 range
+// is split into 2^SUB_BITS equal width buckets, so that recording is a few
+// instructions, memory use is fixed & relative error is bounded by 2^-SUB_BITS
+class histogram
+{
+private:
+  static constexpr size_t SUB_BITS = 5;
+  static constexpr size_t SUB_CNT = 1ul << SUB_BITS;
+
+  std::vector<uint64_t> buckets = std::vector<uint64_t>(64 * SUB_CNT);
+  uint64_t cnt = 0;
+  uint64_t lo = UINT64_MAX;
+  uint64_t hi = 0;
+  double sum = 0.;
+
+  inline static size_t index(const uint64_t v)
+  {
+    if (v < SUB_CNT) {
+      return static_cast<size_t>(v);
+    }
+
+    const size_t msb = static_cast<size_t>(std::bit_width(v)) - 1;
+    const size_t shift = msb - SUB_BITS;
+    const size_t sub = static_cast<size_t>(v >> shift) & (SUB_CNT - 1);
+
+    return (shift + 1) * SUB_CNT + sub;
+  }
+
+  // Returns mid point of values falling in given bucket
+  inline static double value(const size_t idx)
+  {
+    if (idx < SUB_CNT) {
+      return static_cast<double>(idx);
+    }
+
+    const size_t shift = idx / SUB_CNT - 1;
+    const size_t sub = idx % SUB_CNT;
+    const double lo = static_cast<double>((SUB_CNT + sub) << shift);
+
+    return lo + static_cast<double>(1ul << shift) / 2.;
+  }
+
+public:
+  inline void record(const uint64_t v)
+  {
+    buckets[index(v)]++;
+    cnt++;
+    lo = std::min(lo, v);
+    hi = std::max(hi, v);
+    sum += static_cast<double>(v);
+  }
+
+  inline uint64_t count() const { return cnt; }
+  inline double min() const { return cnt ? static_cast<double>(lo) : 0.; }
+  inline double max() const { return static_cast<double>(hi); }
+  inline double mean() const { return cnt ? sum / cnt : 0.; }
+
+  // Returns q-th quantile ( 0 <= q <= 1 ) of recorded samples
+  inline double quantile(const double q) const
+  {
+    if (cnt == 0) {
+      return 0.;
+    }
+
+    const uint64_t rank = static_cast<uint64_t>(q * (cnt - 1)) + 1;
+
+    uint64_t acc = 0;
+    for (size_t i = 0; i < buckets.size(); i++) {
+      acc += buckets[i];
+      if (acc >= rank) {
+        return std::clamp(value(i), min(), max());
+      }
+    }
+
+    return max();
+  }
+};
+
+// Flushes given memory region out of all levels of cache hierarchy
+static void
+flush(const void* const ptr, const size_t len)
+{
+#if defined __x86_64__ || defined __i386__
+  const uint8_t* const p = static_cast<const uint8_t*>(ptr);
+
+  for (size_t off = 0; off < len; off += photon_utils::CACHE_LINE_LEN) {
+    _mm_clflush(p + off);
+  }
+  if (len > 0) {
+    _mm_clflush(p + len - 1);
+  }
+#else
+  (void)ptr;
+  (void)len;
+#endif
+}
+
+// Evicts permutation's lookup tables & given buffers out of cache hierarchy,
+// on targets which support flushing cache lines, otherwise by walking through
+// a buffer, larger than last level cache
+static void
+evict(const std::vector<std::pair<const void*, size_t>>& regions)
+{
+#if defined __x86_64__ || defined __i386__
+  flush(photon::SBOX.data(), sizeof(photon::SBOX));
+  flush(photon::GF16_MUL_TAB.data(), sizeof(photon::GF16_MUL_TAB));
+  flush(photon::M8.data(), sizeof(photon::M8));
+  flush(photon::RC.data(), sizeof(photon::RC));
+
+  for (const auto& [ptr, len] : regions) {
+    flush(ptr, len);
+  }
+
+  _mm_mfence();
+#else
+  (void)regions;
+
+  static std::vector<uint8_t> buf(64ul << 20);
+  volatile uint8_t sink = 0;
+  for (size_t i = 0; i < buf.size(); i += photon_utils::CACHE_LINE_LEN) {
+    buf[i]++;
+    sink = sink + buf[i];
+  }
+#endif
+}
+
+// Parses comma separated list of message lengths
+static std::vector<size_t>
+parse_lens(const char* const arg)
+{
+  std::vector<size_t> lens;
+  std::string s(arg);
+
+  size_t beg = 0;
+  while (beg <= s.size()) {
+    const size_t end = std::min(s.find(',', beg), s.size());
+    if (end > beg) {
+      const auto tok = s.substr(beg, end - beg);
+      lens.push_back(std::strtoul(tok.c_str(), nullptr, 10));
+    }
+    beg = end + 1;
+  }
+
+  return lens;
+}
+
+int
+main(int argc, char** argv)
+{
+  using namespace photon_beetle;
+
+  size_t samples = 10000;
+  size_t dlen = 16;
+  std::vector<size_t> lens{ 0, 16, 64, 256, 1024, 4096 };
+  long cpu = -1;
+  bool cold = false;
+
+  const option opts[]{ { "samples", required_argument, nullptr, 'n' },
+                       { "lens", required_argument, nullptr, 'm' },
+                       { "adlen", required_argument, nullptr, 'a' },
+                       { "cpu", required_argument, nullptr, 'c' },
+                       { "cold", no_argument, nullptr, 'C' },
+                       { nullptr, 0, nullptr, 0 } };
+
+  int opt;
+  while ((opt = getopt_long(argc, argv, "n:m:a:c:", opts, nullptr)) != -1) {
+    switch (opt) {
+      case 'n':
+        samples = std::max(1ul, std::strtoul(optarg, nullptr, 10));
+        break;
+      case 'm':
+        lens = parse_lens(optarg);
+        break;
+      case 'a':
+        dlen = std::strtoul(optarg, nullptr, 10);
+        break;
+      case 'c':
+        cpu = std::strtol(optarg, nullptr, 10);
+        break;
+      case 'C':
+        cold = true;
+        break;
+      default:
+        std::fprintf(stderr,
+                     "Usage: %s [-n SAMPLES] [-m LEN,LEN,...] [-a ADLEN] "
+                     "[-c CPU] [--cold]\n",
+                     argv[0]);
+        return EXIT_FAILURE;
+    }
+  }
+
+  if (cpu >= 0) {
+#if defined __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(static_cast<int>(cpu), &set);
+
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+      std::fprintf(stderr, "error: can't pin to CPU %ld\n", cpu);
+      return EXIT_FAILURE;
+    }
+#else
+    std::fprintf(stderr, "warning: CPU pinning is not supported\n");
+#endif
+  }
+
+  timer tm;
+  tm.calibrate();
+
+  const size_t max_mlen =
+    lens.empty() ? 0 : *std::max_element(lens.begin(), lens.end());
+
+  uint8_t key[KEY_LEN];
+  uint8_t nonce[NONCE_LEN];
+  uint8_t tag[TAG_LEN];
+  uint8_t digest[DIGEST_LEN];
+  std::vector<uint8_t> data(dlen);
+  std::vector<uint8_t> txt(max_mlen);
+  std::vector<uint8_t> enc(max_mlen);
+  std::vector<uint8_t> dec(max_mlen);
+
+  photon_utils::random_data(key, sizeof(key));
+  photon_utils::random_data(nonce, sizeof(nonce));
+  photon_utils::random_data(data.data(), data.size());
+  photon_utils::random_data(txt.data(), txt.size());
+
+  std::printf("# %s cache, %zu samples, %zu -bytes associated data, %s\n",
+              cold ? "cold" : "warm",
+              samples,
+              dlen,
+              cpu >= 0 ? ("pinned to CPU " + std::to_string(cpu)).c_str()
+                       : "not pinned");
+  std::printf("%-14s %8s %10s %10s %10s %10s %10s %10s %10s\n",
+              "op",
+              "mlen",
+              "min",
+              "p50",
+              "p90",
+              "p99",
+              "p999",
+              "max",
+              "mean");
+
+  int status = EXIT_SUCCESS;
+
+  for (const size_t mlen : lens) {
+    // prepare valid cipher text & tag for decryption
+    uint8_t tag32[TAG_LEN], tag128[TAG_LEN];
+    std::vector<uint8_t> enc32(mlen), enc128(mlen);
+
+    encrypt<4>(
+      key, nonce, data.data(), dlen, txt.data(), enc32.data(), mlen, tag32);
+    encrypt<16>(
+      key, nonce, data.data(), dlen, txt.data(), enc128.data(), mlen, tag128);
+
+    bool ok = true;
+
+    using op = std::function<void()>;
+    const std::pair<const char*, op> ops[]{
+      { "hash", [&] { hash(txt.data(), mlen, digest); } },
+      { "encrypt<4>",
+        [&] {
+          encrypt<4>(
+            key, nonce, data.data(), dlen, txt.data(), enc.data(), mlen, tag);
+        } },
+      { "decrypt<4>",
+        [&] {
+          ok &= decrypt<4>(key,
+                           nonce,
+                           tag32,
+                           data.data(),
+                           dlen,
+                           enc32.data(),
+                           dec.data(),
+                           mlen);
+        } },
+      { "encrypt<16>",
+        [&] {
+          encrypt<16>(
+            key, nonce, data.data(), dlen, txt.data(), enc.data(), mlen, tag);
+        } },
+      { "decrypt<16>",
+        [&] {
+          ok &= decrypt<16>(key,
+                            nonce,
+                            tag128,
+                            data.data(),
+                            dlen,
+                            enc128.data(),
+                            dec.data(),
+                            mlen);
+        } },
+    };
+
+    const std::vector<std::pair<const void*, size_t>> regions{
+      { key, sizeof(key) },          { nonce, sizeof(nonce) },
+      { tag, sizeof(tag) },          { tag32, sizeof(tag32) },
+      { tag128, sizeof(tag128) },    { digest, sizeof(digest) },
+      { data.data(), data.size() },  { txt.data(), mlen },
+      { enc.data(), mlen },          { dec.data(), mlen },
+      { enc32.data(), enc32.size() }, { enc128.data(), enc128.size() },
+    };
+
+    for (const auto& [name, fn] : ops) {
+      // warm up caches & branch predictors
+      for (size_t i = 0; i < std::min<size_t>(samples, 100); i++) {
+        fn();
+      }
+
+      histogram h;
+      for (size_t i = 0; i < samples; i++) {
+        if (cold) {
+          evict(regions);
+        }
+
+        const uint64_t t0 = timer::start();
+        fn();
+        const uint64_t t1 = timer::stop();
+
+        h.record(t1 - t0);
+      }
+
+      const double k = tm.ns_per_tick;
+      std::printf(
+        "%-14s %8zu %10.0f %10.0f %10.0f %10.0f %10.0f %10.0f %10.0f\n",
+        name,
+        mlen,
+        h.min() * k,
+        h.quantile(.5) * k,
+        h.quantile(.9) * k,
+        h.quantile(.99) * k,
+        h.quantile(.999) * k,
+        h.max() * k,
+        h.mean() * k);
+    }
+
+    if (!ok) {
+      std::fprintf(stderr, "error: decryption failed for %zu -bytes\n", mlen);
+      status = EXIT_FAILURE;
+    }
+  }
+
+  std::printf("# all latencies are in nanoseconds\n");
+  return status;
+}
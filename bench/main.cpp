@@ -1,48 +1,324 @@
 #include "bench/bench_photon_beetle.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Benchmark matrix of Photon-Beetle-{Hash, AEAD}, which can be configured
+// from command line, using following arguments ( which are consumed here,
+// while rest are forwarded to google-benchmark )
+//
+// --lens=L,L,...   message lengths ( default: 64,128,...,4096 ), benchmarked
+//                  with --ad_len -bytes associated data, message-only & AD-only
+// --ad_len=N       associated data length ( default: 32 )
+// --tiny_max=N     every message length in [0, N] ( default: 64 ), exposing
+//                  partial block & domain separation constant paths
+// --large=L,L,...  large input lengths, exceeding last level cache, compared
+//                  against memcpy baseline ( default: 1M,4M,16M,64M,256M )
+//
+// Lengths are in bytes, optionally suffixed with K, M or G ( powers of 2 ).
+// Empty list disables respective part of matrix, say --large=
+struct matrix
+{
+  std::vector<int64_t> lens{ 64, 128, 256, 512, 1024, 2048, 4096 };
+  int64_t ad_len = 32;
+  int64_t tiny_max = 64;
+  std::vector<int64_t> large{ 1l << 20, 4l << 20, 16l << 20, 64l << 20,
+                              256l << 20 };
+};
+
+// Parses length, optionally suffixed with K, M or G
+static int64_t
+parse_len(const std::string& s)
+{
+  char* end = nullptr;
+  int64_t v = std::strtoll(s.c_str(), &end, 10);
+
+  switch (*end) {
+    case 'K':
+    case 'k':
+      v <<= 10;
+      break;
+    case 'M':
+    case 'm':
+      v <<= 20;
+      break;
+    case 'G':
+    case 'g':
+      v <<= 30;
+      break;
+  }
+
+  return v;
+}
+
+// Parses comma separated list of lengths
+static std::vector<int64_t>
+parse_lens(const std::string& s)
+{
+  std::vector<int64_t> lens;
+
+  size_t beg = 0;
+  while (beg < s.size()) {
+    const size_t end = std::min(s.find(',', beg), s.size());
+    if (end > beg) {
+      lens.push_back(parse_len(s.substr(beg, end - beg)));
+    }
+    beg = end + 1;
+  }
+
+  return lens;
+}
+
+// Consumes matrix arguments, removing them from argument vector
+static matrix
+parse_matrix(int& argc, char** argv)
+{
+  matrix m;
+  int j = 1;
+
+  for (int i = 1; i < argc; i++) {
+    const std::string arg(argv[i]);
+
+    if (arg.starts_with("--lens=")) {
+      m.lens = parse_lens(arg.substr(7));
+    } else if (arg.starts_with("--ad_len=")) {
+      m.ad_len = parse_len(arg.substr(9));
+    } else if (arg.starts_with("--tiny_max=")) {
+      m.tiny_max = parse_len(arg.substr(11));
+    } else if (arg.starts_with("--large=")) {
+      m.large = parse_lens(arg.substr(8));
+    } else {
+      argv[j++] = argv[i];
+    }
+  }
+
+  argc = j;
+  return m;
+}
+
+// Registers Photon-Beetle-AEAD[32, 128] encrypt/ decrypt routines for
+// benchmarking, with given associated data & message lengths
+template<const size_t R>
+static void
+register_aead(const int64_t dlen, const int64_t mlen)
+{
+  using namespace bench_photon_beetle;
+
+  const std::string rate = std::to_string(R);
+  const std::string enc = "bench_photon_beetle::aead_encrypt<" + rate + ">";
+  const std::string dec = "bench_photon_beetle::aead_decrypt<" + rate + ">";
+
+  benchmark::RegisterBenchmark(enc.c_str(), aead_encrypt<R>)
+    ->Args({ dlen, mlen });
+  benchmark::RegisterBenchmark(dec.c_str(), aead_decrypt<R>)
+    ->Args({ dlen, mlen });
+}
+
+// Registers Photon-Beetle-{Hash, AEAD} benchmark matrix
+static void
+register_matrix(const matrix& m)
+{
+  using namespace bench_photon_beetle;
+
+  constexpr const char* hash_name = "bench_photon_beetle::hash";
+
+  // every message length in [0, N], to expose partial block paths
+  for (int64_t mlen = 0; mlen <= m.tiny_max; mlen++) {
+    benchmark::RegisterBenchmark(hash_name, hash)->Arg(mlen);
+  }
+  for (int64_t mlen = 0; mlen <= m.tiny_max; mlen++) {
+    register_aead<4>(m.ad_len, mlen);
+    register_aead<16>(m.ad_len, mlen);
+  }
+
+  // empty associated data & empty message, which is a special case
+  register_aead<4>(0, 0);
+  register_aead<16>(0, 0);
+
+  // message with associated data, message-only & associated data-only
+  for (const int64_t len : m.lens) {
+    benchmark::RegisterBenchmark(hash_name, hash)->Arg(len);
+  }
+  for (const int64_t len : m.lens) {
+    register_aead<4>(m.ad_len, len);
+    register_aead<16>(m.ad_len, len);
+  }
+  for (const int64_t len : m.lens) {
+    register_aead<4>(0, len);
+    register_aead<16>(0, len);
+  }
+  for (const int64_t len : m.lens) {
+    register_aead<4>(len, 0);
+    register_aead<16>(len, 0);
+  }
+
+  // inputs exceeding last level cache, compared against memcpy bandwidth
+  for (const int64_t len : m.large) {
+    const auto unit = benchmark::kMillisecond;
+
+    benchmark::RegisterBenchmark("bench_photon_beetle::memcpy_baseline",
+                                 memcpy_baseline)
+      ->Arg(len)
+      ->Unit(unit);
+    benchmark::RegisterBenchmark(hash_name, hash)->Arg(len)->Unit(unit);
+    benchmark::RegisterBenchmark("bench_photon_beetle::aead_encrypt<4>",
+                                 aead_encrypt<4>)
+      ->Args({ 0, len })
+      ->Unit(unit);
+    benchmark::RegisterBenchmark("bench_photon_beetle::aead_encrypt<16>",
+                                 aead_encrypt<16>)
+      ->Args({ 0, len })
+      ->Unit(unit);
+  }
+}
 
 // registering Photon256 permutation routine for benchmarking
 BENCHMARK(bench_photon_beetle::permute);
+BENCHMARK(bench_photon_beetle::permute_lanes<false>)->Arg(2)->Arg(4);
+BENCHMARK(bench_photon_beetle::permute_lanes<true>)->Arg(2)->Arg(4);
+
+// registering Photon256 based XOF for benchmarking, against random number
+// generator based baseline, for 16, 256 & 4096 -bytes outputs
+BENCHMARK(bench_photon_beetle::xof_fill)
+  ->RangeMultiplier(16)
+  ->Range(16, bench_photon_beetle::XOF_BENCH_MAX_LEN);
+BENCHMARK(bench_photon_beetle::random_data_baseline)
+  ->RangeMultiplier(16)
+  ->Range(16, bench_photon_beetle::XOF_BENCH_MAX_LEN);
+
+// registering nonce allocation routine(s) for benchmarking, on 1..N threads
+BENCHMARK(bench_photon_beetle::nonce_sequencer)
+  ->Arg(256)
+  ->ThreadRange(1, std::max(1u, std::thread::hardware_concurrency()))
+  ->UseRealTime();
+BENCHMARK(bench_photon_beetle::nonce_mutex)
+  ->ThreadRange(1, std::max(1u, std::thread::hardware_concurrency()))
+  ->UseRealTime();
+
+// registering bulk engine for benchmarking, on 1..N worker threads
+BENCHMARK(bench_photon_beetle::engine_hash)
+  ->RangeMultiplier(2)
+  ->Range(1, std::max(1u, std::thread::hardware_concurrency()))
+  ->UseRealTime();
+BENCHMARK(bench_photon_beetle::engine_encrypt<4>)
+  ->RangeMultiplier(2)
+  ->Range(1, std::max(1u, std::thread::hardware_concurrency()))
+  ->UseRealTime();
+BENCHMARK(bench_photon_beetle::engine_encrypt<16>)
+  ->RangeMultiplier(2)
+  ->Range(1, std::max(1u, std::thread::hardware_concurrency()))
+  ->UseRealTime();
+
+// registering multi-threaded throughput scaling benchmarks, on 1..N threads,
+// each working on independent buffers, with outputs either isolated in their
+// own cache lines or packed into shared cache lines
+BENCHMARK(bench_photon_beetle::scaling_hash)
+  ->ArgsProduct({ { 64, 4096 }, { 1, 0 } })
+  ->ThreadRange(1, std::max(1u, std::thread::hardware_concurrency()))
+  ->UseRealTime();
+BENCHMARK(bench_photon_beetle::scaling_encrypt<4>)
+  ->ArgsProduct({ { 64, 4096 }, { 1, 0 } })
+  ->ThreadRange(1, std::max(1u, std::thread::hardware_concurrency()))
+  ->UseRealTime();
+BENCHMARK(bench_photon_beetle::scaling_encrypt<16>)
+  ->ArgsProduct({ { 64, 4096 }, { 1, 0 } })
+  ->ThreadRange(1, std::max(1u, std::thread::hardware_concurrency()))
+  ->UseRealTime();
+
+// registering streaming pipeline stage for benchmarking, with varying packet
+// length and burst size
+BENCHMARK(bench_photon_beetle::pipeline_seal<4>)
+  ->ArgsProduct({ { 64, 1024 }, { 1, 8, 32 } })
+  ->UseRealTime();
+BENCHMARK(bench_photon_beetle::pipeline_seal<16>)
+  ->ArgsProduct({ { 64, 1024 }, { 1, 8, 32 } })
+  ->UseRealTime();
+
+// registering sequential vs. coroutine interleaved batch processing of
+// independent messages for benchmarking, with varying number of in-flight
+// operations
+BENCHMARK(bench_photon_beetle::batch_hash)->Arg(64)->Arg(1024);
+BENCHMARK(bench_photon_beetle::coro_hash)
+  ->ArgsProduct({ { 64, 1024 }, { 1, 2, 4, 8 } });
+BENCHMARK(bench_photon_beetle::batch_encrypt<4>)->Arg(64)->Arg(1024);
+BENCHMARK(bench_photon_beetle::coro_encrypt<4>)
+  ->ArgsProduct({ { 64, 1024 }, { 1, 2, 4, 8 } });
+BENCHMARK(bench_photon_beetle::batch_encrypt<16>)->Arg(64)->Arg(1024);
+BENCHMARK(bench_photon_beetle::coro_encrypt<16>)
+  ->ArgsProduct({ { 64, 1024 }, { 1, 2, 4, 8 } });
+
+// registering Merkle tree appends for benchmarking, one by one vs. batched
+BENCHMARK(bench_photon_beetle::merkle_append)
+  ->ArgsProduct({ { 64, 1024 }, { 0, 1, 8 } });
 
-// registering Photon-Beetle-Hash function for benchmarking
-BENCHMARK(bench_photon_beetle::hash)->Arg(64);
-BENCHMARK(bench_photon_beetle::hash)->Arg(128);
-BENCHMARK(bench_photon_beetle::hash)->Arg(256);
-BENCHMARK(bench_photon_beetle::hash)->Arg(512);
-BENCHMARK(bench_photon_beetle::hash)->Arg(1024);
-BENCHMARK(bench_photon_beetle::hash)->Arg(2048);
-BENCHMARK(bench_photon_beetle::hash)->Arg(4096);
-
-// registering Photon-Beetle-AEAD[32] function(s) for benchmarking
-BENCHMARK(bench_photon_beetle::aead_encrypt<4>)->Args({ 32, 64 });
-BENCHMARK(bench_photon_beetle::aead_decrypt<4>)->Args({ 32, 64 });
-BENCHMARK(bench_photon_beetle::aead_encrypt<4>)->Args({ 32, 128 });
-BENCHMARK(bench_photon_beetle::aead_decrypt<4>)->Args({ 32, 128 });
-BENCHMARK(bench_photon_beetle::aead_encrypt<4>)->Args({ 32, 256 });
-BENCHMARK(bench_photon_beetle::aead_decrypt<4>)->Args({ 32, 256 });
-BENCHMARK(bench_photon_beetle::aead_encrypt<4>)->Args({ 32, 512 });
-BENCHMARK(bench_photon_beetle::aead_decrypt<4>)->Args({ 32, 512 });
-BENCHMARK(bench_photon_beetle::aead_encrypt<4>)->Args({ 32, 1024 });
-BENCHMARK(bench_photon_beetle::aead_decrypt<4>)->Args({ 32, 1024 });
-BENCHMARK(bench_photon_beetle::aead_encrypt<4>)->Args({ 32, 2048 });
-BENCHMARK(bench_photon_beetle::aead_decrypt<4>)->Args({ 32, 2048 });
-BENCHMARK(bench_photon_beetle::aead_encrypt<4>)->Args({ 32, 4096 });
-BENCHMARK(bench_photon_beetle::aead_decrypt<4>)->Args({ 32, 4096 });
-
-// registering Photon-Beetle-AEAD[128] function(s) for benchmarking
-BENCHMARK(bench_photon_beetle::aead_encrypt<16>)->Args({ 32, 64 });
-BENCHMARK(bench_photon_beetle::aead_decrypt<16>)->Args({ 32, 64 });
-BENCHMARK(bench_photon_beetle::aead_encrypt<16>)->Args({ 32, 128 });
-BENCHMARK(bench_photon_beetle::aead_decrypt<16>)->Args({ 32, 128 });
-BENCHMARK(bench_photon_beetle::aead_encrypt<16>)->Args({ 32, 256 });
-BENCHMARK(bench_photon_beetle::aead_decrypt<16>)->Args({ 32, 256 });
-BENCHMARK(bench_photon_beetle::aead_encrypt<16>)->Args({ 32, 512 });
-BENCHMARK(bench_photon_beetle::aead_decrypt<16>)->Args({ 32, 512 });
-BENCHMARK(bench_photon_beetle::aead_encrypt<16>)->Args({ 32, 1024 });
-BENCHMARK(bench_photon_beetle::aead_decrypt<16>)->Args({ 32, 1024 });
-BENCHMARK(bench_photon_beetle::aead_encrypt<16>)->Args({ 32, 2048 });
-BENCHMARK(bench_photon_beetle::aead_decrypt<16>)->Args({ 32, 2048 });
-BENCHMARK(bench_photon_beetle::aead_encrypt<16>)->Args({ 32, 4096 });
-BENCHMARK(bench_photon_beetle::aead_decrypt<16>)->Args({ 32, 4096 });
+// registering cache pollution caused by encrypting large payload, with regular
+// vs. non-temporal stores, for benchmarking, as seen by a co-running workload
+// walking its L2 resident working set
+BENCHMARK(bench_photon_beetle::bulk_pollution<false>)
+  ->Args({ 512 << 10, 256 << 10 })
+  ->Args({ 2 << 20, 1 << 20 })
+  ->Iterations(8)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_photon_beetle::bulk_pollution<true>)
+  ->Args({ 512 << 10, 256 << 10 })
+  ->Args({ 2 << 20, 1 << 20 })
+  ->Iterations(8)
+  ->Unit(benchmark::kMillisecond);
+
+// registering random reads out of a large, seekable encrypted container, with
+// varying block & read lengths, for benchmarking
+BENCHMARK(bench_photon_beetle::container_read)
+  ->ArgsProduct({ { 64 << 20 }, { 4 << 10, 64 << 10 }, { 64, 4 << 10 } })
+  ->Unit(benchmark::kMicrosecond);
+
+// CPU model name, as found in /proc/cpuinfo, or empty string, if unknown
+static std::string
+cpu_model()
+{
+  std::ifstream in("/proc/cpuinfo");
+  std::string line;
+
+  while (std::getline(in, line)) {
+    if (line.starts_with("model name")) {
+      const size_t beg = line.find_first_not_of(" \t", line.find(':') + 1);
+      return beg == std::string::npos ? std::string{} : line.substr(beg);
+    }
+  }
+
+  return {};
+}
+
+// Tags benchmark results with CPU model, compiler & permutation backend, so
+// that JSON baselines ( see scripts/bench_compare.py ) carry enough context to
+// tell whether two of them are comparable at all
+static void
+add_context()
+{
+  using namespace photon_utils;
+
+  benchmark::AddCustomContext("cpu_model", cpu_model());
+  benchmark::AddCustomContext("compiler", compiler_name());
+  benchmark::AddCustomContext("photon_backend", photon_backend());
+}
 
 // main function to drive execution of benchmark
-BENCHMARK_MAIN();
+int
+main(int argc, char** argv)
+{
+  const matrix m = parse_matrix(argc, argv);
+  register_matrix(m);
+  add_context();
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return EXIT_FAILURE;
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  return EXIT_SUCCESS;
+}
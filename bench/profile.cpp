@@ -0,0 +1,59 @@
+#include "hash.hpp"
+#include <cstdio>
+#include <cstdlib>
+
+// Prints per-stage & per-round breakdown of cycles spent in Photon256
+// permutation, first when permutation is applied back to back on a single
+// state & then when it's invoked from Photon-Beetle-Hash.
+//
+// Must be compiled with `PHOTON_PROFILE` defined, which Makefile target does
+//
+// make bench/profile.out
+//
+// And run it as
+//
+// ./bench/profile.out [N ( = 100000 ) permutation calls]
+
+static_assert(photon_profile::ENABLED, "compile with -DPHOTON_PROFILE");
+
+int
+main(int argc, char** argv)
+{
+  const size_t calls = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+
+  // warm up caches & branch predictors, then discard what's recorded
+  uint8_t state[32];
+  photon_utils::random_data(state, sizeof(state));
+
+  for (size_t i = 0; i < 1000; i++) {
+    photon::photon256(state);
+  }
+  photon_profile::local().reset();
+
+  for (size_t i = 0; i < calls; i++) {
+    photon::photon256(state);
+  }
+
+  std::printf("## photon256, back to back\n\n");
+  photon_profile::report(stdout);
+  photon_profile::local().reset();
+
+  // Photon-Beetle-Hash over 4 KiB messages invokes permutation once per 16
+  // -bytes, interleaving it with absorption
+  constexpr size_t MLEN = 4096;
+
+  uint8_t msg[MLEN];
+  uint8_t digest[photon_beetle::DIGEST_LEN];
+  photon_utils::random_data(msg, sizeof(msg));
+
+  const size_t msgs = std::max<size_t>(1, calls / (MLEN / 16));
+  for (size_t i = 0; i < msgs; i++) {
+    photon_beetle::hash(msg, sizeof(msg), digest);
+  }
+
+  std::printf("\n## photon256, invoked from hash ( %zu -bytes message )\n\n",
+              MLEN);
+  photon_profile::report(stdout);
+
+  return EXIT_SUCCESS;
+}
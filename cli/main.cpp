@@ -0,0 +1,450 @@
+#include "engine.hpp"
+#include "mmap.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <getopt.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Command line utility for hashing files/ directory trees using
+// Photon-Beetle-Hash & encrypting/ decrypting files using
+// Photon-Beetle-AEAD[32, 128].
+//
+// Inputs are memory mapped ( with sequential access hint ) instead of being
+// read into heap allocated buffers, while encryption/ decryption writes output
+// directly into memory mapped output file. Multiple files are processed
+// concurrently on bulk engine's worker threads.
+//
+// Encrypted file layout is 16 -bytes nonce || cipher text || 16 -bytes tag.
+//
+// Output is written into a temporary file, next to its destination, which is
+// renamed to destination only after encryption/ decryption ( including tag
+// verification ) succeeds, so a failed run never leaves a partial or
+// unauthenticated output behind. Existing files are never overwritten, unless
+// asked to, using -f.
+//
+// Compile it with
+//
+// make cli/a.out
+
+// Suffix appended to encrypted file's name
+constexpr const char* SUFFIX = ".pb";
+
+// Files are mapped & submitted in chunks, so that number of simultaneously
+// live mappings stays bounded, even when hashing huge directory trees
+constexpr size_t CHUNK_LEN = 1024;
+
+enum class command
+{
+  hash,
+  encrypt,
+  decrypt
+};
+
+// A single file being processed, along with its mapping(s) & output buffers
+struct item
+{
+  std::string src_path;
+  std::string dst_path;
+  std::string tmp_path;
+  photon_utils::mapped_file src;
+  photon_utils::mapped_file dst;
+  uint8_t digest[photon_beetle::DIGEST_LEN]{};
+};
+
+static void
+usage(const char* const prog)
+{
+  std::fprintf(
+    stderr,
+    "Usage:\n"
+    "  %s hash    [-j N] PATH...\n"
+    "  %s encrypt [-j N] [-r 32|128] [-f] (-k HEX | -K FILE) FILE...\n"
+    "  %s decrypt [-j N] [-r 32|128] [-f] (-k HEX | -K FILE) FILE%s...\n\n"
+    "  -j N      number of worker threads ( default: all hardware threads )\n"
+    "  -r RATE   Photon-Beetle-AEAD rate in bits ( default: 128 )\n"
+    "  -k HEX    16 -bytes secret key, as 32 hex characters\n"
+    "  -K FILE   file holding 16 -bytes raw secret key\n"
+    "  -f        overwrite existing output files\n\n"
+    "Directories passed to `hash` are walked recursively. `encrypt` writes\n"
+    "FILE%s, while `decrypt` strips %s suffix.\n",
+    prog,
+    prog,
+    prog,
+    SUFFIX,
+    SUFFIX,
+    SUFFIX);
+}
+
+// Parses 32 hex characters into 16 -bytes secret key
+static bool
+parse_key_hex(const char* const hex, uint8_t* const key)
+{
+  if (std::strlen(hex) != 2 * photon_beetle::KEY_LEN) {
+    return false;
+  }
+
+  for (size_t i = 0; i < photon_beetle::KEY_LEN; i++) {
+    unsigned int v;
+    if (std::sscanf(hex + 2 * i, "%2x", &v) != 1) {
+      return false;
+    }
+    key[i] = static_cast<uint8_t>(v);
+  }
+
+  return true;
+}
+
+// Reads 16 -bytes raw secret key from given file
+static bool
+read_key_file(const char* const path, uint8_t* const key)
+{
+  photon_utils::mapped_file f;
+  if (!f.open(path) || f.size() != photon_beetle::KEY_LEN) {
+    return false;
+  }
+
+  std::memcpy(key, f.data(), photon_beetle::KEY_LEN);
+  return true;
+}
+
+// Expands given paths into list of regular files, walking directories
+// recursively, in sorted order
+static std::vector<std::string>
+collect(const std::vector<std::string>& paths)
+{
+  namespace fs = std::filesystem;
+
+  std::vector<std::string> files;
+  for (const auto& p : paths) {
+    std::error_code ec;
+
+    if (fs::is_directory(p, ec)) {
+      std::vector<std::string> sub;
+      for (const auto& e : fs::recursive_directory_iterator(p, ec)) {
+        if (e.is_regular_file(ec)) {
+          sub.push_back(e.path().string());
+        }
+      }
+
+      std::sort(sub.begin(), sub.end());
+      files.insert(files.end(), sub.begin(), sub.end());
+    } else {
+      files.push_back(p);
+    }
+  }
+
+  return files;
+}
+
+// Fills given buffer with random bytes, used for sampling nonces
+static void
+random_nonce(uint8_t* const nonce)
+{
+  std::random_device rd;
+
+  for (size_t i = 0; i < photon_beetle::NONCE_LEN; i += sizeof(uint32_t)) {
+    const uint32_t v = rd();
+    std::memcpy(nonce + i, &v, sizeof(v));
+  }
+}
+
+// Maps a fresh temporary file of N -bytes, next to destination of given item,
+// into which output is written. Returns false, after reporting error, if it
+// can't be created.
+static bool
+create_output(item& it, const size_t olen)
+{
+  it.tmp_path = it.dst_path + ".XXXXXX";
+
+  if (!it.dst.create_temp(it.tmp_path.data(), olen)) {
+    std::fprintf(stderr,
+                 "error: can't create temporary file for %s: %s\n",
+                 it.dst_path.c_str(),
+                 std::strerror(errno));
+    it.tmp_path.clear();
+    return false;
+  }
+
+  return true;
+}
+
+// Moves completed output of given item from its temporary file to destination,
+// carrying over permission bits of source file. Unless asked to overwrite, an
+// existing destination is left as it is, in which case ( or on any other
+// failure ) temporary file is removed & false is returned, after reporting
+// error.
+static bool
+commit_output(item& it, const bool force)
+{
+  it.dst.close();
+
+  struct stat st;
+  const bool ok =
+    stat(it.src_path.c_str(), &st) == 0 &&
+    chmod(it.tmp_path.c_str(), st.st_mode & 07777) == 0 &&
+    renameat2(AT_FDCWD,
+              it.tmp_path.c_str(),
+              AT_FDCWD,
+              it.dst_path.c_str(),
+              force ? 0 : RENAME_NOREPLACE) == 0;
+
+  if (!ok) {
+    std::fprintf(stderr,
+                 "error: can't write %s: %s\n",
+                 it.dst_path.c_str(),
+                 std::strerror(errno));
+    unlink(it.tmp_path.c_str());
+  }
+
+  return ok;
+}
+
+// Maps source ( & destination ) file of given item, preparing job which needs
+// to be executed on it. Returns false, after reporting error, if file can't be
+// mapped or has unexpected length.
+template<const size_t R>
+static bool
+prepare(const command cmd,
+        const uint8_t* const key,
+        item& it,
+        photon_beetle::job& j)
+{
+  using namespace photon_beetle;
+
+  if (!it.src.open(it.src_path.c_str())) {
+    std::fprintf(stderr,
+                 "error: can't map %s: %s\n",
+                 it.src_path.c_str(),
+                 std::strerror(errno));
+    return false;
+  }
+
+  const uint8_t* const in = it.src.data();
+  const size_t ilen = it.src.size();
+
+  switch (cmd) {
+    case command::hash:
+      j = job::hash(in, ilen, it.digest);
+      break;
+
+    case command::encrypt: {
+      const size_t olen = NONCE_LEN + ilen + TAG_LEN;
+      if (!create_output(it, olen)) {
+        return false;
+      }
+
+      uint8_t* const out = it.dst.data();
+      random_nonce(out);
+
+      uint8_t* const enc = out + NONCE_LEN;
+      uint8_t* const tag = enc + ilen;
+      j = job::encrypt<R>(key, out, nullptr, 0, in, enc, ilen, tag);
+      break;
+    }
+
+    case command::decrypt: {
+      if (ilen < NONCE_LEN + TAG_LEN) {
+        std::fprintf(
+          stderr, "error: %s is too short\n", it.src_path.c_str());
+        return false;
+      }
+
+      const size_t olen = ilen - NONCE_LEN - TAG_LEN;
+      if (!create_output(it, olen)) {
+        return false;
+      }
+
+      const uint8_t* const enc = in + NONCE_LEN;
+      const uint8_t* const tag = enc + olen;
+      j = job::decrypt<R>(key, in, tag, nullptr, 0, enc, it.dst.data(), olen);
+      break;
+    }
+  }
+
+  return true;
+}
+
+int
+main(int argc, char** argv)
+{
+  if (argc < 2) {
+    usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  command cmd;
+  if (std::strcmp(argv[1], "hash") == 0) {
+    cmd = command::hash;
+  } else if (std::strcmp(argv[1], "encrypt") == 0) {
+    cmd = command::encrypt;
+  } else if (std::strcmp(argv[1], "decrypt") == 0) {
+    cmd = command::decrypt;
+  } else {
+    usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  size_t threads = std::max(1u, std::thread::hardware_concurrency());
+  size_t rate = 128;
+  bool has_key = false;
+  bool force = false;
+  uint8_t key[photon_beetle::KEY_LEN]{};
+
+  optind = 2;
+  int opt;
+  while ((opt = getopt(argc, argv, "j:r:k:K:fh")) != -1) {
+    switch (opt) {
+      case 'j':
+        threads = std::max(1ul, std::strtoul(optarg, nullptr, 10));
+        break;
+      case 'r':
+        rate = std::strtoul(optarg, nullptr, 10);
+        break;
+      case 'k':
+        if (!parse_key_hex(optarg, key)) {
+          std::fprintf(stderr, "error: key must be 32 hex characters\n");
+          return EXIT_FAILURE;
+        }
+        has_key = true;
+        break;
+      case 'K':
+        if (!read_key_file(optarg, key)) {
+          std::fprintf(stderr, "error: can't read 16 -bytes key file\n");
+          return EXIT_FAILURE;
+        }
+        has_key = true;
+        break;
+      case 'f':
+        force = true;
+        break;
+      default:
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+  }
+
+  if (cmd != command::hash && !has_key) {
+    std::fprintf(stderr, "error: secret key is required\n");
+    return EXIT_FAILURE;
+  }
+  if (rate != 32 && rate != 128) {
+    std::fprintf(stderr, "error: rate must be either 32 or 128\n");
+    return EXIT_FAILURE;
+  }
+  if (optind >= argc) {
+    usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  const std::vector<std::string> paths(argv + optind, argv + argc);
+  const auto files = cmd == command::hash ? collect(paths) : paths;
+
+  photon_beetle::engine eng{ threads };
+
+  int status = EXIT_SUCCESS;
+  size_t total = 0;
+  const auto t0 = std::chrono::steady_clock::now();
+
+  for (size_t beg = 0; beg < files.size(); beg += CHUNK_LEN) {
+    const size_t end = std::min(files.size(), beg + CHUNK_LEN);
+    const size_t cnt = end - beg;
+
+    std::vector<item> items(cnt);
+    std::vector<photon_beetle::job> jobs;
+    std::vector<size_t> idx;
+    jobs.reserve(cnt);
+    idx.reserve(cnt);
+
+    for (size_t i = 0; i < cnt; i++) {
+      auto& it = items[i];
+      it.src_path = files[beg + i];
+
+      if (cmd == command::encrypt) {
+        it.dst_path = it.src_path + SUFFIX;
+      } else if (cmd == command::decrypt) {
+        const size_t slen = std::strlen(SUFFIX);
+        const bool suffixed = it.src_path.size() > slen &&
+                              it.src_path.ends_with(SUFFIX);
+
+        if (!suffixed) {
+          std::fprintf(stderr,
+                       "error: %s doesn't end with %s\n",
+                       it.src_path.c_str(),
+                       SUFFIX);
+          status = EXIT_FAILURE;
+          continue;
+        }
+        it.dst_path = it.src_path.substr(0, it.src_path.size() - slen);
+      }
+
+      // checked early, to skip needless work; rename still won't replace a
+      // destination which shows up meanwhile
+      if (cmd != command::hash && !force &&
+          access(it.dst_path.c_str(), F_OK) == 0) {
+        std::fprintf(stderr,
+                     "error: %s already exists, use -f to overwrite\n",
+                     it.dst_path.c_str());
+        status = EXIT_FAILURE;
+        continue;
+      }
+
+      photon_beetle::job j;
+      const bool ok = rate == 32 ? prepare<4>(cmd, key, it, j)
+                                 : prepare<16>(cmd, key, it, j);
+      if (!ok) {
+        status = EXIT_FAILURE;
+        continue;
+      }
+
+      total += it.src.size();
+      jobs.push_back(j);
+      idx.push_back(i);
+    }
+
+    std::unique_ptr<bool[]> flags(new bool[jobs.size()]);
+    eng.submit(jobs, std::span<bool>(flags.get(), jobs.size()));
+    eng.wait();
+
+    for (size_t k = 0; k < idx.size(); k++) {
+      auto& it = items[idx[k]];
+
+      if (cmd == command::hash) {
+        const auto hex = photon_utils::to_hex(it.digest, sizeof(it.digest));
+        std::printf("%s  %s\n", hex.c_str(), it.src_path.c_str());
+      } else if (!flags[k]) {
+        std::fprintf(stderr,
+                     "error: %s failed authentication\n",
+                     it.src_path.c_str());
+
+        it.dst.close();
+        unlink(it.tmp_path.c_str());
+        status = EXIT_FAILURE;
+      } else if (!commit_output(it, force)) {
+        status = EXIT_FAILURE;
+      }
+    }
+  }
+
+  const auto t1 = std::chrono::steady_clock::now();
+  const double secs = std::chrono::duration<double>(t1 - t0).count();
+  const double mbps = secs > 0 ? (static_cast<double>(total) / 1e6) / secs : 0;
+
+  std::fprintf(stderr,
+               "%zu file(s), %.2f MB in %.3f s ( %.2f MB/s )\n",
+               files.size(),
+               static_cast<double>(total) / 1e6,
+               secs,
+               mbps);
+
+  return status;
+}
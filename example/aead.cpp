@@ -1,4 +1,5 @@
 #include "photon_beetle.hpp"
+#include "xof.hpp"
 #include <cassert>
 #include <iostream>
 
@@ -27,11 +28,15 @@ main()
   uint8_t* enc = static_cast<uint8_t*>(std::malloc(mlen));
   uint8_t* dec = static_cast<uint8_t*>(std::malloc(mlen));
 
-  // generate random inputs i.e. key, nonce, associated data and text
-  photon_utils::random_data(key, photon_beetle::KEY_LEN);
-  photon_utils::random_data(nonce, photon_beetle::NONCE_LEN);
-  photon_utils::random_data(dat, dlen);
-  photon_utils::random_data(txt, mlen);
+  // generate inputs i.e. key, nonce, associated data and text, squeezed out
+  // of Photon256 based XOF, so that they're same on every run
+  //
+  // Note, real keys & nonces must never come from a fixed seed !
+  photon_xof::xof gen{ 42 };
+  gen.fill({ key, photon_beetle::KEY_LEN });
+  gen.fill({ nonce, photon_beetle::NONCE_LEN });
+  gen.fill({ dat, dlen });
+  gen.fill({ txt, mlen });
 
   // clean to be written memory allocations
   std::memset(tag, 0, photon_beetle::TAG_LEN);
@@ -1,4 +1,5 @@
 #include "photon_beetle.hpp"
+#include "xof.hpp"
 #include <iostream>
 
 // Compile it with
@@ -14,8 +15,9 @@ main()
   uint8_t* msg = static_cast<uint8_t*>(std::malloc(mlen));
   uint8_t* dig = static_cast<uint8_t*>(std::malloc(dlen));
 
-  photon_utils::random_data(msg, mlen); // generate random message bytes
-  std::memset(dig, 0, dlen);            // set digest to zero bytes
+  photon_xof::xof gen{ 42 }; // reproducible pseudo-random byte stream
+  gen.fill({ msg, mlen });   // generate message bytes
+  std::memset(dig, 0, dlen); // set digest to zero bytes
 
   // compute Photon-Beetle hash
   photon_beetle::hash(msg, mlen, dig);
@@ -1,5 +1,6 @@
 #pragma once
 #include "common.hpp"
+#include "probes.hpp"
 #include <cstring>
 
 // Photon-Beetle-{Hash, AEAD} function(s)
@@ -60,6 +61,9 @@ verify_tag(const uint8_t* const __restrict expected, // 16 -bytes
 //
 // RATE is in terms of bytes, allowed values are {4, 16}.
 //
+// Plain text and cipher text may live in same buffer ( in-place encryption ),
+// but they must not partially overlap.
+//
 // Note, avoid reusing same nonce under same secret key !
 //
 // See algorithm `PHOTON-Beetle-AEAD.ENC[r](K, N, A, M)` defined in figure 3.6
@@ -72,13 +76,18 @@ encrypt(
   const uint8_t* const __restrict nonce, // 16 -bytes public message nonce
   const uint8_t* const __restrict data,  // N -bytes associated data | N >= 0
   const size_t dlen,                     // len(data) >= 0
-  const uint8_t* const __restrict txt,   // N -bytes plain text | N >= 0
-  uint8_t* const __restrict enc,         // N -bytes cipher text | N >= 0
+  const uint8_t* const txt,              // N -bytes plain text | N >= 0
+  uint8_t* const enc,                    // N -bytes cipher text | N >= 0
   const size_t mlen,                     // len(txt) = len(enc) >= 0
   uint8_t* const __restrict tag          // 16 -bytes authentication tag
   )
   requires(photon_common::check_rate(RATE))
 {
+  PHOTON_PROBE(encrypt_entry, RATE, dlen, mlen);
+
+  [[maybe_unused]] const photon_stats::scope timed;
+  photon_stats::add(photon_stats::BYTES_SEALED, dlen + mlen);
+
   uint8_t state[32];
 
   std::memcpy(state, nonce, NONCE_LEN);
@@ -88,16 +97,11 @@ encrypt(
     state[31] ^= (1 << 5);
     photon_common::gen_tag<TAG_LEN>(state, tag);
 
+    PHOTON_PROBE(encrypt_return, RATE, dlen, mlen);
     return;
   }
 
-  const bool f0 = mlen > 0;
-  const bool f1 = (dlen & (RATE - 1)) == 0;
-  const bool f2 = dlen > 0;
-  const bool f3 = (mlen & (RATE - 1)) == 0;
-
-  const uint8_t C0 = (f0 && f1) ? 1 : f0 ? 2 : f1 ? 3 : 4;
-  const uint8_t C1 = (f2 && f3) ? 1 : f2 ? 2 : f3 ? 5 : 6;
+  const auto [C0, C1] = photon_common::aead_constants<RATE>(dlen, mlen);
 
   if (dlen > 0) [[likely]] {
     photon_common::absorb<RATE>(state, data, dlen, C0);
@@ -115,6 +119,8 @@ encrypt(
   }
 
   photon_common::gen_tag<TAG_LEN>(state, tag);
+
+  PHOTON_PROBE(encrypt_return, RATE, dlen, mlen);
 }
 
 // Given 16 -bytes secret key, 16 -bytes public message nonce, 16 -bytes
@@ -124,6 +130,9 @@ encrypt(
 //
 // RATE is in terms of bytes, allowed values are {4, 16}.
 //
+// Cipher text and plain text may live in same buffer ( in-place decryption ),
+// but they must not partially overlap.
+//
 // Note, before consuming decrypted bytes ensure presence of truth value in
 // returned boolean flag !
 //
@@ -138,12 +147,17 @@ decrypt(
   const uint8_t* const __restrict tag,   // 16 -bytes authentication tag
   const uint8_t* const __restrict data,  // N -bytes associated data | N >= 0
   const size_t dlen,                     // len(data) >= 0
-  const uint8_t* const __restrict enc,   // N -bytes cipher text | N >= 0
-  uint8_t* const __restrict txt,         // N -bytes decrypted text | N >= 0
+  const uint8_t* const enc,              // N -bytes cipher text | N >= 0
+  uint8_t* const txt,                    // N -bytes decrypted text | N >= 0
   const size_t mlen                      // len(enc) = len(txt) >= 0
   )
   requires(photon_common::check_rate(RATE))
 {
+  PHOTON_PROBE(decrypt_entry, RATE, dlen, mlen);
+
+  [[maybe_unused]] const photon_stats::scope timed;
+  photon_stats::add(photon_stats::BYTES_OPENED, dlen + mlen);
+
   uint8_t state[32];
   uint8_t tag_[TAG_LEN];
 
@@ -154,16 +168,14 @@ decrypt(
     state[31] ^= (1 << 5);
     photon_common::gen_tag<TAG_LEN>(state, tag_);
 
-    return verify_tag(tag, tag_);
-  }
+    const auto flg = verify_tag(tag, tag_);
+    photon_stats::add(photon_stats::TAG_FAILURES, !flg);
 
-  const bool f0 = mlen > 0;
-  const bool f1 = (dlen & (RATE - 1)) == 0;
-  const bool f2 = dlen > 0;
-  const bool f3 = (mlen & (RATE - 1)) == 0;
+    PHOTON_PROBE(decrypt_return, RATE, dlen, mlen, flg);
+    return flg;
+  }
 
-  const uint8_t C0 = (f0 && f1) ? 1 : f0 ? 2 : f1 ? 3 : 4;
-  const uint8_t C1 = (f2 && f3) ? 1 : f2 ? 2 : f3 ? 5 : 6;
+  const auto [C0, C1] = photon_common::aead_constants<RATE>(dlen, mlen);
 
   if (dlen > 0) [[likely]] {
     photon_common::absorb<RATE>(state, data, dlen, C0);
@@ -183,7 +195,9 @@ decrypt(
   photon_common::gen_tag<TAG_LEN>(state, tag_);
   const auto flg = verify_tag(tag, tag_);
   std::memset(txt, 0, !flg * mlen);
+  photon_stats::add(photon_stats::TAG_FAILURES, !flg);
 
+  PHOTON_PROBE(decrypt_return, RATE, dlen, mlen, flg);
   return flg;
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "aead.hpp"
+#include "perf_counters.hpp"
 #include <benchmark/benchmark.h>
 #include <cassert>
 
@@ -7,7 +8,8 @@
 namespace bench_photon_beetle {
 
 // Benchmarks Photon-Beetle-AEAD[32, 128] instance's encrypt routine on CPU
-// based systems
+// based systems, reporting cycles/ byte & hardware event counters, when
+// available
 template<const size_t R>
 void
 aead_encrypt(benchmark::State& state)
@@ -28,6 +30,9 @@ aead_encrypt(benchmark::State& state)
   photon_utils::random_data(data, dlen);
   photon_utils::random_data(txt, mlen);
 
+  perf_counters counters;
+  counters.start();
+
   for (auto _ : state) {
     photon_beetle::encrypt<R>(key, nonce, data, dlen, txt, enc, mlen, tag);
 
@@ -40,6 +45,8 @@ aead_encrypt(benchmark::State& state)
     benchmark::ClobberMemory();
   }
 
+  counters.stop();
+
   // --- test correctness ---
   bool f0 = false;
   f0 = photon_beetle::decrypt<R>(key, nonce, tag, data, dlen, enc, dec, mlen);
@@ -56,6 +63,7 @@ aead_encrypt(benchmark::State& state)
 
   const size_t per_itr = mlen + dlen;
   state.SetBytesProcessed(static_cast<int64_t>(per_itr * state.iterations()));
+  counters.report(state, per_itr);
 
   std::free(key);
   std::free(nonce);
@@ -67,7 +75,8 @@ aead_encrypt(benchmark::State& state)
 }
 
 // Benchmarks Photon-Beetle-AEAD[32, 128] instance's decrypt routine on CPU
-// based systems
+// based systems, reporting cycles/ byte & hardware event counters, when
+// available
 template<const size_t R>
 void
 aead_decrypt(benchmark::State& state)
@@ -90,6 +99,9 @@ aead_decrypt(benchmark::State& state)
 
   photon_beetle::encrypt<R>(key, nonce, data, dlen, txt, enc, mlen, tag);
 
+  perf_counters counters;
+  counters.start();
+
   for (auto _ : state) {
     bool f0 = false;
     f0 = photon_beetle::decrypt<R>(key, nonce, tag, data, dlen, enc, dec, mlen);
@@ -104,6 +116,8 @@ aead_decrypt(benchmark::State& state)
     benchmark::ClobberMemory();
   }
 
+  counters.stop();
+
   // --- test correctness ---
   bool f = false;
   for (size_t i = 0; i < mlen; i++) {
@@ -115,6 +129,7 @@ aead_decrypt(benchmark::State& state)
 
   const size_t per_itr = mlen + dlen;
   state.SetBytesProcessed(static_cast<int64_t>(per_itr * state.iterations()));
+  counters.report(state, per_itr);
 
   std::free(key);
   std::free(nonce);
@@ -0,0 +1,102 @@
+#pragma once
+#include "bulk.hpp"
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <numeric>
+#include <random>
+#include <vector>
+
+// Benchmark Photon-Beetle-{Hash, AEAD} routines
+namespace bench_photon_beetle {
+
+// Cache line sized node of a randomly shuffled cyclic linked list, chased by
+// cache-sensitive probe
+struct alignas(photon_utils::CACHE_LINE_LEN) probe_node
+{
+  probe_node* next;
+};
+
+// Links given nodes into a single cycle, visiting them in random order, so
+// that hardware prefetcher can't guess next node
+inline static probe_node*
+link_cycle(std::vector<probe_node>& nodes)
+{
+  std::vector<size_t> order(nodes.size());
+  std::iota(order.begin(), order.end(), 0ul);
+  std::shuffle(order.begin(), order.end(), std::mt19937_64{ 42 });
+
+  for (size_t i = 0; i < order.size(); i++) {
+    nodes[order[i]].next = &nodes[order[(i + 1) % order.size()]];
+  }
+
+  return &nodes[order[0]];
+}
+
+// Chases given cycle once, returning node it stops at
+inline static probe_node*
+chase(probe_node* node, const size_t cnt)
+{
+  for (size_t i = 0; i < cnt; i++) {
+    node = node->next;
+  }
+
+  return node;
+}
+
+// Measures how much Photon-Beetle-AEAD[128] encryption of M -bytes payload
+// pollutes cache, for a co-running cache-sensitive workload, which repeatedly
+// walks its working set of W -bytes ( arranged as a randomly linked list of
+// cache lines ), when payload is encrypted with regular stores ( `encrypt` ) or
+// with non-temporal stores ( `encrypt_bulk` ) | M, W are provided when setting
+// up benchmark.
+//
+// Each iteration warms up working set, encrypts payload and walks working set
+// again; average latency of that walk, per cache line, is reported as
+// `probe_ns`, which stays close to warm-cache latency, when encryption doesn't
+// evict working set.
+template<const bool bulk>
+void
+bulk_pollution(benchmark::State& state)
+{
+  const size_t mlen = static_cast<size_t>(state.range(0));
+  const size_t wlen = static_cast<size_t>(state.range(1));
+  const size_t cnt = wlen / sizeof(probe_node);
+
+  uint8_t key[16], nonce[16], tag[16];
+  std::vector<uint8_t> txt(mlen), enc(mlen);
+  std::vector<probe_node> nodes(cnt);
+
+  photon_utils::random_data(key, sizeof(key));
+  photon_utils::random_data(nonce, sizeof(nonce));
+  photon_utils::random_data(txt.data(), txt.size());
+
+  probe_node* node = link_cycle(nodes);
+  double probe_ns = 0.;
+
+  for (auto _ : state) {
+    node = chase(node, cnt);
+
+    if constexpr (bulk) {
+      photon_beetle::encrypt_bulk<16>(
+        key, nonce, nullptr, 0, txt.data(), enc.data(), mlen, tag, 0);
+    } else {
+      photon_beetle::encrypt<16>(
+        key, nonce, nullptr, 0, txt.data(), enc.data(), mlen, tag);
+    }
+    benchmark::DoNotOptimize(enc.data());
+    benchmark::ClobberMemory();
+
+    const auto t0 = std::chrono::steady_clock::now();
+    node = chase(node, cnt);
+    benchmark::DoNotOptimize(node);
+    const auto t1 = std::chrono::steady_clock::now();
+
+    probe_ns += std::chrono::duration<double, std::nano>(t1 - t0).count();
+  }
+
+  const auto itr = static_cast<double>(state.iterations());
+  state.counters["probe_ns"] = probe_ns / (itr * static_cast<double>(cnt));
+  state.SetBytesProcessed(static_cast<int64_t>(mlen * state.iterations()));
+}
+
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include "container.hpp"
+#include "mmap.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+// Benchmark Photon-Beetle-{Hash, AEAD} routines
+namespace bench_photon_beetle {
+
+// Benchmarks latency of reading R -bytes, from a random offset, out of
+// seekable container holding N -bytes plain text, split into B -bytes blocks,
+// which lives in a memory mapped file | N, B, R are provided when setting up
+// benchmark.
+//
+// Container file is sealed once, before timing, and stays in page cache, so
+// reported latency is what decrypting & verifying touched blocks costs, which
+// depends on B & R, but not on N.
+inline void
+container_read(benchmark::State& state)
+{
+  const size_t plen = static_cast<size_t>(state.range(0));
+  const size_t blen = static_cast<size_t>(state.range(1));
+  const size_t rlen = static_cast<size_t>(state.range(2));
+
+  uint8_t key[16], prefix[8];
+  photon_utils::random_data(key, sizeof(key));
+  photon_utils::random_data(prefix, sizeof(prefix));
+
+  const auto dir = std::filesystem::temp_directory_path();
+  std::string path = (dir / "photon-beetle-container-XXXXXX").string();
+
+  const int fd = mkstemp(path.data());
+  if (fd < 0) {
+    state.SkipWithError("failed to create temporary file");
+    return;
+  }
+  ::close(fd);
+
+  {
+    std::vector<uint8_t> txt(plen);
+    photon_utils::random_data(txt.data(), txt.size());
+
+    photon_utils::mapped_file out;
+    if (!out.create(path.c_str(), photon_beetle::container_len(plen, blen))) {
+      std::filesystem::remove(path);
+      state.SkipWithError("failed to map temporary file");
+      return;
+    }
+
+    if (!photon_beetle::container_seal<16>(
+          key, prefix, blen, txt.data(), plen, out.data())) {
+      std::filesystem::remove(path);
+      state.SkipWithError("failed to seal container");
+      return;
+    }
+  }
+
+  photon_utils::mapped_file in;
+  photon_beetle::container_reader rd;
+  if (!in.open(path.c_str()) || !rd.open(key, in.data(), in.size())) {
+    std::filesystem::remove(path);
+    state.SkipWithError("failed to open sealed container");
+    return;
+  }
+
+  std::vector<uint8_t> out(rlen);
+  std::mt19937_64 rng{ 42 };
+  size_t touched = 0;
+
+  for (auto _ : state) {
+    const uint64_t off = rng() % (plen - rlen + 1);
+    touched += (off + rlen - 1) / blen - off / blen + 1;
+
+    const bool flg = rd.read(off, out.data(), rlen);
+    benchmark::DoNotOptimize(flg);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  const auto itr = static_cast<double>(state.iterations());
+  state.counters["blocks"] = static_cast<double>(touched) / itr;
+  state.SetBytesProcessed(static_cast<int64_t>(rlen * state.iterations()));
+
+  std::filesystem::remove(path);
+}
+
+}
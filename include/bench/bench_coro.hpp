@@ -0,0 +1,178 @@
+#pragma once
+#include "coro.hpp"
+#include <benchmark/benchmark.h>
+#include <cassert>
+#include <vector>
+
+// Benchmark Photon-Beetle-{Hash, AEAD} routines
+namespace bench_photon_beetle {
+
+// Number of independent messages processed in every iteration of batch
+// benchmarks, where sequential calls are compared against interleaved ones
+constexpr size_t BATCH_LEN = 64;
+
+// Benchmarks Photon-Beetle-Hash, sequentially hashing a batch of independent
+// N -bytes messages, one after another | N is provided when setting up
+// benchmark
+inline void
+batch_hash(benchmark::State& state)
+{
+  const size_t mlen = static_cast<size_t>(state.range(0));
+
+  std::vector<uint8_t> msg(BATCH_LEN * mlen);
+  std::vector<uint8_t> dig(BATCH_LEN * photon_beetle::DIGEST_LEN);
+  photon_utils::random_data(msg.data(), msg.size());
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < BATCH_LEN; i++) {
+      uint8_t* const out = dig.data() + i * photon_beetle::DIGEST_LEN;
+      photon_beetle::hash(msg.data() + i * mlen, mlen, out);
+    }
+
+    benchmark::DoNotOptimize(msg.data());
+    benchmark::DoNotOptimize(dig.data());
+    benchmark::ClobberMemory();
+  }
+
+  const size_t per_itr = BATCH_LEN * mlen;
+  state.SetBytesProcessed(static_cast<int64_t>(per_itr * state.iterations()));
+}
+
+// Benchmarks Photon-Beetle-Hash, hashing a batch of independent N -bytes
+// messages, as coroutines, keeping W -many of them in flight, on single thread
+// | N, W are provided when setting up benchmark
+inline void
+coro_hash(benchmark::State& state)
+{
+  const size_t mlen = static_cast<size_t>(state.range(0));
+  const size_t width = static_cast<size_t>(state.range(1));
+
+  std::vector<uint8_t> msg(BATCH_LEN * mlen);
+  std::vector<uint8_t> dig(BATCH_LEN * photon_beetle::DIGEST_LEN);
+  photon_utils::random_data(msg.data(), msg.size());
+
+  std::vector<photon_beetle::sponge_task> tasks(BATCH_LEN);
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < BATCH_LEN; i++) {
+      uint8_t* const out = dig.data() + i * photon_beetle::DIGEST_LEN;
+      tasks[i] = photon_beetle::hash_task(msg.data() + i * mlen, mlen, out);
+    }
+
+    photon_beetle::run_tasks(tasks, width);
+
+    benchmark::DoNotOptimize(msg.data());
+    benchmark::DoNotOptimize(dig.data());
+    benchmark::ClobberMemory();
+  }
+
+  // --- test correctness ---
+  uint8_t expected[photon_beetle::DIGEST_LEN];
+  photon_beetle::hash(msg.data(), mlen, expected);
+  assert(std::memcmp(expected, dig.data(), sizeof(expected)) == 0);
+  // --- test correctness ---
+
+  const size_t per_itr = BATCH_LEN * mlen;
+  state.SetBytesProcessed(static_cast<int64_t>(per_itr * state.iterations()));
+}
+
+// Benchmarks Photon-Beetle-AEAD[32, 128] encryption, sequentially encrypting a
+// batch of independent N -bytes messages, one after another | N is provided
+// when setting up benchmark
+template<const size_t R>
+void
+batch_encrypt(benchmark::State& state)
+{
+  const size_t mlen = static_cast<size_t>(state.range(0));
+
+  uint8_t key[photon_beetle::KEY_LEN];
+  uint8_t nonce[photon_beetle::NONCE_LEN];
+  std::vector<uint8_t> txt(BATCH_LEN * mlen);
+  std::vector<uint8_t> enc(BATCH_LEN * mlen);
+  std::vector<uint8_t> tag(BATCH_LEN * photon_beetle::TAG_LEN);
+
+  photon_utils::random_data(key, sizeof(key));
+  photon_utils::random_data(nonce, sizeof(nonce));
+  photon_utils::random_data(txt.data(), txt.size());
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < BATCH_LEN; i++) {
+      using namespace photon_beetle;
+
+      encrypt<R>(key,
+                 nonce,
+                 nullptr,
+                 0,
+                 txt.data() + i * mlen,
+                 enc.data() + i * mlen,
+                 mlen,
+                 tag.data() + i * TAG_LEN);
+    }
+
+    benchmark::DoNotOptimize(enc.data());
+    benchmark::DoNotOptimize(tag.data());
+    benchmark::ClobberMemory();
+  }
+
+  const size_t per_itr = BATCH_LEN * mlen;
+  state.SetBytesProcessed(static_cast<int64_t>(per_itr * state.iterations()));
+}
+
+// Benchmarks Photon-Beetle-AEAD[32, 128] encryption, encrypting a batch of
+// independent N -bytes messages, as coroutines, keeping W -many of them in
+// flight, on single thread | N, W are provided when setting up benchmark
+template<const size_t R>
+void
+coro_encrypt(benchmark::State& state)
+{
+  const size_t mlen = static_cast<size_t>(state.range(0));
+  const size_t width = static_cast<size_t>(state.range(1));
+
+  uint8_t key[photon_beetle::KEY_LEN];
+  uint8_t nonce[photon_beetle::NONCE_LEN];
+  std::vector<uint8_t> txt(BATCH_LEN * mlen);
+  std::vector<uint8_t> enc(BATCH_LEN * mlen);
+  std::vector<uint8_t> tag(BATCH_LEN * photon_beetle::TAG_LEN);
+
+  photon_utils::random_data(key, sizeof(key));
+  photon_utils::random_data(nonce, sizeof(nonce));
+  photon_utils::random_data(txt.data(), txt.size());
+
+  std::vector<photon_beetle::sponge_task> tasks(BATCH_LEN);
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < BATCH_LEN; i++) {
+      using namespace photon_beetle;
+
+      tasks[i] = encrypt_task<R>(key,
+                                 nonce,
+                                 nullptr,
+                                 0,
+                                 txt.data() + i * mlen,
+                                 enc.data() + i * mlen,
+                                 mlen,
+                                 tag.data() + i * TAG_LEN);
+    }
+
+    photon_beetle::run_tasks(tasks, width);
+
+    benchmark::DoNotOptimize(enc.data());
+    benchmark::DoNotOptimize(tag.data());
+    benchmark::ClobberMemory();
+  }
+
+  // --- test correctness ---
+  std::vector<uint8_t> dec(mlen);
+  bool f = false;
+  f = photon_beetle::decrypt<R>(
+    key, nonce, tag.data(), nullptr, 0, enc.data(), dec.data(), mlen);
+
+  assert(f);
+  assert(std::memcmp(txt.data(), dec.data(), mlen) == 0);
+  // --- test correctness ---
+
+  const size_t per_itr = BATCH_LEN * mlen;
+  state.SetBytesProcessed(static_cast<int64_t>(per_itr * state.iterations()));
+}
+
+}
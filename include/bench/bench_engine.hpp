@@ -0,0 +1,135 @@
+#pragma once
+#include "engine.hpp"
+#include <benchmark/benchmark.h>
+#include <cassert>
+
+// Benchmark Photon-Beetle-{Hash, AEAD} routines
+namespace bench_photon_beetle {
+
+// Generates skewed message lengths, where every 16-th message is 64x longer
+// than others, so that naive static partitioning leaves some workers idle
+inline std::vector<size_t>
+skewed_lengths(const size_t cnt, const size_t base)
+{
+  std::vector<size_t> lens(cnt);
+  for (size_t i = 0; i < cnt; i++) {
+    lens[i] = (i & 15) == 0 ? base * 64 : base;
+  }
+
+  return lens;
+}
+
+// Benchmarks bulk engine, executing a batch of 256 Photon-Beetle-Hash jobs, of
+// skewed message lengths, on N -many worker threads | N is provided when
+// setting up benchmark
+inline void
+engine_hash(benchmark::State& state)
+{
+  const size_t wcnt = static_cast<size_t>(state.range(0));
+  const auto lens = skewed_lengths(256, 256);
+
+  size_t total = 0;
+  std::vector<size_t> offs(lens.size());
+  for (size_t i = 0; i < lens.size(); i++) {
+    offs[i] = total;
+    total += lens[i];
+  }
+
+  std::vector<uint8_t> msg(total);
+  std::vector<uint8_t> dig(lens.size() * photon_beetle::DIGEST_LEN);
+  photon_utils::random_data(msg.data(), msg.size());
+
+  std::vector<photon_beetle::job> js;
+  for (size_t i = 0; i < lens.size(); i++) {
+    uint8_t* const out = dig.data() + i * photon_beetle::DIGEST_LEN;
+    js.push_back(photon_beetle::job::hash(msg.data() + offs[i], lens[i], out));
+  }
+
+  photon_beetle::engine eng{ wcnt };
+
+  for (auto _ : state) {
+    eng.submit(js);
+    eng.wait();
+
+    benchmark::DoNotOptimize(dig.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(total * state.iterations()));
+}
+
+// Benchmarks bulk engine, executing a batch of 256 Photon-Beetle-AEAD
+// encryption jobs, of skewed message lengths, on N -many worker threads | N is
+// provided when setting up benchmark
+template<const size_t R>
+void
+engine_encrypt(benchmark::State& state)
+{
+  const size_t wcnt = static_cast<size_t>(state.range(0));
+  const auto lens = skewed_lengths(256, 256);
+
+  size_t total = 0;
+  std::vector<size_t> offs(lens.size());
+  for (size_t i = 0; i < lens.size(); i++) {
+    offs[i] = total;
+    total += lens[i];
+  }
+
+  uint8_t key[photon_beetle::KEY_LEN];
+  uint8_t nonce[photon_beetle::NONCE_LEN];
+  std::vector<uint8_t> txt(total);
+  std::vector<uint8_t> enc(total);
+  std::vector<uint8_t> tag(lens.size() * photon_beetle::TAG_LEN);
+
+  photon_utils::random_data(key, sizeof(key));
+  photon_utils::random_data(nonce, sizeof(nonce));
+  photon_utils::random_data(txt.data(), txt.size());
+
+  std::vector<photon_beetle::job> js;
+  for (size_t i = 0; i < lens.size(); i++) {
+    using namespace photon_beetle;
+
+    js.push_back(job::encrypt<R>(key,
+                                 nonce,
+                                 nullptr,
+                                 0,
+                                 txt.data() + offs[i],
+                                 enc.data() + offs[i],
+                                 lens[i],
+                                 tag.data() + i * TAG_LEN));
+  }
+
+  photon_beetle::engine eng{ wcnt };
+
+  for (auto _ : state) {
+    eng.submit(js);
+    eng.wait();
+
+    benchmark::DoNotOptimize(enc.data());
+    benchmark::DoNotOptimize(tag.data());
+    benchmark::ClobberMemory();
+  }
+
+  // --- test correctness ---
+  std::vector<uint8_t> dec(total);
+  for (size_t i = 0; i < lens.size(); i++) {
+    using namespace photon_beetle;
+
+    const bool f = decrypt<R>(key,
+                              nonce,
+                              tag.data() + i * TAG_LEN,
+                              nullptr,
+                              0,
+                              enc.data() + offs[i],
+                              dec.data() + offs[i],
+                              lens[i]);
+    assert(f);
+  }
+
+  assert(txt == dec);
+  // --- test correctness ---
+
+  state.SetBytesProcessed(static_cast<int64_t>(total * state.iterations()));
+}
+
+}
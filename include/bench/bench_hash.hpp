@@ -1,13 +1,14 @@
 #pragma once
 #include "hash.hpp"
+#include "perf_counters.hpp"
 #include <benchmark/benchmark.h>
 
 // Benchmark Photon-Beetle-{Hash, AEAD} routines
 namespace bench_photon_beetle {
 
 // Benchmarks Photon-Beetle cryptographic hash function implementation for
-// random input of length N (>=0) -bytes | N is provided when setting up
-// benchmark
+// random input of length N (>=0) -bytes, reporting cycles/ byte & hardware
+// event counters, when available | N is provided when setting up benchmark
 inline void
 hash(benchmark::State& state)
 {
@@ -18,6 +19,9 @@ hash(benchmark::State& state)
 
   photon_utils::random_data(msg, mlen);
 
+  perf_counters counters;
+  counters.start();
+
   for (auto _ : state) {
     photon_beetle::hash(msg, mlen, out);
 
@@ -26,7 +30,10 @@ hash(benchmark::State& state)
     benchmark::ClobberMemory();
   }
 
+  counters.stop();
+
   state.SetBytesProcessed(static_cast<int64_t>(mlen * state.iterations()));
+  counters.report(state, mlen);
 
   std::free(msg);
   std::free(out);
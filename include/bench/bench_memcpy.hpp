@@ -0,0 +1,34 @@
+#pragma once
+#include "utils.hpp"
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <vector>
+
+// Benchmark Photon-Beetle-{Hash, AEAD} routines
+namespace bench_photon_beetle {
+
+// Benchmarks `memcpy` of N -bytes, which is used as memory bandwidth baseline
+// for Photon-Beetle-{Hash, AEAD} routines, when operating on inputs larger
+// than last level cache | N is provided when setting up benchmark
+inline void
+memcpy_baseline(benchmark::State& state)
+{
+  const size_t len = static_cast<size_t>(state.range(0));
+
+  std::vector<uint8_t> src(len);
+  std::vector<uint8_t> dst(len);
+
+  photon_utils::random_data(src.data(), src.size());
+
+  for (auto _ : state) {
+    std::memcpy(dst.data(), src.data(), len);
+
+    benchmark::DoNotOptimize(src.data());
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(len * state.iterations()));
+}
+
+}
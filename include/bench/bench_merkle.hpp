@@ -0,0 +1,47 @@
+#pragma once
+#include "bench_coro.hpp"
+#include "merkle.hpp"
+#include <benchmark/benchmark.h>
+#include <span>
+#include <vector>
+
+// Benchmark Photon-Beetle-{Hash, AEAD} routines
+namespace bench_photon_beetle {
+
+// Benchmarks appending a batch of N -bytes records to Merkle tree, either one
+// by one ( W = 0 ) or at once, interleaving W -many leaf hashes on single
+// thread ( W > 0 ) | N, W are provided when setting up benchmark
+inline void
+merkle_append(benchmark::State& state)
+{
+  const size_t rlen = static_cast<size_t>(state.range(0));
+  const size_t width = static_cast<size_t>(state.range(1));
+
+  std::vector<uint8_t> recs(BATCH_LEN * rlen);
+  photon_utils::random_data(recs.data(), recs.size());
+
+  std::vector<std::span<const uint8_t>> views(BATCH_LEN);
+  for (size_t i = 0; i < BATCH_LEN; i++) {
+    views[i] = std::span(recs.data() + i * rlen, rlen);
+  }
+
+  photon_beetle::merkle_tree tree;
+
+  for (auto _ : state) {
+    if (width == 0) {
+      for (const auto& v : views) {
+        tree.append(v.data(), v.size());
+      }
+    } else {
+      tree.append(views, width);
+    }
+
+    benchmark::DoNotOptimize(tree);
+    benchmark::ClobberMemory();
+  }
+
+  const size_t per_itr = BATCH_LEN * rlen;
+  state.SetBytesProcessed(static_cast<int64_t>(per_itr * state.iterations()));
+}
+
+}
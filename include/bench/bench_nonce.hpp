@@ -0,0 +1,69 @@
+#pragma once
+#include "nonce.hpp"
+#include <benchmark/benchmark.h>
+#include <mutex>
+
+// Benchmark Photon-Beetle-{Hash, AEAD} routines
+namespace bench_photon_beetle {
+
+// Shared nonce sequencer, used by all threads of nonce allocation benchmark
+inline photon_beetle::nonce_sequencer&
+shared_sequencer()
+{
+  static const uint8_t prefix[photon_beetle::NONCE_PREFIX_LEN]{};
+  static photon_beetle::nonce_sequencer seq{ prefix };
+
+  return seq;
+}
+
+// Benchmarks lock-free nonce allocation, where each thread reserves a block of
+// N -many counters with single atomic fetch-add & hands them out locally | N is
+// provided when setting up benchmark
+inline void
+nonce_sequencer(benchmark::State& state)
+{
+  const uint64_t blk_len = static_cast<uint64_t>(state.range(0));
+
+  auto& seq = shared_sequencer();
+  photon_beetle::nonce_block blk;
+  uint8_t nonce[photon_beetle::NONCE_LEN];
+
+  for (auto _ : state) {
+    const bool f = seq.next(blk, nonce, blk_len);
+    assert(f);
+
+    benchmark::DoNotOptimize(f);
+    benchmark::DoNotOptimize(nonce);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Benchmarks ( baseline ) nonce allocation, where each thread increments a
+// mutex guarded shared counter, for every nonce
+inline void
+nonce_mutex(benchmark::State& state)
+{
+  static std::mutex lock;
+  static uint64_t ctr = 0;
+
+  uint8_t nonce[photon_beetle::NONCE_LEN]{};
+
+  for (auto _ : state) {
+    uint64_t v;
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      v = ctr++;
+    }
+
+    std::memcpy(nonce + photon_beetle::NONCE_PREFIX_LEN, &v, sizeof(v));
+
+    benchmark::DoNotOptimize(nonce);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+}
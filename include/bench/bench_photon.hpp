@@ -1,11 +1,14 @@
 #pragma once
+#include "perf_counters.hpp"
 #include "photon.hpp"
 #include <benchmark/benchmark.h>
+#include <cassert>
 
 // Benchmark Photon-Beetle-{Hash, AEAD} routines
 namespace bench_photon_beetle {
 
-// Benchmarks Photon256 permutation routine
+// Benchmarks Photon256 permutation routine, reporting cycles/ byte ( of 32
+// -bytes permutation state ) & hardware event counters, when available
 inline void
 permute(benchmark::State& state)
 {
@@ -14,6 +17,9 @@ permute(benchmark::State& state)
   // generate initial random permutation state
   photon_utils::random_data(pstate, sizeof(pstate));
 
+  perf_counters counters;
+  counters.start();
+
   for (auto _ : state) {
     photon::photon256(pstate);
 
@@ -21,7 +27,53 @@ permute(benchmark::State& state)
     benchmark::ClobberMemory();
   }
 
+  counters.stop();
+
   state.SetBytesProcessed(state.iterations() * sizeof(pstate));
+  counters.report(state, sizeof(pstate));
+}
+
+// Benchmarks Photon256 permutation of N (= 2 or 4) independent states, either
+// calling `photon256` on each of them back-to-back or using interleaved
+// `photon256_x{2,4}`, reporting bytes of permutation state processed per
+// second, so that speed-up of interleaving can be read off throughput column
+template<const bool interleaved>
+void
+permute_lanes(benchmark::State& state)
+{
+  const size_t lanes = static_cast<size_t>(state.range(0));
+  assert(lanes == 2 || lanes == 4);
+
+  uint8_t pstate[4][32];
+
+  // generate initial random permutation states
+  photon_utils::random_data(&pstate[0][0], sizeof(pstate));
+
+  perf_counters counters;
+  counters.start();
+
+  for (auto _ : state) {
+    if constexpr (interleaved) {
+      if (lanes == 4) {
+        photon::photon256_x4(pstate[0], pstate[1], pstate[2], pstate[3]);
+      } else {
+        photon::photon256_x2(pstate[0], pstate[1]);
+      }
+    } else {
+      for (size_t l = 0; l < lanes; l++) {
+        photon::photon256(pstate[l]);
+      }
+    }
+
+    benchmark::DoNotOptimize(pstate);
+    benchmark::ClobberMemory();
+  }
+
+  counters.stop();
+
+  const size_t per_itr = lanes * sizeof(pstate[0]);
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * per_itr));
+  counters.report(state, per_itr);
 }
 
 }
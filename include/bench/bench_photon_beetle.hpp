@@ -1,5 +1,15 @@
 #pragma once
 
 #include "bench_aead.hpp"
+#include "bench_bulk.hpp"
+#include "bench_container.hpp"
+#include "bench_coro.hpp"
+#include "bench_engine.hpp"
 #include "bench_hash.hpp"
+#include "bench_memcpy.hpp"
+#include "bench_merkle.hpp"
+#include "bench_nonce.hpp"
 #include "bench_photon.hpp"
+#include "bench_pipeline.hpp"
+#include "bench_scaling.hpp"
+#include "bench_xof.hpp"
@@ -0,0 +1,116 @@
+#pragma once
+#include "pipeline.hpp"
+#include <benchmark/benchmark.h>
+#include <cassert>
+
+// Benchmark Photon-Beetle-{Hash, AEAD} routines
+namespace bench_photon_beetle {
+
+// Returns monotonic clock reading in nanoseconds
+inline uint64_t
+now_ns()
+{
+  using namespace std::chrono;
+
+  const auto t = steady_clock::now().time_since_epoch();
+  return static_cast<uint64_t>(duration_cast<nanoseconds>(t).count());
+}
+
+// Returns q-th quantile ( 0 <= q <= 1 ) of given samples, sorting them
+inline double
+quantile(std::vector<uint64_t>& samples, const double q)
+{
+  if (samples.empty()) {
+    return 0.;
+  }
+
+  std::sort(samples.begin(), samples.end());
+  const size_t idx = static_cast<size_t>(q * (samples.size() - 1));
+  return static_cast<double>(samples[idx]);
+}
+
+// Benchmarks streaming pipeline stage, sealing synthetic packets using
+// Photon-Beetle-AEAD[32, 128], reporting throughput along with median and tail
+// latency of packets, from submission into RX ring till collection from TX
+// ring | packet length & burst size are provided when setting up benchmark
+template<const size_t R>
+void
+pipeline_seal(benchmark::State& state)
+{
+  constexpr size_t WINDOW = 256;
+
+  const size_t mlen = static_cast<size_t>(state.range(0));
+  const size_t burst = static_cast<size_t>(state.range(1));
+
+  uint8_t key[photon_beetle::KEY_LEN];
+  uint8_t nonce[photon_beetle::NONCE_LEN];
+  std::vector<uint8_t> txt(WINDOW * mlen);
+  std::vector<uint8_t> enc(WINDOW * mlen);
+  std::vector<uint8_t> tag(WINDOW * photon_beetle::TAG_LEN);
+
+  photon_utils::random_data(key, sizeof(key));
+  photon_utils::random_data(nonce, sizeof(nonce));
+  photon_utils::random_data(txt.data(), txt.size());
+
+  std::vector<photon_beetle::packet> pkts(WINDOW);
+  for (size_t i = 0; i < WINDOW; i++) {
+    using namespace photon_beetle;
+
+    pkts[i].j = job::encrypt<R>(key,
+                                nonce,
+                                nullptr,
+                                0,
+                                txt.data() + i * mlen,
+                                enc.data() + i * mlen,
+                                mlen,
+                                tag.data() + i * TAG_LEN);
+  }
+
+  std::vector<photon_beetle::packet> done(WINDOW);
+  std::vector<uint64_t> lat;
+  lat.reserve(1ul << 20);
+
+  photon_beetle::pipeline_stage<1024> stage{ burst };
+
+  for (auto _ : state) {
+    for (auto& p : pkts) {
+      p.stamp = now_ns();
+      while (!stage.submit(p)) {
+        std::this_thread::yield();
+      }
+    }
+
+    size_t cnt = 0;
+    while (cnt < WINDOW) {
+      const auto slots = std::span(done.data() + cnt, WINDOW - cnt);
+      const size_t n = stage.collect(slots);
+      const uint64_t t = now_ns();
+
+      for (size_t i = cnt; i < cnt + n; i++) {
+        assert(done[i].ok);
+        if (lat.size() < lat.capacity()) {
+          lat.push_back(t - done[i].stamp);
+        }
+      }
+
+      cnt += n;
+      if (n == 0) {
+        std::this_thread::yield();
+      }
+    }
+
+    benchmark::DoNotOptimize(enc.data());
+    benchmark::DoNotOptimize(tag.data());
+    benchmark::ClobberMemory();
+  }
+
+  const size_t per_itr = WINDOW * mlen;
+  state.SetBytesProcessed(static_cast<int64_t>(per_itr * state.iterations()));
+  state.SetItemsProcessed(static_cast<int64_t>(WINDOW * state.iterations()));
+
+  state.counters["p50_ns"] = quantile(lat, 0.5);
+  state.counters["p99_ns"] = quantile(lat, 0.99);
+  state.counters["p999_ns"] = quantile(lat, 0.999);
+}
+
+}
@@ -0,0 +1,190 @@
+#pragma once
+#include "aead.hpp"
+#include "hash.hpp"
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Benchmark Photon-Beetle-{Hash, AEAD} routines
+namespace bench_photon_beetle {
+
+// Maximum number of threads, whose outputs can be packed in shared slots
+constexpr size_t MAX_SCALING_THREADS = 1024;
+
+// Records single-threaded throughput ( in bytes/ s ) of a scaling benchmark,
+// when invoked from its 1 -thread run, and returns recorded throughput, so
+// that runs with more threads can compute per-thread efficiency. Returns 0, if
+// 1 -thread run is yet to happen.
+inline double
+scaling_baseline(const std::string& key, const int threads, const double rate)
+{
+  static std::mutex lock;
+  static std::map<std::string, double> baselines;
+
+  std::lock_guard<std::mutex> guard(lock);
+
+  if (threads == 1) {
+    baselines[key] = rate;
+  }
+
+  const auto it = baselines.find(key);
+  return it == baselines.end() ? 0. : it->second;
+}
+
+// Returns packed 32 -bytes output slots, one per thread, shared by all threads
+// of a scaling benchmark, so that adjacent threads write into same cache line,
+// which exposes cost of false sharing
+inline uint8_t*
+shared_slots()
+{
+  constexpr size_t align = photon_utils::CACHE_LINE_LEN;
+  alignas(align) static uint8_t slots[MAX_SCALING_THREADS * 32];
+
+  return slots;
+}
+
+// Returns output slot of calling thread, which is either a cache line sized &
+// aligned buffer of its own or a packed slot, shared with neighbouring threads
+inline uint8_t*
+output_slot(benchmark::State& state, const bool isolated, void*& own)
+{
+  if (isolated) {
+    own = std::aligned_alloc(photon_utils::CACHE_LINE_LEN,
+                             photon_utils::CACHE_LINE_LEN);
+    return static_cast<uint8_t*>(own);
+  }
+
+  own = nullptr;
+  return shared_slots() + (state.thread_index() % MAX_SCALING_THREADS) * 32;
+}
+
+// Reports aggregate throughput & per-thread efficiency of a scaling benchmark,
+// where efficiency is ratio of this thread's throughput to that of 1 -thread
+// run, so that 1.0 denotes perfect linear scaling
+inline void
+report_scaling(benchmark::State& state,
+               const std::string& key,
+               const size_t per_itr,
+               const double secs)
+{
+  const double bytes = static_cast<double>(per_itr * state.iterations());
+  const double rate = secs > 0. ? bytes / secs : 0.;
+  const double base = scaling_baseline(key, state.threads(), rate);
+
+  state.SetBytesProcessed(static_cast<int64_t>(bytes));
+
+  using benchmark::Counter;
+  state.counters["bytes/s/thread"] = Counter(rate, Counter::kAvgThreads);
+  if (base > 0.) {
+    state.counters["efficiency"] = Counter(rate / base, Counter::kAvgThreads);
+  }
+}
+
+// Benchmarks Photon-Beetle-Hash, running on T -many threads, each hashing its
+// own independent N -bytes message, while writing digest either into its own
+// cache line or a slot shared with neighbouring threads | N & whether outputs
+// are isolated, are provided when setting up benchmark, T is set using
+// `->Threads()`
+inline void
+scaling_hash(benchmark::State& state)
+{
+  const size_t mlen = static_cast<size_t>(state.range(0));
+  const bool isolated = state.range(1) != 0;
+
+  std::vector<uint8_t> msg(mlen);
+  photon_utils::random_data(msg.data(), msg.size());
+
+  void* own = nullptr;
+  uint8_t* const out = output_slot(state, isolated, own);
+
+  // clock is read only at first iteration ( i.e. after start barrier ) & once
+  // loop is done ( i.e. after stop barrier, when slowest thread is done ), so
+  // that reading it doesn't add to time of short messages
+  using clock = std::chrono::steady_clock;
+  clock::time_point t0;
+  bool first = true;
+
+  for (auto _ : state) {
+    if (first) {
+      t0 = clock::now();
+      first = false;
+    }
+
+    photon_beetle::hash(msg.data(), mlen, out);
+
+    benchmark::DoNotOptimize(msg.data());
+    benchmark::DoNotOptimize(out);
+    benchmark::ClobberMemory();
+  }
+
+  const auto t1 = clock::now();
+  const double secs = std::chrono::duration<double>(t1 - t0).count();
+
+  const std::string key = "hash/" + std::to_string(mlen) + "/" +
+                          std::to_string(static_cast<int>(isolated));
+  report_scaling(state, key, mlen, secs);
+
+  std::free(own);
+}
+
+// Benchmarks Photon-Beetle-AEAD[32, 128] encryption, running on T -many
+// threads, each encrypting its own independent N -bytes message, while writing
+// authentication tag either into its own cache line or a slot shared with
+// neighbouring threads | N & whether outputs are isolated, are provided when
+// setting up benchmark, T is set using `->Threads()`
+template<const size_t R>
+void
+scaling_encrypt(benchmark::State& state)
+{
+  const size_t mlen = static_cast<size_t>(state.range(0));
+  const bool isolated = state.range(1) != 0;
+
+  uint8_t key[photon_beetle::KEY_LEN];
+  uint8_t nonce[photon_beetle::NONCE_LEN];
+  std::vector<uint8_t> txt(mlen);
+  std::vector<uint8_t> enc(mlen);
+
+  photon_utils::random_data(key, sizeof(key));
+  photon_utils::random_data(nonce, sizeof(nonce));
+  photon_utils::random_data(txt.data(), txt.size());
+
+  void* own = nullptr;
+  uint8_t* const tag = output_slot(state, isolated, own);
+
+  // clock is read only at first iteration ( i.e. after start barrier ) & once
+  // loop is done ( i.e. after stop barrier, when slowest thread is done ), so
+  // that reading it doesn't add to time of short messages
+  using clock = std::chrono::steady_clock;
+  clock::time_point t0;
+  bool first = true;
+
+  for (auto _ : state) {
+    if (first) {
+      t0 = clock::now();
+      first = false;
+    }
+
+    using namespace photon_beetle;
+    encrypt<R>(key, nonce, nullptr, 0, txt.data(), enc.data(), mlen, tag);
+
+    benchmark::DoNotOptimize(enc.data());
+    benchmark::DoNotOptimize(tag);
+    benchmark::ClobberMemory();
+  }
+
+  const auto t1 = clock::now();
+  const double secs = std::chrono::duration<double>(t1 - t0).count();
+
+  const std::string key_ = "encrypt<" + std::to_string(R) + ">/" +
+                           std::to_string(mlen) + "/" +
+                           std::to_string(static_cast<int>(isolated));
+  report_scaling(state, key_, mlen, secs);
+
+  std::free(own);
+}
+
+}
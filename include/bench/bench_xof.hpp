@@ -0,0 +1,54 @@
+#pragma once
+#include "xof.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+// Benchmark Photon-Beetle-{Hash, AEAD} routines
+namespace bench_photon_beetle {
+
+// Largest output length `xof_fill` & `random_data_baseline` are benchmarked
+// for. XOF squeezes only few MB/s, so larger outputs would just slow down
+// whole benchmark suite, without telling anything new.
+constexpr size_t XOF_BENCH_MAX_LEN = 4096;
+
+// Benchmarks squeezing N -bytes out of Photon256 based XOF, in a single call
+// to `fill` | N <= XOF_BENCH_MAX_LEN is provided when setting up benchmark
+inline void
+xof_fill(benchmark::State& state)
+{
+  const size_t len = static_cast<size_t>(state.range(0));
+
+  std::vector<uint8_t> out(len);
+  photon_xof::xof gen{ 0ul };
+
+  for (auto _ : state) {
+    gen.fill(out);
+
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(len * state.iterations()));
+}
+
+// Benchmarks generating N random bytes using `photon_utils::random_data`,
+// which is used as baseline for `xof_fill` | N <= XOF_BENCH_MAX_LEN is
+// provided when setting up benchmark
+inline void
+random_data_baseline(benchmark::State& state)
+{
+  const size_t len = static_cast<size_t>(state.range(0));
+
+  std::vector<uint8_t> out(len);
+
+  for (auto _ : state) {
+    photon_utils::random_data(out.data(), out.size());
+
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(len * state.iterations()));
+}
+
+}
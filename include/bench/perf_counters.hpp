@@ -0,0 +1,204 @@
+#pragma once
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <cstring>
+
+#if defined __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined __x86_64__ || defined __i386__
+#include <x86intrin.h>
+#endif
+
+// Benchmark Photon-Beetle-{Hash, AEAD} routines
+namespace bench_photon_beetle {
+
+// Whether time stamp counter can be read on target CPU
+#if defined __x86_64__ || defined __i386__
+constexpr bool HAS_TSC = true;
+#else
+constexpr bool HAS_TSC = false;
+#endif
+
+// Reads time stamp counter, returning 0 when it's not available
+inline uint64_t
+read_tsc()
+{
+#if defined __x86_64__ || defined __i386__
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+// Hardware event counters, collected for calling thread, while a benchmark's
+// timed loop is running, so that cycles/ byte ( figure of merit used in NIST
+// LWC literature, which allows comparing kernels across machines running at
+// different clock frequencies ), instructions per cycle, L1D cache misses &
+// branch misses can be reported along with wall clock time.
+//
+// Counters are read using Linux `perf_event_open(2)`. Each event is opened on
+// its own, so that when some of them are unavailable ( say, inside a virtual
+// machine or when `perf_event_paranoid` forbids it ), rest are still reported.
+// When CPU cycles can't be counted, time stamp counter is used instead, which
+// ticks at a constant reference frequency, so cycles/ byte is approximate.
+// When neither is available, no counter is reported.
+class perf_counters
+{
+private:
+  enum event : size_t
+  {
+    CYCLES,
+    INSTRUCTIONS,
+    L1D_MISSES,
+    BRANCH_MISSES,
+    EVENT_CNT
+  };
+
+  int fds[EVENT_CNT];
+  double vals[EVENT_CNT]{};
+  uint64_t tsc_beg = 0;
+  uint64_t tsc_end = 0;
+
+  inline static int open_event(const uint32_t type, const uint64_t config)
+  {
+#if defined __linux__
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format =
+      PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+#else
+    (void)type;
+    (void)config;
+    return -1;
+#endif
+  }
+
+  // Reads counter value, scaling it up, if event was multiplexed with others
+  // and so didn't run for whole duration it was enabled
+  inline static double read_event(const int fd)
+  {
+#if defined __linux__
+    uint64_t buf[3]{}; // value, time enabled, time running
+    if (read(fd, buf, sizeof(buf)) != sizeof(buf) || buf[2] == 0) {
+      return 0.;
+    }
+
+    const double scale = static_cast<double>(buf[1]) / buf[2];
+    return static_cast<double>(buf[0]) * scale;
+#else
+    (void)fd;
+    return 0.;
+#endif
+  }
+
+  inline bool has(const event e) const { return fds[e] >= 0; }
+
+public:
+  inline perf_counters()
+  {
+#if defined __linux__
+    constexpr uint64_t l1d_miss = PERF_COUNT_HW_CACHE_L1D |
+                                  (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+    fds[CYCLES] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    fds[INSTRUCTIONS] =
+      open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    fds[L1D_MISSES] = open_event(PERF_TYPE_HW_CACHE, l1d_miss);
+    fds[BRANCH_MISSES] =
+      open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+#else
+    for (size_t i = 0; i < EVENT_CNT; i++) {
+      fds[i] = -1;
+    }
+#endif
+  }
+
+  perf_counters(const perf_counters&) = delete;
+  perf_counters& operator=(const perf_counters&) = delete;
+
+  inline ~perf_counters()
+  {
+#if defined __linux__
+    for (size_t i = 0; i < EVENT_CNT; i++) {
+      if (has(static_cast<event>(i))) {
+        close(fds[i]);
+      }
+    }
+#endif
+  }
+
+  // Resets & starts counting, call it right before benchmark's timed loop
+  inline void start()
+  {
+#if defined __linux__
+    for (size_t i = 0; i < EVENT_CNT; i++) {
+      if (has(static_cast<event>(i))) {
+        ioctl(fds[i], PERF_EVENT_IOC_RESET, 0);
+        ioctl(fds[i], PERF_EVENT_IOC_ENABLE, 0);
+      }
+    }
+#endif
+
+    tsc_beg = read_tsc();
+  }
+
+  // Stops counting, call it right after benchmark's timed loop
+  inline void stop()
+  {
+    tsc_end = read_tsc();
+
+#if defined __linux__
+    for (size_t i = 0; i < EVENT_CNT; i++) {
+      if (has(static_cast<event>(i))) {
+        ioctl(fds[i], PERF_EVENT_IOC_DISABLE, 0);
+        vals[i] = read_event(fds[i]);
+      }
+    }
+#endif
+  }
+
+  // Reports collected counters as user counters of given benchmark, where each
+  // iteration processes N -bytes | N >= 0
+  inline void report(benchmark::State& state, const size_t per_itr) const
+  {
+    const double itrs = static_cast<double>(state.iterations());
+    const double bytes = static_cast<double>(per_itr) * itrs;
+
+    double cycles = 0.;
+    if (has(CYCLES)) {
+      cycles = vals[CYCLES];
+    } else if (HAS_TSC) {
+      cycles = static_cast<double>(tsc_end - tsc_beg);
+    }
+
+    if (cycles > 0. && bytes > 0.) {
+      state.counters["cycles/byte"] = cycles / bytes;
+    }
+    if (has(CYCLES) && has(INSTRUCTIONS) && cycles > 0.) {
+      state.counters["IPC"] = vals[INSTRUCTIONS] / cycles;
+    }
+    if (has(L1D_MISSES) && itrs > 0.) {
+      state.counters["L1D_miss"] = vals[L1D_MISSES] / itrs;
+    }
+    if (has(BRANCH_MISSES) && itrs > 0.) {
+      state.counters["br_miss"] = vals[BRANCH_MISSES] / itrs;
+    }
+  }
+};
+
+}
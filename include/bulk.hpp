@@ -0,0 +1,334 @@
+#pragma once
+#include "aead.hpp"
+#include "hash.hpp"
+#include <unistd.h>
+
+#if defined __SSE2__
+#include <emmintrin.h>
+#endif
+
+// Cache-bypassing bulk mode of Photon-Beetle-{Hash, AEAD}, for payloads larger
+// than last level cache, where input is read strictly once ( so caching it only
+// evicts useful data ) and output isn't going to be read back soon.
+//
+// Input is prefetched few cache lines ahead, hinting that it has no temporal
+// locality, while output is produced one cache line at a time into a staging
+// buffer and then written out using non-temporal ( streaming ) stores, which
+// don't allocate cache lines, when target supports them. Outputs are same as
+// what `hash`, `encrypt` & `decrypt` produce.
+namespace photon_beetle {
+
+// Number of bytes, input is prefetched ahead of the block being processed
+constexpr size_t BULK_PREFETCH_DIST = 8 * photon_utils::CACHE_LINE_LEN;
+
+// Payload length threshold, used when last level cache size can't be queried
+constexpr size_t BULK_DEFAULT_THRESHOLD = 8ul << 20;
+
+// Returns payload length ( in bytes ), above which bulk mode is used, which is
+// size of last level cache, as reported by C library, queried only once
+inline size_t
+bulk_threshold()
+{
+  static const size_t threshold = [] {
+    long llc = -1;
+
+#if defined _SC_LEVEL3_CACHE_SIZE
+    llc = sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+#if defined _SC_LEVEL2_CACHE_SIZE
+    if (llc <= 0) {
+      llc = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    }
+#endif
+
+    return llc > 0 ? static_cast<size_t>(llc) : BULK_DEFAULT_THRESHOLD;
+  }();
+
+  return threshold;
+}
+
+namespace bulk {
+
+constexpr size_t LINE = photon_utils::CACHE_LINE_LEN;
+
+// Hints that cache line holding given address is going to be read soon, but
+// only once
+inline static void
+prefetch(const uint8_t* const ptr)
+{
+#if defined __GNUG__
+  __builtin_prefetch(ptr, 0, 0);
+#else
+  (void)ptr;
+#endif
+}
+
+// Writes a cache line worth of bytes from staging buffer to destination, using
+// non-temporal stores when destination is 16 -bytes aligned, falling back to
+// regular stores otherwise
+inline static void
+stream_line(uint8_t* const __restrict dst, const uint8_t* const __restrict src)
+{
+#if defined __SSE2__
+  if ((reinterpret_cast<uintptr_t>(dst) & 15ul) == 0ul) [[likely]] {
+#if defined __clang__
+#pragma clang loop unroll(enable)
+#elif defined __GNUG__
+#pragma GCC unroll 4
+#endif
+    for (size_t i = 0; i < LINE; i += 16) {
+      const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+      _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i), v);
+    }
+
+    return;
+  }
+#endif
+
+  std::memcpy(dst, src, LINE);
+}
+
+// Orders non-temporal stores issued so far before any later store, so that
+// output is visible to other threads once bulk routine returns
+inline static void
+stream_fence()
+{
+#if defined __SSE2__
+  _mm_sfence();
+#endif
+}
+
+// Absorbs whole cache lines of M -bytes message into permutation state, in
+// RATE -bytes blocks, prefetching input ahead, returning number of absorbed
+// bytes, which is a multiple of 64 | M >= 0
+template<const size_t RATE>
+inline static size_t
+absorb_lines(uint8_t* const __restrict state,
+             const uint8_t* const __restrict msg,
+             const size_t mlen)
+{
+  const size_t lines = mlen / LINE;
+  const size_t pf_end = mlen > BULK_PREFETCH_DIST ? mlen - BULK_PREFETCH_DIST
+                                                  : 0ul;
+
+  size_t off = 0;
+  for (size_t l = 0; l < lines; l++) {
+    if (off < pf_end) [[likely]] {
+      prefetch(msg + off + BULK_PREFETCH_DIST);
+    }
+
+    for (size_t i = 0; i < LINE; i += RATE) {
+      photon::photon256(state);
+      photon_common::absorb_block<RATE>(state, msg + off + i);
+    }
+
+    off += LINE;
+  }
+
+  return off;
+}
+
+}
+
+// Photon-Beetle-Hash routine, computing same digest as `hash`, which prefetches
+// N (>=0) -bytes input message ahead, when N > threshold ( by default, last
+// level cache size, see `bulk_threshold` ). Shorter messages are hashed using
+// `hash` itself.
+inline void
+hash_bulk(const uint8_t* const __restrict msg, // input message
+          const size_t mlen,                   // len(msg) >= 0
+          uint8_t* const __restrict digest,    // 32 -bytes digest
+          const size_t threshold = bulk_threshold())
+{
+  if (mlen <= threshold || mlen <= 16) {
+    hash(msg, mlen, digest);
+    return;
+  }
+
+  PHOTON_PROBE(hash_entry, mlen);
+
+  [[maybe_unused]] const photon_stats::scope timed;
+  photon_stats::add(photon_stats::BYTES_HASHED, mlen);
+
+  uint8_t state[32]{};
+  std::memcpy(state, msg, 16);
+
+  const size_t rmlen = mlen - 16;
+  constexpr uint8_t C[]{ 2, 1 };
+  const uint8_t c0 = C[(rmlen & 3ul) == 0ul];
+
+  const size_t off = bulk::absorb_lines<4>(state, msg + 16, rmlen);
+  photon_common::absorb<4>(state, msg + 16 + off, rmlen - off, c0);
+  photon_common::gen_tag<32>(state, digest);
+
+  PHOTON_PROBE(hash_return, mlen);
+}
+
+// Photon-Beetle-AEAD encrypt routine, computing same cipher text & tag as
+// `encrypt<RATE>`, which prefetches M -bytes plain text ahead and writes cipher
+// text using non-temporal stores, when M > threshold ( by default, last level
+// cache size, see `bulk_threshold` ). Shorter plain text is encrypted using
+// `encrypt<RATE>` itself.
+//
+// Plain text and cipher text may live in same buffer, but they must not
+// partially overlap. Cipher text is best kept 16 -bytes aligned, otherwise
+// regular stores are used.
+template<const size_t RATE>
+inline void
+encrypt_bulk(
+  const uint8_t* const __restrict key,   // 16 -bytes secret key
+  const uint8_t* const __restrict nonce, // 16 -bytes public message nonce
+  const uint8_t* const __restrict data,  // N -bytes associated data | N >= 0
+  const size_t dlen,                     // len(data) >= 0
+  const uint8_t* const txt,              // M -bytes plain text | M >= 0
+  uint8_t* const enc,                    // M -bytes cipher text | M >= 0
+  const size_t mlen,                     // len(txt) = len(enc) >= 0
+  uint8_t* const __restrict tag,         // 16 -bytes authentication tag
+  const size_t threshold = bulk_threshold())
+  requires(photon_common::check_rate(RATE))
+{
+  if (mlen <= threshold || mlen < bulk::LINE) {
+    encrypt<RATE>(key, nonce, data, dlen, txt, enc, mlen, tag);
+    return;
+  }
+
+  PHOTON_PROBE(encrypt_entry, RATE, dlen, mlen);
+
+  [[maybe_unused]] const photon_stats::scope timed;
+  photon_stats::add(photon_stats::BYTES_SEALED, dlen + mlen);
+
+  uint8_t state[32];
+
+  std::memcpy(state, nonce, NONCE_LEN);
+  std::memcpy(state + NONCE_LEN, key, KEY_LEN);
+
+  const auto [C0, C1] = photon_common::aead_constants<RATE>(dlen, mlen);
+
+  if (dlen > 0) {
+    photon_common::absorb<RATE>(state, data, dlen, C0);
+  }
+
+  alignas(16) uint8_t line[bulk::LINE];
+
+  const size_t lines_len = mlen - (mlen % bulk::LINE);
+  const size_t pf_end = mlen > BULK_PREFETCH_DIST ? mlen - BULK_PREFETCH_DIST
+                                                  : 0ul;
+
+  size_t off = 0;
+  while (off < lines_len) {
+    if (off < pf_end) [[likely]] {
+      bulk::prefetch(txt + off + BULK_PREFETCH_DIST);
+    }
+
+    for (size_t i = 0; i < bulk::LINE; i += RATE) {
+      photon::photon256(state);
+      photon_common::rho<RATE>(state, txt + off + i, line + i, RATE);
+    }
+
+    bulk::stream_line(enc + off, line);
+    off += bulk::LINE;
+  }
+  bulk::stream_fence();
+
+  for (; off < mlen; off += RATE) {
+    photon::photon256(state);
+
+    const auto len = std::min(RATE, mlen - off);
+    photon_common::rho<RATE>(state, txt + off, enc + off, len);
+  }
+
+  state[31] ^= (C1 << 5);
+  photon_common::gen_tag<TAG_LEN>(state, tag);
+
+  PHOTON_PROBE(encrypt_return, RATE, dlen, mlen);
+}
+
+// Photon-Beetle-AEAD decrypt routine, computing same plain text & verification
+// flag as `decrypt<RATE>`, which prefetches M -bytes cipher text ahead and
+// writes plain text using non-temporal stores, when M > threshold ( by default,
+// last level cache size, see `bulk_threshold` ). Shorter cipher text is
+// decrypted using `decrypt<RATE>` itself.
+//
+// Cipher text and plain text may live in same buffer, but they must not
+// partially overlap. Plain text is best kept 16 -bytes aligned, otherwise
+// regular stores are used.
+//
+// Note, before consuming decrypted bytes ensure presence of truth value in
+// returned boolean flag !
+template<const size_t RATE>
+inline bool
+decrypt_bulk(
+  const uint8_t* const __restrict key,   // 16 -bytes secret key
+  const uint8_t* const __restrict nonce, // 16 -bytes public message nonce
+  const uint8_t* const __restrict tag,   // 16 -bytes authentication tag
+  const uint8_t* const __restrict data,  // N -bytes associated data | N >= 0
+  const size_t dlen,                     // len(data) >= 0
+  const uint8_t* const enc,              // M -bytes cipher text | M >= 0
+  uint8_t* const txt,                    // M -bytes decrypted text | M >= 0
+  const size_t mlen,                     // len(enc) = len(txt) >= 0
+  const size_t threshold = bulk_threshold())
+  requires(photon_common::check_rate(RATE))
+{
+  if (mlen <= threshold || mlen < bulk::LINE) {
+    return decrypt<RATE>(key, nonce, tag, data, dlen, enc, txt, mlen);
+  }
+
+  PHOTON_PROBE(decrypt_entry, RATE, dlen, mlen);
+
+  [[maybe_unused]] const photon_stats::scope timed;
+  photon_stats::add(photon_stats::BYTES_OPENED, dlen + mlen);
+
+  uint8_t state[32];
+  uint8_t tag_[TAG_LEN];
+
+  std::memcpy(state, nonce, NONCE_LEN);
+  std::memcpy(state + NONCE_LEN, key, KEY_LEN);
+
+  const auto [C0, C1] = photon_common::aead_constants<RATE>(dlen, mlen);
+
+  if (dlen > 0) {
+    photon_common::absorb<RATE>(state, data, dlen, C0);
+  }
+
+  alignas(16) uint8_t line[bulk::LINE];
+
+  const size_t lines_len = mlen - (mlen % bulk::LINE);
+  const size_t pf_end = mlen > BULK_PREFETCH_DIST ? mlen - BULK_PREFETCH_DIST
+                                                  : 0ul;
+
+  size_t off = 0;
+  while (off < lines_len) {
+    if (off < pf_end) [[likely]] {
+      bulk::prefetch(enc + off + BULK_PREFETCH_DIST);
+    }
+
+    for (size_t i = 0; i < bulk::LINE; i += RATE) {
+      photon::photon256(state);
+      photon_common::inv_rho<RATE>(state, enc + off + i, line + i, RATE);
+    }
+
+    bulk::stream_line(txt + off, line);
+    off += bulk::LINE;
+  }
+  bulk::stream_fence();
+
+  for (; off < mlen; off += RATE) {
+    photon::photon256(state);
+
+    const auto len = std::min(RATE, mlen - off);
+    photon_common::inv_rho<RATE>(state, enc + off, txt + off, len);
+  }
+
+  state[31] ^= (C1 << 5);
+
+  photon_common::gen_tag<TAG_LEN>(state, tag_);
+  const auto flg = verify_tag(tag, tag_);
+  std::memset(txt, 0, !flg * mlen);
+  photon_stats::add(photon_stats::TAG_FAILURES, !flg);
+
+  PHOTON_PROBE(decrypt_return, RATE, dlen, mlen, flg);
+  return flg;
+}
+
+}
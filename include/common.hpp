@@ -22,111 +22,161 @@ check_out(const size_t out)
   return (out == 16) || (out == 32);
 }
 
-// Absorbs N (>=0) -bytes of input message into permutation state, see
-// `HASH<RATE>(IV, D, c0)` algorithm defined in figure 3.6 of Photon-Beetle
-// specification
+// Domain separation constants of Photon-Beetle-AEAD, which are added to
+// permutation state after absorbing associated data ( C0 ) & after
+// encrypting/ decrypting message ( C1 )
+struct aead_consts
+{
+  uint8_t c0;
+  uint8_t c1;
+};
+
+// Computes domain separation constants of Photon-Beetle-AEAD[RATE * 8], for
+// N -bytes associated data & M -bytes message, see `PHOTON-Beetle-AEAD.ENC[r]`
+// algorithm defined in figure 3.6 of Photon-Beetle specification. When both
+// are empty, only constant 1 is added, before generating tag, which is handled
+// by caller | N > 0 || M > 0
+// https://csrc.nist.gov/CSRC/media/Projects/lightweight-cryptography/documents/finalist-round/updated-spec-doc/photon-beetle-spec-final.pdf
+template<const size_t RATE>
+inline static constexpr aead_consts
+aead_constants(const size_t dlen, const size_t mlen)
+  requires(check_rate(RATE))
+{
+  const bool f0 = mlen > 0;
+  const bool f1 = (dlen & (RATE - 1)) == 0;
+  const bool f2 = dlen > 0;
+  const bool f3 = (mlen & (RATE - 1)) == 0;
+
+  const uint8_t C0 = (f0 && f1) ? 1 : f0 ? 2 : f1 ? 3 : 4;
+  const uint8_t C1 = (f2 && f3) ? 1 : f2 ? 2 : f3 ? 5 : 6;
+
+  return { C0, C1 };
+}
+
+// Absorbs a full RATE -bytes block of input message into rate portion of
+// permutation state, which must already be permuted, see `HASH<RATE>(IV, D,
+// c0)` algorithm defined in figure 3.6 of Photon-Beetle specification
 // https://csrc.nist.gov/CSRC/media/Projects/lightweight-cryptography/documents/finalist-round/updated-spec-doc/photon-beetle-spec-final.pdf
 template<const size_t RATE>
 inline static void
-absorb(uint8_t* const __restrict state,     // 8x4 permutation state
-       const uint8_t* const __restrict msg, // input message to be absorbed
-       const size_t mlen,                   // len(msg) | >= 0
-       const uint8_t C                      // domain seperation constant
-       )
+absorb_block(uint8_t* const __restrict state,    // 8x4 permutation state
+             const uint8_t* const __restrict msg // RATE -bytes message block
+             )
   requires(check_rate(RATE))
 {
   if constexpr (RATE == 4) {
     static_assert(RATE == 4, "Rate portion of state must be 32 -bit wide");
 
-    const size_t full_blk_cnt = mlen / RATE;
-    const size_t full_blk_bytes = full_blk_cnt * RATE;
+    uint32_t rate;
+    std::memcpy(&rate, state, RATE);
 
-    size_t off = 0;
-    while (off < full_blk_bytes) {
-      photon::photon256(state);
+    uint32_t mword;
+    std::memcpy(&mword, msg, RATE);
 
-      uint32_t rate;
-      std::memcpy(&rate, state, RATE);
+    const auto nrate = rate ^ mword;
+    std::memcpy(state, &nrate, RATE);
+  } else {
+    static_assert(RATE == 16, "Rate portion of state must be 128 -bit wide");
 
-      uint32_t mword;
-      std::memcpy(&mword, msg + off, RATE);
+    uint128_t rate;
+    std::memcpy(&rate, state, RATE);
 
-      const auto nrate = rate ^ mword;
-      std::memcpy(state, &nrate, RATE);
+    uint128_t mword;
+    std::memcpy(&mword, msg, RATE);
 
-      off += RATE;
-    }
+    const auto nrate = rate ^ mword;
+    std::memcpy(state, &nrate, RATE);
+  }
+}
 
-    const size_t rm_bytes = mlen - off;
-    if (rm_bytes > 0) {
-      photon::photon256(state);
+// Absorbs last, partially filled block of input message ( padded with 1 followed
+// by zeros ) into rate portion of permutation state, which must already be
+// permuted, see `HASH<RATE>(IV, D, c0)` algorithm defined in figure 3.6 of
+// Photon-Beetle specification
+// https://csrc.nist.gov/CSRC/media/Projects/lightweight-cryptography/documents/finalist-round/updated-spec-doc/photon-beetle-spec-final.pdf
+template<const size_t RATE>
+inline static void
+absorb_partial(uint8_t* const __restrict state,     // 8x4 permutation state
+               const uint8_t* const __restrict msg, // message block
+               const size_t rm_bytes                // len(msg) | < RATE
+               )
+  requires(check_rate(RATE))
+{
+  if constexpr (RATE == 4) {
+    static_assert(RATE == 4, "Rate portion of state must be 32 -bit wide");
 
-      if constexpr (std::endian::native == std::endian::little) {
-        uint32_t rate;
-        std::memcpy(&rate, state, RATE);
+    if constexpr (std::endian::native == std::endian::little) {
+      uint32_t rate;
+      std::memcpy(&rate, state, RATE);
 
-        uint32_t mword = 1u << (rm_bytes * 8);
-        std::memcpy(&mword, msg + off, rm_bytes);
+      uint32_t mword = 1u << (rm_bytes * 8);
+      std::memcpy(&mword, msg, rm_bytes);
 
-        const auto nrate = rate ^ mword;
-        std::memcpy(state, &nrate, RATE);
-      } else {
-        uint32_t rate;
-        std::memcpy(&rate, state, RATE);
+      const auto nrate = rate ^ mword;
+      std::memcpy(state, &nrate, RATE);
+    } else {
+      uint32_t rate;
+      std::memcpy(&rate, state, RATE);
 
-        uint32_t mword = 16777216u >> (rm_bytes * 8);
-        std::memcpy(&mword, msg + off, rm_bytes);
+      uint32_t mword = 16777216u >> (rm_bytes * 8);
+      std::memcpy(&mword, msg, rm_bytes);
 
-        const auto nrate = rate ^ mword;
-        std::memcpy(state, &nrate, RATE);
-      }
+      const auto nrate = rate ^ mword;
+      std::memcpy(state, &nrate, RATE);
     }
   } else {
     static_assert(RATE == 16, "Rate portion of state must be 128 -bit wide");
 
-    const size_t full_blk_cnt = mlen / RATE;
-    const size_t full_blk_bytes = full_blk_cnt * RATE;
+    if constexpr (std::endian::native == std::endian::little) {
+      uint128_t rate;
+      std::memcpy(&rate, state, RATE);
 
-    size_t off = 0;
-    while (off < full_blk_bytes) {
-      photon::photon256(state);
+      uint128_t mword = static_cast<uint128_t>(1) << (rm_bytes * 8);
+      std::memcpy(&mword, msg, rm_bytes);
 
+      const auto nrate = rate ^ mword;
+      std::memcpy(state, &nrate, RATE);
+    } else {
       uint128_t rate;
       std::memcpy(&rate, state, RATE);
 
-      uint128_t mword;
-      std::memcpy(&mword, msg + off, RATE);
+      uint128_t mword = static_cast<uint128_t>(1) << ((15 - rm_bytes) * 8);
+      std::memcpy(&mword, msg, rm_bytes);
 
       const auto nrate = rate ^ mword;
       std::memcpy(state, &nrate, RATE);
-
-      off += RATE;
     }
+  }
+}
 
-    const size_t rm_bytes = mlen - off;
-    if (rm_bytes > 0) {
-      photon::photon256(state);
-
-      if constexpr (std::endian::native == std::endian::little) {
-        uint128_t rate;
-        std::memcpy(&rate, state, RATE);
-
-        uint128_t mword = static_cast<uint128_t>(1) << (rm_bytes * 8);
-        std::memcpy(&mword, msg + off, rm_bytes);
+// Absorbs N (>=0) -bytes of input message into permutation state, see
+// `HASH<RATE>(IV, D, c0)` algorithm defined in figure 3.6 of Photon-Beetle
+// specification
+// https://csrc.nist.gov/CSRC/media/Projects/lightweight-cryptography/documents/finalist-round/updated-spec-doc/photon-beetle-spec-final.pdf
+template<const size_t RATE>
+inline static void
+absorb(uint8_t* const __restrict state,     // 8x4 permutation state
+       const uint8_t* const __restrict msg, // input message to be absorbed
+       const size_t mlen,                   // len(msg) | >= 0
+       const uint8_t C                      // domain seperation constant
+       )
+  requires(check_rate(RATE))
+{
+  const size_t full_blk_cnt = mlen / RATE;
+  const size_t full_blk_bytes = full_blk_cnt * RATE;
 
-        const auto nrate = rate ^ mword;
-        std::memcpy(state, &nrate, RATE);
-      } else {
-        uint128_t rate;
-        std::memcpy(&rate, state, RATE);
+  size_t off = 0;
+  while (off < full_blk_bytes) {
+    photon::photon256(state);
+    absorb_block<RATE>(state, msg + off);
 
-        uint128_t mword = static_cast<uint128_t>(1) << ((15 - rm_bytes) * 8);
-        std::memcpy(&mword, msg + off, rm_bytes);
+    off += RATE;
+  }
 
-        const auto nrate = rate ^ mword;
-        std::memcpy(state, &nrate, RATE);
-      }
-    }
+  const size_t rm_bytes = mlen - off;
+  if (rm_bytes > 0) {
+    photon::photon256(state);
+    absorb_partial<RATE>(state, msg + off, rm_bytes);
   }
 
   // add domain seperation constant
@@ -216,13 +266,18 @@ shuffle(const uint8_t* const __restrict state,
 
 // Linear function `ρ` used during authenticated encryption, as defined in
 // section 3.1 of Photon-Beetle specification
+//
+// Plain text and encrypted bytes may live in same buffer ( i.e. txt == enc ),
+// as each plain text byte is read before respective encrypted byte is written,
+// but they must not partially overlap.
+//
 // https://csrc.nist.gov/CSRC/media/Projects/lightweight-cryptography/documents/finalist-round/updated-spec-doc/photon-beetle-spec-final.pdf
 template<const size_t RATE>
 inline static void
-rho(uint8_t* const __restrict state,     // 8x4 permutation state
-    const uint8_t* const __restrict txt, // plain text
-    uint8_t* const __restrict enc,       // encrypted bytes
-    const size_t tlen                    // = len(txt) = len(txt) | <= RATE
+rho(uint8_t* const __restrict state, // 8x4 permutation state
+    const uint8_t* const txt,        // plain text
+    uint8_t* const enc,              // encrypted bytes
+    const size_t tlen                // = len(txt) = len(txt) | <= RATE
     )
   requires(check_rate(RATE))
 {
@@ -235,8 +290,10 @@ rho(uint8_t* const __restrict state,     // 8x4 permutation state
 #pragma GCC ivdep
 #endif
   for (size_t i = 0; i < tlen; i++) {
-    enc[i] = shuffled[i] ^ txt[i];
-    state[i] ^= txt[i];
+    const uint8_t t = txt[i];
+
+    enc[i] = shuffled[i] ^ t;
+    state[i] ^= t;
   }
 
   constexpr uint8_t br[]{ 0, 1 };
@@ -245,13 +302,17 @@ rho(uint8_t* const __restrict state,     // 8x4 permutation state
 
 // Linear function `ρ^-1` used during verified decryption ( which is just
 // inverse of `ρ` ), as defined in section 3.1 of Photon-Beetle specification
+//
+// Encrypted and plain text bytes may live in same buffer ( i.e. enc == txt ),
+// but they must not partially overlap.
+//
 // https://csrc.nist.gov/CSRC/media/Projects/lightweight-cryptography/documents/finalist-round/updated-spec-doc/photon-beetle-spec-final.pdf
 template<const size_t RATE>
 inline static void
-inv_rho(uint8_t* const __restrict state,     // 8x4 permutation state
-        const uint8_t* const __restrict enc, // encrypted text
-        uint8_t* const __restrict txt,       // plain text
-        const size_t tlen                    // = len(enc) = len(txt) | <= RATE
+inv_rho(uint8_t* const __restrict state, // 8x4 permutation state
+        const uint8_t* const enc,        // encrypted text
+        uint8_t* const txt,              // plain text
+        const size_t tlen                // = len(enc) = len(txt) | <= RATE
         )
   requires(check_rate(RATE))
 {
@@ -264,8 +325,10 @@ inv_rho(uint8_t* const __restrict state,     // 8x4 permutation state
 #pragma GCC ivdep
 #endif
   for (size_t i = 0; i < tlen; i++) {
-    txt[i] = shuffled[i] ^ enc[i];
-    state[i] ^= txt[i];
+    const uint8_t t = shuffled[i] ^ enc[i];
+
+    txt[i] = t;
+    state[i] ^= t;
   }
 
   constexpr uint8_t br[]{ 0, 1 };
@@ -0,0 +1,344 @@
+#pragma once
+#include "coro.hpp"
+#include "nonce.hpp"
+#include <vector>
+
+// Photon-Beetle-{Hash, AEAD} function(s)
+namespace photon_beetle {
+
+// Seekable encrypted container, which splits N (>=0) -bytes plain text into
+// fixed size blocks ( last one may be shorter ), each sealed on its own using
+// Photon-Beetle-AEAD[RATE * 8], so that any byte range can be read back by
+// decrypting & verifying only the blocks it touches. Layout is
+//
+//   header ( 48 -bytes ) || cipher text of block 0, 1, ... || footer index
+//
+// where header is
+//
+//   [ 0,  8) magic "PBSEEK01"
+//   [ 8,  9) RATE ∈ {4, 16}
+//   [ 9, 12) zero
+//   [12, 16) block length, little endian
+//   [16, 24) plain text length, little endian
+//   [24, 32) nonce prefix, which must never be reused under same key
+//   [32, 48) header tag
+//
+// Cipher text of a block is as long as its plain text, so block i lives at a
+// fixed offset, while footer index holds 16 -bytes tag of each block, in order.
+// Block i is sealed with nonce = prefix || BE64(i) & no associated data, while
+// header tag is what sealing empty message, with first 32 -bytes of header as
+// associated data, under nonce = prefix || BE64(2^64 - 1) yields. So header
+// authenticates block & total length, nonce binds each block to its position
+// in that container, and a tampered index entry fails its block's
+// verification.
+constexpr size_t CONTAINER_HEADER_LEN = 48;
+
+// Magic bytes, at the beginning of container header
+constexpr uint8_t CONTAINER_MAGIC[8]{ 'P', 'B', 'S', 'E', 'E', 'K', '0', '1' };
+
+// Counter value, used in header's nonce, which is never used by any block
+constexpr uint64_t CONTAINER_HEADER_CTR = ~0ul;
+
+namespace container {
+
+// Number of blocks, N -bytes plain text is split into
+inline static constexpr uint64_t
+block_cnt(const uint64_t plen, const size_t blen)
+{
+  return (plen + blen - 1) / blen;
+}
+
+// Computes header tag, over first 32 -bytes of header
+template<const size_t RATE>
+inline static void
+header_tag(const uint8_t* const __restrict key,
+           const uint8_t* const __restrict hdr,
+           uint8_t* const __restrict tag)
+{
+  uint8_t nonce[NONCE_LEN];
+  make_nonce(hdr + 24, CONTAINER_HEADER_CTR, nonce);
+
+  encrypt<RATE>(key, nonce, hdr, 32, nullptr, nullptr, 0, tag);
+}
+
+}
+
+// Total length of container holding N -bytes plain text, split into blocks of
+// B -bytes | B > 0
+inline constexpr size_t
+container_len(const uint64_t plen, const size_t blen)
+{
+  return CONTAINER_HEADER_LEN + plen +
+         container::block_cnt(plen, blen) * TAG_LEN;
+}
+
+// Seals N (>=0) -bytes plain text into a container of `container_len(N, B)`
+// -bytes, using given 16 -bytes key & 8 -bytes nonce prefix, splitting plain
+// text into blocks of B -bytes. Returns false, without touching output, when
+// block length is not in range 0 < B < 2^32.
+//
+// Blocks are sealed as interleaved coroutines, keeping ( at max ) `width` of
+// them in flight, see `run_tasks`.
+//
+// Note, never reuse same nonce prefix under same secret key !
+template<const size_t RATE>
+inline bool
+container_seal(const uint8_t* const __restrict key,    // 16 -bytes secret key
+               const uint8_t* const __restrict prefix, // 8 -bytes nonce prefix
+               const size_t blen,                      // block length
+               const uint8_t* const __restrict txt,    // N -bytes plain text
+               const uint64_t plen,                    // len(txt) >= 0
+               uint8_t* const __restrict out,          // container
+               const size_t width = 8)
+  requires(photon_common::check_rate(RATE))
+{
+  if (blen == 0 || blen > 0xfffffffful) [[unlikely]] {
+    return false;
+  }
+
+  uint8_t* const hdr = out;
+
+  std::memcpy(hdr, CONTAINER_MAGIC, sizeof(CONTAINER_MAGIC));
+  hdr[8] = static_cast<uint8_t>(RATE);
+  std::memset(hdr + 9, 0, 3);
+  for (size_t i = 0; i < 4; i++) {
+    hdr[12 + i] = static_cast<uint8_t>(blen >> (i * 8));
+  }
+  for (size_t i = 0; i < 8; i++) {
+    hdr[16 + i] = static_cast<uint8_t>(plen >> (i * 8));
+  }
+  std::memcpy(hdr + 24, prefix, NONCE_PREFIX_LEN);
+  container::header_tag<RATE>(key, hdr, hdr + 32);
+
+  const uint64_t cnt = container::block_cnt(plen, blen);
+  uint8_t* const enc = out + CONTAINER_HEADER_LEN;
+  uint8_t* const index = enc + plen;
+
+  // blocks are sealed in batches, so that only a batch worth of coroutine
+  // frames & nonces is alive at a time
+  constexpr size_t BATCH = 64;
+  uint8_t nonces[BATCH][NONCE_LEN];
+  std::vector<sponge_task> tasks;
+  tasks.reserve(BATCH);
+
+  for (uint64_t b = 0; b < cnt; b += BATCH) {
+    const uint64_t end = std::min<uint64_t>(cnt, b + BATCH);
+
+    tasks.clear();
+    for (uint64_t i = b; i < end; i++) {
+      const uint64_t off = i * blen;
+      const size_t len =
+        static_cast<size_t>(std::min<uint64_t>(blen, plen - off));
+
+      uint8_t* const nonce = nonces[i - b];
+      make_nonce(prefix, i, nonce);
+
+      tasks.push_back(encrypt_task<RATE>(key,
+                                         nonce,
+                                         nullptr,
+                                         0,
+                                         txt + off,
+                                         enc + off,
+                                         len,
+                                         index + i * TAG_LEN));
+    }
+
+    run_tasks(tasks, width);
+  }
+
+  return true;
+}
+
+// Random-access reader over a container, living in memory ( say, a memory
+// mapped file, see `photon_utils::mapped_file` ), which decrypts & verifies
+// only those blocks, a read touches.
+class container_reader
+{
+private:
+  const uint8_t* enc = nullptr;   // cipher text of block 0
+  const uint8_t* index = nullptr; // footer index
+  uint8_t key[KEY_LEN]{};
+  uint8_t prefix[NONCE_PREFIX_LEN]{};
+  size_t rate = 0;
+  size_t blen = 0;
+  uint64_t plen = 0;
+  uint64_t cnt = 0;
+  std::vector<uint8_t> scratch; // partially read first & last block
+
+  // Decrypts & verifies blocks [b, e), writing block i at dst[i - b], using
+  // Photon-Beetle-AEAD[RATE * 8], returning truth value if all of them verify
+  template<const size_t RATE>
+  inline bool open_blocks(const uint64_t b,
+                          const uint64_t e,
+                          uint8_t* const* const dst,
+                          const size_t width)
+  {
+    constexpr size_t BATCH = 64;
+    uint8_t nonces[BATCH][NONCE_LEN];
+    std::vector<sponge_task> tasks;
+    tasks.reserve(std::min<uint64_t>(BATCH, e - b));
+
+    bool flg = true;
+    for (uint64_t s = b; s < e; s += BATCH) {
+      const uint64_t t = std::min<uint64_t>(e, s + BATCH);
+
+      tasks.clear();
+      for (uint64_t i = s; i < t; i++) {
+        const uint64_t off = i * blen;
+        const size_t len =
+          static_cast<size_t>(std::min<uint64_t>(blen, plen - off));
+
+        uint8_t* const nonce = nonces[i - s];
+        make_nonce(prefix, i, nonce);
+
+        tasks.push_back(decrypt_task<RATE>(key,
+                                           nonce,
+                                           index + i * TAG_LEN,
+                                           nullptr,
+                                           0,
+                                           enc + off,
+                                           dst[i - b],
+                                           len));
+      }
+
+      run_tasks(tasks, width);
+      for (const auto& task : tasks) {
+        flg &= task.result();
+      }
+    }
+
+    return flg;
+  }
+
+public:
+  // Opens container of N -bytes, using given 16 -bytes key, verifying its
+  // header & checking that its length matches header. Returns false, when it
+  // doesn't, in which case reader must not be used. Container bytes must
+  // outlive reader.
+  inline bool open(const uint8_t* const __restrict key_,
+                   const uint8_t* const __restrict data,
+                   const size_t dlen)
+  {
+    *this = container_reader{};
+
+    if (dlen < CONTAINER_HEADER_LEN ||
+        std::memcmp(data, CONTAINER_MAGIC, sizeof(CONTAINER_MAGIC)) != 0) {
+      return false;
+    }
+
+    const size_t rate_ = data[8];
+    if (rate_ != 4 && rate_ != 16) {
+      return false;
+    }
+
+    uint8_t tag[TAG_LEN];
+    if (rate_ == 4) {
+      container::header_tag<4>(key_, data, tag);
+    } else {
+      container::header_tag<16>(key_, data, tag);
+    }
+    if (!verify_tag(data + 32, tag)) {
+      return false;
+    }
+
+    size_t blen_ = 0;
+    for (size_t i = 0; i < 4; i++) {
+      blen_ |= static_cast<size_t>(data[12 + i]) << (i * 8);
+    }
+
+    uint64_t plen_ = 0;
+    for (size_t i = 0; i < 8; i++) {
+      plen_ |= static_cast<uint64_t>(data[16 + i]) << (i * 8);
+    }
+
+    // authentic header may still not match truncated/ extended container
+    const uint64_t cnt_ = blen_ > 0 ? container::block_cnt(plen_, blen_) : 0;
+    const uint64_t body = dlen - CONTAINER_HEADER_LEN;
+    if (blen_ == 0 || plen_ > body || (body - plen_) / TAG_LEN != cnt_ ||
+        (body - plen_) % TAG_LEN != 0) {
+      return false;
+    }
+
+    std::memcpy(key, key_, KEY_LEN);
+    std::memcpy(prefix, data + 24, NONCE_PREFIX_LEN);
+    rate = rate_;
+    blen = blen_;
+    plen = plen_;
+    cnt = cnt_;
+    enc = data + CONTAINER_HEADER_LEN;
+    index = enc + plen;
+    scratch.resize(2 * blen);
+
+    return true;
+  }
+
+  // Length of plain text, held in container
+  inline uint64_t size() const { return plen; }
+
+  // Length of each block, except ( possibly ) the last one
+  inline size_t block_size() const { return blen; }
+
+  // Number of blocks, plain text is split into
+  inline uint64_t blocks() const { return cnt; }
+
+  // Reads N (>=0) -bytes of plain text, starting at given offset, decrypting &
+  // verifying only the blocks those bytes live in, keeping ( at max ) `width`
+  // of them in flight. Returns false, if range doesn't fit in plain text or any
+  // touched block fails verification, in which case output is zeroed.
+  inline bool read(const uint64_t off,
+                   uint8_t* const __restrict dst,
+                   const size_t len,
+                   const size_t width = 8)
+  {
+    if (off > plen || len > plen - off) {
+      std::memset(dst, 0, len);
+      return false;
+    }
+    if (len == 0) {
+      return true;
+    }
+
+    const uint64_t b = off / blen;
+    const uint64_t e = (off + len - 1) / blen + 1;
+
+    // fully covered blocks are decrypted straight into output, while partially
+    // covered first & last ones go through scratch space
+    std::vector<uint8_t*> dsts(e - b);
+    for (uint64_t i = b; i < e; i++) {
+      const uint64_t beg = i * blen;
+      const uint64_t end = std::min<uint64_t>(plen, beg + blen);
+
+      if (beg >= off && end <= off + len) {
+        dsts[i - b] = dst + (beg - off);
+      } else {
+        dsts[i - b] = scratch.data() + (i == b ? 0 : blen);
+      }
+    }
+
+    const bool flg = rate == 4 ? open_blocks<4>(b, e, dsts.data(), width)
+                               : open_blocks<16>(b, e, dsts.data(), width);
+    if (!flg) {
+      std::memset(dst, 0, len);
+      return false;
+    }
+
+    for (const uint64_t i : { b, e - 1 }) {
+      const uint8_t* const src = dsts[i - b];
+      if (src != scratch.data() && src != scratch.data() + blen) {
+        continue;
+      }
+
+      const uint64_t beg = std::max<uint64_t>(off, i * blen);
+      const uint64_t end = std::min<uint64_t>(off + len, (i + 1) * blen);
+      std::memcpy(dst + (beg - off), src + (beg - i * blen), end - beg);
+
+      if (b == e - 1) {
+        break;
+      }
+    }
+
+    return true;
+  }
+};
+
+}
@@ -0,0 +1,386 @@
+#pragma once
+#include "aead.hpp"
+#include "hash.hpp"
+#include <cassert>
+#include <coroutine>
+#include <exception>
+#include <span>
+#include <utility>
+
+// Photon-Beetle-{Hash, AEAD} function(s)
+namespace photon_beetle {
+
+// Resumable Photon-Beetle-{Hash, AEAD} operation, written as a C++20
+// coroutine, which suspends every time it needs its permutation state to be
+// permuted. Permutation itself is applied by the scheduler, which resumes the
+// coroutine afterwards, so that a single thread can keep many independent
+// sponges in flight, interleaving their permutation calls.
+//
+// Coroutine is lazily started i.e. it doesn't run until scheduled.
+class sponge_task
+{
+public:
+  struct promise_type
+  {
+    uint8_t* pending = nullptr; // state waiting to be permuted
+    bool result = true;         // verification flag, on completion
+
+    inline sponge_task get_return_object()
+    {
+      return sponge_task{ handle_t::from_promise(*this) };
+    }
+
+    inline std::suspend_always initial_suspend() noexcept { return {}; }
+    inline std::suspend_always final_suspend() noexcept { return {}; }
+    inline void return_value(const bool flg) { result = flg; }
+    inline void unhandled_exception() { std::terminate(); }
+  };
+
+  using handle_t = std::coroutine_handle<promise_type>;
+
+private:
+  handle_t hdl;
+
+  inline explicit sponge_task(const handle_t h)
+    : hdl{ h }
+  {
+  }
+
+public:
+  inline sponge_task() = default;
+
+  inline sponge_task(sponge_task&& other) noexcept
+    : hdl{ std::exchange(other.hdl, nullptr) }
+  {
+  }
+
+  inline sponge_task& operator=(sponge_task&& other) noexcept
+  {
+    if (this != &other) {
+      if (hdl) {
+        hdl.destroy();
+      }
+      hdl = std::exchange(other.hdl, nullptr);
+    }
+
+    return *this;
+  }
+
+  sponge_task(const sponge_task&) = delete;
+  sponge_task& operator=(const sponge_task&) = delete;
+
+  inline ~sponge_task()
+  {
+    if (hdl) {
+      hdl.destroy();
+    }
+  }
+
+  // Returns truth value if operation has run to completion
+  inline bool done() const { return !hdl || hdl.done(); }
+
+  // Returns verification flag of completed operation, which is always true for
+  // hashing/ encryption
+  inline bool result() const { return hdl.promise().result; }
+
+  // Permutation state which operation is waiting on, before it can be resumed,
+  // or nullptr when operation is not yet started
+  inline uint8_t* pending() const { return hdl.promise().pending; }
+
+  // Runs operation until it needs its state to be permuted or it completes |
+  // operation must neither be empty ( default-constructed/ moved-from ) nor
+  // already completed
+  inline void resume()
+  {
+    assert(!done());
+    hdl.resume();
+  }
+};
+
+// Awaitable, used from inside a `sponge_task`, which suspends calling
+// coroutine, handing its 256 -bit permutation state over to the scheduler.
+// When coroutine is resumed, state has been permuted using Photon256.
+struct permute
+{
+  uint8_t* state;
+
+  inline bool await_ready() const noexcept { return false; }
+  inline void await_suspend(sponge_task::handle_t h) const noexcept
+  {
+    h.promise().pending = state;
+  }
+  inline void await_resume() const noexcept {}
+};
+
+// Resumable version of Photon-Beetle-Hash, computing 32 -bytes digest of N
+// (>=0) -bytes message; produces same output as `photon_beetle::hash`
+inline sponge_task
+hash_task(const uint8_t* const msg, // input message
+          const size_t mlen,        // len(msg) >= 0
+          uint8_t* const digest     // 32 -bytes digest
+)
+{
+  photon_stats::add(photon_stats::BYTES_HASHED, mlen);
+
+  uint8_t state[32]{};
+
+  if (mlen <= 16) {
+    const bool flg = mlen < 16;
+
+    if (mlen > 0) {
+      std::memcpy(state, msg, mlen);
+      state[mlen & 15] ^= static_cast<uint8_t>(flg);
+    }
+
+    constexpr uint8_t br[]{ 2, 1 };
+    const uint8_t c0 = mlen == 0 ? 1 : br[flg];
+    state[31] ^= (c0 << 5);
+  } else {
+    std::memcpy(state, msg, 16);
+
+    const size_t rmlen = mlen - 16;
+    const uint8_t* const rmsg = msg + 16;
+
+    size_t off = 0;
+    for (; off + 4 <= rmlen; off += 4) {
+      co_await permute{ state };
+      photon_common::absorb_block<4>(state, rmsg + off);
+    }
+
+    if (off < rmlen) {
+      co_await permute{ state };
+      photon_common::absorb_partial<4>(state, rmsg + off, rmlen - off);
+    }
+
+    constexpr uint8_t C[]{ 2, 1 };
+    const uint8_t c0 = C[(rmlen & 3ul) == 0ul];
+    state[31] ^= (c0 << 5);
+  }
+
+  co_await permute{ state };
+  std::memcpy(digest, state, DIGEST_LEN / 2);
+
+  co_await permute{ state };
+  std::memcpy(digest + DIGEST_LEN / 2, state, DIGEST_LEN / 2);
+
+  co_return true;
+}
+
+// Resumable version of Photon-Beetle-AEAD[RATE * 8] encryption; produces same
+// output as `photon_beetle::encrypt<RATE>`
+template<const size_t RATE>
+sponge_task
+encrypt_task(const uint8_t* const key,   // 16 -bytes secret key
+             const uint8_t* const nonce, // 16 -bytes public message nonce
+             const uint8_t* const data,  // N -bytes associated data | N >= 0
+             const size_t dlen,          // len(data) >= 0
+             const uint8_t* const txt,   // N -bytes plain text | N >= 0
+             uint8_t* const enc,         // N -bytes cipher text | N >= 0
+             const size_t mlen,          // len(txt) = len(enc) >= 0
+             uint8_t* const tag          // 16 -bytes authentication tag
+             )
+  requires(photon_common::check_rate(RATE))
+{
+  photon_stats::add(photon_stats::BYTES_SEALED, dlen + mlen);
+
+  uint8_t state[32];
+
+  std::memcpy(state, nonce, NONCE_LEN);
+  std::memcpy(state + NONCE_LEN, key, KEY_LEN);
+
+  if ((dlen == 0) && (mlen == 0)) {
+    state[31] ^= (1 << 5);
+  } else {
+    const auto [C0, C1] = photon_common::aead_constants<RATE>(dlen, mlen);
+
+    if (dlen > 0) {
+      size_t off = 0;
+      for (; off + RATE <= dlen; off += RATE) {
+        co_await permute{ state };
+        photon_common::absorb_block<RATE>(state, data + off);
+      }
+
+      if (off < dlen) {
+        co_await permute{ state };
+        photon_common::absorb_partial<RATE>(state, data + off, dlen - off);
+      }
+
+      state[31] ^= (C0 << 5);
+    }
+
+    if (mlen > 0) {
+      for (size_t off = 0; off < mlen; off += RATE) {
+        co_await permute{ state };
+
+        const auto len = std::min(RATE, mlen - off);
+        photon_common::rho<RATE>(state, txt + off, enc + off, len);
+      }
+
+      state[31] ^= (C1 << 5);
+    }
+  }
+
+  co_await permute{ state };
+  std::memcpy(tag, state, TAG_LEN);
+
+  co_return true;
+}
+
+// Resumable version of Photon-Beetle-AEAD[RATE * 8] verified decryption;
+// produces same output as `photon_beetle::decrypt<RATE>`, while verification
+// flag is available via `sponge_task::result()`, after completion
+template<const size_t RATE>
+sponge_task
+decrypt_task(const uint8_t* const key,   // 16 -bytes secret key
+             const uint8_t* const nonce, // 16 -bytes public message nonce
+             const uint8_t* const tag,   // 16 -bytes authentication tag
+             const uint8_t* const data,  // N -bytes associated data | N >= 0
+             const size_t dlen,          // len(data) >= 0
+             const uint8_t* const enc,   // N -bytes cipher text | N >= 0
+             uint8_t* const txt,         // N -bytes decrypted text | N >= 0
+             const size_t mlen           // len(enc) = len(txt) >= 0
+             )
+  requires(photon_common::check_rate(RATE))
+{
+  photon_stats::add(photon_stats::BYTES_OPENED, dlen + mlen);
+
+  uint8_t state[32];
+  uint8_t tag_[TAG_LEN];
+
+  std::memcpy(state, nonce, NONCE_LEN);
+  std::memcpy(state + NONCE_LEN, key, KEY_LEN);
+
+  if ((dlen == 0) && (mlen == 0)) {
+    state[31] ^= (1 << 5);
+  } else {
+    const auto [C0, C1] = photon_common::aead_constants<RATE>(dlen, mlen);
+
+    if (dlen > 0) {
+      size_t off = 0;
+      for (; off + RATE <= dlen; off += RATE) {
+        co_await permute{ state };
+        photon_common::absorb_block<RATE>(state, data + off);
+      }
+
+      if (off < dlen) {
+        co_await permute{ state };
+        photon_common::absorb_partial<RATE>(state, data + off, dlen - off);
+      }
+
+      state[31] ^= (C0 << 5);
+    }
+
+    if (mlen > 0) {
+      for (size_t off = 0; off < mlen; off += RATE) {
+        co_await permute{ state };
+
+        const auto len = std::min(RATE, mlen - off);
+        photon_common::inv_rho<RATE>(state, enc + off, txt + off, len);
+      }
+
+      state[31] ^= (C1 << 5);
+    }
+  }
+
+  co_await permute{ state };
+  std::memcpy(tag_, state, TAG_LEN);
+
+  const auto flg = verify_tag(tag, tag_);
+  std::memset(txt, 0, !flg * mlen);
+  photon_stats::add(photon_stats::TAG_FAILURES, !flg);
+
+  co_return flg;
+}
+
+// Single-threaded scheduler, which drives given resumable Photon-Beetle-{Hash,
+// AEAD} operations to completion, keeping ( at max ) N -many of them in flight
+// and round-robin permuting their states, so that independent permutation
+// calls are issued back-to-back, filling CPU pipeline with independent work.
+// Pending states of in-flight tasks are permuted in groups of four ( or two ),
+// using `photon256_x4` ( or `photon256_x2` ), before resuming each of them.
+//
+// Empty ( default-constructed/ moved-from ) and already completed tasks are
+// skipped. Once this routine returns, each task's outputs & verification flag
+// are ready | 0 < N <= 64
+inline void
+run_tasks(std::span<sponge_task> tasks, const size_t width = 8)
+{
+  // interleaved tasks can't be timed on their own, so whole run is timed
+  [[maybe_unused]] const photon_stats::scope timed;
+
+  constexpr size_t MAX_WIDTH = 64;
+
+  const size_t cnt = tasks.size();
+  const size_t lanes = std::clamp<size_t>(width, 1, MAX_WIDTH);
+
+  size_t next = 0;   // index of next task to be started
+  size_t active = 0; // number of in-flight tasks
+  sponge_task* inflight[MAX_WIDTH];
+
+  // start first batch of tasks, running each until its first permutation
+  while (active < lanes && next < cnt) {
+    auto& t = tasks[next++];
+    if (t.done()) {
+      continue;
+    }
+    t.resume();
+
+    if (!t.done()) {
+      inflight[active++] = &t;
+    }
+  }
+
+  while (active > 0) {
+    // permute pending states of all in-flight tasks, four ( or two ) at a
+    // time, using interleaved permutation
+    size_t j = 0;
+    for (; j + 4 <= active; j += 4) {
+      photon::photon256_x4(inflight[j]->pending(),
+                           inflight[j + 1]->pending(),
+                           inflight[j + 2]->pending(),
+                           inflight[j + 3]->pending());
+    }
+    for (; j + 2 <= active; j += 2) {
+      photon::photon256_x2(inflight[j]->pending(), inflight[j + 1]->pending());
+    }
+    if (j < active) {
+      photon::photon256(inflight[j]->pending());
+    }
+
+    size_t i = 0;
+    while (i < active) {
+      auto& t = *inflight[i];
+
+      t.resume();
+
+      if (!t.done()) [[likely]] {
+        i++;
+        continue;
+      }
+
+      // refill freed slot with next not-yet-started task
+      bool refilled = false;
+      while (next < cnt) {
+        auto& n = tasks[next++];
+        if (n.done()) {
+          continue;
+        }
+        n.resume();
+
+        if (!n.done()) {
+          inflight[i] = &n;
+          refilled = true;
+          break;
+        }
+      }
+
+      if (!refilled) {
+        inflight[i] = inflight[--active];
+      } else {
+        i++;
+      }
+    }
+  }
+}
+
+}
@@ -0,0 +1,403 @@
+#pragma once
+#include "aead.hpp"
+#include "hash.hpp"
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+#if defined __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// Photon-Beetle-{Hash, AEAD} function(s)
+namespace photon_beetle {
+
+// Kind of cryptographic operation, which can be submitted to bulk engine
+enum class job_kind : uint8_t
+{
+  hash,
+  encrypt_32,
+  encrypt_128,
+  decrypt_32,
+  decrypt_128
+};
+
+// Descriptor of a single Photon-Beetle-{Hash, AEAD} operation, which doesn't
+// own any of the memory it points to. Caller must keep all buffers alive until
+// operation completes. Use static member functions for constructing it.
+struct job
+{
+  job_kind kind = job_kind::hash;
+  const uint8_t* key = nullptr;   // 16 -bytes secret key
+  const uint8_t* nonce = nullptr; // 16 -bytes public message nonce
+  const uint8_t* data = nullptr;  // N -bytes associated data
+  size_t dlen = 0;                // len(data) >= 0
+  const uint8_t* in = nullptr;    // M -bytes message/ plain/ cipher text
+  uint8_t* out = nullptr;         // M -bytes cipher/ plain text or digest
+  size_t len = 0;                 // len(in) >= 0
+  uint8_t* tag = nullptr;         // 16 -bytes tag, read on decrypt
+
+  // Computes 32 -bytes Photon-Beetle-Hash digest of N (>=0) -bytes message
+  static inline job hash(const uint8_t* const msg,
+                         const size_t mlen,
+                         uint8_t* const digest)
+  {
+    job j;
+    j.kind = job_kind::hash;
+    j.in = msg;
+    j.len = mlen;
+    j.out = digest;
+
+    return j;
+  }
+
+  // Encrypts M (>=0) -bytes plain text using Photon-Beetle-AEAD[RATE * 8]
+  template<const size_t RATE>
+  static inline job encrypt(const uint8_t* const key,
+                            const uint8_t* const nonce,
+                            const uint8_t* const data,
+                            const size_t dlen,
+                            const uint8_t* const txt,
+                            uint8_t* const enc,
+                            const size_t mlen,
+                            uint8_t* const tag)
+    requires(photon_common::check_rate(RATE))
+  {
+    job j;
+    j.kind = RATE == 4 ? job_kind::encrypt_32 : job_kind::encrypt_128;
+    j.key = key;
+    j.nonce = nonce;
+    j.data = data;
+    j.dlen = dlen;
+    j.in = txt;
+    j.out = enc;
+    j.len = mlen;
+    j.tag = tag;
+
+    return j;
+  }
+
+  // Decrypts M (>=0) -bytes cipher text using Photon-Beetle-AEAD[RATE * 8]
+  template<const size_t RATE>
+  static inline job decrypt(const uint8_t* const key,
+                            const uint8_t* const nonce,
+                            const uint8_t* const tag,
+                            const uint8_t* const data,
+                            const size_t dlen,
+                            const uint8_t* const enc,
+                            uint8_t* const txt,
+                            const size_t mlen)
+    requires(photon_common::check_rate(RATE))
+  {
+    job j;
+    j.kind = RATE == 4 ? job_kind::decrypt_32 : job_kind::decrypt_128;
+    j.key = key;
+    j.nonce = nonce;
+    j.data = data;
+    j.dlen = dlen;
+    j.in = enc;
+    j.out = txt;
+    j.len = mlen;
+    j.tag = const_cast<uint8_t*>(tag);
+
+    return j;
+  }
+};
+
+// Executes a single job on calling thread, returning verification flag for
+// decryption jobs, while for hashing/ encryption jobs it's always true.
+inline bool
+execute(const job& j)
+{
+  switch (j.kind) {
+    case job_kind::hash:
+      hash(j.in, j.len, j.out);
+      return true;
+    case job_kind::encrypt_32:
+      encrypt<4>(j.key, j.nonce, j.data, j.dlen, j.in, j.out, j.len, j.tag);
+      return true;
+    case job_kind::encrypt_128:
+      encrypt<16>(j.key, j.nonce, j.data, j.dlen, j.in, j.out, j.len, j.tag);
+      return true;
+    case job_kind::decrypt_32:
+      return decrypt<4>(
+        j.key, j.nonce, j.tag, j.data, j.dlen, j.in, j.out, j.len);
+    case job_kind::decrypt_128:
+      return decrypt<16>(
+        j.key, j.nonce, j.tag, j.data, j.dlen, j.in, j.out, j.len);
+  }
+
+  return false;
+}
+
+// Bulk cryptographic engine, which spreads submitted Photon-Beetle-{Hash, AEAD}
+// jobs over a pool of per-core workers. Each worker owns a job queue, which it
+// drains from back, while idle workers steal from front of others' queues, so
+// that skewed message sizes don't leave some cores idle.
+//
+// Note, both Photon-Beetle-Hash and Photon-Beetle-AEAD are sequential sponge
+// modes, so a single message can't be split across workers, instead a batch of
+// jobs is split into per-worker chunks.
+class engine
+{
+public:
+  // Invoked on worker thread, after job completes, with verification flag
+  using callback = std::function<void(bool)>;
+
+private:
+  struct task
+  {
+    job j;
+    callback done;
+  };
+
+  struct alignas(photon_utils::CACHE_LINE_LEN) worker
+  {
+    std::mutex lock;
+    std::deque<task> queue;
+  };
+
+  std::vector<std::unique_ptr<worker>> workers;
+  std::vector<std::thread> threads;
+
+  alignas(photon_utils::CACHE_LINE_LEN) std::atomic<size_t> queued{ 0 };
+  alignas(photon_utils::CACHE_LINE_LEN) std::atomic<size_t> inflight{ 0 };
+  alignas(photon_utils::CACHE_LINE_LEN) std::atomic<size_t> next_worker{ 0 };
+
+  std::mutex idle_lock;
+  std::condition_variable idle_cv;
+  std::condition_variable done_cv;
+  bool stop = false;
+
+  // Pops a task from back of own queue, or steals from front of some other
+  // worker's queue, returning truth value if a task is found
+  inline bool pop(const size_t wid, task& t)
+  {
+    {
+      auto& w = *workers[wid];
+      std::lock_guard<std::mutex> guard(w.lock);
+
+      if (!w.queue.empty()) {
+        t = std::move(w.queue.back());
+        w.queue.pop_back();
+        queued.fetch_sub(1, std::memory_order_relaxed);
+
+        return true;
+      }
+    }
+
+    const size_t wcnt = workers.size();
+    for (size_t i = 1; i < wcnt; i++) {
+      auto& w = *workers[(wid + i) % wcnt];
+      std::lock_guard<std::mutex> guard(w.lock);
+
+      if (!w.queue.empty()) {
+        t = std::move(w.queue.front());
+        w.queue.pop_front();
+        queued.fetch_sub(1, std::memory_order_relaxed);
+
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  // Event loop of a worker thread, which keeps executing tasks until engine
+  // is asked to stop & there's no more queued task
+  inline void run(const size_t wid)
+  {
+    task t;
+
+    while (true) {
+      if (pop(wid, t)) {
+        const bool flg = execute(t.j);
+        if (t.done) {
+          t.done(flg);
+        }
+
+        if (inflight.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+          std::lock_guard<std::mutex> guard(idle_lock);
+          done_cv.notify_all();
+        }
+
+        continue;
+      }
+
+      std::unique_lock<std::mutex> guard(idle_lock);
+      idle_cv.wait(guard, [&] {
+        return stop || queued.load(std::memory_order_relaxed) > 0;
+      });
+
+      if (stop && queued.load(std::memory_order_relaxed) == 0) {
+        break;
+      }
+    }
+  }
+
+  // Pins calling thread to given logical CPU, when supported by platform
+  static inline void pin_to_cpu(const size_t cpu)
+  {
+#if defined __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpu;
+#endif
+  }
+
+  // Enqueues N -many tasks into queue of given worker & wakes up idle workers
+  inline void push(const size_t wid, std::span<task> ts)
+  {
+    inflight.fetch_add(ts.size(), std::memory_order_relaxed);
+
+    // count tasks as queued before they become visible to stealers, so that
+    // counter never underflows
+    {
+      std::lock_guard<std::mutex> guard(idle_lock);
+      queued.fetch_add(ts.size(), std::memory_order_relaxed);
+    }
+
+    {
+      auto& w = *workers[wid];
+      std::lock_guard<std::mutex> guard(w.lock);
+
+      for (auto& t : ts) {
+        w.queue.push_back(std::move(t));
+      }
+    }
+
+    if (ts.size() == 1) {
+      idle_cv.notify_one();
+    } else {
+      idle_cv.notify_all();
+    }
+  }
+
+public:
+  // Spawns N -many worker threads, optionally pinning i-th worker to i-th
+  // logical CPU | N > 0, defaults to number of available hardware threads
+  inline explicit engine(
+    const size_t wcnt = std::max(1u, std::thread::hardware_concurrency()),
+    const bool pin = false)
+  {
+    const size_t cnt = std::max<size_t>(1, wcnt);
+    const size_t cpus = std::max(1u, std::thread::hardware_concurrency());
+
+    workers.reserve(cnt);
+    for (size_t i = 0; i < cnt; i++) {
+      workers.emplace_back(std::make_unique<worker>());
+    }
+
+    threads.reserve(cnt);
+    for (size_t i = 0; i < cnt; i++) {
+      threads.emplace_back([this, i, pin, cpus] {
+        if (pin) {
+          pin_to_cpu(i % cpus);
+        }
+        run(i);
+      });
+    }
+  }
+
+  engine(const engine&) = delete;
+  engine& operator=(const engine&) = delete;
+
+  // Drains all queued jobs & joins worker threads
+  inline ~engine()
+  {
+    {
+      std::lock_guard<std::mutex> guard(idle_lock);
+      stop = true;
+    }
+    idle_cv.notify_all();
+
+    for (auto& t : threads) {
+      t.join();
+    }
+  }
+
+  // Number of worker threads in pool
+  inline size_t size() const { return workers.size(); }
+
+  // Submits a single job, invoking completion callback on worker thread, after
+  // it's executed
+  inline void submit(const job& j, callback done)
+  {
+    const size_t wid = next_worker.fetch_add(1, std::memory_order_relaxed);
+
+    task t{ j, std::move(done) };
+    push(wid % workers.size(), std::span<task>(&t, 1));
+  }
+
+  // Submits a single job, returning a future, which resolves to verification
+  // flag, after it's executed
+  inline std::future<bool> submit(const job& j)
+  {
+    auto p = std::make_shared<std::promise<bool>>();
+    auto f = p->get_future();
+
+    submit(j, [p](const bool flg) { p->set_value(flg); });
+    return f;
+  }
+
+  // Submits a batch of jobs, splitting it into contiguous per-worker chunks,
+  // while writing i-th job's verification flag to i-th slot of flags ( when
+  // non-empty ). Call `wait()` before reading flags or outputs.
+  inline void submit(std::span<const job> js, std::span<bool> flags = {})
+  {
+    assert(flags.empty() || flags.size() == js.size());
+
+    const size_t wcnt = workers.size();
+    const size_t chunk = (js.size() + wcnt - 1) / wcnt;
+    const size_t wbeg = next_worker.fetch_add(wcnt, std::memory_order_relaxed);
+
+    std::vector<task> ts;
+    ts.reserve(chunk);
+
+    for (size_t w = 0; w < wcnt; w++) {
+      const size_t beg = std::min(js.size(), w * chunk);
+      const size_t end = std::min(js.size(), beg + chunk);
+
+      if (beg == end) {
+        break;
+      }
+
+      ts.clear();
+      for (size_t i = beg; i < end; i++) {
+        callback done;
+        if (!flags.empty()) {
+          bool* const slot = &flags[i];
+          done = [slot](const bool flg) { *slot = flg; };
+        }
+
+        ts.push_back(task{ js[i], std::move(done) });
+      }
+
+      push((wbeg + w) % wcnt, ts);
+    }
+  }
+
+  // Blocks calling thread until all submitted jobs are executed
+  inline void wait()
+  {
+    std::unique_lock<std::mutex> guard(idle_lock);
+    done_cv.wait(guard, [&] {
+      return inflight.load(std::memory_order_acquire) == 0;
+    });
+  }
+};
+
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include "common.hpp"
+#include "probes.hpp"
 
 // Photon-Beetle-{Hash, AEAD} function(s)
 namespace photon_beetle {
@@ -23,6 +24,11 @@ hash(const uint8_t* const __restrict msg, // input message
      uint8_t* const __restrict digest     // 32 -bytes digest
 )
 {
+  PHOTON_PROBE(hash_entry, mlen);
+
+  [[maybe_unused]] const photon_stats::scope timed;
+  photon_stats::add(photon_stats::BYTES_HASHED, mlen);
+
   uint8_t state[32]{};
 
   // when hashing empty message
@@ -30,6 +36,7 @@ hash(const uint8_t* const __restrict msg, // input message
     state[31] ^= (1 << 5);
     photon_common::gen_tag<32>(state, digest);
 
+    PHOTON_PROBE(hash_return, mlen);
     return;
   }
 
@@ -55,6 +62,7 @@ hash(const uint8_t* const __restrict msg, // input message
     state[31] ^= (c0 << 5);
     photon_common::gen_tag<32>(state, digest);
 
+    PHOTON_PROBE(hash_return, mlen);
     return;
   }
 
@@ -67,6 +75,106 @@ hash(const uint8_t* const __restrict msg, // input message
 
   photon_common::absorb<4>(state, msg + 16, rmlen, c0);
   photon_common::gen_tag<32>(state, digest);
+
+  PHOTON_PROBE(hash_return, mlen);
 }
 
+// Incremental Photon-Beetle-Hash, which absorbs N (>=0) -bytes message,
+// arriving in arbitrary sized chunks, and computes 32 -bytes digest, same as
+// what `hash` computes over whole message, in one go.
+//
+// First 16 -bytes of message are kept buffered, because whether message is
+// longer than 16 -bytes or not decides how it's absorbed. After that, message
+// is absorbed in 4 -bytes blocks, as soon as they're available.
+class hasher
+{
+private:
+  uint8_t state[32]{};
+  uint8_t buf[16]{};
+  size_t blen = 0;     // number of buffered message bytes
+  size_t total = 0;    // number of message bytes seen so far
+  bool loaded = false; // first 16 -bytes loaded into state ?
+
+public:
+  // Absorbs N (>=0) -bytes of message into hasher state, can be called any
+  // number of times, before finalizing
+  inline void absorb(const uint8_t* const __restrict msg, const size_t mlen)
+  {
+    [[maybe_unused]] const photon_stats::scope timed;
+    size_t off = 0;
+    total += mlen;
+
+    if (!loaded) {
+      const size_t take = std::min(16 - blen, mlen);
+      std::memcpy(buf + blen, msg, take);
+
+      blen += take;
+      off += take;
+
+      // message is known to be longer than 16 -bytes, only when some more
+      // bytes are available
+      if (blen < 16 || off == mlen) {
+        return;
+      }
+
+      std::memcpy(state, buf, 16);
+      loaded = true;
+      blen = 0;
+    }
+
+    if (blen > 0) {
+      const size_t take = std::min(4 - blen, mlen - off);
+      std::memcpy(buf + blen, msg + off, take);
+
+      blen += take;
+      off += take;
+
+      if (blen < 4) {
+        return;
+      }
+
+      photon::photon256(state);
+      photon_common::absorb_block<4>(state, buf);
+      blen = 0;
+    }
+
+    while (off + 4 <= mlen) {
+      photon::photon256(state);
+      photon_common::absorb_block<4>(state, msg + off);
+      off += 4;
+    }
+
+    std::memcpy(buf, msg + off, mlen - off);
+    blen = mlen - off;
+  }
+
+  // Finalizes hasher state, computing 32 -bytes digest of all message bytes
+  // absorbed so far. Hasher must not be used after this, without resetting.
+  inline void finalize(uint8_t* const __restrict digest)
+  {
+    if (!loaded) {
+      hash(buf, total, digest);
+      return;
+    }
+
+    // message bytes are counted once, when digest is computed
+    [[maybe_unused]] const photon_stats::scope timed;
+    photon_stats::add(photon_stats::BYTES_HASHED, total);
+
+    if (blen > 0) {
+      photon::photon256(state);
+      photon_common::absorb_partial<4>(state, buf, blen);
+    }
+
+    constexpr uint8_t C[]{ 2, 1 };
+    const uint8_t c0 = C[((total - 16) & 3ul) == 0ul];
+
+    state[31] ^= (c0 << 5);
+    photon_common::gen_tag<32>(state, digest);
+  }
+
+  // Resets hasher, so that it can be used for hashing a new message
+  inline void reset() { *this = hasher{}; }
+};
+
 }
@@ -0,0 +1,458 @@
+#pragma once
+#include "coro.hpp"
+#include "hash.hpp"
+#include <array>
+#include <bit>
+#include <span>
+#include <vector>
+
+// Photon-Beetle-{Hash, AEAD} function(s)
+namespace photon_beetle {
+
+// Merkle tree over Photon-Beetle-Hash, following tree shape & domain
+// separation of RFC 6962 ( Certificate Transparency ), section 2.1 i.e.
+//
+// - leaf hash of record d is `HASH(0x00 || d)`
+// - node hash of children l, r is `HASH(0x01 || l || r)`
+// - tree of n > 1 leaves is split at k, largest power of 2 smaller than n,
+//   into a left, perfect subtree of k leaves & a right subtree of n - k leaves
+// - root of empty tree is `HASH()`
+//
+// See https://www.rfc-editor.org/rfc/rfc6962#section-2.1
+using merkle_digest = std::array<uint8_t, DIGEST_LEN>;
+
+// Computes leaf hash of N (>=0) -bytes record
+inline void
+merkle_leaf(const uint8_t* const __restrict rec,
+            const size_t rlen,
+            uint8_t* const __restrict digest)
+{
+  constexpr uint8_t prefix = 0x00;
+
+  hasher h;
+  h.absorb(&prefix, 1);
+  h.absorb(rec, rlen);
+  h.finalize(digest);
+}
+
+// Computes node hash of two children; output may overlap with either input
+inline void
+merkle_node(const uint8_t* const left,
+            const uint8_t* const right,
+            uint8_t* const digest)
+{
+  uint8_t buf[1 + 2 * DIGEST_LEN];
+
+  buf[0] = 0x01;
+  std::memcpy(buf + 1, left, DIGEST_LEN);
+  std::memcpy(buf + 1 + DIGEST_LEN, right, DIGEST_LEN);
+
+  hash(buf, sizeof(buf), digest);
+}
+
+// Compact Merkle accumulator, which keeps only tree size & its frontier i.e.
+// roots of perfect subtrees, which tree of n leaves decomposes into, one per
+// set bit of n. That's enough for appending leaves in amortized O(1) ( worst
+// case O(log n) ) node hashes & computing root, while state stays O(log n)
+// sized, no matter how long the log is.
+class merkle_accumulator
+{
+private:
+  uint64_t cnt = 0;
+  merkle_digest frontier[64]{}; // i-th entry valid iff bit i of `cnt` is set
+
+  mutable merkle_digest cached{};
+  mutable bool fresh = false; // is `cached` root of current tree ?
+
+public:
+  // Number of leaves appended so far
+  inline uint64_t size() const { return cnt; }
+
+  // Appends leaf hash ( see `merkle_leaf` ), merging perfect subtrees of same
+  // size, just like carry propagates when incrementing a binary counter
+  inline void append_leaf(const uint8_t* const __restrict leaf)
+  {
+    merkle_digest carry;
+    std::memcpy(carry.data(), leaf, DIGEST_LEN);
+
+    size_t k = 0;
+    while ((cnt >> k) & 1ul) {
+      merkle_node(frontier[k].data(), carry.data(), carry.data());
+      k++;
+    }
+
+    frontier[k] = carry;
+    cnt++;
+    fresh = false;
+  }
+
+  // Appends N (>=0) -bytes record
+  inline void append(const uint8_t* const __restrict rec, const size_t rlen)
+  {
+    merkle_digest leaf;
+    merkle_leaf(rec, rlen, leaf.data());
+    append_leaf(leaf.data());
+  }
+
+  // Computes root of tree, by folding frontier, from smallest subtree to
+  // largest one; result is cached until next append
+  inline void root(uint8_t* const __restrict digest) const
+  {
+    if (!fresh) {
+      if (cnt == 0) {
+        photon_beetle::hash(nullptr, 0, cached.data());
+      } else {
+        size_t k = static_cast<size_t>(std::countr_zero(cnt));
+        cached = frontier[k];
+
+        for (k++; k < 64; k++) {
+          if ((cnt >> k) & 1ul) {
+            merkle_node(frontier[k].data(), cached.data(), cached.data());
+          }
+        }
+      }
+
+      fresh = true;
+    }
+
+    std::memcpy(digest, cached.data(), DIGEST_LEN);
+  }
+
+  // Serializes accumulator state as 8 -bytes little endian tree size, followed
+  // by frontier, from smallest subtree to largest one
+  inline std::vector<uint8_t> serialize() const
+  {
+    std::vector<uint8_t> out(8 + std::popcount(cnt) * DIGEST_LEN);
+    for (size_t i = 0; i < 8; i++) {
+      out[i] = static_cast<uint8_t>(cnt >> (i * 8));
+    }
+
+    size_t off = 8;
+    for (size_t k = 0; k < 64; k++) {
+      if ((cnt >> k) & 1ul) {
+        std::memcpy(out.data() + off, frontier[k].data(), DIGEST_LEN);
+        off += DIGEST_LEN;
+      }
+    }
+
+    return out;
+  }
+
+  // Restores accumulator state, serialized using `serialize`, returning false
+  // ( & leaving accumulator untouched ), if input is malformed
+  inline bool deserialize(std::span<const uint8_t> in)
+  {
+    if (in.size() < 8) {
+      return false;
+    }
+
+    uint64_t n = 0;
+    for (size_t i = 0; i < 8; i++) {
+      n |= static_cast<uint64_t>(in[i]) << (i * 8);
+    }
+
+    if (in.size() != 8 + std::popcount(n) * DIGEST_LEN) {
+      return false;
+    }
+
+    size_t off = 8;
+    for (size_t k = 0; k < 64; k++) {
+      if ((n >> k) & 1ul) {
+        std::memcpy(frontier[k].data(), in.data() + off, DIGEST_LEN);
+        off += DIGEST_LEN;
+      }
+    }
+
+    cnt = n;
+    fresh = false;
+    return true;
+  }
+};
+
+// Merkle tree, which keeps node hashes of all perfect subtrees, level by
+// level, so that along with appending records & computing root ( which the
+// compact accumulator can do too ), inclusion proofs can be generated for any
+// leaf. Records themselves are never kept; node hashes cost ~64 -bytes per
+// record.
+class merkle_tree
+{
+private:
+  // levels[k][j] is root of perfect subtree of 2^k leaves [j 2^k, (j+1) 2^k)
+  std::vector<std::vector<merkle_digest>> levels;
+
+  // Root of leaves [lo, lo + n), which is either looked up, for a perfect
+  // subtree, or computed, for right-most imperfect one
+  inline merkle_digest subtree(const uint64_t lo, const uint64_t n) const
+  {
+    if (std::has_single_bit(n)) {
+      const size_t k = static_cast<size_t>(std::countr_zero(n));
+      return levels[k][lo >> k];
+    }
+
+    const uint64_t k = std::bit_floor(n - 1);
+    const auto l = subtree(lo, k);
+    auto r = subtree(lo + k, n - k);
+
+    merkle_node(l.data(), r.data(), r.data());
+    return r;
+  }
+
+  // Audit path of m-th leaf of subtree [lo, lo + n), see section 2.1.1 of RFC
+  // 6962, pushed from leaf to root
+  inline void path(const uint64_t m,
+                   const uint64_t lo,
+                   const uint64_t n,
+                   std::vector<merkle_digest>& proof) const
+  {
+    if (n <= 1) {
+      return;
+    }
+
+    const uint64_t k = std::bit_floor(n - 1);
+    if (m < k) {
+      path(m, lo, k, proof);
+      proof.push_back(subtree(lo + k, n - k));
+    } else {
+      path(m - k, lo + k, n - k, proof);
+      proof.push_back(subtree(lo, k));
+    }
+  }
+
+public:
+  // Number of leaves appended so far
+  inline uint64_t size() const
+  {
+    return levels.empty() ? 0 : levels[0].size();
+  }
+
+  // Appends leaf hash ( see `merkle_leaf` ), completing O(log n) ( amortized
+  // O(1) ) parent nodes
+  inline void append_leaf(const uint8_t* const __restrict leaf)
+  {
+    if (levels.empty()) {
+      levels.emplace_back();
+    }
+
+    merkle_digest d;
+    std::memcpy(d.data(), leaf, DIGEST_LEN);
+    levels[0].push_back(d);
+
+    size_t k = 0;
+    while (levels[k].size() % 2 == 0) {
+      const auto& lvl = levels[k];
+      const size_t n = lvl.size();
+      merkle_node(lvl[n - 2].data(), lvl[n - 1].data(), d.data());
+
+      if (k + 1 == levels.size()) {
+        levels.emplace_back();
+      }
+      levels[++k].push_back(d);
+    }
+  }
+
+  // Appends N (>=0) -bytes record
+  inline void append(const uint8_t* const __restrict rec, const size_t rlen)
+  {
+    merkle_digest leaf;
+    merkle_leaf(rec, rlen, leaf.data());
+    append_leaf(leaf.data());
+  }
+
+  // Appends many records at once, whose leaf hashes are computed by
+  // interleaving ( at max ) W -many of them on calling thread, using
+  // `run_tasks`, before appending them in order | 0 < W <= 64
+  inline void append(std::span<const std::span<const uint8_t>> recs,
+                     const size_t width = 8)
+  {
+    size_t total = 0;
+    for (const auto& r : recs) {
+      total += 1 + r.size();
+    }
+
+    // leaf hash input is 0x00 || record, so records are laid out contiguously,
+    // each prefixed with 0x00
+    std::vector<uint8_t> buf(total);
+    std::vector<merkle_digest> leaves(recs.size());
+    std::vector<sponge_task> tasks;
+    tasks.reserve(recs.size());
+
+    size_t off = 0;
+    for (size_t i = 0; i < recs.size(); i++) {
+      const size_t len = 1 + recs[i].size();
+
+      buf[off] = 0x00;
+      std::copy(recs[i].begin(), recs[i].end(), buf.begin() + off + 1);
+      tasks.push_back(hash_task(buf.data() + off, len, leaves[i].data()));
+
+      off += len;
+    }
+
+    run_tasks(tasks, width);
+
+    for (const auto& leaf : leaves) {
+      append_leaf(leaf.data());
+    }
+  }
+
+  // Computes root of tree, by folding its frontier i.e. last node of each
+  // level holding odd number of nodes
+  inline void root(uint8_t* const __restrict digest) const
+  {
+    to_accumulator().root(digest);
+  }
+
+  // Compact accumulator, holding same tree, which can be persisted in
+  // O(log n) space, when inclusion proofs aren't needed anymore
+  inline merkle_accumulator to_accumulator() const
+  {
+    const uint64_t n = size();
+    std::vector<uint8_t> state(8 + std::popcount(n) * DIGEST_LEN);
+
+    for (size_t i = 0; i < 8; i++) {
+      state[i] = static_cast<uint8_t>(n >> (i * 8));
+    }
+
+    size_t off = 8;
+    for (size_t k = 0; k < levels.size(); k++) {
+      if ((n >> k) & 1ul) {
+        std::memcpy(state.data() + off, levels[k].back().data(), DIGEST_LEN);
+        off += DIGEST_LEN;
+      }
+    }
+
+    merkle_accumulator acc;
+    acc.deserialize(state);
+    return acc;
+  }
+
+  // Computes inclusion proof of i-th leaf, returning false, if it's not yet in
+  // tree | i < size()
+  inline bool prove(const uint64_t i, std::vector<merkle_digest>& proof) const
+  {
+    proof.clear();
+    if (i >= size()) {
+      return false;
+    }
+
+    path(i, 0, size(), proof);
+    return true;
+  }
+
+  // Serializes tree as 8 -bytes little endian number of leaves, followed by
+  // node hashes, level by level, starting at leaves, so that tree can be
+  // restored, without rehashing records
+  inline std::vector<uint8_t> serialize() const
+  {
+    size_t nodes = 0;
+    for (const auto& lvl : levels) {
+      nodes += lvl.size();
+    }
+
+    const uint64_t n = size();
+    std::vector<uint8_t> out(8 + nodes * DIGEST_LEN);
+
+    for (size_t i = 0; i < 8; i++) {
+      out[i] = static_cast<uint8_t>(n >> (i * 8));
+    }
+
+    size_t off = 8;
+    for (const auto& lvl : levels) {
+      for (const auto& d : lvl) {
+        std::memcpy(out.data() + off, d.data(), DIGEST_LEN);
+        off += DIGEST_LEN;
+      }
+    }
+
+    return out;
+  }
+
+  // Restores tree, serialized using `serialize`, returning false ( & leaving
+  // tree untouched ), if input is malformed
+  inline bool deserialize(std::span<const uint8_t> in)
+  {
+    if (in.size() < 8) {
+      return false;
+    }
+
+    uint64_t n = 0;
+    for (size_t i = 0; i < 8; i++) {
+      n |= static_cast<uint64_t>(in[i]) << (i * 8);
+    }
+
+    // leaves alone need n digests, which also keeps sum below from
+    // overflowing, as it's < 2n
+    const size_t cnt = (in.size() - 8) / DIGEST_LEN;
+    if (n > cnt) {
+      return false;
+    }
+
+    // level k holds n >> k nodes, while there's at least one of them
+    size_t nodes = 0;
+    for (uint64_t m = n; m > 0; m >>= 1) {
+      nodes += m;
+    }
+
+    if (cnt != nodes || (in.size() - 8) % DIGEST_LEN != 0) {
+      return false;
+    }
+
+    std::vector<std::vector<merkle_digest>> lvls;
+    size_t off = 8;
+
+    for (uint64_t m = n; m > 0; m >>= 1) {
+      auto& lvl = lvls.emplace_back(m);
+      for (auto& d : lvl) {
+        std::memcpy(d.data(), in.data() + off, DIGEST_LEN);
+        off += DIGEST_LEN;
+      }
+    }
+
+    levels = std::move(lvls);
+    return true;
+  }
+};
+
+// Verifies inclusion proof of i-th leaf, with given leaf hash, in tree of n
+// leaves, with given root, see section 2.1.3.2 of RFC 9162
+// https://www.rfc-editor.org/rfc/rfc9162#section-2.1.3.2
+inline bool
+merkle_verify(const uint8_t* const __restrict root,
+              const uint64_t n,
+              const uint64_t i,
+              const uint8_t* const __restrict leaf,
+              std::span<const merkle_digest> proof)
+{
+  if (i >= n) {
+    return false;
+  }
+
+  uint64_t fn = i;
+  uint64_t sn = n - 1;
+
+  merkle_digest r;
+  std::memcpy(r.data(), leaf, DIGEST_LEN);
+
+  for (const auto& p : proof) {
+    if (sn == 0) {
+      return false;
+    }
+
+    if ((fn & 1ul) || fn == sn) {
+      merkle_node(p.data(), r.data(), r.data());
+
+      while (!(fn & 1ul) && fn != 0) {
+        fn >>= 1;
+        sn >>= 1;
+      }
+    } else {
+      merkle_node(r.data(), p.data(), r.data());
+    }
+
+    fn >>= 1;
+    sn >>= 1;
+  }
+
+  return sn == 0 && std::memcmp(r.data(), root, DIGEST_LEN) == 0;
+}
+
+}
@@ -0,0 +1,174 @@
+#pragma once
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Utility functions used in Photon-Beetle-{Hash, AEAD}
+namespace photon_utils {
+
+// RAII wrapper over a memory mapped file, so that file contents can be
+// hashed/ encrypted/ decrypted in place, without first reading whole file into
+// a heap allocated buffer. File descriptor is closed as soon as mapping is
+// established.
+//
+// Note, mapping an empty file yields an empty ( nullptr ) mapping.
+class mapped_file
+{
+private:
+  uint8_t* ptr = nullptr;
+  size_t len = 0;
+
+  inline void release()
+  {
+    if (ptr != nullptr) {
+      munmap(ptr, len);
+    }
+
+    ptr = nullptr;
+    len = 0;
+  }
+
+  // Resizes opened file to N -bytes & maps it read-write, closing file
+  // descriptor in any case
+  inline bool map_rw(const int fd, const size_t flen)
+  {
+    if (ftruncate(fd, static_cast<off_t>(flen)) != 0) {
+      ::close(fd);
+      return false;
+    }
+
+    if (flen > 0) {
+      const int prot = PROT_READ | PROT_WRITE;
+      void* const p = mmap(nullptr, flen, prot, MAP_SHARED, fd, 0);
+      if (p == MAP_FAILED) {
+        ::close(fd);
+        return false;
+      }
+
+      madvise(p, flen, MADV_SEQUENTIAL);
+
+      ptr = static_cast<uint8_t*>(p);
+      len = flen;
+    }
+
+    ::close(fd);
+    return true;
+  }
+
+public:
+  inline mapped_file() = default;
+
+  inline mapped_file(mapped_file&& other) noexcept
+    : ptr{ std::exchange(other.ptr, nullptr) }
+    , len{ std::exchange(other.len, 0) }
+  {
+  }
+
+  inline mapped_file& operator=(mapped_file&& other) noexcept
+  {
+    if (this != &other) {
+      release();
+
+      ptr = std::exchange(other.ptr, nullptr);
+      len = std::exchange(other.len, 0);
+    }
+
+    return *this;
+  }
+
+  mapped_file(const mapped_file&) = delete;
+  mapped_file& operator=(const mapped_file&) = delete;
+
+  inline ~mapped_file() { release(); }
+
+  // Maps whole file, living at given path, read-only, hinting kernel that it'll
+  // be accessed sequentially, so that it reads ahead aggressively. Returns false
+  // on failure, leaving `errno` set.
+  inline bool open(const char* const path)
+  {
+    release();
+
+    const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+      ::close(fd);
+      return false;
+    }
+
+    const size_t flen = static_cast<size_t>(st.st_size);
+    if (flen > 0) {
+      void* const p = mmap(nullptr, flen, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (p == MAP_FAILED) {
+        ::close(fd);
+        return false;
+      }
+
+      madvise(p, flen, MADV_SEQUENTIAL);
+
+      ptr = static_cast<uint8_t*>(p);
+      len = flen;
+    }
+
+    ::close(fd);
+    return true;
+  }
+
+  // Creates ( or truncates ) file, living at given path, of N -bytes & maps it
+  // read-write, so that output can be written directly into page cache. Returns
+  // false on failure, leaving `errno` set.
+  inline bool create(const char* const path, const size_t flen)
+  {
+    release();
+
+    const int fd = ::open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+      return false;
+    }
+
+    return map_rw(fd, flen);
+  }
+
+  // Creates a new, uniquely named, file of N -bytes, from given `mkstemp`
+  // template ( ending with "XXXXXX", which is replaced in place by name of
+  // created file ) & maps it read-write. Existing files are never touched, so
+  // output can be written into such a temporary file, placed next to its final
+  // destination, and renamed over it only once it's known to be good. Returns
+  // false on failure, leaving `errno` set.
+  inline bool create_temp(char* const tmpl, const size_t flen)
+  {
+    release();
+
+    const int fd = mkostemp(tmpl, O_CLOEXEC);
+    if (fd < 0) {
+      return false;
+    }
+
+    if (!map_rw(fd, flen)) {
+      const int err = errno;
+      unlink(tmpl);
+      errno = err;
+      return false;
+    }
+
+    return true;
+  }
+
+  // Unmaps file, if mapped
+  inline void close() { release(); }
+
+  inline uint8_t* data() const { return ptr; }
+  inline size_t size() const { return len; }
+};
+
+}
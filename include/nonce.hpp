@@ -0,0 +1,144 @@
+#pragma once
+#include "aead.hpp"
+#include <atomic>
+#include <cassert>
+#include <limits>
+
+// Photon-Beetle-{Hash, AEAD} function(s)
+namespace photon_beetle {
+
+// Width of fixed prefix portion of 16 -bytes nonce, which is set once per
+// sequencer ( say, per secret key/ process ), rest 8 -bytes hold big-endian
+// 64 -bit counter
+constexpr size_t NONCE_PREFIX_LEN = NONCE_LEN - sizeof(uint64_t);
+
+// Upper bound on total number of nonces handed out by a sequencer. Keeping it
+// at 2^63 ensures that even if all threads keep reserving after exhaustion,
+// shared 64 -bit counter can't practically wrap around and start handing out
+// already used counter values.
+constexpr uint64_t MAX_NONCE_CNT = 1ul << 63;
+
+// Writes 16 -bytes nonce = prefix || BE64(counter), given 8 -bytes fixed
+// prefix & 64 -bit counter
+inline void
+make_nonce(const uint8_t* const __restrict prefix,
+           const uint64_t ctr,
+           uint8_t* const __restrict nonce)
+{
+  std::memcpy(nonce, prefix, NONCE_PREFIX_LEN);
+
+#if defined __clang__
+#pragma clang loop unroll(enable)
+#elif defined __GNUG__
+#pragma GCC unroll 8
+#endif
+  for (size_t i = 0; i < sizeof(ctr); i++) {
+    nonce[NONCE_PREFIX_LEN + i] = static_cast<uint8_t>(ctr >> (56 - i * 8));
+  }
+}
+
+// Contiguous range [beg, end) of nonce counters, reserved by some thread from
+// shared sequencer, which can be handed out locally, without touching any
+// shared state
+struct nonce_block
+{
+  uint8_t prefix[NONCE_PREFIX_LEN]{};
+  uint64_t beg = 0;
+  uint64_t end = 0;
+
+  // Number of nonces which are still left in this block
+  inline uint64_t remaining() const { return end - beg; }
+
+  // Writes next 16 -bytes nonce from this block, returning truth value, if
+  // block is not yet empty. Otherwise it returns false & nonce is not touched.
+  inline bool next(uint8_t* const __restrict nonce)
+  {
+    if (beg == end) [[unlikely]] {
+      return false;
+    }
+
+    make_nonce(prefix, beg++, nonce);
+    return true;
+  }
+};
+
+// Lock-free nonce sequencer, which can be shared among many threads encrypting
+// under same secret key, ensuring no ( key, nonce ) pair is ever reused.
+//
+// Each thread reserves a block of counters with a single atomic fetch-add on
+// shared counter & then hands out nonces from that block locally, so shared
+// cache line is touched only once per block. Nonce = prefix || BE64(counter).
+//
+// Note, unused counters of a reserved block are never given back, they are
+// simply skipped.
+class nonce_sequencer
+{
+private:
+  alignas(photon_utils::CACHE_LINE_LEN) std::atomic<uint64_t> ctr;
+  alignas(photon_utils::CACHE_LINE_LEN) uint8_t prefix[NONCE_PREFIX_LEN];
+  uint64_t limit;
+
+public:
+  // Given 8 -bytes fixed nonce prefix, starting counter value & exclusive upper
+  // bound on counter values, sets up a nonce sequencer | start <= limit <= 2^63
+  inline nonce_sequencer(const uint8_t* const __restrict prefix_,
+                         const uint64_t start = 0,
+                         const uint64_t limit_ = MAX_NONCE_CNT)
+    : ctr{ start }
+    , limit{ limit_ }
+  {
+    assert(start <= limit_);
+    assert(limit_ <= MAX_NONCE_CNT);
+
+    std::memcpy(prefix, prefix_, NONCE_PREFIX_LEN);
+  }
+
+  nonce_sequencer(const nonce_sequencer&) = delete;
+  nonce_sequencer& operator=(const nonce_sequencer&) = delete;
+
+  // Reserves a block of ( at max ) N -many nonce counters, using a single
+  // atomic fetch-add. Returned block may be shorter than requested one, when
+  // sequencer is close to exhaustion, while an empty block denotes that all
+  // counters are already consumed | 0 < N <= 2^32
+  inline nonce_block reserve(const uint64_t cnt)
+  {
+    assert(cnt > 0 && cnt <= (1ul << 32));
+
+    nonce_block blk;
+    std::memcpy(blk.prefix, prefix, NONCE_PREFIX_LEN);
+
+    const uint64_t beg = ctr.fetch_add(cnt, std::memory_order_relaxed);
+    if (beg >= limit) [[unlikely]] {
+      return blk;
+    }
+
+    blk.beg = beg;
+    blk.end = beg + std::min(cnt, limit - beg);
+
+    return blk;
+  }
+
+  // Writes next 16 -bytes nonce, taken from thread-local block, refilling it
+  // with N -many fresh counters from shared sequencer when it runs empty.
+  // Returns false only when sequencer is exhausted, in which case nonce must
+  // not be used.
+  inline bool next(nonce_block& blk,
+                   uint8_t* const __restrict nonce,
+                   const uint64_t cnt = 1024)
+  {
+    if (blk.next(nonce)) [[likely]] {
+      return true;
+    }
+
+    blk = reserve(cnt);
+    return blk.next(nonce);
+  }
+
+  // Returns truth value if all counters of this sequencer are already reserved
+  inline bool exhausted() const
+  {
+    return ctr.load(std::memory_order_relaxed) >= limit;
+  }
+};
+
+}
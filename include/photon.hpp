@@ -1,4 +1,6 @@
 #pragma once
+#include "profile.hpp"
+#include "stats.hpp"
 #include "utils.hpp"
 #include <array>
 #include <bit>
@@ -363,14 +365,255 @@ mix_column_serial(uint8_t* const __restrict state)
 
 // Photon256 permutation composed of 12 rounds, applied on a state matrix of
 // dimension 8x4, see chapter 2 ( on page 2 ) of the specification
+//
+// When compiled with `PHOTON_PROFILE` defined, cycles spent in each stage of
+// each round are accumulated into calling thread's counters, see
+// include/profile.hpp
+//
+// When compiled with `PHOTON_STATS` defined, each call is counted in calling
+// thread's `PERMUTATIONS` counter, see include/stats.hpp
 inline void
 photon256(uint8_t* const __restrict state)
 {
-  for (size_t i = 0; i < ROUNDS; i++) {
-    add_constant(state, i);
-    subcells(state);
-    shift_rows(state);
-    mix_column_serial(state);
+  static_assert(ROUNDS == photon_profile::ROUNDS);
+  photon_stats::add(photon_stats::PERMUTATIONS, 1);
+
+  if constexpr (photon_profile::ENABLED) {
+    using namespace photon_profile;
+
+    auto& c = local();
+    uint64_t t[STAGES + 1];
+
+    for (size_t i = 0; i < ROUNDS; i++) {
+      t[ADD_CONSTANT] = ticks();
+      add_constant(state, i);
+      t[SUBCELLS] = ticks();
+      subcells(state);
+      t[SHIFT_ROWS] = ticks();
+      shift_rows(state);
+      t[MIX_COLUMN_SERIAL] = ticks();
+      mix_column_serial(state);
+      t[STAGES] = ticks();
+
+      c.record(i, t);
+    }
+
+    c.calls++;
+  } else {
+    for (size_t i = 0; i < ROUNDS; i++) {
+      add_constant(state, i);
+      subcells(state);
+      shift_rows(state);
+      mix_column_serial(state);
+    }
+  }
+}
+
+// Interleaved Photon256, permuting 2P independent states in same loop body,
+// in SWAR ( SIMD within a register ) form, where i-th rows of a pair of
+// states ( each row is 8 cells of 4 -bits, which is exactly how it's laid out
+// in a little endian 32 -bit word ) are packed into lower & upper half of a 64
+// -bit word, while P such pairs are processed in innermost loop, so that their
+// instructions are independent of each other.
+//
+// MixColumnSerial is computed as new row i = ⊕_k M8[i][k] · row k, where
+// multiplication of packed cells by constant M8[i][k] ∈ GF(2^4) is ⊕ of row k
+// multiplied by 1, 2, 4 or 8 ( i.e. x^0 ... x^3 ), chosen using set bits of
+// constant; those are computed once per round, using doubling over packed
+// cells. SubCells still uses 8 -bit S-box table.
+//
+// Only used on little endian platform, see `photon256_x2` & `photon256_x4`.
+namespace swar {
+
+// Least significant bit of each 4 -bit cell
+constexpr uint64_t CELL_LSB = 0x1111111111111111ul;
+
+// Multiplies each of 16 packed 4 -bit cells by x ( i.e. 2 ) in GF(2^4), with
+// irreducible polynomial x^4 + x + 1
+inline static constexpr uint64_t
+xtime(const uint64_t x)
+{
+  return ((x << 1) & (CELL_LSB * 0xe)) ^ (((x >> 3) & CELL_LSB) * IRP);
+}
+
+// Rotates both 32 -bit halves of a 64 -bit word right by N -bits | 0 < N < 32
+inline static constexpr uint64_t
+rotr_x2(const uint64_t x, const size_t n)
+{
+  const uint64_t lo = (0xfffffffful >> n) * 0x100000001ul;
+  return ((x >> n) & lo) | ((x << (32 - n)) & ~lo);
+}
+
+// Applies 8 -bit S-box to each byte of a 64 -bit word
+inline static uint64_t
+subcells_x2(const uint64_t x)
+{
+  uint64_t res = 0;
+
+#if defined __clang__
+#pragma clang loop unroll(enable)
+#elif defined __GNUG__
+#pragma GCC unroll 8
+#endif
+  for (size_t i = 0; i < 8; i++) {
+    res |= static_cast<uint64_t>(SBOX[(x >> (i * 8)) & 0xff]) << (i * 8);
+  }
+
+  return res;
+}
+
+// Photon256 permutation on P pairs of permutation states, where states[2p] &
+// states[2p + 1] are packed into p-th pair
+template<const size_t P>
+inline static void
+permute(uint8_t* const* const states)
+{
+  uint64_t w[P][8];
+
+  for (size_t p = 0; p < P; p++) {
+    for (size_t i = 0; i < 8; i++) {
+      uint32_t lo, hi;
+      std::memcpy(&lo, states[2 * p] + i * 4, sizeof(lo));
+      std::memcpy(&hi, states[2 * p + 1] + i * 4, sizeof(hi));
+
+      w[p][i] = (static_cast<uint64_t>(hi) << 32) | lo;
+    }
+  }
+
+  for (size_t r = 0; r < ROUNDS; r++) {
+    // AddConstant, SubCells & ShiftRows, row by row
+#if defined __clang__
+#pragma clang loop unroll(enable)
+#elif defined __GNUG__
+#pragma GCC unroll 8
+#endif
+    for (size_t i = 0; i < 8; i++) {
+      const uint64_t rc = RC[r * 8 + i] * 0x100000001ul;
+
+#if defined __clang__
+#pragma clang loop unroll(enable)
+#elif defined __GNUG__
+#pragma GCC unroll 4
+#endif
+      for (size_t p = 0; p < P; p++) {
+        const uint64_t t = subcells_x2(w[p][i] ^ rc);
+        w[p][i] = i == 0 ? t : rotr_x2(t, i * 4);
+      }
+    }
+
+    // MixColumnSerial, with row k multiplied by x^b, kept in x[p][k][b]
+    uint64_t x[P][8][4];
+
+#if defined __clang__
+#pragma clang loop unroll(enable)
+#elif defined __GNUG__
+#pragma GCC unroll 8
+#endif
+    for (size_t k = 0; k < 8; k++) {
+#if defined __clang__
+#pragma clang loop unroll(enable)
+#elif defined __GNUG__
+#pragma GCC unroll 4
+#endif
+      for (size_t p = 0; p < P; p++) {
+        x[p][k][0] = w[p][k];
+        x[p][k][1] = xtime(x[p][k][0]);
+        x[p][k][2] = xtime(x[p][k][1]);
+        x[p][k][3] = xtime(x[p][k][2]);
+      }
+    }
+
+#if defined __clang__
+#pragma clang loop unroll(enable)
+#elif defined __GNUG__
+#pragma GCC unroll 8
+#endif
+    for (size_t i = 0; i < 8; i++) {
+#if defined __clang__
+#pragma clang loop unroll(enable)
+#elif defined __GNUG__
+#pragma GCC unroll 4
+#endif
+      for (size_t p = 0; p < P; p++) {
+        uint64_t acc = 0;
+
+#if defined __clang__
+#pragma clang loop unroll(enable)
+#elif defined __GNUG__
+#pragma GCC unroll 8
+#endif
+        for (size_t k = 0; k < 8; k++) {
+          const uint8_t c = M8[i * 8 + k];
+
+#if defined __clang__
+#pragma clang loop unroll(enable)
+#elif defined __GNUG__
+#pragma GCC unroll 4
+#endif
+          for (size_t b = 0; b < 4; b++) {
+            if ((c >> b) & 1) {
+              acc ^= x[p][k][b];
+            }
+          }
+        }
+
+        w[p][i] = acc;
+      }
+    }
+  }
+
+  for (size_t p = 0; p < P; p++) {
+    for (size_t i = 0; i < 8; i++) {
+      const auto lo = static_cast<uint32_t>(w[p][i]);
+      const auto hi = static_cast<uint32_t>(w[p][i] >> 32);
+
+      std::memcpy(states[2 * p] + i * 4, &lo, sizeof(lo));
+      std::memcpy(states[2 * p + 1] + i * 4, &hi, sizeof(hi));
+    }
+  }
+}
+
+}
+
+// Applies Photon256 permutation on 2 independent states, producing same output
+// as calling `photon256` on each of them, but keeping scalar execution ports
+// busier, see `swar::permute`. States must not overlap.
+//
+// When compiled with `PHOTON_PROFILE` defined or on big endian platform, it
+// falls back to calling `photon256` on each state.
+inline void
+photon256_x2(uint8_t* const __restrict s0, uint8_t* const __restrict s1)
+{
+  if constexpr (photon_profile::ENABLED ||
+                std::endian::native != std::endian::little) {
+    photon256(s0);
+    photon256(s1);
+  } else {
+    photon_stats::add(photon_stats::PERMUTATIONS, 2);
+
+    uint8_t* const states[]{ s0, s1 };
+    swar::permute<1>(states);
+  }
+}
+
+// Applies Photon256 permutation on 4 independent states, see `photon256_x2`
+inline void
+photon256_x4(uint8_t* const __restrict s0,
+             uint8_t* const __restrict s1,
+             uint8_t* const __restrict s2,
+             uint8_t* const __restrict s3)
+{
+  if constexpr (photon_profile::ENABLED ||
+                std::endian::native != std::endian::little) {
+    photon256(s0);
+    photon256(s1);
+    photon256(s2);
+    photon256(s3);
+  } else {
+    photon_stats::add(photon_stats::PERMUTATIONS, 4);
+
+    uint8_t* const states[]{ s0, s1, s2, s3 };
+    swar::permute<2>(states);
   }
 }
 
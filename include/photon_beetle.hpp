@@ -2,3 +2,4 @@
 
 #include "aead.hpp"
 #include "hash.hpp"
+#include "nonce.hpp"
@@ -0,0 +1,155 @@
+#pragma once
+#include "engine.hpp"
+#include "spsc_ring.hpp"
+#include <chrono>
+
+// Photon-Beetle-{Hash, AEAD} function(s)
+namespace photon_beetle {
+
+// Descriptor of a packet, flowing through pipeline stage, which carries a
+// Photon-Beetle-{Hash, AEAD} job ( pointing to caller owned buffers ), its
+// verification flag ( set by crypto worker ) & an opaque caller defined
+// timestamp/ cookie, which is passed through untouched
+struct packet
+{
+  job j;
+  bool ok = false;
+  uint64_t stamp = 0;
+};
+
+// Streaming pipeline stage, sitting between a producer ( say, network RX ) and
+// a consumer ( say, network TX ). Producer submits packet descriptors into RX
+// ring, a dedicated crypto worker drains it in bursts, seals/ opens packets &
+// forwards them, in order, into TX ring, from where consumer collects them.
+//
+// Worker processes a burst as soon as it has gathered BURST -many packets, or
+// when oldest packet of a partially filled burst has waited for longer than
+// flush timeout, which bounds latency under light load.
+//
+// Note, `submit` must only be called from one producer thread & `collect` from
+// one consumer thread.
+template<const size_t CAP = 1024>
+class pipeline_stage
+{
+private:
+  photon_utils::spsc_ring<packet, CAP> rx;
+  photon_utils::spsc_ring<packet, CAP> tx;
+
+  const size_t burst;
+  const std::chrono::nanoseconds flush_after;
+
+  alignas(photon_utils::CACHE_LINE_LEN) std::atomic<bool> stop{ false };
+  std::thread worker;
+
+  // Event loop of crypto worker
+  inline void run()
+  {
+    using clock = std::chrono::steady_clock;
+
+    std::vector<packet> buf(burst);
+    size_t cnt = 0;
+    clock::time_point first{};
+
+    while (true) {
+      const size_t n = rx.pop(std::span(buf.data() + cnt, burst - cnt));
+      if (cnt == 0 && n > 0) {
+        first = clock::now();
+      }
+      cnt += n;
+
+      if (cnt == 0) {
+        if (stop.load(std::memory_order_acquire)) {
+          break;
+        }
+
+        std::this_thread::yield();
+        continue;
+      }
+
+      const bool full = cnt == burst;
+      const bool stale = (clock::now() - first) >= flush_after;
+      const bool draining = stop.load(std::memory_order_acquire);
+
+      if (!(full || stale || draining)) {
+        std::this_thread::yield();
+        continue;
+      }
+
+      for (size_t i = 0; i < cnt; i++) {
+        buf[i].ok = execute(buf[i].j);
+      }
+
+      // When stopping, forwarding is abandoned once TX ring has stayed full
+      // for longer than flush timeout, so that a consumer which has stopped
+      // collecting can't keep worker from being joined
+      size_t off = 0;
+      clock::time_point moved = clock::now();
+      while (off < cnt) {
+        const size_t n =
+          tx.push(std::span<const packet>(buf.data() + off, cnt - off));
+        off += n;
+        if (off == cnt) {
+          break;
+        }
+
+        const auto now = clock::now();
+        if (n > 0) {
+          moved = now;
+        } else if (stop.load(std::memory_order_acquire) &&
+                   (now - moved) >= flush_after) {
+          break;
+        }
+
+        std::this_thread::yield();
+      }
+
+      cnt = 0;
+    }
+  }
+
+public:
+  // Spawns crypto worker, which processes packets in bursts of ( at max ) N
+  // -many, flushing partial burst after given timeout | 0 < N <= CAP
+  inline explicit pipeline_stage(
+    const size_t burst_ = 32,
+    const std::chrono::nanoseconds flush_after_ = std::chrono::microseconds(10))
+    : burst{ std::clamp<size_t>(burst_, 1, CAP) }
+    , flush_after{ flush_after_ }
+  {
+    worker = std::thread([this] { run(); });
+  }
+
+  pipeline_stage(const pipeline_stage&) = delete;
+  pipeline_stage& operator=(const pipeline_stage&) = delete;
+
+  // Processes all packets which are already submitted & joins crypto worker.
+  //
+  // Processed packets are still forwarded into TX ring, for a consumer which
+  // keeps collecting while stage is being destroyed. But once TX ring stays
+  // full for longer than flush timeout, rest of descriptors are dropped ( their
+  // buffers are still sealed/ opened ), so shutdown never waits on a consumer
+  // which has stopped collecting. Uncollected packets are gone along with the
+  // stage.
+  inline ~pipeline_stage()
+  {
+    stop.store(true, std::memory_order_release);
+    worker.join();
+  }
+
+  // Producer side: submits ( at max ) N -many packets, returning how many of
+  // them were accepted, which may be lesser than N, if RX ring is full
+  inline size_t submit(std::span<const packet> pkts) { return rx.push(pkts); }
+
+  // Producer side: submits single packet, returning false if RX ring is full
+  inline bool submit(const packet& pkt) { return rx.push(pkt); }
+
+  // Consumer side: collects ( at max ) N -many processed packets, returning how
+  // many of them were actually collected
+  inline size_t collect(std::span<packet> pkts) { return tx.pop(pkts); }
+
+  // Consumer side: collects single processed packet, returning false if none
+  // is ready
+  inline bool collect(packet& pkt) { return tx.pop(pkt); }
+};
+
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+// User-level statically defined tracing ( USDT ) probes, placed at entry & exit
+// of Photon-Beetle-{Hash, AEAD} routines, so that latency of crypto work can
+// be traced in live processes, using bpftrace/ perf, without rebuilding them.
+//
+// Probes are compiled in, when systemtap's `<sys/sdt.h>` is available ( on
+// Debian/ Ubuntu, it's provided by `systemtap-sdt-dev` ), unless
+// `PHOTON_NO_USDT` is defined. Each probe is a single NOP instruction, along
+// with an ELF note describing where its arguments live, which tracer patches,
+// only while it's attached. When header is not available, probes expand to
+// nothing.
+//
+// All probes live under provider `photon_beetle`
+//
+// - hash_entry(mlen), hash_return(mlen)
+// - encrypt_entry(rate, dlen, mlen), encrypt_return(rate, dlen, mlen)
+// - decrypt_entry(rate, dlen, mlen), decrypt_return(rate, dlen, mlen, ok)
+//
+// C-ABI batched routines ( see wrapper/photon-beetle.cpp ) fire
+//
+// - hash_batch_entry(cnt, threads), hash_batch_return(cnt, threads)
+// - encrypt_batch_entry(rate, cnt, threads), encrypt_batch_return(rate, cnt,
+// threads)
+// - decrypt_batch_entry(rate, cnt, threads), decrypt_batch_return(rate, cnt,
+// threads, ok)
+//
+// while their single message counterparts are covered by probes of routines
+// they wrap.
+//
+// See scripts/latency.bt for a sample bpftrace script.
+#if !defined PHOTON_NO_USDT && __has_include(<sys/sdt.h>)
+
+#include <sys/sdt.h>
+#define PHOTON_PROBE(name, ...) STAP_PROBEV(photon_beetle, name, __VA_ARGS__)
+
+namespace photon_probes {
+constexpr bool ENABLED = true;
+}
+
+#else
+
+#define PHOTON_PROBE(name, ...)
+
+namespace photon_probes {
+constexpr bool ENABLED = false;
+}
+
+#endif
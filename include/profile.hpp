@@ -0,0 +1,181 @@
+#pragma once
+#include "utils.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#if defined __x86_64__ || defined __i386__
+#include <x86intrin.h>
+#endif
+
+// Per-stage profiling of Photon256 permutation, enabled at compile-time by
+// defining `PHOTON_PROFILE` ( say, -DPHOTON_PROFILE ). When enabled, each round
+// of permutation reads cycle counter around each of its four stages, adding
+// elapsed cycles to counters of calling thread, which can be dumped using
+// `report`. When disabled, instrumented code path is discarded at compile-time,
+// so permutation is exactly same as uninstrumented one.
+//
+// Note, profiling perturbs what it measures ( counter reads serialize
+// execution, preventing overlap of adjacent stages ), so use it for finding
+// relative cost of stages, not for absolute throughput figures.
+namespace photon_profile {
+
+#if defined PHOTON_PROFILE
+constexpr bool ENABLED = true;
+#else
+constexpr bool ENABLED = false;
+#endif
+
+// Photon256 permutation has 12 rounds ( same as `photon::ROUNDS` )
+constexpr size_t ROUNDS = 12ul;
+
+// Stages of each round of Photon256 permutation
+enum stage : size_t
+{
+  ADD_CONSTANT,
+  SUBCELLS,
+  SHIFT_ROWS,
+  MIX_COLUMN_SERIAL,
+  STAGES
+};
+
+constexpr const char* STAGE_NAMES[STAGES]{
+  "add_constant",
+  "subcells",
+  "shift_rows",
+  "mix_column_serial",
+};
+
+// Reads cycle counter ( time stamp counter on x86, nanoseconds elsewhere ),
+// which neither compiler nor CPU can reorder with respect to preceding code
+inline uint64_t
+ticks()
+{
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+
+#if defined __x86_64__ || defined __i386__
+  _mm_lfence();
+  const uint64_t t = __rdtsc();
+#else
+  using namespace std::chrono;
+  const auto d = steady_clock::now().time_since_epoch();
+  const auto ns = duration_cast<nanoseconds>(d).count();
+  const uint64_t t = static_cast<uint64_t>(ns);
+#endif
+
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+  return t;
+}
+
+// Unit of what `ticks` returns
+#if defined __x86_64__ || defined __i386__
+constexpr const char* TICK_UNIT = "cycles";
+#else
+constexpr const char* TICK_UNIT = "ns";
+#endif
+
+// Per-thread accumulated cycles, spent in each stage of each round
+struct counters
+{
+  uint64_t cycles[ROUNDS][STAGES]{};
+  uint64_t calls = 0;
+
+  // Records cycle counter readings taken at start of each stage of r-th round
+  // & at end of last stage
+  inline void record(const size_t r, const uint64_t (&t)[STAGES + 1])
+  {
+    for (size_t s = 0; s < STAGES; s++) {
+      cycles[r][s] += t[s + 1] - t[s];
+    }
+  }
+
+  inline void reset() { *this = counters{}; }
+};
+
+// Returns counters of calling thread
+inline counters&
+local()
+{
+  static thread_local counters c;
+  return c;
+}
+
+// Estimates cost of a single `ticks` call, which is subtracted from each
+// measured stage, taking minimum over many back to back readings
+inline double
+overhead()
+{
+  uint64_t best = UINT64_MAX;
+
+  for (size_t i = 0; i < 1024; i++) {
+    const uint64_t t0 = ticks();
+    const uint64_t t1 = ticks();
+    best = std::min(best, t1 - t0);
+  }
+
+  return static_cast<double>(best);
+}
+
+// Writes per-stage & per-round breakdown of given counters, averaged over all
+// recorded permutation calls, into given stream
+inline void
+report(std::FILE* const out, const counters& c = local())
+{
+  using namespace photon_utils;
+
+  std::fprintf(out, "# Photon256 per-stage profile\n");
+  std::fprintf(out, "# compiler : %s\n", compiler_name());
+  std::fprintf(
+    out, "# backend  : %s ( mix_column_serial )\n", photon_backend());
+  std::fprintf(out, "# calls    : %zu\n", static_cast<size_t>(c.calls));
+
+  if (c.calls == 0) {
+    return;
+  }
+
+  const double calls = static_cast<double>(c.calls);
+  const double ovh = overhead();
+
+  double per_round[ROUNDS][STAGES];
+  double per_stage[STAGES]{};
+  double total = 0.;
+
+  for (size_t r = 0; r < ROUNDS; r++) {
+    for (size_t s = 0; s < STAGES; s++) {
+      const double v = static_cast<double>(c.cycles[r][s]) / calls - ovh;
+      per_round[r][s] = std::max(v, 0.);
+      per_stage[s] += per_round[r][s];
+      total += per_round[r][s];
+    }
+  }
+
+  std::fprintf(out, "# %s per permutation call, ", TICK_UNIT);
+  std::fprintf(out, "after subtracting %.1f of timer overhead\n\n", ovh);
+
+  std::fprintf(out, "%-20s %12s %8s\n", "stage", TICK_UNIT, "share");
+  for (size_t s = 0; s < STAGES; s++) {
+    const double share = total > 0. ? 100. * per_stage[s] / total : 0.;
+    std::fprintf(
+      out, "%-20s %12.1f %7.1f%%\n", STAGE_NAMES[s], per_stage[s], share);
+  }
+  std::fprintf(out, "%-20s %12.1f\n\n", "total", total);
+
+  std::fprintf(out, "%-6s", "round");
+  for (size_t s = 0; s < STAGES; s++) {
+    std::fprintf(out, " %18s", STAGE_NAMES[s]);
+  }
+  std::fprintf(out, "\n");
+
+  for (size_t r = 0; r < ROUNDS; r++) {
+    std::fprintf(out, "%-6zu", r);
+    for (size_t s = 0; s < STAGES; s++) {
+      std::fprintf(out, " %18.1f", per_round[r][s]);
+    }
+    std::fprintf(out, "\n");
+  }
+}
+
+}
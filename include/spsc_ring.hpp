@@ -0,0 +1,98 @@
+#pragma once
+#include "utils.hpp"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <span>
+
+// Utility functions used in Photon-Beetle-{Hash, AEAD}
+namespace photon_utils {
+
+// Compile-time check for ensuring that ring capacity is a power of 2
+consteval bool
+check_ring_cap(const size_t cap)
+{
+  return (cap >= 2) && ((cap & (cap - 1)) == 0);
+}
+
+// Lock-free, bounded, single-producer single-consumer ring buffer, holding at
+// max CAP -many elements of type T.
+//
+// Producer owned and consumer owned indices live on their own cache lines,
+// while each side also keeps a cached copy of other side's index, so that
+// shared cache lines are touched only when ring looks full/ empty.
+template<typename T, const size_t CAP>
+  requires(check_ring_cap(CAP))
+class spsc_ring
+{
+private:
+  static constexpr size_t MASK = CAP - 1;
+
+  // consumer side
+  alignas(CACHE_LINE_LEN) std::atomic<size_t> head{ 0 };
+  alignas(CACHE_LINE_LEN) size_t tail_cache = 0;
+
+  // producer side
+  alignas(CACHE_LINE_LEN) std::atomic<size_t> tail{ 0 };
+  alignas(CACHE_LINE_LEN) size_t head_cache = 0;
+
+  alignas(CACHE_LINE_LEN) std::unique_ptr<T[]> slots;
+
+public:
+  inline spsc_ring()
+    : slots{ std::make_unique<T[]>(CAP) }
+  {
+  }
+
+  spsc_ring(const spsc_ring&) = delete;
+  spsc_ring& operator=(const spsc_ring&) = delete;
+
+  // Maximum number of elements ring can hold
+  static constexpr size_t capacity() { return CAP; }
+
+  // Producer side: enqueues ( at max ) N -many elements, returning how many of
+  // them were actually enqueued, which may be lesser than N, if ring is full
+  inline size_t push(std::span<const T> elms)
+  {
+    const size_t t = tail.load(std::memory_order_relaxed);
+
+    if (CAP - (t - head_cache) < elms.size()) {
+      head_cache = head.load(std::memory_order_acquire);
+    }
+
+    const size_t cnt = std::min(elms.size(), CAP - (t - head_cache));
+    for (size_t i = 0; i < cnt; i++) {
+      slots[(t + i) & MASK] = elms[i];
+    }
+
+    tail.store(t + cnt, std::memory_order_release);
+    return cnt;
+  }
+
+  // Producer side: enqueues single element, returning false if ring is full
+  inline bool push(const T& elm) { return push(std::span<const T>(&elm, 1)); }
+
+  // Consumer side: dequeues ( at max ) N -many elements, returning how many of
+  // them were actually dequeued, which may be lesser than N, if ring is empty
+  inline size_t pop(std::span<T> elms)
+  {
+    const size_t h = head.load(std::memory_order_relaxed);
+
+    if (tail_cache - h < elms.size()) {
+      tail_cache = tail.load(std::memory_order_acquire);
+    }
+
+    const size_t cnt = std::min(elms.size(), tail_cache - h);
+    for (size_t i = 0; i < cnt; i++) {
+      elms[i] = slots[(h + i) & MASK];
+    }
+
+    head.store(h + cnt, std::memory_order_release);
+    return cnt;
+  }
+
+  // Consumer side: dequeues single element, returning false if ring is empty
+  inline bool pop(T& elm) { return pop(std::span<T>(&elm, 1)); }
+};
+
+}
@@ -0,0 +1,195 @@
+#pragma once
+#include "utils.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// Runtime operational counters of Photon-Beetle-{Hash, AEAD}, enabled at
+// compile-time by defining `PHOTON_STATS` ( say, -DPHOTON_STATS ). When
+// enabled, each thread accumulates how many bytes it hashed, sealed & opened,
+// how many permutations it executed, how many tags failed to verify & how much
+// time it spent doing so, into its own cache line sized & aligned slot, so
+// that no two threads ever write to same cache line. Slots are only summed up
+// when counters are read, using `collect`.
+//
+// When disabled, counting code is discarded at compile-time, so library is
+// exactly same as one built without this header.
+namespace photon_stats {
+
+#if defined PHOTON_STATS
+constexpr bool ENABLED = true;
+#else
+constexpr bool ENABLED = false;
+#endif
+
+// Counters, maintained by each thread
+enum counter : size_t
+{
+  BYTES_HASHED,
+  BYTES_SEALED, // plain text + associated data bytes, encrypted
+  BYTES_OPENED, // cipher text + associated data bytes, decrypted
+  PERMUTATIONS,
+  TAG_FAILURES,
+  NANOSECONDS, // wall clock time spent in Photon-Beetle-{Hash, AEAD} routines
+  COUNTERS
+};
+
+// Process-wide counters, aggregated over all threads, which are alive or have
+// already exited. Layout of this struct is part of C-ABI, see
+// `photon_beetle_stats` in wrapper/photon-beetle.cpp.
+struct snapshot
+{
+  uint64_t bytes_hashed = 0;
+  uint64_t bytes_sealed = 0;
+  uint64_t bytes_opened = 0;
+  uint64_t permutations = 0;
+  uint64_t tag_failures = 0;
+  uint64_t nanoseconds = 0;
+};
+
+static_assert(sizeof(snapshot) == COUNTERS * sizeof(uint64_t));
+
+// Counters of a single thread, living on a cache line of their own. Only the
+// owning thread ever writes to them, so relaxed load followed by relaxed store
+// suffices, while other threads can read them anytime, without tearing.
+struct alignas(photon_utils::CACHE_LINE_LEN) slot
+{
+  std::atomic<uint64_t> vals[COUNTERS]{};
+};
+
+static_assert(sizeof(slot) == photon_utils::CACHE_LINE_LEN);
+
+// Keeps track of slots of all alive threads, while counters of exited threads
+// are folded into a single set of counters, so that they are not lost
+class registry
+{
+private:
+  std::mutex lock;
+  std::vector<const slot*> live;
+  uint64_t retired[COUNTERS]{};
+
+public:
+  // Never destroyed, so that threads exiting after `main` returns can still
+  // detach their slots
+  inline static registry& get()
+  {
+    static registry* const r = new registry;
+    return *r;
+  }
+
+  inline void attach(const slot* const s)
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    live.push_back(s);
+  }
+
+  inline void detach(const slot* const s)
+  {
+    std::lock_guard<std::mutex> guard(lock);
+
+    for (size_t i = 0; i < COUNTERS; i++) {
+      retired[i] += s->vals[i].load(std::memory_order_relaxed);
+    }
+    std::erase(live, s);
+  }
+
+  inline void collect(uint64_t (&out)[COUNTERS])
+  {
+    std::lock_guard<std::mutex> guard(lock);
+
+    for (size_t i = 0; i < COUNTERS; i++) {
+      out[i] = retired[i];
+    }
+    for (const slot* s : live) {
+      for (size_t i = 0; i < COUNTERS; i++) {
+        out[i] += s->vals[i].load(std::memory_order_relaxed);
+      }
+    }
+  }
+};
+
+// Slot of calling thread, registered on first use & detached when thread exits
+struct holder
+{
+  slot s;
+
+  inline holder() { registry::get().attach(&s); }
+  inline ~holder() { registry::get().detach(&s); }
+  holder(const holder&) = delete;
+  holder& operator=(const holder&) = delete;
+};
+
+inline slot&
+local()
+{
+  static thread_local holder h;
+  return h.s;
+}
+
+// Adds N to given counter of calling thread | N >= 0
+inline void
+add(const counter c, const uint64_t n)
+{
+  if constexpr (ENABLED) {
+    auto& v = local().vals[c];
+    v.store(v.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+  }
+}
+
+// Nanoseconds elapsed since some fixed point in time
+inline uint64_t
+now()
+{
+  using namespace std::chrono;
+  const auto d = steady_clock::now().time_since_epoch();
+  return static_cast<uint64_t>(duration_cast<nanoseconds>(d).count());
+}
+
+// Adds time spent in enclosing block to calling thread's `NANOSECONDS` counter,
+// place it only in outermost routines, so that time is not counted twice
+#if defined PHOTON_STATS
+class scope
+{
+private:
+  const uint64_t beg;
+
+public:
+  inline scope()
+    : beg(now())
+  {
+  }
+  inline ~scope() { add(NANOSECONDS, now() - beg); }
+  scope(const scope&) = delete;
+  scope& operator=(const scope&) = delete;
+};
+#else
+struct scope
+{};
+#endif
+
+// Returns process-wide counters, aggregated over all threads; all zeros, when
+// compiled without `PHOTON_STATS`
+inline snapshot
+collect()
+{
+  snapshot s;
+
+  if constexpr (ENABLED) {
+    uint64_t vals[COUNTERS];
+    registry::get().collect(vals);
+
+    s.bytes_hashed = vals[BYTES_HASHED];
+    s.bytes_sealed = vals[BYTES_SEALED];
+    s.bytes_opened = vals[BYTES_OPENED];
+    s.permutations = vals[PERMUTATIONS];
+    s.tag_failures = vals[TAG_FAILURES];
+    s.nanoseconds = vals[NANOSECONDS];
+  }
+
+  return s;
+}
+
+}
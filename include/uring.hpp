@@ -0,0 +1,401 @@
+#pragma once
+#include "hash.hpp"
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <vector>
+
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// Utility functions used in Photon-Beetle-{Hash, AEAD}
+namespace photon_utils {
+
+// Minimal io_uring based asynchronous file reader, talking to kernel using raw
+// system calls ( so that there's no dependency on liburing ), which keeps
+// several aligned reads in flight & feeds completed buffers, in file order,
+// into incremental Photon-Beetle-Hash, so that disk reads overlap with
+// permutation work.
+//
+// Linux only, needs kernel >= 5.6, for IORING_OP_READ.
+class uring_reader
+{
+private:
+  // Alignment of read buffers, which satisfies O_DIRECT requirements of
+  // commonly used block devices/ file systems
+  static constexpr size_t ALIGN = 4096;
+
+  int ring_fd = -1;
+  unsigned depth = 0;
+
+  void* sq_ptr = nullptr;
+  void* cq_ptr = nullptr;
+  size_t sq_len = 0;
+  size_t cq_len = 0;
+  io_uring_sqe* sqes = nullptr;
+  size_t sqes_len = 0;
+
+  unsigned* sq_head = nullptr;
+  unsigned* sq_tail = nullptr;
+  unsigned* sq_mask = nullptr;
+  unsigned* sq_array = nullptr;
+  unsigned* cq_head = nullptr;
+  unsigned* cq_tail = nullptr;
+  unsigned* cq_mask = nullptr;
+  io_uring_cqe* cqes = nullptr;
+
+  // A read buffer, along with file region it's currently assigned to
+  struct slot
+  {
+    uint8_t* buf = nullptr;
+    uint64_t off = 0;  // file offset of this region
+    size_t len = 0;    // length of this region
+    size_t done = 0;   // bytes of this region which are already read
+    bool busy = false; // region assigned, but not yet consumed ?
+  };
+
+  inline void release()
+  {
+    if (sqes != nullptr) {
+      munmap(sqes, sqes_len);
+    }
+    if (cq_ptr != nullptr && cq_ptr != sq_ptr) {
+      munmap(cq_ptr, cq_len);
+    }
+    if (sq_ptr != nullptr) {
+      munmap(sq_ptr, sq_len);
+    }
+    if (ring_fd >= 0) {
+      ::close(ring_fd);
+    }
+
+    ring_fd = -1;
+    sq_ptr = cq_ptr = nullptr;
+    sqes = nullptr;
+  }
+
+  // Offset, within given slot's region, from where read request for its
+  // unread part starts. When file is opened with O_DIRECT, both file offset &
+  // buffer address must be aligned, so after a short read, request starts from
+  // aligned-down offset, reading again those few bytes which are already read.
+  static inline size_t read_start(const slot& s, const bool direct)
+  {
+    return direct ? s.done & ~(ALIGN - 1) : s.done;
+  }
+
+  // Queues a read request for unread part of given slot's region. When file
+  // is opened with O_DIRECT, requested length is rounded up to alignment, as
+  // kernel returns only those bytes which are present before end of file.
+  inline void queue_read(const int fd,
+                         const size_t sid,
+                         const slot& s,
+                         const bool direct)
+  {
+    const size_t beg = read_start(s, direct);
+    const size_t rem = s.len - beg;
+    const size_t rlen = direct ? (rem + ALIGN - 1) & ~(ALIGN - 1) : rem;
+
+    const unsigned tail = *sq_tail;
+    const unsigned idx = tail & *sq_mask;
+
+    io_uring_sqe& sqe = sqes[idx];
+    std::memset(&sqe, 0, sizeof(sqe));
+
+    sqe.opcode = IORING_OP_READ;
+    sqe.fd = fd;
+    sqe.addr = reinterpret_cast<uint64_t>(s.buf + beg);
+    sqe.len = static_cast<uint32_t>(rlen);
+    sqe.off = s.off + beg;
+    sqe.user_data = sid;
+
+    sq_array[idx] = idx;
+
+    std::atomic_ref<unsigned> tail_ref(*sq_tail);
+    tail_ref.store(tail + 1, std::memory_order_release);
+  }
+
+  // Submits N -many queued requests, waiting for at least M -many completions
+  // ( kernel doesn't wait, if only some of them could be submitted ). Returns
+  // number of requests actually submitted, rest stay queued, or -1, leaving
+  // `errno` set, on failure.
+  inline long enter(const unsigned to_submit, const unsigned min_complete)
+  {
+    const unsigned flags = min_complete > 0 ? IORING_ENTER_GETEVENTS : 0;
+
+    while (true) {
+      const long ret = syscall(__NR_io_uring_enter,
+                               ring_fd,
+                               to_submit,
+                               min_complete,
+                               flags,
+                               nullptr,
+                               0);
+      if (ret >= 0) {
+        return ret;
+      }
+      if (errno != EINTR) {
+        return -1;
+      }
+    }
+  }
+
+public:
+  inline uring_reader() = default;
+  uring_reader(const uring_reader&) = delete;
+  uring_reader& operator=(const uring_reader&) = delete;
+  inline ~uring_reader() { release(); }
+
+  // Sets up an io_uring instance, which can keep N -many reads in flight.
+  // Returns false, leaving `errno` set, if io_uring is not available.
+  inline bool init(const unsigned qdepth = 8)
+  {
+    release();
+
+    io_uring_params p;
+    std::memset(&p, 0, sizeof(p));
+
+    const long fd = syscall(__NR_io_uring_setup, qdepth, &p);
+    if (fd < 0) {
+      return false;
+    }
+
+    ring_fd = static_cast<int>(fd);
+    depth = p.sq_entries;
+
+    sq_len = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    cq_len = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+
+    const bool single = (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single) {
+      sq_len = cq_len = std::max(sq_len, cq_len);
+    }
+
+    constexpr int prot = PROT_READ | PROT_WRITE;
+    constexpr int flags = MAP_SHARED | MAP_POPULATE;
+
+    sq_ptr = mmap(nullptr, sq_len, prot, flags, ring_fd, IORING_OFF_SQ_RING);
+    if (sq_ptr == MAP_FAILED) {
+      sq_ptr = nullptr;
+      release();
+      return false;
+    }
+
+    if (single) {
+      cq_ptr = sq_ptr;
+    } else {
+      constexpr auto off = IORING_OFF_CQ_RING;
+      cq_ptr = mmap(nullptr, cq_len, prot, flags, ring_fd, off);
+      if (cq_ptr == MAP_FAILED) {
+        cq_ptr = nullptr;
+        release();
+        return false;
+      }
+    }
+
+    sqes_len = p.sq_entries * sizeof(io_uring_sqe);
+    constexpr auto off = IORING_OFF_SQES;
+    void* const s = mmap(nullptr, sqes_len, prot, flags, ring_fd, off);
+    if (s == MAP_FAILED) {
+      release();
+      return false;
+    }
+    sqes = static_cast<io_uring_sqe*>(s);
+
+    uint8_t* const sq = static_cast<uint8_t*>(sq_ptr);
+    sq_head = reinterpret_cast<unsigned*>(sq + p.sq_off.head);
+    sq_tail = reinterpret_cast<unsigned*>(sq + p.sq_off.tail);
+    sq_mask = reinterpret_cast<unsigned*>(sq + p.sq_off.ring_mask);
+    sq_array = reinterpret_cast<unsigned*>(sq + p.sq_off.array);
+
+    uint8_t* const cq = static_cast<uint8_t*>(cq_ptr);
+    cq_head = reinterpret_cast<unsigned*>(cq + p.cq_off.head);
+    cq_tail = reinterpret_cast<unsigned*>(cq + p.cq_off.tail);
+    cq_mask = reinterpret_cast<unsigned*>(cq + p.cq_off.ring_mask);
+    cqes = reinterpret_cast<io_uring_cqe*>(cq + p.cq_off.cqes);
+
+    return true;
+  }
+
+  // Computes Photon-Beetle-Hash digest of file, living at given path, keeping
+  // ( at max ) queue depth -many reads, each of N -bytes, in flight, while
+  // optionally bypassing page cache, using O_DIRECT. Returns false, leaving
+  // `errno` set, on failure | N > 0 && N % 4096 == 0
+  //
+  // If in-flight reads can't be drained after a failure, ring is torn down
+  // & this reader must be set up again, using `init`, before next use.
+  inline bool hash_file(const char* const path,
+                        uint8_t* const __restrict digest,
+                        const size_t blk_len = 1ul << 20,
+                        const bool direct = false)
+  {
+    if (ring_fd < 0 || blk_len == 0 || (blk_len % ALIGN) != 0) {
+      errno = EINVAL;
+      return false;
+    }
+
+    const int oflags = O_RDONLY | O_CLOEXEC | (direct ? O_DIRECT : 0);
+    const int fd = ::open(path, oflags);
+    if (fd < 0) {
+      return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+      ::close(fd);
+      return false;
+    }
+
+    const uint64_t flen = static_cast<uint64_t>(st.st_size);
+    std::vector<slot> slots(depth);
+
+    bool ok = true;
+    for (auto& s : slots) {
+      s.buf = static_cast<uint8_t*>(std::aligned_alloc(ALIGN, blk_len));
+      ok &= s.buf != nullptr;
+    }
+
+    photon_beetle::hasher h;
+
+    uint64_t next_off = 0; // next file offset to be assigned to a slot
+    uint64_t hash_off = 0; // next file offset to be hashed
+    unsigned inflight = 0; // number of submitted, not yet completed reads
+    unsigned queued = 0;   // number of queued, not yet submitted reads
+
+    // assign file regions to all free slots & queue reads
+    auto refill = [&] {
+      for (size_t i = 0; i < slots.size() && next_off < flen; i++) {
+        auto& s = slots[i];
+        if (s.busy) {
+          continue;
+        }
+
+        s.off = next_off;
+        s.len = std::min<uint64_t>(blk_len, flen - next_off);
+        s.done = 0;
+        s.busy = true;
+        next_off += s.len;
+
+        queue_read(fd, i, s, direct);
+        queued++;
+      }
+    };
+
+    if (ok) {
+      refill();
+    }
+
+    while (ok && hash_off < flen) {
+      const long sub = enter(queued, 1);
+      if (sub < 0) {
+        ok = false;
+        break;
+      }
+
+      inflight += static_cast<unsigned>(sub);
+      queued -= static_cast<unsigned>(sub);
+
+      // reap all available completions
+      std::atomic_ref<unsigned> head_ref(*cq_head);
+      std::atomic_ref<unsigned> tail_ref(*cq_tail);
+
+      unsigned head = head_ref.load(std::memory_order_relaxed);
+      const unsigned tail = tail_ref.load(std::memory_order_acquire);
+
+      while (head != tail) {
+        const io_uring_cqe& cqe = cqes[head & *cq_mask];
+        auto& s = slots[cqe.user_data];
+        head++;
+        inflight--;
+
+        if (cqe.res < 0) {
+          errno = -cqe.res;
+          ok = false;
+          continue;
+        }
+        if (cqe.res == 0) {
+          // file shrunk while being read
+          errno = EIO;
+          ok = false;
+          continue;
+        }
+
+        // only one read per slot is in flight, so its start is still known
+        const size_t end = read_start(s, direct) + static_cast<size_t>(cqe.res);
+        s.done = std::min(s.len, std::max(s.done, end));
+        if (s.done < s.len) {
+          // short read, ask for rest of region
+          queue_read(fd, cqe.user_data, s, direct);
+          queued++;
+        }
+      }
+
+      head_ref.store(head, std::memory_order_release);
+
+      // hash completely read regions, strictly in file order
+      bool progress = true;
+      while (ok && progress) {
+        progress = false;
+
+        for (auto& s : slots) {
+          if (s.busy && s.off == hash_off && s.done == s.len) {
+            h.absorb(s.buf, s.len);
+
+            hash_off += s.len;
+            s.busy = false;
+            progress = true;
+          }
+        }
+      }
+
+      if (ok) {
+        refill();
+      }
+    }
+
+    // drain reads which are still in flight, before releasing their buffers
+    while (inflight + queued > 0) {
+      const long sub = enter(queued, 1);
+      if (sub < 0) {
+        break;
+      }
+
+      inflight += static_cast<unsigned>(sub);
+      queued -= static_cast<unsigned>(sub);
+
+      std::atomic_ref<unsigned> head_ref(*cq_head);
+      std::atomic_ref<unsigned> tail_ref(*cq_tail);
+
+      const unsigned head = head_ref.load(std::memory_order_relaxed);
+      const unsigned tail = tail_ref.load(std::memory_order_acquire);
+
+      inflight -= tail - head;
+      head_ref.store(tail, std::memory_order_release);
+    }
+
+    if (inflight + queued > 0) {
+      // kernel may still write into buffers of reads, which couldn't be
+      // drained, even after ring is torn down, so those are leaked, while
+      // this reader needs to be set up again, using `init`
+      const int err = errno;
+      release();
+      errno = err;
+      ok = false;
+    } else {
+      for (auto& s : slots) {
+        std::free(s.buf);
+      }
+    }
+    ::close(fd);
+
+    if (ok) {
+      h.finalize(digest);
+    }
+    return ok;
+  }
+};
+
+}
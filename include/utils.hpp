@@ -1,6 +1,7 @@
 #pragma once
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <iomanip>
 #include <random>
 #include <sstream>
@@ -8,6 +9,36 @@
 // Utility functions used in Photon-Beetle-{Hash, AEAD}
 namespace photon_utils {
 
+// Assumed L1 cache line width in bytes, used for keeping shared, frequently
+// written data on its own cache line, so that it doesn't false share with
+// neighbouring data
+constexpr size_t CACHE_LINE_LEN = 64ul;
+
+// Name of Photon256 permutation backend, which is chosen at compile-time, see
+// include/photon.hpp
+inline constexpr const char*
+photon_backend()
+{
+#if (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) && defined __SSSE3__
+  return "SSSE3";
+#else
+  return "portable";
+#endif
+}
+
+// Name & version of compiler, which is used for compiling calling code
+inline constexpr const char*
+compiler_name()
+{
+#if defined __clang__
+  return "clang " __clang_version__;
+#elif defined __GNUG__
+  return "gcc " __VERSION__;
+#else
+  return "unknown";
+#endif
+}
+
 // Given a 32 -bit unsigned integer word, this routine swaps byte order and
 // returns byte swapped 32 -bit word.
 //
@@ -40,15 +71,25 @@ to_hex(const uint8_t* const bytes, const size_t len)
 }
 
 // Generates N -many random bytes | N >= 0
+//
+// Random engine is seeded only once per thread, and each draw of 64 -bit word
+// yields 8 bytes, so that filling large buffers ( say, benchmark inputs ) is
+// cheap
 inline void
 random_data(uint8_t* const data, const size_t len)
 {
-  std::random_device rd;
-  std::mt19937_64 gen(rd());
-  std::uniform_int_distribution<uint8_t> dis;
+  thread_local std::mt19937_64 gen(std::random_device{}());
 
-  for (size_t i = 0; i < len; i++) {
-    data[i] = dis(gen);
+  size_t off = 0;
+  while (off + 8 <= len) {
+    const uint64_t word = gen();
+    std::memcpy(data + off, &word, 8);
+    off += 8;
+  }
+
+  if (off < len) {
+    const uint64_t word = gen();
+    std::memcpy(data + off, &word, len - off);
   }
 }
 
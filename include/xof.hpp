@@ -0,0 +1,81 @@
+#pragma once
+#include "common.hpp"
+#include <span>
+
+// Photon256 based extendable output function, producing arbitrary long stream
+// of pseudo-random bytes from a seed, used as a reproducible data generator
+namespace photon_xof {
+
+// Domain separation constant, added after absorbing seed; it's not used by
+// Photon-Beetle-Hash ( which uses 1 or 2 ), so that XOF output never collides
+// with a digest's state
+constexpr uint8_t C = 7;
+
+// Number of bytes squeezed out of permutation state, after each permutation,
+// same as `TAGτ (T0)` algorithm of Photon-Beetle specification does
+constexpr size_t RATE = 16;
+
+// Sponge in squeeze mode. Seed of N (>=0) -bytes is absorbed in 16 -bytes
+// blocks, just like `HASH<16>(IV, D, c0)` does, followed by adding domain
+// separation constant. After that, each permutation yields 16 -bytes of output.
+//
+// Note, this is not a standardized XOF, it's meant for generating test &
+// benchmark inputs, not for deriving keys.
+class xof
+{
+private:
+  uint8_t state[32]{};
+  uint8_t buf[RATE]{};
+  size_t boff = RATE; // number of already consumed bytes in `buf`
+
+public:
+  explicit xof(std::span<const uint8_t> seed)
+  {
+    photon_common::absorb<RATE>(state, seed.data(), seed.size(), C);
+  }
+
+  // Seeds XOF using little endian encoding of 64 -bit unsigned integer
+  explicit xof(const uint64_t seed)
+  {
+    uint8_t bytes[8];
+    for (size_t i = 0; i < sizeof(bytes); i++) {
+      bytes[i] = static_cast<uint8_t>(seed >> (i * 8));
+    }
+
+    photon_common::absorb<RATE>(state, bytes, sizeof(bytes), C);
+  }
+
+  // Squeezes next N (>=0) -bytes of output stream into given span. Whole 16
+  // -bytes blocks are copied straight out of permutation state, while only a
+  // trailing partial block is buffered, so that calling it any number of
+  // times, with any lengths, produces same stream.
+  inline void fill(std::span<uint8_t> out)
+  {
+    uint8_t* const dst = out.data();
+    const size_t len = out.size();
+    if (len == 0) {
+      return;
+    }
+
+    const size_t take = std::min(RATE - boff, len);
+    std::memcpy(dst, buf + boff, take);
+    boff += take;
+
+    size_t off = take;
+    while (off + RATE <= len) {
+      photon::photon256(state);
+      std::memcpy(dst + off, state, RATE);
+      off += RATE;
+    }
+
+    if (off < len) {
+      photon::photon256(state);
+      std::memcpy(buf, state, RATE);
+
+      boff = len - off;
+      std::memcpy(dst + off, buf, boff);
+    }
+  }
+};
+
+}
@@ -0,0 +1,178 @@
+#!/usr/bin/python3
+
+"""
+  Compares two google-benchmark JSON outputs of `bench/a.out` ( baseline &
+  current ), collected with `--benchmark_repetitions=N` ( N >= 2 ), flagging
+  statistically significant regressions & improvements, per benchmark case.
+
+  For each case, 95% confidence interval of difference between mean time of
+  current & baseline runs is computed using Welch's t-test; when interval
+  doesn't contain 0 and relative change is at least `--threshold`, case is
+  reported as regressed ( slower ) or improved ( faster ).
+
+  Usage
+
+    make baseline    # on old version, writes bench/baseline.json
+    make regression  # on new version, compares against bench/baseline.json
+
+    # or, directly
+    python3 scripts/bench_compare.py old.json new.json --threshold 0.02
+
+  Exits with status 1, if any case regressed, so that it can gate upgrades.
+  Only Python standard library is required.
+"""
+
+import argparse
+import json
+import math
+import sys
+from statistics import mean, variance
+from typing import Dict, List, Tuple
+
+# Context keys, which must match for two results to be comparable, see
+# `add_context()` in bench/main.cpp
+CONTEXT_KEYS = ("cpu_model", "compiler", "photon_backend", "library_build_type")
+
+# Multipliers for converting google-benchmark time units to nanoseconds
+TIME_UNITS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+# Two-sided 95% quantiles of Student's t-distribution, for 1..30 degrees of
+# freedom, followed by few larger ones
+T_975 = [
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042,
+]  # fmt: skip
+T_975_LARGE = [(40, 2.021), (60, 2.000), (120, 1.980)]
+
+
+def t_quantile(df: float) -> float:
+    """
+    95% two-sided quantile of t-distribution, for given ( possibly fractional )
+    degrees of freedom, rounded down, which makes interval conservative
+    """
+    k = max(int(math.floor(df)), 1)
+    if k <= len(T_975):
+        return T_975[k - 1]
+
+    # quantile of largest tabulated degrees of freedom, not exceeding k, which
+    # is never smaller than exact one
+    q = T_975[-1]
+    for lim, val in T_975_LARGE:
+        if k >= lim:
+            q = val
+    return q
+
+
+def load(
+    path: str, metric: str
+) -> Tuple[Dict[str, str], Dict[str, List[float]]]:
+    """
+    Loads google-benchmark JSON output, returning its context & per-iteration
+    time ( in nanoseconds, either `cpu_time` or `real_time` ) of each
+    repetition, keyed by benchmark case name
+    """
+    with open(path) as f:
+        doc = json.load(f)
+
+    runs: Dict[str, List[float]] = {}
+    for b in doc.get("benchmarks", []):
+        if b.get("run_type") != "iteration" or b.get("error_occurred"):
+            continue
+
+        scale = TIME_UNITS[b.get("time_unit", "ns")]
+        runs.setdefault(b["run_name"], []).append(b[metric] * scale)
+
+    return doc.get("context", {}), runs
+
+
+def welch(base: List[float], curr: List[float]) -> Tuple[float, float, float]:
+    """
+    Returns difference of means ( current - baseline ) & lower, upper bound of
+    its 95% confidence interval
+    """
+    vb, vc = variance(base) / len(base), variance(curr) / len(curr)
+    diff = mean(curr) - mean(base)
+    se = math.sqrt(vb + vc)
+
+    if se == 0.0:
+        return diff, diff, diff
+
+    df = (vb + vc) ** 2 / (vb**2 / (len(base) - 1) + vc**2 / (len(curr) - 1))
+    half = t_quantile(df) * se
+    return diff, diff - half, diff + half
+
+
+def fmt_time(ns: float) -> str:
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if abs(ns) >= scale:
+            return f"{ns / scale:.2f} {unit}"
+    return f"{ns:.0f} ns"
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("baseline", help="baseline JSON file")
+    parser.add_argument("current", help="current JSON file")
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.02,
+        help="minimum relative change to be reported ( default: 0.02 )",
+    )
+    parser.add_argument(
+        "--metric",
+        choices=("cpu_time", "real_time"),
+        default="cpu_time",
+        help="compared time metric ( default: cpu_time )",
+    )
+    args = parser.parse_args()
+
+    base_ctx, base = load(args.baseline, args.metric)
+    curr_ctx, curr = load(args.current, args.metric)
+
+    for key in CONTEXT_KEYS:
+        if base_ctx.get(key) != curr_ctx.get(key):
+            print(
+                f"warning: {key} differs, '{base_ctx.get(key)}' vs "
+                f"'{curr_ctx.get(key)}', results may not be comparable",
+                file=sys.stderr,
+            )
+
+    print(
+        f"{'Benchmark':<48} {'Baseline':>12} {'Current':>12} "
+        f"{'Change':>8} {'95% CI':>18}  Verdict"
+    )
+
+    regressed = improved = 0
+    for name in base:
+        if name not in curr:
+            continue
+
+        b, c = base[name], curr[name]
+        if len(b) < 2 or len(c) < 2:
+            print(f"{name:<48} needs >= 2 repetitions in both files")
+            continue
+
+        diff, lo, hi = welch(b, c)
+        ref = mean(b)
+        rel, rel_lo, rel_hi = diff / ref, lo / ref, hi / ref
+
+        verdict = "~"
+        if (lo > 0.0 or hi < 0.0) and abs(rel) >= args.threshold:
+            verdict = "REGRESSED" if diff > 0.0 else "improved"
+            regressed += diff > 0.0
+            improved += diff < 0.0
+
+        ci = f"[{rel_lo:+.1%}, {rel_hi:+.1%}]"
+        print(
+            f"{name:<48} {fmt_time(ref):>12} {fmt_time(mean(c)):>12} "
+            f"{rel:>+8.1%} {ci:>18}  {verdict}"
+        )
+
+    print(f"\n{regressed} regressed, {improved} improved")
+    return 1 if regressed > 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,37 @@
+#!/bin/bash
+
+# Compiles one variant of official Photon-Beetle implementation ( C sources of a
+# NIST LWC submission package directory, say
+# third_party/photon-beetle/crypto_aead/photonbeetleaead128rate128v1/ref ) into
+# a single relocatable object, where its crypto_aead_encrypt/
+# crypto_aead_decrypt/ crypto_hash entry points are renamed to
+# <prefix>_encrypt/ <prefix>_decrypt/ <prefix>_hash & every other symbol is
+# made local, so that all variants, which share internal function names, can be
+# linked into same program.
+#
+# Usage: bash scripts/build_official.sh <source directory> <prefix> <output object>
+
+set -e
+
+src=$1
+prefix=$2
+out=$3
+
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+for f in "$src"/*.c; do
+  ${CC:-cc} ${CFLAGS:--O3 -march=native -mtune=native} -I "$src" -c "$f" -o "$tmp/$(basename "${f%.c}").o"
+done
+
+ld -r "$tmp"/*.o -o "$tmp/variant.o"
+
+objcopy --keep-global-symbol=crypto_aead_encrypt \
+  --keep-global-symbol=crypto_aead_decrypt \
+  --keep-global-symbol=crypto_hash \
+  "$tmp/variant.o" "$tmp/local.o"
+
+objcopy --redefine-sym crypto_aead_encrypt="${prefix}_encrypt" \
+  --redefine-sym crypto_aead_decrypt="${prefix}_decrypt" \
+  --redefine-sym crypto_hash="${prefix}_hash" \
+  "$tmp/local.o" "$out"
@@ -0,0 +1,29 @@
+#!/bin/bash
+
+# Fetches official Photon-Beetle implementations, as shipped in NIST LWC
+# submission package, into third_party/photon-beetle, keeping package's
+# crypto_aead/ crypto_hash layout ( along with any license/ readme files it
+# carries ), so that `make compare` also benchmarks them.
+
+set -e
+
+url=https://csrc.nist.gov/CSRC/media/Projects/lightweight-cryptography/documents/finalist-round/updated-submissions/photon-beetle.zip
+dst=third_party/photon-beetle
+
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+wget -O "$tmp/photon-beetle.zip" "$url"
+unzip -q "$tmp/photon-beetle.zip" -d "$tmp"
+
+rm -rf "$dst"
+mkdir -p "$dst"
+
+cp -r "$tmp/photon-beetle/Implementations/crypto_aead" "$dst/"
+cp -r "$tmp/photon-beetle/Implementations/crypto_hash" "$dst/"
+find "$tmp/photon-beetle" -maxdepth 2 -type f \
+  \( -iname '*license*' -o -iname '*copying*' -o -iname '*readme*' \) \
+  -exec cp {} "$dst/" \;
+
+# KAT files are checked by test_kat.sh, no need to keep them here
+find "$dst" -name 'LWC_*_KAT_*.txt' -delete
@@ -0,0 +1,10 @@
+#include "fuzz.hpp"
+
+// libFuzzer entry point, running differential checks of test/fuzz.hpp on
+// fuzzer generated inputs; build using `make fuzz`, which needs Clang
+extern "C" int
+LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+  photon_fuzz::fuzz_one(data, size);
+  return 0;
+}
@@ -0,0 +1,491 @@
+#pragma once
+#include "bulk.hpp"
+#include "coro.hpp"
+#include "engine.hpp"
+#include "photon_beetle.hpp"
+#include "reference.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// C-ABI batched routines, see wrapper/photon-beetle.cpp, which is linked into
+// test programs
+extern "C"
+{
+  void photon_beetle_hash_batch(const uint8_t* const __restrict,
+                                const size_t* const __restrict,
+                                const size_t,
+                                uint8_t* const __restrict,
+                                const size_t);
+
+  void photon_beetle_32_encrypt_batch(const uint8_t* const __restrict,
+                                      const uint8_t* const __restrict,
+                                      const uint8_t* const __restrict,
+                                      const size_t* const __restrict,
+                                      const uint8_t* const __restrict,
+                                      uint8_t* const __restrict,
+                                      const size_t* const __restrict,
+                                      uint8_t* const __restrict,
+                                      const size_t,
+                                      const size_t);
+
+  bool photon_beetle_32_decrypt_batch(const uint8_t* const __restrict,
+                                      const uint8_t* const __restrict,
+                                      const uint8_t* const __restrict,
+                                      const uint8_t* const __restrict,
+                                      const size_t* const __restrict,
+                                      const uint8_t* const __restrict,
+                                      uint8_t* const __restrict,
+                                      const size_t* const __restrict,
+                                      bool* const __restrict,
+                                      const size_t,
+                                      const size_t);
+
+  void photon_beetle_128_encrypt_batch(const uint8_t* const __restrict,
+                                       const uint8_t* const __restrict,
+                                       const uint8_t* const __restrict,
+                                       const size_t* const __restrict,
+                                       const uint8_t* const __restrict,
+                                       uint8_t* const __restrict,
+                                       const size_t* const __restrict,
+                                       uint8_t* const __restrict,
+                                       const size_t,
+                                       const size_t);
+
+  bool photon_beetle_128_decrypt_batch(const uint8_t* const __restrict,
+                                       const uint8_t* const __restrict,
+                                       const uint8_t* const __restrict,
+                                       const uint8_t* const __restrict,
+                                       const size_t* const __restrict,
+                                       const uint8_t* const __restrict,
+                                       uint8_t* const __restrict,
+                                       const size_t* const __restrict,
+                                       bool* const __restrict,
+                                       const size_t,
+                                       const size_t);
+}
+
+// Differential fuzzing of Photon256 permutation & every Photon-Beetle-{Hash,
+// AEAD} code path ( one-shot, incremental, coroutine based, bulk engine &
+// C-ABI batched ) against reference implementation, living in
+// test/reference.hpp
+namespace photon_fuzz {
+
+using bytes = std::vector<uint8_t>;
+
+// Aborts, after reporting which check failed, so that both libFuzzer & the
+// standalone driver catch it
+inline void
+check(const bool cond, const char* const what)
+{
+  if (!cond) [[unlikely]] {
+    std::fprintf(stderr, "differential check failed: %s\n", what);
+    std::abort();
+  }
+}
+
+// Bulk engine shared by all fuzz inputs, so that worker threads are spawned
+// only once
+inline photon_beetle::engine&
+shared_engine()
+{
+  static photon_beetle::engine eng{ 2 };
+  return eng;
+}
+
+// Consumes bytes of fuzz input from front, returning zeros once it's exhausted
+class reader
+{
+private:
+  const uint8_t* ptr;
+  size_t left;
+
+public:
+  inline reader(const uint8_t* const data, const size_t size)
+    : ptr(data)
+    , left(size)
+  {
+  }
+
+  inline uint8_t byte()
+  {
+    if (left == 0) {
+      return 0;
+    }
+
+    left--;
+    return *ptr++;
+  }
+
+  inline bytes take(const size_t n)
+  {
+    const size_t avail = std::min(n, left);
+
+    bytes res(n);
+    std::copy_n(ptr, avail, res.begin());
+
+    ptr += avail;
+    left -= avail;
+    return res;
+  }
+
+  inline bytes rest() { return take(left); }
+};
+
+// Photon256 permutation, applied few times on fuzzer chosen state, both one
+// state at a time & interleaved
+inline void
+fuzz_permutation(reader& r)
+{
+  bytes s0 = r.take(32);
+  bytes s1 = s0;
+
+  const size_t rounds = 1 + (r.byte() & 3);
+  for (size_t i = 0; i < rounds; i++) {
+    photon::photon256(s0.data());
+    photon_reference::photon256(s1.data());
+  }
+
+  check(s0 == s1, "photon256");
+
+  // interleaved permutations, each lane holding a distinct state, derived
+  // from fuzzer chosen one
+  bytes lanes[4];
+  bytes expected[4];
+  for (size_t l = 0; l < 4; l++) {
+    lanes[l] = s0;
+    lanes[l][l] ^= static_cast<uint8_t>(1 + l);
+    expected[l] = lanes[l];
+
+    for (size_t i = 0; i < rounds; i++) {
+      photon_reference::photon256(expected[l].data());
+    }
+  }
+
+  for (size_t i = 0; i < rounds; i++) {
+    photon::photon256_x4(
+      lanes[0].data(), lanes[1].data(), lanes[2].data(), lanes[3].data());
+  }
+  for (size_t l = 0; l < 4; l++) {
+    check(lanes[l] == expected[l], "photon256_x4");
+  }
+
+  // continue permuting first two lanes, now using 2 -way interleaving
+  for (size_t i = 0; i < rounds; i++) {
+    photon::photon256_x2(lanes[0].data(), lanes[1].data());
+    photon_reference::photon256(expected[0].data());
+    photon_reference::photon256(expected[1].data());
+  }
+  check(lanes[0] == expected[0], "photon256_x2");
+  check(lanes[1] == expected[1], "photon256_x2");
+}
+
+// Photon-Beetle-Hash, computed using all available routines
+inline void
+fuzz_hash(reader& r)
+{
+  const size_t chunk = 1 + r.byte();
+  const bytes msg = r.rest();
+
+  bytes expected(32);
+  photon_reference::hash(msg.data(), msg.size(), expected.data());
+
+  bytes computed(32);
+  photon_beetle::hash(msg.data(), msg.size(), computed.data());
+  check(computed == expected, "hash");
+
+  // incremental hashing, fed in fuzzer chosen sized chunks
+  photon_beetle::hasher h;
+  for (size_t off = 0; off < msg.size(); off += chunk) {
+    h.absorb(msg.data() + off, std::min(chunk, msg.size() - off));
+  }
+  h.finalize(computed.data());
+  check(computed == expected, "hasher");
+
+  // cache-bypassing bulk mode, forced on by zero threshold
+  photon_beetle::hash_bulk(msg.data(), msg.size(), computed.data(), 0);
+  check(computed == expected, "hash_bulk");
+
+  // coroutine based, interleaved with another hash of a prefix of message
+  const size_t half = msg.size() / 2;
+  bytes half_dig(32), half_exp(32);
+  photon_reference::hash(msg.data(), half, half_exp.data());
+
+  std::vector<photon_beetle::sponge_task> tasks;
+  tasks.push_back(photon_beetle::hash_task(msg.data(), half, half_dig.data()));
+  tasks.push_back(
+    photon_beetle::hash_task(msg.data(), msg.size(), computed.data()));
+  photon_beetle::run_tasks(tasks, 2);
+  check(computed == expected && half_dig == half_exp, "hash_task");
+
+  // bulk engine
+  auto& eng = shared_engine();
+  using photon_beetle::job;
+  const auto j = job::hash(msg.data(), msg.size(), computed.data());
+  check(eng.submit(j).get() && computed == expected, "engine hash");
+
+  // C-ABI batch, holding prefix & whole message
+  const size_t offs[]{ 0, half, half + msg.size() };
+  bytes packed(msg.begin(), msg.begin() + half);
+  packed.insert(packed.end(), msg.begin(), msg.end());
+
+  bytes digests(64);
+  photon_beetle_hash_batch(packed.data(), offs, 2, digests.data(), 2);
+  check(bytes(digests.begin(), digests.begin() + 32) == half_exp &&
+          bytes(digests.begin() + 32, digests.end()) == expected,
+        "photon_beetle_hash_batch");
+}
+
+// Photon-Beetle-AEAD[RATE * 8], computed using all available routines, while
+// also checking that tampered cipher text/ tag doesn't verify
+template<const size_t RATE>
+inline void
+fuzz_aead(reader& r)
+{
+  const bytes key = r.take(16);
+  const bytes nonce = r.take(16);
+  const size_t dlen = r.byte();
+  const bytes data = r.take(std::min<size_t>(dlen, 64));
+  const bytes txt = r.rest();
+  const size_t mlen = txt.size();
+
+  bytes enc_exp(mlen), tag_exp(16);
+  photon_reference::encrypt(RATE,
+                            key.data(),
+                            nonce.data(),
+                            data.data(),
+                            data.size(),
+                            txt.data(),
+                            enc_exp.data(),
+                            mlen,
+                            tag_exp.data());
+
+  using namespace photon_beetle;
+
+  // one-shot, out-of-place & in-place
+  bytes enc(mlen), tag(16), dec(mlen);
+  encrypt<RATE>(key.data(),
+                nonce.data(),
+                data.data(),
+                data.size(),
+                txt.data(),
+                enc.data(),
+                mlen,
+                tag.data());
+  check(enc == enc_exp && tag == tag_exp, "encrypt");
+
+  bool flg = decrypt<RATE>(key.data(),
+                           nonce.data(),
+                           tag.data(),
+                           data.data(),
+                           data.size(),
+                           enc.data(),
+                           dec.data(),
+                           mlen);
+  check(flg && dec == txt, "decrypt");
+
+  bytes buf = txt;
+  encrypt<RATE>(key.data(),
+                nonce.data(),
+                data.data(),
+                data.size(),
+                buf.data(),
+                buf.data(),
+                mlen,
+                tag.data());
+  check(buf == enc_exp && tag == tag_exp, "in-place encrypt");
+
+  flg = decrypt<RATE>(key.data(),
+                      nonce.data(),
+                      tag.data(),
+                      data.data(),
+                      data.size(),
+                      buf.data(),
+                      buf.data(),
+                      mlen);
+  check(flg && buf == txt, "in-place decrypt");
+
+  // cache-bypassing bulk mode, forced on by zero threshold, writing into
+  // nonce chosen ( possibly unaligned ) offset of output buffer
+  const size_t shift = nonce[0] & 15;
+  bytes bulk(mlen + shift);
+  encrypt_bulk<RATE>(key.data(),
+                     nonce.data(),
+                     data.data(),
+                     data.size(),
+                     txt.data(),
+                     bulk.data() + shift,
+                     mlen,
+                     tag.data(),
+                     0);
+  check(bytes(bulk.begin() + shift, bulk.end()) == enc_exp && tag == tag_exp,
+        "encrypt_bulk");
+
+  flg = decrypt_bulk<RATE>(key.data(),
+                           nonce.data(),
+                           tag.data(),
+                           data.data(),
+                           data.size(),
+                           bulk.data() + shift,
+                           bulk.data() + shift,
+                           mlen,
+                           0);
+  check(flg && bytes(bulk.begin() + shift, bulk.end()) == txt,
+        "in-place decrypt_bulk");
+
+  // tampering with either tag or cipher text must fail verification, same as
+  // reference, while zeroing decrypted text
+  bytes bad_tag = tag_exp;
+  bad_tag[r.byte() & 15] ^= 1 << (r.byte() & 7);
+  bytes bad_enc = enc_exp;
+  if (mlen > 0) {
+    bad_enc[mlen / 2] ^= 0x80;
+  }
+
+  for (const auto& [t, e] : { std::pair{ &bad_tag, &enc_exp },
+                              std::pair{ &tag_exp, &bad_enc } }) {
+    if (t == &tag_exp && mlen == 0) {
+      continue;
+    }
+
+    bytes ref(mlen);
+    const bool ref_flg = photon_reference::decrypt(RATE,
+                                                   key.data(),
+                                                   nonce.data(),
+                                                   t->data(),
+                                                   data.data(),
+                                                   data.size(),
+                                                   e->data(),
+                                                   ref.data(),
+                                                   mlen);
+
+    flg = decrypt<RATE>(key.data(),
+                        nonce.data(),
+                        t->data(),
+                        data.data(),
+                        data.size(),
+                        e->data(),
+                        dec.data(),
+                        mlen);
+    check(!flg && !ref_flg && dec == bytes(mlen), "tampered decrypt");
+
+    flg = decrypt_bulk<RATE>(key.data(),
+                             nonce.data(),
+                             t->data(),
+                             data.data(),
+                             data.size(),
+                             e->data(),
+                             dec.data(),
+                             mlen,
+                             0);
+    check(!flg && dec == bytes(mlen), "tampered decrypt_bulk");
+  }
+
+  // coroutine based, encryption & decryption interleaved
+  bytes enc_c(mlen), tag_c(16), dec_c(mlen);
+  std::vector<sponge_task> tasks;
+  tasks.push_back(encrypt_task<RATE>(key.data(),
+                                     nonce.data(),
+                                     data.data(),
+                                     data.size(),
+                                     txt.data(),
+                                     enc_c.data(),
+                                     mlen,
+                                     tag_c.data()));
+  tasks.push_back(decrypt_task<RATE>(key.data(),
+                                     nonce.data(),
+                                     tag_exp.data(),
+                                     data.data(),
+                                     data.size(),
+                                     enc_exp.data(),
+                                     dec_c.data(),
+                                     mlen));
+  run_tasks(tasks, 2);
+  check(enc_c == enc_exp && tag_c == tag_exp, "encrypt_task");
+  check(tasks[1].result() && dec_c == txt, "decrypt_task");
+
+  // bulk engine
+  auto& eng = shared_engine();
+  const job jobs[]{ job::encrypt<RATE>(key.data(),
+                                       nonce.data(),
+                                       data.data(),
+                                       data.size(),
+                                       txt.data(),
+                                       enc.data(),
+                                       mlen,
+                                       tag.data()),
+                    job::decrypt<RATE>(key.data(),
+                                       nonce.data(),
+                                       tag_exp.data(),
+                                       data.data(),
+                                       data.size(),
+                                       enc_exp.data(),
+                                       dec.data(),
+                                       mlen) };
+  bool flags[2]{};
+  eng.submit(jobs, flags);
+  eng.wait();
+  check(flags[0] && enc == enc_exp && tag == tag_exp, "engine encrypt");
+  check(flags[1] && dec == txt, "engine decrypt");
+
+  // C-ABI batch of a single packet
+  constexpr auto enc_batch = RATE == 4 ? photon_beetle_32_encrypt_batch
+                                       : photon_beetle_128_encrypt_batch;
+  constexpr auto dec_batch = RATE == 4 ? photon_beetle_32_decrypt_batch
+                                       : photon_beetle_128_decrypt_batch;
+
+  const size_t d_offs[]{ 0, data.size() };
+  const size_t ct_offs[]{ 0, mlen };
+  bool flag = false;
+
+  enc_batch(key.data(),
+            nonce.data(),
+            data.data(),
+            d_offs,
+            txt.data(),
+            enc.data(),
+            ct_offs,
+            tag.data(),
+            1,
+            1);
+  check(enc == enc_exp && tag == tag_exp, "encrypt_batch");
+
+  flg = dec_batch(key.data(),
+                  nonce.data(),
+                  tag_exp.data(),
+                  data.data(),
+                  d_offs,
+                  enc_exp.data(),
+                  dec.data(),
+                  ct_offs,
+                  &flag,
+                  1,
+                  1);
+  check(flg && flag && dec == txt, "decrypt_batch");
+}
+
+// Runs one differential check on given fuzz input, whose first byte selects
+// what's checked, while rest of it is consumed as inputs
+inline void
+fuzz_one(const uint8_t* const data, const size_t size)
+{
+  reader r(data, size);
+
+  switch (r.byte() % 4) {
+    case 0:
+      fuzz_permutation(r);
+      break;
+    case 1:
+      fuzz_hash(r);
+      break;
+    case 2:
+      fuzz_aead<4>(r);
+      break;
+    case 3:
+      fuzz_aead<16>(r);
+      break;
+  }
+}
+
+}
@@ -0,0 +1,163 @@
+#include "kat.hpp"
+#include "reference.hpp"
+#include <cstring>
+
+// Generates Known Answer Tests using reference implementation, living in
+// test/reference.hpp, either as C++ header, which is embedded into test
+// program ( default ), or as LWC format KAT files ( --lwc ), which can be
+// diffed against ones shipped with Photon-Beetle submission
+//
+// Usage
+//
+//   ./test/gen_kat.out > test/kat_vectors.hpp
+//   ./test/gen_kat.out --lwc <dir>
+
+using bytes = std::vector<uint8_t>;
+
+static void
+ref_digest(const uint8_t* const msg, const size_t mlen, uint8_t* const md)
+{
+  photon_reference::hash(msg, mlen, md);
+}
+
+template<const size_t RATE>
+static void
+ref_seal(const uint8_t* const key,
+         const uint8_t* const nonce,
+         const bytes& data,
+         const bytes& txt,
+         bytes& ct)
+{
+  photon_reference::encrypt(RATE,
+                            key,
+                            nonce,
+                            data.data(),
+                            data.size(),
+                            txt.data(),
+                            ct.data(),
+                            txt.size(),
+                            ct.data() + txt.size());
+}
+
+// Writes hex string as C++ string literal, split into 64 characters wide
+// pieces, so that generated file stays within 80 columns
+static void
+write_literal(std::FILE* const out, const std::string& hex)
+{
+  std::fprintf(out, "  \"%s\"", hex.substr(0, 64).c_str());
+  for (size_t off = 64; off < hex.size(); off += 64) {
+    std::fprintf(out, "\n  \"%s\"", hex.substr(off, 64).c_str());
+  }
+  std::fprintf(out, ",\n");
+}
+
+template<const size_t RATE>
+static void
+write_aead_array(std::FILE* const out, const char* const name)
+{
+  using namespace photon_kat;
+
+  const auto key = kat_bytes(16);
+  const auto nonce = kat_bytes(16);
+
+  std::fprintf(out, "constexpr const char* %s[AEAD_KAT_CNT]{\n", name);
+  for (size_t i = 0; i < AEAD_KAT_CNT; i++) {
+    size_t mlen, dlen;
+    aead_lengths(i, mlen, dlen);
+
+    const auto txt = kat_bytes(mlen);
+    const auto data = kat_bytes(dlen);
+    bytes ct(mlen + 16);
+    ref_seal<RATE>(key.data(), nonce.data(), data, txt, ct);
+
+    write_literal(out, to_hex(ct));
+  }
+  std::fprintf(out, "};\n\n");
+}
+
+static void
+write_header(std::FILE* const out)
+{
+  using namespace photon_kat;
+
+  std::fprintf(out, "#pragma once\n#include \"kat.hpp\"\n\n");
+  std::fprintf(out,
+               "// Generated by test/gen_kat.cpp, using reference "
+               "implementation living\n"
+               "// in test/reference.hpp, don't edit by hand.\n"
+               "//\n"
+               "// i-th entry holds expected output of KAT with `Count = i "
+               "+ 1`, while inputs\n"
+               "// are regenerated following LWC conventions, see "
+               "test/kat.hpp\n"
+               "namespace photon_kat {\n\n");
+
+  std::fprintf(out, "// Photon-Beetle-Hash digests ( `MD` )\n");
+  std::fprintf(out, "constexpr const char* HASH_MD[HASH_KAT_CNT]{\n");
+  for (size_t i = 0; i < HASH_KAT_CNT; i++) {
+    const auto msg = kat_bytes(i);
+    uint8_t md[32];
+    ref_digest(msg.data(), msg.size(), md);
+
+    write_literal(out, to_hex(md, sizeof(md)));
+  }
+  std::fprintf(out, "};\n\n");
+
+  std::fprintf(out, "// Photon-Beetle-AEAD[32] cipher text || tag ( `CT` )\n");
+  write_aead_array<4>(out, "AEAD_32_CT");
+
+  std::fprintf(out, "// Photon-Beetle-AEAD[128] cipher text || tag ( `CT` )\n");
+  write_aead_array<16>(out, "AEAD_128_CT");
+
+  std::fprintf(out, "}\n");
+}
+
+// Writes LWC format KAT files into given directory, returning false, if any
+// of them can't be opened
+static bool
+write_lwc(const std::string& dir)
+{
+  using namespace photon_kat;
+
+  std::FILE* const hash =
+    std::fopen((dir + "/LWC_HASH_KAT_256.txt").c_str(), "w");
+  std::FILE* const aead32 =
+    std::fopen((dir + "/LWC_AEAD_KAT_128_128.txt.32").c_str(), "w");
+  std::FILE* const aead128 =
+    std::fopen((dir + "/LWC_AEAD_KAT_128_128.txt.128").c_str(), "w");
+
+  const bool ok = hash != nullptr && aead32 != nullptr && aead128 != nullptr;
+  if (ok) {
+    write_hash_kat(hash, ref_digest);
+    write_aead_kat(aead32, ref_seal<4>);
+    write_aead_kat(aead128, ref_seal<16>);
+  }
+
+  for (std::FILE* f : { hash, aead32, aead128 }) {
+    if (f != nullptr) {
+      std::fclose(f);
+    }
+  }
+
+  return ok;
+}
+
+int
+main(int argc, char** argv)
+{
+  if (argc == 3 && std::strcmp(argv[1], "--lwc") == 0) {
+    if (!write_lwc(argv[2])) {
+      std::fprintf(stderr, "failed to write KAT files into %s\n", argv[2]);
+      return 1;
+    }
+    return 0;
+  }
+
+  if (argc != 1) {
+    std::fprintf(stderr, "usage: %s [--lwc <dir>]\n", argv[0]);
+    return 1;
+  }
+
+  write_header(stdout);
+  return 0;
+}
@@ -0,0 +1,160 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+// Helpers for Known Answer Tests, following conventions of NIST LWC's
+// `genkat_hash.c` & `genkat_aead.c`, so that vectors can be compared against
+// `LWC_HASH_KAT_256.txt` & `LWC_AEAD_KAT_128_128.txt` files, shipped with
+// Photon-Beetle submission
+namespace photon_kat {
+
+// Hash KATs cover messages of 0 to 1024 -bytes
+constexpr size_t MAX_MESSAGE_LENGTH = 1024;
+
+// AEAD KATs cover all combinations of 0 to 32 -bytes plain text & 0 to 32
+// -bytes associated data, where plain text length is outer loop
+constexpr size_t MAX_AEAD_LENGTH = 32;
+
+constexpr size_t HASH_KAT_CNT = MAX_MESSAGE_LENGTH + 1;
+constexpr size_t AEAD_KAT_CNT = (MAX_AEAD_LENGTH + 1) * (MAX_AEAD_LENGTH + 1);
+
+// Returns N -bytes input used in KATs i.e. 00 01 02 ... | N >= 0
+inline std::vector<uint8_t>
+kat_bytes(const size_t n)
+{
+  std::vector<uint8_t> res(n);
+  for (size_t i = 0; i < n; i++) {
+    res[i] = static_cast<uint8_t>(i);
+  }
+
+  return res;
+}
+
+// Plain text & associated data lengths of i-th AEAD KAT ( 0 -based )
+inline void
+aead_lengths(const size_t i, size_t& mlen, size_t& dlen)
+{
+  mlen = i / (MAX_AEAD_LENGTH + 1);
+  dlen = i % (MAX_AEAD_LENGTH + 1);
+}
+
+// Upper case hex encoding of N -bytes, as used in LWC KAT files | N >= 0
+inline std::string
+to_hex(const uint8_t* const bytes, const size_t len)
+{
+  constexpr char digits[] = "0123456789ABCDEF";
+
+  std::string res(2 * len, '0');
+  for (size_t i = 0; i < len; i++) {
+    res[2 * i] = digits[bytes[i] >> 4];
+    res[2 * i + 1] = digits[bytes[i] & 0xf];
+  }
+
+  return res;
+}
+
+inline std::string
+to_hex(const std::vector<uint8_t>& bytes)
+{
+  return to_hex(bytes.data(), bytes.size());
+}
+
+// Decodes hex string ( either case ) into bytes
+inline std::vector<uint8_t>
+from_hex(const std::string& hex)
+{
+  const auto nibble = [](const char c) -> uint8_t {
+    if (c >= '0' && c <= '9') {
+      return c - '0';
+    }
+    return (c | 0x20) - 'a' + 10;
+  };
+
+  std::vector<uint8_t> res(hex.size() / 2);
+  for (size_t i = 0; i < res.size(); i++) {
+    res[i] = (nibble(hex[2 * i]) << 4) | nibble(hex[2 * i + 1]);
+  }
+
+  return res;
+}
+
+// Writes hash KATs in LWC format, computing digests using given function
+template<typename F>
+inline void
+write_hash_kat(std::FILE* const out, F&& digest)
+{
+  for (size_t i = 0; i < HASH_KAT_CNT; i++) {
+    const auto msg = kat_bytes(i);
+    uint8_t md[32];
+    digest(msg.data(), msg.size(), md);
+
+    std::fprintf(out, "Count = %zu\n", i + 1);
+    std::fprintf(out, "Msg = %s\n", to_hex(msg).c_str());
+    std::fprintf(out, "MD = %s\n\n", to_hex(md, sizeof(md)).c_str());
+  }
+}
+
+// Writes AEAD KATs in LWC format, computing cipher text || tag using given
+// function
+template<typename F>
+inline void
+write_aead_kat(std::FILE* const out, F&& seal)
+{
+  const auto key = kat_bytes(16);
+  const auto nonce = kat_bytes(16);
+
+  for (size_t i = 0; i < AEAD_KAT_CNT; i++) {
+    size_t mlen, dlen;
+    aead_lengths(i, mlen, dlen);
+
+    const auto txt = kat_bytes(mlen);
+    const auto data = kat_bytes(dlen);
+    std::vector<uint8_t> ct(mlen + 16);
+    seal(key.data(), nonce.data(), data, txt, ct);
+
+    std::fprintf(out, "Count = %zu\n", i + 1);
+    std::fprintf(out, "Key = %s\n", to_hex(key).c_str());
+    std::fprintf(out, "Nonce = %s\n", to_hex(nonce).c_str());
+    std::fprintf(out, "PT = %s\n", to_hex(txt).c_str());
+    std::fprintf(out, "AD = %s\n", to_hex(data).c_str());
+    std::fprintf(out, "CT = %s\n\n", to_hex(ct).c_str());
+  }
+}
+
+// Parses LWC format KAT file, returning one `name -> value` map per vector;
+// returns empty vector, if file can't be read
+inline std::vector<std::map<std::string, std::string>>
+parse_lwc(const std::string& path)
+{
+  std::vector<std::map<std::string, std::string>> res;
+  std::ifstream in(path);
+  std::string line;
+
+  while (std::getline(in, line)) {
+    if (!line.empty() && line.back() == '\r') {
+      line.pop_back();
+    }
+
+    const auto eq = line.find(" = ");
+    if (eq == std::string::npos) {
+      continue;
+    }
+
+    const auto key = line.substr(0, eq);
+    if (key == "Count") {
+      res.emplace_back();
+    }
+    if (!res.empty()) {
+      res.back()[key] = line.substr(eq + 3);
+    }
+  }
+
+  return res;
+}
+
+}
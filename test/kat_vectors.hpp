@@ -0,0 +1,4282 @@
+#pragma once
+#include "kat.hpp"
+
+// Generated by test/gen_kat.cpp, using reference implementation living
+// in test/reference.hpp, don't edit by hand.
+//
+// i-th entry holds expected output of KAT with `Count = i + 1`, while inputs
+// are regenerated following LWC conventions, see test/kat.hpp
+namespace photon_kat {
+
+// Photon-Beetle-Hash digests ( `MD` )
+constexpr const char* HASH_MD[HASH_KAT_CNT]{
+  "44A99882FEA033566856A27E7F0C94DC84FAC7E411B08B890A4A574E3DB75D4A",
+  "F165CCD18640B9703E96F1BD9A4A4EE32DD4031E4680A1B9890891DCC63468A7",
+  "2EF2D38F71E77928DF37FBA337872B639F7748556C1A081821B9B8460AC68FAC",
+  "F9A8C467209E7B5F32DB28BDE50D5210A81A9C6AA9C1686A05C3619CBF44061D",
+  "EFAB98A1FFEB6F9E832DB6FA7FC6BFF670895F8A2ABE987CD962E93B0127EC3C",
+  "5B70F82D129B04298A0FFEC3A507AE3FDFB6EBC176D826DBA648A75F87342981",
+  "FE3D9E337581E983AD042BAB6D6D84974458B65F9C6597312ECEC481B45BC39D",
+  "7861B5A8CB7C3EDCF79072C676F19EA02636A65B62D740546B86200BCB1188B7",
+  "87947EED1020EC45EEC25CC05A135E08E5928FB6DC1F9214E6A69421A3BC30DA",
+  "4F121DFD18C5D204E6EFFC91216DD21A239E9D79097DFBBD67550E975BB9B07F",
+  "99DA93FA5E371BD4936E90AE06E174CD0CAE8D731317F9EECA44255F4F3C3945",
+  "66B7AEFCAD94E6938861FD2A958151782D94773D2851F01C0027E5DBBA7477D5",
+  "7E30DE75906872699ADEFEBF5D73801599A25398A0D3AE024A9D23DBF557637C",
+  "2AB206402094152C95805F5CD17FEE228DC2FBAA9DE6DB008C7B2F654C1DE462",
+  "0E69B759FD296D210B4EE1136CAD47BAAA2CC27C58F46624FE251E486A79B676",
+  "B26E2947B1EBF3D8D6116716CD89F7EE18683FEB11CB6BF81F29C7364A1207BA",
+  "AB0D1EB0315DF8AF7F7AE0AC42EAF2F52FB0FDF0904E182DCC796B6CB8D7981A",
+  "5A281AD7EB81FB083D05CCD21B78C4BCA938AF26F20869DA29C8F13B7389BC5F",
+  "C48B6E9B12FD0BC3A603F8EA2F4A6A6F8F83DCC6036D3F5F56AAF092DB9CD90B",
+  "441DD532063B8DDA4F053EB4F37583120DEF0F2E62EDBB900B9AFC2564A01615",
+  "E6470F7FB66345B3DB97774832AB07F26DD836B6CD3B28AFA74F67404368F54F",
+  "A518EEF8C72D9D1DA6BEE187716A9BBF1DAFF28EAAB6B5E89F071259C219F4CF",
+  "3F9E0159CEDBDDE609909158376918BD2FA4197E86088CF52BB25A45F012CD7D",
+  "9DB4465229E011100FFA49C0500C3A7B2B154F29AFFD0291CA3EFF69A74DBA9E",
+  "C65D15E64477D0CA123E85D632E8444C343E00EC08934EF3A8B4E22C871BADF8",
+  "37A7278A4AC2C4B02328A578A8F08E86FD00AB412EE4961CD102F2312B0A09E0",
+  "04B2BC51BAA27EA30F34D461EB68E804A4971FF8B03273325F910098609F1806",
+  "3793762082AC3CC05A396B591D465C7883DC0AC2725743B49A59885C94565E81",
+  "0A2BA0D32096CA3B56E4FF99540B7B7AD019AE86AB9A05B3645FF75FC709973D",
+  "EC9252D6603BF2D0225B3653841804187623FE81E62D96C152A8A2CBD23022C9",
+  "ECC5E6C73F960993B5F4902553E1D1AEB0A59A18460E51240F4060E7CE28D6D8",
+  "EB955043643B385D88721AF08BAA6CAAC4B61870E6A30B2572EE4102E2A9973A",
+  "73609F6A67B96085829DFE8A3FE3EBC767F48A493640DD97461957AD995239E5",
+  "68A6C4B6A99849C6B0586D5F6FA1AAF9A39A0985936CB7AB74F130258F62CA4F",
+  "B6D190F936DD9AEAB42F58BEE49B0DF2AE1C2099825352E9ED1CF1A4A8C137CA",
+  "B3CC8B468853A62EABCC75E466E1E41B4D47AB57A9637CA7E20DB2EF522A5821",
+  "9164597B0FD4B6AFDCF7450E5DCD1AF3601D1936E7ACC5AF955632DBB1E1B52B",
+  "4F921B83EADF5C88B50770BA882A5C05C328A9D794E1EDD96D259BC95AC8904A",
+  "4DAAF19A49C249EDC725FE62DB147225BD26AFF2089682369A4799AECBF3F2B9",
+  "E58D45ECA5A58538F9DE5B7560079D31728B220207EBC2CEC80FF80AD1D62795",
+  "F926C7CC6413483EF7D0BE1079E86F27375ECCFB7F0667C474556A7460E62AC8",
+  "0A930F2514FDFF9B85A64AF7D0E97E976617D45D57489F87F202E82BA6FB2EC5",
+  "EB63F0D82807BE1AB74694978995922B1DDE6E5633CA33018F327284FAEE1C91",
+  "7360F653CA19D49FFD4103DA8A83120746651BF585C18407AC3F58EF6FD51DB5",
+  "41ED3DE5E13EB579688FC5E65D44DFB79F7072C9666F29E46F3C191DFE5F32AF",
+  "7A49ACEC023DFF20F80D0D70334647ED8CB345D35D166944D0212AD9D5A5EBA1",
+  "BF099D57C161AF5C3A8DFF603BA5B12A1B818F97B7325AE1A8FAAE6D3A503EE2",
+  "E69F5330299E26C69E6E6ECEE856C0500C333867258DD65D32CD34717DC0FF3A",
+  "CA3A75E863D836E585FE089418C3E8B228A53CCD2A6F9075B76E7D97CAC05182",
+  "B1EBF993B7054F4D449716C126537717E267F7A86F8344F45B1E39792195B56E",
+  "C62BC3BD14FE400AF4B4DF8F46079067B8F7E89FB8B7FECFE55BE95D710EB18F",
+  "A2EF06DD6D14EE69DDCB1C1EFFCC9A1FEC9A50C4452B98A6AF208932245AD751",
+  "52F18DD353481DA053E6051D55644BEE424CBA0F667EC41FFE176363626D1514",
+  "244D1607431B7A476F0EEA7B52D3117481DA99C28AA572F4FE8D4A57E12FC09C",
+  "AE76C11BBA8F32821200263A3F5FC254A53DAC20C41D9ABC20C92756E1DA7A68",
+  "3E9B31B85EE8FA66CA827115F14E4C4C16E905C38958D9E237C3A99A5DC6A2BC",
+  "A640653D3A7EF7A3C4EC6DF5651BA4B6D990B78E9482406E39B09BCEE2FC4E13",
+  "337B38B4A273A1294EDDB035FACC53DBCE5DF5236DAB30C14E8F625736BCDC2E",
+  "5FCBDFAF40B96D418D15F7093C7F73BDFD235B63574B103ECD4A94BDAF3C8CC8",
+  "A76117629A5F50A725A0DE4B282E468F4AB15CC658DF092F57C94278483286B1",
+  "4F4E3819E95E660F60B110AB4C720571C29FC4F95DF5B7A04905D4F11D475135",
+  "11A5830E910F98978CE18CAFAC96C8EDD42A8A92253DA151523E77C4FB42676D",
+  "52DC57E3DE7EAFBCCE757AD27353F031BD3933C7F203113D2A68BF3F1565E58C",
+  "06AA1F930D02CBDC8E01309FDED97DA98C82D4B6EE822758DD5B9B1684DCB3CF",
+  "CAA5F259FF5A59C3E53965736CA1652CE2C53677AD60797AF4473BBA9B48E751",
+  "630FCD852EAC3DA60D005EB8583FE075467B7F0A8B5457DBC0965DA34A1E1253",
+  "A71288A515AF446C9E5746ED82A37BA4070E98DFFE2024EDAB896ED643840858",
+  "224F58001DC820F07AAA4E6151677A1F447E1D67D1D9A4DF0B5BF005A9BA4A64",
+  "5143E52B6D6511B7F8AE9360690782076018311FC70FACB00F0925DD63A560D9",
+  "7648FA88C7EE8012CDB12F99DD0EF78695FB7773C944F1C26B45B28C000A6B33",
+  "9B0EEA22DAEEAF0CC76D49D87E64F41A8CFEDB0A6AE96A89E50ED5D76F0A5C0E",
+  "2D42A9C4A03353E23C573C93D6C32AB8F5A22F8C015290942F23839BBC4DBD05",
+  "BFE93BEBAD3F82675FC584559A0D93457BC4EB0299188DDE1A49DED0106D229E",
+  "E9DC68FC5F4799A479E9F5A69DEC8677B2C8F631F4923439D8DAD01F422F0930",
+  "45F23D54230C0945CF8659B57E393D51B9484B28FA124652026D73EF862AD672",
+  "28B9689F7D2E644D1B78BE65BEA8AEF3C9C83992E5C5CF9586F7A95BB68958BF",
+  "2761D393CD1AE96A38EEB34B648C0D01436FE236A8678CFAB0A902648D6D7686",
+  "E49C8E2165B27F609A1BAF045E62AE0359107EF10CC9D57E2E6C3DF12D08D4FF",
+  "D5A73692A95B9EBE0A83AC66EE66DA9973F87F27C8DF544AC49A4149F136AAFC",
+  "E42C1CDCD13421FF77CF9BE150DD7B9222894577FFEAE6909628A2500A1EC475",
+  "0AD81104D8C563FB40085D94F30B07C65BAAA95291E4034715DACA4BFC96B092",
+  "FC313EA1ED866425CD3B6AEFE23B111718C2D9C02DAC0A5DD2ADBBBAEA8A35E4",
+  "D39E901D9BE34A7F82B5BA02933CFD363B4EFCC235237D074C3A6BE8098DA2AB",
+  "5AE5595184ACFCD86FF2934922FD73A627DBF33451C3D6338E757245BE4EFBA3",
+  "7D415BBC830C311A6A066DB56BF217140ED652A6D09DECC18A192286D10E5487",
+  "0C12BEDE0ADABB9E3B4A6D58D243465C6A34D774E835EA07EE40C77DDAEA7E96",
+  "5477EA91C730FFD72DF56DD3D1482B093939F20E3A041D05D8EA8151688F7915",
+  "C70933F4D2674FCD74A56EE0B9ED451355375AF8F4C75CCAFACD76AB5C79F6D7",
+  "36296CA6CF6D93F2D17EF8F243F6AEE3202AAD393ED16AF5829EBDEACC833C4D",
+  "EE1AADD1882806070A3C8AE0B496F468F4C2FAB34ED7384E3A861BD06E0266E5",
+  "51556D5B7F8C27B92CD7F888454C1CE40BEB44721896018CD7E1E1AE1545181A",
+  "FAE3EFAF851F0D96401DA2175E00933D049F5DD1F7101A5C9944BFDFD7D0EF65",
+  "D4A59BE0A3C70721B18CBD9F8DB666B40CAA106B036F9F1A49A732E3DD9D96E2",
+  "46C25896079A30721B3BFF18A7905A203D77B1221010F8521ADB6B64BCEADBEA",
+  "9131DCB5061D303E75CB7FC145D6F2345C655F21D505042B0659148C8AEE9BD4",
+  "E6C28B026EC9A9E81313C98A5486741C8E86BAAAEE4E1A981B051E95B3482B73",
+  "950D192841DEACC44CB58E02FA3FD1E35E6BB27DADB266D06CD5C7EEF0C33560",
+  "C1C14BB9B8B2104E9B902031B06E4DFA2ABBB2F04A035FA8C20D427FB13BB08E",
+  "A65191CFDD631BFA83E9700C6BAC80FF31AC949BC8C9BA61E8F888BADBC7D164",
+  "663F33FBDC59620303CC75AFEA27FDDB2E3DC4BA0A72545342F5B0EC0941031D",
+  "27699E4C2FE62799997418194BBA370C093F7538EDDA2A422D6E1F15ABEE6AE0",
+  "9D4206D12659DB689286F780326FFE18BBEC2A0C5378C46EC98C0C2E85E79FE3",
+  "26115279AE3CBF8A1B66415D77419397B4D91D358DD67F570F60F5DB21EB49F0",
+  "9AECA17C9CEB3BD99467781B9C0C3FBAA41E98865804D5FAFEEB85D9D2403981",
+  "34AA601D2F23871961A776E4B0850DC4108057A7B8094C0715623F45AD3B74DD",
+  "403AF67663796783789201328D571DC9F789BC807A0ED841C9CA407CE4400E95",
+  "D8C61C6588BE25B22BFACF200FFAAB8E268AD629E7FF0126D2D8A37661E19D55",
+  "445C8D46F30CCD62AE0D83E3FEB3F3B7A1274A1100CC60D320AAD72D2C916258",
+  "C7E88833D8C2D389599C50F5D93B148D1DED90B8E77046B40984278DB450D94D",
+  "C267382AD2A0DEDB71568E4374AA25C799F37FFB852AA980DFEE08B6279A3C7C",
+  "F7F99245942F45763DC103CC3F6CA3C3B3D07FDA92B382BAA2C9B77772314734",
+  "C66AFD3C81FAA87A49F131346FB33C64BFC8D6986526F9A9CEB9357934F3BA08",
+  "7B0BAA02FEA78FE1635066A0ECEB665445A7F488803A29FBF01CD3D1DBDA2130",
+  "A6116416A40E269DD81FDB512BEC6D069CF1972F88F8270AD3B9DB4CFDE968A3",
+  "BAFD02B49F0CC28007635D64E656E0A6D3E4E06D0485F6D688523BA3B0BE13EF",
+  "AAC471AAF7B0ED210DEE7FDDD51BBDCABCC5D471D73DEE24704DD29FA8ED02D4",
+  "B721EDF3538D9D3BB3839721CB476DB34C0A6D63FD63E7A7967036A99139D29C",
+  "A7430734BC7CD8826588E5EC207145E1E5CA03C11463007790DEA11921C0284B",
+  "21A4E09A73603812D58087268BB9AA0A6BAB8CD751FC068BF67288015397F52C",
+  "6CF55032E99F595FFF79645DA5FB5BBAAC0A5B98AA44FD6808C61B42536729DB",
+  "65439D2A6988EB43F1657248A7D26677F95CCDA2F829C5398474BFA767A8071B",
+  "D68D703C0EFA28FE4742BB349A04152F825FF506517C82C087560766E18136B5",
+  "334A71543065C44ED37A046615E11B4E2211D168A829AE6CFD49D16CBC5AE927",
+  "616FA42F4B4BD2761BEEB78A4BA714A7E2A3F0FF36F4344329B7E985C5A10C4B",
+  "84CA7F244A49B6FE4409E2516E4968A1E8C9F3FA3D33737819FB1C51566C48D7",
+  "136848D84EAB8F70BFBEA267CB38589209F44A3371BFF147BC941B54A6F1EAEA",
+  "4AE6BD4C16867A3B737C3F740F507683353B3BA7841311F37FE86F21CEBD93D1",
+  "12C913A9069A3A53362FEE4F4095BE3C0345A8C83F7E599094A40BA0B6500EAA",
+  "6FDD029E613948670CCFF791016E73297526F67482F37A520831AF41267C6518",
+  "04AD3112F7B6A0BD17C586F59CD6631215D6778FAF441520BBCFDE1235B311CB",
+  "F07BBDA28B6723F2D0E1A9B44274C47F77D22E94755889CB26E453B92587BA17",
+  "69C60297ECBA16C90B7D8AA5D0693B97FE219B672DA89D0AFB5C6312686DE379",
+  "C80445E28A09426C4138922025BD7C770066CAC1B9E4B0A34948AA99827E68BB",
+  "6EA81B37744C780F60722A193F95A0F224C3D10156C56628416C2631E1E27AD9",
+  "0E41FAC3575A83E550360BBE8B57AA1E5B09804D4465D4328F0BC463F28560E6",
+  "2F79A5D2D0162A9E85DCB3BEB291299666657B7BADFD6AE959D70E74281FD71E",
+  "929EA81484A207E5C7B0FF4C4B537FD719B0CAF9DB2598AEDEA67EDE3AC9A732",
+  "6867F57CD5956766AB6CFD6643920933C09E12D1DA95781FAD2EA1D2BB939416",
+  "B91BA277E0A21F6B24DFA63A073E073E949041A9984E3C27FFC1C9ADD5FBF29C",
+  "F76A11DC0679327D30D4CA3A2DB80C2A56F45A5CDDD240C5F6831208FF4A0659",
+  "EC29BAD2E2051420E41B65EFB06D158DFCDA1733EDA047F35473DB6CAAC4DC0C",
+  "255A9CE1100D926C3D1404A8121578A1527FA2D12CC40A17B2A2B72264DF6969",
+  "434C67F6D4B650D0171E06598FD55814EFBDDC720DB2E4ABF145BA2D25274FDA",
+  "A7F8B7D479F33823F7C585E6B0172C4D16CF558EAA66FA66EFAF9F0D0E3473FC",
+  "5AE85D6B55F8CC73CC10FFEA84A15EFBBF0E685FA8C454773800BA694A276A78",
+  "ED12B3CAC4C7439EE58AC0CA264AFF233A7D3D12B5C77A0ED55A7A4BD6ABDABA",
+  "DF80813DA045734E934A94C4608B76880EA3F53FEF75B4C6EE8E2E49C0804FDC",
+  "0BAF003FB2C1AEB3453B928EF7602677B93A76A7C6F938221B70CBFB2FBDBC32",
+  "EAEED58FFA55A76F56EF4626025A6C5833589C36F3C06C799B10FF3F7854E0E0",
+  "54578D9D0D42A6AF74BAD204EC05AD518F9773A98DD3EA0C83B8D100825E9502",
+  "8E7EE1721785FC229E9AC41E80C3BF500C05A9B19423E2ED51C3C96FFB5B1BC1",
+  "D1D378225E48A979B67C83443BC96AA2ACC7550A430C35585DEC612B56B4DFEA",
+  "EFA110488D317076330D202C595C85C493CCB61770B37E4895A61C6129E16033",
+  "0053DEF8083DDF0CE96642CF62A6B8B651B78989EDDE57A7B49DDE984F30F153",
+  "DFD44E34BD4B4BB11CAC90751F99CF64A5DA50AD421EFDE8FB9738491E791C07",
+  "465ADB26A4784FEFD0DC46329DA1B1C8CA1ED1C90A9BBBCAA45E4F0A1D717E1D",
+  "0F7A321921ACE892D08E08CD958635528B72A9EF53396D777D864D7F8CDF6578",
+  "94D6F72207E25E7C882C3D9A04C5698BE366B11D647A31DCC1A66084FB11B757",
+  "CE32323605C72D376285B937E1B65B3E4869CA1CE11CA6B28AD810D89681EF8F",
+  "DE96C5E9AC154E19756E9902CEC8CECCDEDD757F165B857BE6292F350FAF9925",
+  "B9A454D3E77AA76CBC2FFE68548BB4E91E9B36897290F910278784CCE9F8FBD6",
+  "9461E90127185595C4050679E909F29055B1E6697831FBD667F2D4401040D05C",
+  "CC1AD1286DDF441CC9781DDCC6C19F24DFB88C1BA3C86355412068CD3EE44EF7",
+  "A33257E48A2FECEE41343C2F6B5CFA65BB2C936629F25A65F5A9E2FD1A97824C",
+  "3438A8F10D6B24052E8E67A0F546B271E7EDC026CA2B8F249B370BE5470BE9B4",
+  "DA9481DF821BA5E2C427E96DD89326B31EBC84A08BB15C9A23774104E9EC3E59",
+  "4522B2533A32E4E3A2E926E8D38A2BF192AB7217D80180CB8E080C33422A69D6",
+  "BFAA00E85138AC411D8AA61FE59727426E97B20688B6CE09CA9E79AE1910D62D",
+  "4D94DDD76612496ED3324A753E939FE39C6EF0B94819C005AE1DC02F24DD773B",
+  "D6D25B80686C0C447E879371AAAB206F7D5079775C7BBC100E8FD6564F9A5BBE",
+  "AF956606395B8AF1446188A110F51A8DB7C0769F5A19721CCEEBCE58C888C6D1",
+  "29105BB1022152715FB3FABFAD01286E5A4979286C3FB056D192C2D9E2876F9D",
+  "7EB1AF898BB0C3200CA84228A3CC49CEF119011E0551E72D6925039E790C26DB",
+  "0FCC093E43953FD974F2FD95D87947E419A6A969A911C2D349EB179055869D83",
+  "B239F2015DA120871ACEFEF049C0116BBFB43C727D661FD4F2BD1D688159F618",
+  "5C97523F8D8755EC9FE15E4FE47E7F9BED5D58A9789542958B2FE7FF3B026E91",
+  "C5946ACA2EE1852C2548EBC2CF5567D02683F2516D0BD17903843C084755D55F",
+  "FF0F65E4E087D3B396720890EBCF32FFA6626FF5C3A60AFCFF0D90056067AFEE",
+  "2EA225DAF7573F98EA3D2BDD74EE6F407F6BBED7F5CF1F22C37C4FFBABDEB9C6",
+  "BBF5173B854981C3553FC94E8B8885408B629E1BE3DA994BCA20304EA1BE1607",
+  "24C5F097451EE72DA1699DC2B94C8E954A053E658CEA88D260BBDA34D256DB2D",
+  "41BD5139839A129BF91FAEEB12CC1AE4EBCB7F9A39A2F8B62F2F75429A2903B2",
+  "008D71D9D19017620C043C1F61AC057BCF9B6821D3BDAADC8E7609824CC19492",
+  "BD6CE2F651D0C9141E210632FFEC4A60E1DF12F236E87CF5DAE3B89CA351CF41",
+  "53B9B5C8696A898D98EBBAEC68EFB3E06F43412E0698F89AF1D39B00F8259979",
+  "3CBFFC644B193DE9C181110E1327290599824DEB52755D7AAAED5B3976CBA1FB",
+  "AA9AB3CD93D95CDBDC922B35DC39F83A7F30508526EFCFD99771B941B31E7778",
+  "746DCEFA5AC458F7B740A42C40714EA5F30B338DA67DCF16FE06E08F7635F4C8",
+  "39A2E79D4AEE88F330556BA734DE6F34731D0013C2B180F7F4657D61143E11DA",
+  "372F372C7C05FB750129C73A22A190AC1BBFAA8A2985A30B346230C4AEDCC206",
+  "71157BC55D59E35DCCFD34311C0A783A5071D4DF77C15D35C87C2314C7D89DD3",
+  "44537E37F177FF6491E2B04D98035364CECACFC178AAC27F6D9CC46443941484",
+  "F115287F7F2CC4E225F82D0290185830DD8238A282F2E0FE1DDA538B5E7DA921",
+  "0AA991CADC39ABA114DABD2C52FF34D26F798D529E4E1A8A47EC12591562C7EA",
+  "5B8B64A0B9E225FAB9695EF1FA21334BD192E3B7FDEE96EAF5C99796B0ACF3E4",
+  "CA3CD87EBA803BF3F460B26F15A7B307F60828ED73FEEB6743D64716E8864E6F",
+  "9E2AEDE537B0B10A96E901C12B2B0E739F163713B26890A5D42AF6FBD678B021",
+  "F27CFAB7257DD2157B348D456128F1AE39C14DB52DDF5BAEAC8C017C7D7895A7",
+  "62F31060F9C789C6BB27696C5BEDF093DF8303B2EC145B9A1ED109353202D0F8",
+  "3DBFCB90C61E83C6371A88ECBA98AED6ECEBBAAB270D16D4342B5C7CC39E12CF",
+  "201942846595F768C2CB516C986AF1C0E78C6C4746468A8C637C038960BE132C",
+  "ECBD91BFEF5FB5749CB90427C668A768CCFF3BFE163D4F7126BDEA9A4F0B0579",
+  "D07E62F962F806427D79EEA2C8D9A54AA00F256E32D15C91A0962A32DDBF251C",
+  "53E934A01AD32715F8AF8AE2451E993098619FD04E5E587978F38617E6C44D10",
+  "32AF368A25C83A104A74AD645142A00CAAC0F8DEBB5870FAA456A53B319A6925",
+  "B3352F2235643435B769D99C8A5CE074264AAC4756B6D1A42A0F1B703833ED25",
+  "0538CD2D4DFACADF45A1B539B8958BC396B83E34244744EC5DDC8ACA1F5D0648",
+  "7266E899A1F1B03C56E3A820039B5EE745CB37CAFABAE252F29B2174DAE1A604",
+  "9782641C969D4B2FEB03A8C57E4E9813DFFD26B2051F068490A51E700B7AA701",
+  "F05DDE6F4F596B3574C54B57AEAD1D5530103A0BF2509980032EC2B477467394",
+  "64E5FCA2EC4D288C4743E5675D6C72D1CB6EE85A70F8971066B5E43F0E5A2F1E",
+  "F298BC7D02D0F72EA2171C0C27A54E1F378B407A68C3C2CE985F714124ED4B56",
+  "D04DF60C1114CA4F8CB01DE5401E5E2CF14987A005E9965DA9C4153AF4BDF7B7",
+  "B5D1C35A3C6E721F1F31D837A0F04D08475B75A7E6411D651B9BEF1FD69A20B6",
+  "12CFF27301B92A786392619632FDC7950C12849EECA9A208B2E86B68ABCD582A",
+  "51A9DB72D2F879709CF938151A395C1EDC4B006C5E346F4AAD6DECA67F888548",
+  "DC6801299A17462C87B755843204B351835AE25D75F9E5171A1E12B57E84994D",
+  "58EFEE086C7543B3AE6FD4583EC50862C6CF53E3AE33635567FDB4D4DF42865E",
+  "C5CA0C71274E238B00BFD3E10A99BDF0FEDF9633F1961D81A6D173BD8BD20A92",
+  "5D6C0F57D724FF3AC992CA5EAAB9E257429E3C4C8F5C379675BC247F56D52199",
+  "73328646D009E2F14A6F189DAA37055582DF269EDB350FB20BB03F7FAF676488",
+  "65D6F47BDA10F72390683F6F944D3CACDA19E7B70E009EFA2DD9BB880B038CA6",
+  "816279C7DEB082A4646E00C31564FD040315915FF2CA0B7419DA813BA41A2999",
+  "CFF2BF03C9645CE9D591C014E3ED6AE6F8D6F68F14EC1030B151D1604674A141",
+  "387A2BECE0AE3D331B80071D6417B5B16120D7D61DC263C91B34F68AEFA9B018",
+  "54C7563C9AE8E699635F25F79650B2DE7318A8ECF3BA4AC206EAD7F4B066AE1B",
+  "2F567238E612EA1FB26010ED7060D9E83029D0C3F23B72CC484EEBAD4CD57D25",
+  "78EB86AA81FF3FFD6EA1F586FA3CD9F09EAD5B84A6083DE5F0F026DAF4650903",
+  "789F32177EBDA29D6D50DBBA750F1D1D34B3BDC81B126B5814F62BA102A51E74",
+  "F3CC4CF1BF6FEDC2BD98A3032986EEE72E18DC924601E7C0BE7928F21CF4DC94",
+  "E3569841E55875FF4D17B6A981CE9A6E531BE15C02930EB642736D43224CE601",
+  "9234179CF6613944387EE8215FBB325083F7DC75C7FB7D025481C1EB18837AEB",
+  "4A9F266D707A06C3AEE64B4CE03105CE1F2A1B0882A67F027316D34A05455AD8",
+  "A667AF379465E54D2061A2429FCC263378B0E8C2C797825B068ABDDD143F664A",
+  "51EAA099E78D79377D152F96EDE0B9B6AB8E7DEC66BE53BBFF1A1B78DA723A2D",
+  "6A120A32451ACE8D1CAA0861B709EB7A6C4E88001676645AD76CB84464DDD8B1",
+  "4F7D4C728A9941EB32EC81893DFAE5E165DAD0D100F80F4FAEFB689FDBBAC3FC",
+  "C1501B200BA65FDF3DBE17DFD56FCEBBFA0CF896B0A2BCC77BCB8C6CB2B33700",
+  "4673B71BF3B5E6DFDE80A8F11966A8C75FB494FE6EB0D6BA00768BCADB537909",
+  "A2D9CF502A183FB03E1A434C89DB7AC7A55A543F092BF8D169E5E69198429E8A",
+  "919EDB6424E433E409719DCEDA1EC9DC416103D8ADA1EA7FC1B152EF179D2C46",
+  "94AD50F8A4AAFAE3EEEC21227B2F7D6F807B09FED0BE8F31A7D80FBFA9FAA923",
+  "05538AB4E06C0BADDEBB41026ACAC9AA2406750C6982303F09BCD7A55DE9B1C9",
+  "A78945BD3B23CF66E690148F7B7048E3FC1307AEE86587112F52E3A4403B448B",
+  "4A22F81C6994EC1AF30FBC22232AC8DE455279789EF44D2EB561E8B3A47FFAF0",
+  "505D8B336DD11951C4C023A7411CB693323C5D44AF0BAF67EC029BAA4084D1E8",
+  "33E468B78EE36D4670E3B170634FB9FDDE9590785032AD7CE162A6F27FA44AE5",
+  "E9E0865FFE785C396450F409EB32ABF31706FF57AEF06C5B7905C8500AA317FF",
+  "B8477F1F81BFF9A3048AE5621DE83C00C0E247776D748F1BBFE7F47253CA3E49",
+  "FC427F124ADF71B3C7D2880C7AB353EEB21979992529D7317E7D180BE3353332",
+  "367BFD7D57B412554675CD59B19D724EDC512DCDCD8DA4F0754837B16BABCA37",
+  "3D020D1FB5B3B4839C71A8990BB7707B4C08401277BB516E0AEDA7C81B026EB5",
+  "9C967B22E555A88BA4244A4E0750D44A34E26FCBE2FB802E05D40FB342224C7F",
+  "C0E556D1DA49B6EA19FBF57BADFE49DFB4981F8905E784A545CA66371DD09760",
+  "59A0CE4711D33A85DF13E121E95B7C64017A612A2921E90F1171E14125C48D92",
+  "0B7C9DF262FA56E8EE72D41E3DAFA1CD0071705293134CA5779EF87816D3743E",
+  "9C5BB8BF6779215B73D0723284E37226A3EA5AF4389270FCC70FA40619FF246A",
+  "E342B0253B43E0CFAE2D745992294CF0FB46CDAA7682949BA6135E2ABB38EE5D",
+  "2AD22E25B7478163FA06A466DE948F1C68CE16944422ED1CAE0A4BC897C7C77E",
+  "F16072104980FAAE91FE451ADA2C246481D6FD6469CABE44E1D83308868DD4A1",
+  "DAE82FF18CAE6E60FEDCF98E2DD129D97E6A36CE07D19AE5904ED08C228C60E1",
+  "C196135E78B521C7CFC6D3899AEC7A4150E42363683CEE23F4B31B5DE7C44BF7",
+  "C1B0784D7E428648996E9F45DFA9025435675E227EF6DB2AE88C22DDE4A32134",
+  "5BF00321E8D11AAFE9C6FCDEE39BC6409A19593FE87E547CBBD210D095C337D8",
+  "A44CBAEA47F0F4A06E2668B5E27106ABCDFEB3E77B8229D3DA1A948AA2B44041",
+  "5FB723FF26C5ED59A4F9FA3E092B166BE613D13E355728D1E2C5B455E81507AE",
+  "47B6853CA48B4647B430F2E5B173214D04A40F38BD3CF8F295D2714ABB468077",
+  "C73A8750E3F5E7A9966CDAD66A677B7478B404BBD4E43321C3D7847E156B30E6",
+  "4530737F3EEC292871EEAEC5820AE9A08DD6B72D636DDBB7894A9E32FFFCFFD8",
+  "D65708818F00735511E001C72AA3C9DF8A62F7E284E79BC6F74163E08884AB86",
+  "6DC00E0DFAE30DE5FE28109A0F102FDDB974AD7301B88324EC502DFF15D91CB3",
+  "3B7C21C3BD46285DDEC4DC571E045EB202124B2D79E3CDCA1ECF1F3034C23092",
+  "B52BDBF22EE9F1204BF10DCC8F013F162CE911A47FB2584C28C159B1E6D38F78",
+  "C5BBADE8A477EAD9A97D364821F9EB044D04DE1B7F832F3293212F246C343ED8",
+  "D9ACA7AE5EC42274FCD31A2DB346F8B2B4F9816B892E38568A09EE3EB691F2BC",
+  "9CF1949768871D7E2CD0106D8316182E601E7D6B1A25E214BEBDF81233D4A1EC",
+  "990EAA6E1333750729E75C8BC6E5503ADEAFF7D410DC0F30C89ACCDD28446EB4",
+  "5FE3B1A12F9EDD119F0E154BF8BDD60CB97C6D7E8BC816DF2BD28D8779423FB6",
+  "338501FF2C729CFB146CAF70844CA9BA2934180556A6C34C81CE47B2B2651564",
+  "F2456162493BF748DEBEA966131E22D7633948D7AF46BBFFB2B68469A384171C",
+  "2744889BF3B63C23CC61153847337DE10E3394A9CD43A0F49B88ED0451154C43",
+  "A227C601A31F42F23507AD5D394AEBA98216AEC2FD6B15036386C1C1CF2FAB7A",
+  "0A61F71B15D5278E6A422C2BEB0CAE614B7585A58D9225A77B9CF27461161801",
+  "6E961690271E9E08FD500983E21497D4AF6BAB72189283D8D2A92456C5377234",
+  "A51AB54C2250AB5390D0D828CAE1DB286E2F714EC7402E20ED04E15B2994417E",
+  "92533F042A0E99E9411C20B421A583907F9B198351A5E858342922BEC3A56319",
+  "5BE43A1E75E59BBBDCD293500EB47F25F5281F954B581712184A0E74763DEDBC",
+  "CF98F0B5678E9760BDC0A8EC9C05B663636FEBC0B3DFF8BC61C61AF38B76F3F4",
+  "3D1A4E209292A50CBA8B4D0EC6319390220636A59452EC15480E6B2A7E39644A",
+  "2159D6C0C7083308DB3B7D00BCB2FAD83E4E9127010FE5B2D6C9D6AE4055333D",
+  "9002449637FC8453BA1DD095F1D8C6A37F9CDEE7D6A37B5E45E5133552A4C3CC",
+  "25280140CB112F90139BE90486B1FC193A76821ECDD39EA3C69F8DC9C2B54854",
+  "1F509E0BA8DBB543C1F354CCE7B71EC75B56EE07EBF32F2088BE653121E75F64",
+  "D5EBEDD4D80369BABD0EEB068D2A69B4A269B9A9D5D258C382A1FCF7BE91AC72",
+  "3385305DEBA9BAE46F42EAB5E64ECC9FB113C3B4ECEF9238E04668B68FFA47D7",
+  "9E062ECC82756980235B48C1306640FB9E3F26E032634F845501600AF8D90A28",
+  "272C8E8B04FD90AED1D8359260CB24FE2D593660CD5C68F172338FF6B9E6B7F0",
+  "A840E2C02EB66B900E81209BAC1C1C2D6E77ACD7629AA654E0B0656CA11C8280",
+  "4CD2E7E7B06B7CC2B5BBE231CF2D7CD9D88C0171D6E8DC75B261540870961598",
+  "71C1D318F2860BA7B0A17A035F9968DEA5CAAC864DCFD04F4550C7AC999DAD18",
+  "29E8DC6209E503F643EE35BE14ACC1BA22221AC24C844061F502106E31B1CF6F",
+  "E5E55DAF38AA9CB9BE29401672AAD05F83B6E25B15A6A981CE601A10A6B86DD3",
+  "8A72DCC787E6983FE1D5F850DCB3CB2351E925E91B8A463BDD2AB79EC3F70CBE",
+  "FC6FED5081997C86BE6B477A17745D5AAAD04B3EC6DF80EC0880C34D46FE50C5",
+  "80015959FF177BAE52C754E6C06999D55DD2FF3F8316D938CB99BBB278F67523",
+  "B5D80E85BD2ADABC469289C56873C15917E87AFAC29F832B4A821AEDCAF54C54",
+  "C2D485F11B5E3E12856C331C578D21350DD3246568890EEE8730D4C7E426A24D",
+  "469C558ACE45382B714A99D04D3FC42464D4934FDFEC798D4815EFE3F1F1A961",
+  "FFB4F470E744F91193AE187987C75226DA6DB4FAE9CCDED27C44EF17857A837E",
+  "C6FD073510258E0A6A19A0306D103F9EDD0FD95D583E6D5E124DB78CE9F2D6BD",
+  "FF73BB400291EBB3A81B371AE5E19AB8226A710A8D8C523F63AE9EAF0CC82D6C",
+  "A3BC97208457B9D67B2D56C35B976639F2A9BC71400C637BB68AD04E3BF82E1C",
+  "D4FF7BCC7A6C6165BA4652A022DA1DD13A27E0F78FD01A19F4216BF803F3D219",
+  "8BF6AFE407BD6EF89AB8B806540F0DD018C5153F3F233008460DE8DEC965916C",
+  "AFDA32A31F0A7E872B0338CCC1B2683CB1CEDB7516957D47690C09D57208DA28",
+  "B7F03D48181B8CBD238418A9E7C3D5F2BD99EFA889BC193690EAB80D399F9F08",
+  "E6CBF0B57964EFDD194934C8AC908B54291FB29E2391A5EBDBC2C72676FA477D",
+  "F207F5D8EC363798A3B1344F6E19B46983AD2D2D3AEDD3438935719BE1B16489",
+  "3F0265A79884E486512B5CC81A3A44F0058599A3EEDF4873E630FE599C88667C",
+  "990A375F2AD8EF684234D396A873D6BEC2BD2BD2EEA1B24C75FB4785E119FC08",
+  "17B4C1A72F137345312898A418101ACA0AE8BA2BBB8828622700640DF9E73243",
+  "CCE8ADA8C854638BCE9F8F8624F9FDB280BC340BBDA3BAAA7C76E101C0B187AA",
+  "86929E0220282D4B31009C271EF045C9C89FAE77A05A47466FEC640FCBBAAFC6",
+  "8626831EC83694C1812A75650409DA9FEA3229B6FBD1B4A3CFB5AC0F39669D3C",
+  "B3500F0D3A7B556FC7CC8ACFA8F45F405CF955B00ACFD343388DDE3AFBE0D7E7",
+  "54AD2AF36E65978E55DAB939FF17D5FBA4BD9006E7843225FB580785C6D90578",
+  "4F8918872C737FA9D560AA8453661CACA1F9D990974F97E16F0B5E4EB98DBA7A",
+  "B3C41658547FC2CAF30AC8C36085EC9017B9764C7143BB99394D8228468327DB",
+  "9D74596DBC2756DB188DCC24DDC84268F736D10D73B589D9309B9D5CDCD972DC",
+  "8590A57BD0F8643723F91BE8029FC1295BDDE3259B1560DC658FF12163EB592E",
+  "EFA04AE0B0339163E08BDE73BFB51AA9DD026303131C43AAF2F39D084D5DA209",
+  "34F9A90C05DD5838C37BC476BC90A89D332F274FEF09C9E70F35A53567AD19C8",
+  "A25C6BD3F302F79EDBF556094BD9C3271E5A0FC3E00AF22387941D1BABDC2BC2",
+  "DC1F9A12AD6C03E1F432528BBD8C12EF8A2E4AAF561459D7A66DE5B2F92AE36C",
+  "27400E226CD83B5F60899466A22191AB7354EA53900C88CD6F142D550F4237E4",
+  "178F607CE68CF691EA2D4F43A714FB461D36866563DC8E7D1656D8662F5C02CA",
+  "1CBAD45579E68AA17E595704AB198EAC1704D504E5DFEBA5F55F138870C19BE2",
+  "F5199641B9E6EAB1266845095DDCD45A641FCD2F9EB856258744792D87EE4919",
+  "4F5888702F937203033E06DD5C559F67B5E4F91DB8432C1E96BDAC2B502814FB",
+  "5940FF7A91DC0D8053BB10C7963D6190C0E0B46DF87D57ADEAF290C105269BDE",
+  "6A7CF83DD49376D69A258D34A964FA039A04367059FD0980C2FCD1180C11394F",
+  "EA549ADE953EBD5F30E45BEF9B918057C871D427AAC4D8C5CB8D4F29D8D36A96",
+  "DE20F1982B1B927542AF1BA8453039A905C38A3F48A276300C6EB8CE46A885ED",
+  "D461418665DE0A0AEF005BCBD0B1A8BF186F882A7CE4DAC36207F6E826B4914D",
+  "97D1FA4C471B8DD473F69E1F764AF76351C4127E8ED882629625307A8A69A077",
+  "AE6B5BD2408DC3FCFA08B33953AD026F8F7A4B569C75C2F74DCCCA77481BCC88",
+  "8D41F2562CD05FEC335056E55EF5AC5A6985D695ACDC6F9E4D4C2B90E0E7D010",
+  "18D3063B54CD15C230AE50A285177598B2CB5CBDB4BDA31631EB12EEAED5BF72",
+  "DBC26E50755935CE109A2CD6D805B682FD47F9DB22601BFD7E03091346EF8BB7",
+  "A37C251D909D40DD5561074DB4F63BFA94640FE8BD60AE2D9F2B709DBB863FC4",
+  "E6761993EA55D9EFE72B0878E290629E91E555790CB8E92F2327FFD008479D0F",
+  "EB44EC5736D2F8F1BA7EA7427F472233634F41F4A580D888695B34D572D9A1E6",
+  "BD1B3BAE97EAA6FCEFCA782B1F78F566561F72F0B5F3F9F6D535328C569F1289",
+  "BEA3E30DF593C9FD67606E01CAD9578C35B55C22401162E15BF96BB2DAC8A7FF",
+  "3FE66E287C69F858BE3E40318ED31957C9BBA9CB1638BB0FC2FF122C98FDDA2B",
+  "075456170ED5ADA1C802863C4DB540F88D0AD1490A180AE832614B64EED37607",
+  "07A422D6714580577846C10E544CC5DA78B09A5AD927D39340CA3E6AFEF409F3",
+  "E15033520BB0F331ACB8E44C1C6A24EDCF814CDEF9D6C7DB41F322DEFD948989",
+  "3F3363F9F47C0C7BDC1398430381085702D333EAD0D2F78C0025727DA4F4AA42",
+  "94E90F45663783C2DC2493F10725A9A824181C5D73AF27D3093DA2961CA67EF9",
+  "E92C083E982C78F4BEF45F026B6DCD5D901EC765854526EE6237A10CBE0E4153",
+  "4D2B9829DA4AE93EE34C2A733D1EF4F2ACE00B70BB4F298C4981DAB6A3398BAB",
+  "FD8ADF031A77062769BEA8800A4DFAD2AAD8BBB334247FA6EA93A305F1E9EE66",
+  "2E3CA75F571757BAFD4CFF7FA49B4036027616C5951B8004901D7DB9BCB7B4E2",
+  "1DFBC70A282DA3BAEA43BE8B3DC64AB4635E97C80A1207D8D319497E4D98F00D",
+  "A191FF645BD87FED933700F5CA92EBE4B23A667809C5C9AD744426D64BBDB84B",
+  "BB730494CCA6511618B5E2F3D9BA0BFB87FD1F64BC20DDB4B5B254A9703D0FFE",
+  "A683515A0402C07BF497F289A63F532B2DA78D7AE029290FEE64295209BAB97B",
+  "86E1B443417EA03E5472E184038AA575573DFF134B010CE1D3D2EA643F6309D6",
+  "1BF7594D157F17A73F2A25D4BA4F334CD10A6B767EEE95A55703198E2D51C855",
+  "DF895198D05C64DBF054B60F2F1616AE637DACA9F080F2049E3CC1AE1F6BB268",
+  "5D65AFF54F5866EE65A4380DE6F96EF8E345E73340C0182FD909B758BE4B576B",
+  "19A438DC4A841B045F1D37D4FA58D415049D76FDB9F0A19A099E155A1B52B800",
+  "A453116E418F84EDC4AFB17FE32D47B1FEA6D3F6C7459E75EE6A80842672DBBD",
+  "DCF6F2269E2CFE10DA27008F65ED8E963698D49332121667FDE0E9649E23D2DA",
+  "2CACB342FC1569E93AEBDE977CFD489FD13AF263533676D2B6DF5F76B9AAEE08",
+  "3424C36C900B28E74FE7CDF11656E1E1F34D2C94F7114CC785A442A985E4E03A",
+  "F5836CC0DB2A943EFDA62FC10BBAFEA63D7B467B0E112A15DCD786D05A8F6F21",
+  "061C6EB9AED36DA4609466EB539C537BC2F5CAF4576780234276B02979973772",
+  "8C635E1BF01B5AB39547EF9FDA2858D468B6F15A8BAB90CDA6BC8334C707612B",
+  "16572F12A2AF1C08116FE0B699ACB26DD0491120F9E5A0989E1EB149A1960A89",
+  "8AA6F6E669B1D91612977E186C11C1B73B9644C16D472B9ECD1A528F52090BF5",
+  "3EDE202F6F15FF4D17D8EEF80F5BA7FA556D93765256C3A7C9D51BA5393CF6F6",
+  "4F2190CB87BA83298D1547A7F61CAC49740E605CB16E615313B1E8E078E1B701",
+  "B142DB09D7F860826598BBF701CBA69D2E66290E192AE9AB672361274C5C7249",
+  "ACAE36A2C00AFF072A753B52752B9556EF961968DF3EE14B8FB013ED26C7EBDD",
+  "968B0F7217172264C38625458A9581EF5EC039F8117A984D7833732385D738B6",
+  "BB65D604407B694CD90630398FD1D8329C00461B0FECA43822F3A5D5B9E2A260",
+  "71EFBAEA3000517F6F65032071719AB786A97EAB0194F2E4D0E2CC029E0921CC",
+  "5F16925F29F24DAE0E04C5C9321CB595BAC3D9FB006E736231DE1C1D9D821D55",
+  "3626ADB84C21106B34BFF8178FBADDE883A1BA02CE5D377CA8A11939378449B0",
+  "5D09DA907020D20926420681DA207055A85BE7C1CA912DC6E521C1DA73E9E0C0",
+  "9BC881A84EF3A384670FB11BE05FEB0B13BD7DC384958D697B43919A2F9A58C6",
+  "A0B2B4E2F7B5A4E3954FA4F8070674E8600D6C3972DEF7CB0AB3CF64FF922B2C",
+  "6FB9002BCB66A5BF636030A6E149707A3A04DD56FBC61848516B676EC1B5A7ED",
+  "76C8EF47218227EC9ED90CD6D67EAAB4D67CD58CAEA1E9539686DAA6DA6B7A1D",
+  "B28C451B098BC74FF8D7E165476E91A1795C676226DF26390295F1723581F8D0",
+  "DF9090331FB3CADED33A471F16ECAF8A27C1A5E1844EAE449C0B87313119DD82",
+  "3C9F174291B6D2A533EA93CEDE39EB32BE8F267A90F825418F7EF249D76B3B48",
+  "3F8E9CB97CE825F352D5C14CADE3E4048EE7FB7F31CC62D2C69FB2D134F945A8",
+  "DFEF1843C88C71E0550840AD3AA3C00C67620147E37354D72DDE0C0E4C592AE1",
+  "CD19C1FEFA0339E51B4E7ED2E7E0F1B665A63ADA8954173D7463137DA63A3E26",
+  "FA06D93CFB5B15EDC3B2CA3E6ECA5561E2E7317B0A8DCCD026D279FC35463ECD",
+  "8F0B1B939B779D74ACBC1689F9F6629914DE38F9113E75A534777FD8D3AE87AD",
+  "ACF06D74FF394A57B4B9C0DA7A36AF6EEB6864D4F0958404DD43E1CDE4E041C9",
+  "DD5323453DA764E4F8BD36C79AC727F6FF87482F382AE91878A439504FAC0BC5",
+  "3B2A713CA38DD5D47C78FA67E4E159165BBD907117D1CD96A7AC6BB1E73A9D2A",
+  "658AE6BAF85778798A2B2EA4EACE3CA9A2D02C56FFD869C81B45D7F6B4D2C919",
+  "7D0C12754F5A248FC0F313CA56D7952CDDE9346CBCB2DE88C99AA9237CA28147",
+  "28A17C8A2E73620FCD7BC115E99565086610EB1B17475916CE763F312E39A4B6",
+  "6A0CB08089F0E987A786718F172B663288037165A4EA4570FEA97BB4D5B6CC76",
+  "E95C5719907C0C76D54B9E46BCF46BD5FCE89BA1C1CC087A2BA3A9639EC57137",
+  "9CF3BC53FB56F802952C4D684288AFCBDAE9FEA093583991F989E14CE596F54D",
+  "4BFBE434C135F11F76B50B664742B6786BCF00EEEE43C6551D440E6D4370F400",
+  "921029E581D41BFE763DA29134E8891C6259DCE7B204709637394208B30D98B9",
+  "3DC65B78E85EDE81D641E7FEE889EF1DE278659F35FFDC527C4B924A25355F8B",
+  "D4DFAD54AEDC99B17BCB63BA61B8502B2320DB06C78CED232C62F2BCCAF502CD",
+  "A504DBA0907AABE1BEEC17EAF8567E43793178D7A4B4195D775443D625B6403B",
+  "7018D2520D12E1B624A57BBBFA6C5A50A51670837E65185EF5275599285477EB",
+  "BBFD70AFA7CC1901370D48CEBD32B64765150746AFA0744B7E507740B88BA61D",
+  "3C0C0059BFFCBB6046EA335301EF87A22935E3B08F8B8C6605C1230162267A3B",
+  "F8CECFEA3BFC02AD024C286D43C980975675442CA059A378FB66B4E5DAB66D78",
+  "27B336A915F65F7711DA60B9E56FB53DE521D8531795AF5A8D6F4C4D44C61A70",
+  "F162985AEE10EBF8D5B7BA572BD5A180D9338F7E64F69C644E27BB5E661C59FE",
+  "9C25B473DF98454B0005D82A56040FA130DB3C517477BC279E63ADF18C782600",
+  "8DF3F7A4C1D52E9FF67F4BAB288E12C23290BBBCB0212DB6D4CDE5C370237869",
+  "2910A6C5561AFB096198244E605CC1567D317B66E54C0B3A74D451B264556C02",
+  "1820066D1F4F03BA13B2FF20D5135A6F4993FC223960FEE7803ECA9680516274",
+  "B46D472437850D2F5857BDEEDC33E9E013EAAF4926B33EAC337DDD9030918DC0",
+  "43CD66B87E847D60F15C510ABD308A5912C14BE338FBBD117ADF3B5FBD068E4B",
+  "9D1A16F7DE7D339A667071DD3E51F31B2D273E450244F7CF17E4A5DCE5510C25",
+  "D84A60A2A23845388E8678371D6882B6936526CD7AD2F029E2679B53056A2170",
+  "FFC67DECF4FEF2E33760C6ACEB1548B05B9BCA450484834DACB8A48B6C659FA7",
+  "89B7930761C6EE6367212E6EC9344C3BBAA675C78CA2776F97E7DAD93411192D",
+  "06AABEEBD2BF4CB78271357BED49C22327A3847927C3F725666470EBE545FC78",
+  "84D7C4411B26E8B66826817DC7A5E25523AB7E5B520980C681FFEB8B3E14D1BE",
+  "F4014F6F19D8F850A6BF998375CC82F02D48E2B8F9728A97892642B01F75FE9E",
+  "9BC988F5E447DBC9E35AEFBC3CEA04F27FFD83EFBF9A9836D17BFE3C4FDDB419",
+  "41AF20C6E76C9525E494748780A7547277524DD5025B25AF302CD9EA202D5808",
+  "91E8B19855CEADEFA239A09BC67F626E1B9DC02E932BB02C3DE1CB0AA77B1A0B",
+  "B19E873BFA51C557DC43049189EC035093A96AB75704813BF251F50E1BF9B4AF",
+  "5AE4303DCE5A46400E260A81EE3586232CEE65B13D71F320137F4F76AAB81A6D",
+  "554A8052EA7584B09F1B83501230300D47C17D1AED2A24028C106500B368B676",
+  "57E43E02B13C81BBC5FB9A29D6A605335A504FFEA4B70CDE775912722214C421",
+  "AF2FD01391E0742A6E9B72A79C516E0D9253F89DF2765D25E90BFAF6987C0637",
+  "A5086AB1DA9CBC04FDEE88BCDF55F97CD009299FC3BD8535C657EC078E4C3571",
+  "A1A7A326933DC491AC27AB0A183AA38CF3617B36BB0FD4539B8CC53A218D3A53",
+  "373E57794C2210D0783F49377D052D3292090DD7AD81FB1EA93FE547E91718D1",
+  "C2B68E248652253F73DF38A52E7AF5A16205E6FBCF2FC5F0D2693E80E94BE5BC",
+  "1397575C478CB723651A0FD21B283EF18B954AB756C577FD7E98A8E0E318494B",
+  "8AC2FC9282804A01873899319F3705827646C7DE68F72F64BE3FB2CDC83203A7",
+  "0CCAB197E9F3BE3DEBCBB7F514526725126F3BC2B2F3B9007AFC03B5DA022BA3",
+  "1768C4AF96CA45D2627C5F35465948D51C7D3717121693513DD0FB8D779EC6E5",
+  "230CEB08E720FFE51F4F296805DCC9F9B3A224AA75AD193DCFEFEFEE0A2448FD",
+  "3A1F87CD019C222279BD698D7C182BB0CB2508A684E08DC43C69EFA8E38DBD27",
+  "ACEAD428163CFF54785109474F72D64DDF74610A69A376CCAC7B86DC3050990A",
+  "D84B1DEB8998DA8D006C08C1C8CDB286B29A78E35C2F1C18002138F9894351A7",
+  "F0EAC96C9DF89F802FAFED82CFE875BDA0DFD6CDC9C968DE9C9A2B72D94CD552",
+  "6C191690CEA20F2C7604A1E89952ADB8A00FE2980F2524153E208A4E38EEA880",
+  "75243F29239668AF506821197BC5CC5EF8DDAAA417260D8C6B623982EB802472",
+  "F061A677D985E9FAEBD8E10A8295536CB403844B77A9082F2F300823FB1ED1FC",
+  "CBCDE53207DBFF33663AA28C888E7CED5F69FF9994672DCF4EB1859081409BE8",
+  "ACF4831E96FF773EC17EE304D44822D9D51F843386583A6AD1090005D421DFFE",
+  "CAF5C7998E7D6A8E6D6E9E76D933296FB747017ED6380F00795825517CFF658B",
+  "FE414578E17AF268EF44BB7A4067A7E2DEEB56822B63D9F2DC4A16EBB860EF7B",
+  "C32967EA4343BDBA4B08A5FAD5190E3413E1AFA995E42F847520F8A8CF49358E",
+  "2E35464A51CC1F6EBFB93AF6C21906DDA07636313E4D15E43CA2DC7C10333381",
+  "6F3563DE70A08D76F6CD4EFB3B02206B2B4C69986B22AEA6D5A7875FE76FE158",
+  "7FCF80E95E6C06E1067ADACA44740AF506E04AB5CF4757FDDDE7E2DC001271D1",
+  "CFECBE3DD559268BAC191653D147372ECBB53FD92D3819665ECE51F4226457F9",
+  "960F3D827839D7DF78B83814CB3595DB1914A428B6167C0196AFF2E577F45493",
+  "7BB66270F3A7B52B980E76F5DBACADC22A77730558A13BCB6768736438CD23F6",
+  "43E1F5C3FBA79E1E7DC17E47658352E5AAAC9645281CBD95269EAA9D823C92C5",
+  "225185EC5AA4B6C2838FC3118A6614617D8F2FAB48AE1BF2BA7D36BB5F94A27F",
+  "FE2317C0D2B1E10714C520599D57CBF544C25044D1E83A2075736B011286A28B",
+  "91E76EA84182D731828E89D83E6C1998D6B1556ECB11909A4BC784CC29B1BD34",
+  "D14F07FB3EE0D608DBB177F9CFD2A84B80DE1E7DD3C7D7A9949ACD14FEA46984",
+  "EA0F5E58C73CF7BC00BD2C6CAEC22477C443A6536BFF742B78A3B235A3D4B3C4",
+  "0553063272387C8B9C7C94E074F2443274FA1F937AEFBC96FC654414309DF44B",
+  "3AB5B81EA6D69B70CD58CED9F38EB2923E5714FF93B62B5ACB3ED0E2C358AF3E",
+  "860271069E4B8FC352BD2523ACEF2A0E333303E3690322B4294512521050830E",
+  "31F5E003F5F801C2F4F6DC1CCCBAD84E5C339FA356DCADA6A85BE065D7EF885D",
+  "E3515662A5C403C42A18A6485F284D8DED59B665821416116E511D146AF08533",
+  "738061BF58FE24133A34103C906B0979C024E5E3B05938B066F7C93D29351C9E",
+  "4847327047C97C0AA453FB5040CFB14CF627AAD95971B7DE4C7E2AED27598A6E",
+  "DE7E531504DF68C490EB0FA6D513D1791A12237924AFD79B2DD41D78C09179C7",
+  "B304DB935AC11BDD2FEAD3B0430EC26D8811BDBFC4F61DEDF2B2C01AFCDF2E73",
+  "4E5D56D9DFBDE3BEFD79F0858704AABAD20FDCA268DD62E7DBE78020C4DEDCC0",
+  "FF95BF7D308E496C8E814F43DD35F24258CC336DED268AD32BEC82D5AFAC062E",
+  "92FF7B8D8A19B1BA739EE836665A7C5D1A38F5318F3810B1558A4E82BE83B20B",
+  "C0871E8AD0DEC6BF7AD824CBC8B3D34D6DA644502A7A94025A6ADA9322920083",
+  "4CC75AAB1E950E0C02D6E4E2DD2BD32E7953BA633B1020EA012DF2E2197FB49E",
+  "C68F7D31B63F80C1F717652A34F4FF5E8F88D878CD1DD904C3263C06114C4176",
+  "20CF144154CB9A75B3F6F9BD658BBB617DD71532F39ADE20877F3D0A3426F8F6",
+  "EBFF14B28C5B2ACACB0828FEFE77298010938EC0F8CB6CF90CC2C64E704F89F4",
+  "4023379DE4D0510EC34639D5B2C06E472055FE093D29D2AB2F05C65F8A882F77",
+  "116574A2B5D873D84C6B881A1DDBD4057BDA2991A4401EA3197EB50084CE5D63",
+  "361BB11F5EAD7727940FA606FFBBE7B9F9D8120959840B5128ABD71585F2736B",
+  "583EC76A68CF2C1A39FDEBDCCD338E824CEF66262BBB4BB7E997DA484166A426",
+  "79D5BD61AE2198329746F387FF7CCDF6B4F50ED5424A8218AE3A7A2277B9C720",
+  "2CBA6CCBF344AE31131CD0E0809A562B25003939A617FD1C514776F90149E6BA",
+  "FE28F9A7FDA9F3336F466A85E393D142FD4558BF406F709CF7D5BF9EB019AC37",
+  "20CF0050F4BD479FC038B3D85BB96674C8F6A7D81FA7BF7B59415F292B930EA0",
+  "4CB99450ED422BEC682B748AFAE81D70C25531AA1D6EF3E45C3305D9225C2D25",
+  "519ADF8104CB832F2EE6028D2501DB31784A4EBD448C80897AC4CDBA55EE17C3",
+  "75A28246D405BB891651BCE6C51464D8E7F6494C527533D17F1A84BD4D6DA0C3",
+  "962803C7707A7CFC774821A84FCEF7ED65ECA10FAEED2EE07CF1D1ECBCFC8B60",
+  "B7977E2681A230530C3D99651C5E1DA8446A05D7A376C5B0DC4E9897091BA633",
+  "DFA17E8A126145373134AB2E435D7EDC89165D0FCC290AB7D9B06BBA313EFB50",
+  "E8804ED2AB1BFAC6537E231C49AF9F78CEA28ED27B13E1A768381B0BCCFCBF15",
+  "0821350A26906C8DAFD34B0C9BF64727447E8C48B6F411DC6B762715AFAFEFF6",
+  "549FFDEB190EED24A8328A808BDEB3F3E727F38C91BCACD9B8BC659BC66A0C65",
+  "D859E9E61D05146809C996F434D22E303B69A27FF58B5A89D8FB4C490361AE7C",
+  "48251C3B3FB90A607BC8AE6B260586FCB53A9BECC1A1642840ED4A0980DF21EA",
+  "531A867C0D6F53DF410C7C590613E40A8A77FABB9B805ACAE85D8A9CBD54441C",
+  "E81D73103FF842D479E7A1EB21F04674BBB8BB1DBE639267D619139A2561D1DC",
+  "F0A92E18787795587E04286C7846C31CF5FC9B9F939767EC94DB23DCEFA2C9D9",
+  "E50A0A3EBDEE95A2510CCC2472853659D51C4E3EB646D7FCFE00DAAB68CDD728",
+  "8481739B9A912B63A2D8DEDE78A5AD25B38E8A52C41107C77A2AC69B0F72C3BA",
+  "C2A780ADD2C464136E81B5E4D6386B76CA1F22FAAC525537FBADFC845325330C",
+  "5654C88C79DE58A2B52628D350B60FA7E56C00560EAAB55FFB076E3C1CC69904",
+  "05DDEA7174E596223718D7A48BC70D0F136E0A273B5B537726C969DBDB457238",
+  "C295619FD1866F44C01FB7A6DBBDBD9C1EBDF0175F724728FAA55DA7A26812A7",
+  "5115F4C15B115747351954931D400B8412E6E90EB767ED657A313AA263565E00",
+  "F93EAE09FA7B588057621E1036788B12A581899D9A417505AFCB2A5B5D392C68",
+  "E7E5E14C91B1CEDE001757E72116ECB5444027CAC08FEB48FCFEE677C400BA7F",
+  "9F6F804137A19A795F90B0D878648FA1DFCB22397A3AAFAA159E109C395EAD82",
+  "47EADB5C378EF4C66D5220A43B4BED9487F88B8EF761F6647E57E686B9781333",
+  "10E133BCDBC770F32BD87E7948902C517426DEC8FFDABD8532F5E991E460A7F5",
+  "246FD5664AADBA0CB3A8567AE6D732280654B78816BD7A1C3D9BE8B74962A465",
+  "B47E277B364C66AA46D683C254E4ED68C34F3A9B8CFEADEE7A0674AF0DB467E8",
+  "7F9E9B0A686A28ACDCB9A8B1680DE540D6C7E4238C1D86F727BBD19A9F2CAAF6",
+  "22C21299FA271BDA4943469D2CB2C17F2DCE36C6AB8EF8E77AF0460DB7CD597B",
+  "7DFF230C5A138CFC0B0D8E9EF995DD436933F22CA996C691E7F2FBF34D28A284",
+  "9CE74E7C1536847A1A0B5493F05ACF3E04670417E6FB2C0B7127340C7F570BDB",
+  "261FA86E522002E57C683D878264EAD18C046FE52FFC477F6C0EC06257CD8AC6",
+  "2EF1F2D08BCB3421C1095C63A8162FB42B97F4CE0A83C541C62C71CB6BF2446D",
+  "F2E0B985E0645595FE265D9214126DC4D565503669CC726CC12E60E0CAB06E26",
+  "8388A7A81D0E659CD2592F85BAF0B74DD6E76E7DDA14E3AAE71AF67BCA34F653",
+  "072FA10112DC37C3A37C2737E09F2707D0B4B823CA76B633509C8273184DB618",
+  "99CBB1698252331623D5F8AF575383965E92B648CB6E8F02FFD03E035B04FB67",
+  "C011E48313E8C4018D8A51615AE622548EB52CF878634076AC06F9DB5733FC4D",
+  "BB198C553C551AD2CBF01CCA89822B9457658D86F04954590E7068CD7D608AF2",
+  "7FA1AB342EA947213F53054BEAE4D86003D853EBF64598B6548BBED25E7F2BFD",
+  "AE53F95F5ECC8B884976DA91ED41424B18219B321C4508900766D65CEC6E2FD0",
+  "D42D14B92D47CF7CC96300CDFC5D21998D3B84A539B7751D3A3FECF8CD629CF3",
+  "E5AC84E2DC77D22FC9CBB0056F9F2BDDA984CB0336FA3F7B667B1307866A85C6",
+  "0E6035FA56588FE343C5E1EBACCB458330CBF352AE2762EBB7F5DD97C30C27D7",
+  "E142B5D20E7CF8E3F09A97B455BB8786531355B7C1D61B2E9B2825BCF2972231",
+  "3A0638243F4441B10DB652227F1AF311FFE45166F1693EF07171021E2DB26195",
+  "DA8B4574F9C2ABE36458167CC4E5026B064BC39CA7E06621DB31F232FF891DA5",
+  "92D7627EB242612D4682A1AF3128A95BC8BC1C332D0A00D9505CF84AA75F21E2",
+  "97D7D38B15B356D07534FAC6E40554C1266E561C2DD931D02577F8DF9406AD35",
+  "D27C4CA5F10EF623448D939EE791AEA691118457CCAFFA8783110E9936A6E4C2",
+  "AF54589106858C7C54F7F747029E1C573FE30EC4D0AF4F9720EA4493A2C94B71",
+  "8C695EB5A041B94AF0CAD907D204E66D45C543865B85BAB6ED71CCDC51919BF7",
+  "B88E68F36392F7521946A612358E2D3353A5EEDF14053EB8CECD6933CC076A44",
+  "08C2888A362CFEC93D125065F96BD7FD8D8E808A9E5EBD2861874A373895FA4F",
+  "5C9644BCA1156ABDCB8A89A58015204CC73D858E6397B69E79BA459592883489",
+  "9C27D50236DF59A1FC384BF884E1F6C9584B0907FD9A317A510E12DF1B713D45",
+  "9B05279C5A31E3F7AD683562BE343A50401DAC9F054E26A16DFBC235990BFAA7",
+  "FCEB08CDC3D5E7104C432FCDE53E661EE5206509DF74BE5542D512A139F55FAE",
+  "626E1BBC86AC6AD0156D7209AF45A320F57F656F00590055126EA1758C55841A",
+  "319EC889C7E3092844C30DBDAE57345395C95BD30371C21293609515E8B30CD5",
+  "8FD542308FAD6B7B08740FFCF74CA6C7FAA0C1168D60FAB5A5D18FAC19EEC625",
+  "2B36C7769C5157819898E36C7197E0FE13FEA4DBE8E5E3FF827BD5475DC853EE",
+  "879B04CDAEF06AFC6086E75D3BA4B9631704AF0B3E36C2E95194DF15D7786E80",
+  "6D1F999669F94F8AA6E3CE32AFD748CB824C8197126839A55CF1A1780D2A4F14",
+  "820D54F864DD53C1C87BB96A37069E6F5B0EB3DC9AC9183A9EF4AB35DB46065F",
+  "8889583BED1511AB604B90A130EDEB1F3FC0BD0DB7792CAFBAD57E13BEF34651",
+  "31EA6D9EE187E814C2F2C178C32B7BD7F87C3AF264A8F9C5EB286138D94C2AA3",
+  "C36CE58185AB8C53FC343687EAEE3E9638118F49C293F4480DDC184802C6B015",
+  "3294B7A000CFF2864CCA62FE6001F29AE2B5FD483ECF0D2C73DCEAEBD6B34253",
+  "A63935D1930668A89236B1DAD44953F31998664C5E8DDFB7F8079164664850CF",
+  "A620FD6E469413385A7CF4470C127436DB370FE71C171050435F54526BF81D78",
+  "31B1DFB2FD68C14601A67AA1CBF8424CCC4B4FB1E114910E19016AD1FC81AC5F",
+  "28D070CD731E82CC6A0C2C5BDE95A48FF5868FDD99507901566F3EC947CAA629",
+  "22496560510E98922E26682D7D72BD99382B0B4ED9FCA50C9F0F3DB4D12846E5",
+  "183497C1BA20EE9D095421E999747C23A0C92A7D101796E4C294CA7FAB29AB6F",
+  "C13E43EF5714290129B04C592AFACC5C0B1389D6A3F36CD15ADA7CDEA02A2A9A",
+  "EBEEF130874FDFF0FC5928F0B0FEA579971B4879DD2B38BAE5FEADCFBC9684A2",
+  "C8C5F568F81BD052BFB1F44ABD62079CFEA3F29306637E7C45E06617DE68C761",
+  "3EF496F85698DCE89089487879600430956244B2FF5EA2FFE027A119A153C0B2",
+  "38180EF2AD7878C22D2F7E6AFAFD5AEF0BB9D1E18DAF7F2C5C5DC1D8A14FE8D1",
+  "FCCAE6829C79B71EF23EF41E657A87E74D8479740EFE6B0B075E81476AF8CB1D",
+  "2B7089AF07E3DEABFE1C706C64C4604D428D369CDEDC80440A51D0C8E96803E0",
+  "8070A70EAE85F4C4E09FC72231993B9AB1D6A356A3C2E122CA135A023E9070F5",
+  "521B1F05E6F141F22ACE2CF53DE12410DE3375A8E8CEE094B63EC453749CB60E",
+  "E1AE7670D4F2099D4E8F9185517A82F4E1870962DA48D059F1096F46F6C230A8",
+  "DB399AAD296124B20961B2BAB74F79AD04FE6CF86B8A1526AB51D39F19F10D39",
+  "B7FF38ED4644D37C8D2F17716BD5E30C1BF7B70AD39E10A9B1A6E2EA914AA338",
+  "35115CFFB97782E2E52A674A24E0599B47820F0ED4FB1A389E15F01F47815361",
+  "8499B9753506C19AFBDBC7F153925A8F9399E1CEDBD1A2576D5316FACCBDA3E3",
+  "58BC6E518B078668C1F4E175A124306A8DC5FB6A6D4BAB0E04A2F2268FD645B4",
+  "4A615389A74C0CE07532BFCFDA1A7D984E5A165101E9C55762841FC01A1FA49E",
+  "29F4AE47A9B488B2113B75E3350F67748F32D84D3D1C24E6EBF3F23E0CFC9FC5",
+  "1E4CFD6AF5F9E18F159D398058A6A0AD13A85603CC1632B8ED67B738AA8888BD",
+  "5EAAA21EC11DCAD8B0764EF9C907E51971A9C4EE4A6CD847EF9D223B7B28DDB0",
+  "5AC705813C9DC0B821404962400AFE4839E344AAA472E28A3ACF7934899A7A25",
+  "2B835FED4A4DD35B2BFA05D6C717DCE5C22F5B72BBFB837D28116F43073A99B1",
+  "1469C7C53ACBC069633B79A9E874DE1114B13262C59889107229C499EB94B44F",
+  "D3D7C8FEC96E3808876ABB5D731A3F1A1E2377FAC7C59F1376986346A8C51C8D",
+  "B6168F4F5E440E4BF72FFCDCF6F597EADD52630670AAC62437E19DF3BC2AB038",
+  "AE8F43DDC8FF6A007DB6F278DBCD86F0DF90E46AB411A4C0E1F26572AB402790",
+  "4174BC753483419951080F7269F97F98B54C3831CC45855F47DB7286E2A8234B",
+  "6C130D07847395FB0DD5E68271A9506C4659B06EA9601D38649E6E05E7189012",
+  "DBD22762A20948A5FFD15359861DAEDCCE5B97AEF2CA56223C5E34D44C2FB43F",
+  "47FBF65BE4858FEC9C5A219FF4DF7A1F8DC197BC975714AF79715DA11C58A00A",
+  "E5C027287ED273ED5E8A67DB7999570950C7E769A0503D9FC7154EDC86183D0E",
+  "E4EAC9E7781E3225D3C0642DDE383EEA49352342CFCFCB9E872F8318E7D9BBEE",
+  "3236BB31B0B852EFD7E4498755A30B38EBB27CF963F0A5FE43032A881E82C726",
+  "E92C9B8D1A01CF3E0C3A2D6BC5C11D974BFF2B9F5667519501DB8A1148D764BE",
+  "C4FB40AE2846519AD8E17B1F2F675E5BF616DDBE27AE97E89FEE0C5FC3AD67FA",
+  "A3B11245478CBDBAC66B79EB8CBDA863A5B7437DA1972FCE12DCCAB37FC24C68",
+  "1B6AD12B4F11250EAA23E3849C47345B9B64B321C340D7039950818EC160C66D",
+  "043BAD5B3566DD14D85DE9C1540A84C521B1BD8C19D7D28C97D94F3236B38953",
+  "2F1E95B20B32E7BC009B4BF5AFBB602CE35ED3DA1DF7DD748AB4ABCA9E6CE92D",
+  "FDE6FAE2562E0115B44467E210BD0A6B092AE14735D9CE8E915DBAA95AE2B62C",
+  "FDF308AEA1C99E19B8CDCB95E7B2E0D57639717F97A17BDC44DDC24DE9E6C8BD",
+  "12C5C312C4259D5F1BD22758DBD63F90B80D3DB0DB6CD719872B0C168CE0F5E8",
+  "F2144816768C79A1D2874CD257996B1DA018075E789469CD9171E5AE39F73671",
+  "CDCFADBA55D14E588C631441D91136661FD32BA8FF54A6F060375CF7B6ADB8EB",
+  "6ADBCE3225B585D20F1D6127A27C27A433D3829C0B15C28C5AE2D53CE8DF1E43",
+  "ADDBEEE53E0CA2422A929CFBBF61B2C7D27D998E7D6B57C5E98C8649FD1EF612",
+  "AA7530C27FDA50E8AB7B0C05E21858283FA26DE67D0346859701B5A635499468",
+  "C9244E16E2637D38F10FAAFF9CF97A25F0C9B1EE028E770D7FDED4C0F50CFAC5",
+  "A4D8642B6277C8A460660AE019444CF8E99CDA83581DFA45E8CB08B7E7E46CE5",
+  "7C71F45B3665F3217D2784CDF95292243B18632BA486829593C2B3ADD331CAC4",
+  "ECD73EA3626C8397E6FBCCB61AE4966A463982C8FB222FC4B4CF92D02A86D7EE",
+  "26FA5E375A202ED42755A52DB6863F26E526546E128C3DFAF42AC47572B167DD",
+  "AA35BD01B4496E1B3D48B56AABD6A43C18757EDCFA2740A42A1DE76CACE45A8A",
+  "39D6EC3A88A9AE1B2F53062EAEA17822A8D651B1D9886AD70ABFA0FEA4198CDA",
+  "1A03A5E93B2608D68C700500D835FEFEF4F5F40DE00AA8AF07790B540D6AB81F",
+  "0193B0242B846B91898ACCE2474FF1AC9C22CE5DBD44F0B55C62D7619B9832E6",
+  "6DE7E90FADC4415BE9D754226429D616F09AD77DB486E9FE35F3B427DF9FB605",
+  "F26494B62294CF49EEC9211AC3246B29963E3B364E20E94C7A14C171B92DDBEF",
+  "A2F3CCEFF949FF4AC7B56C0216FB923B00B31E17136EF2BEA7BA86180F0F7BB3",
+  "73F35EB269CC3384A1AAEF4A08D0AAFCFA2400BF46426F5DAE98B7C5E09FDC1A",
+  "CECD99DD967EDEDD8F049C243B7B216B4CBD56C4C96FD00A6B97890C7A308ED8",
+  "CD772C462DCAF807731D0F306F00AFDED008BFAC0BB83167FD23D7F3A521CF9B",
+  "C8B1F471390D881F9FD77058AE2E7F8E8FEC06D889C7FC6251DF1E04EAB3B971",
+  "81EC525955C7E28801617351B4A9877C3557EA81EC3F3385FF86A4128F704744",
+  "4BF37F0DEF1665EAA35489DC6A6F494083AF8D75ABFCED2A53F8EF3507CD998E",
+  "625E2FD07B45C0D7F5102171F59BF1F14D3757A428244BB47914D80788BEC874",
+  "79F0370FE81A7FC3CB1299869339AA3DE451DB18894DE871F220904C42469856",
+  "3D6C266A3C08B3032524FA6DE02946EDAE718AC5709312355013C4566CC3C20D",
+  "5FA1EDA4D8B01485E0C5118739292AAE574BBF32A5B49E3DE50A26C61E7B279E",
+  "771FEADF6A426DF1081DD62177C76DE8E4356B9EEB440B7CCD70E7678B47250B",
+  "047F734311ED4B49D46B7C86A9FEB65C747D68AB88D433459767668D3AF9D14B",
+  "F1FB5A75BE214261E35BB31054C01EE7F00E3D7027C732B78DA089CC0B975589",
+  "01679EA5FD137787ABAB81CA25E4D62B3736949756B674577604B5F74934433C",
+  "8281188784B5216DC5DD9EA82D3DDC0E9D040A1C4E95CC81C55E329305489E9D",
+  "308810FE647C83622E7A3F0C7D86C4960235A64FCA241036B9E1F6659726C4FD",
+  "7BF0B4F675C34C555BDFBB3C378073AE6D472226BCB756D00952216D8B00BF03",
+  "3F056DC1D0DFD3CF4D9671EC7AFE55C000F35558EBF941FE086B7FE4EC82EE49",
+  "37DCD594CFB0E77DCFAC71D524B1CECF79EB041BD5426E5C110E85E768C5486D",
+  "9AFA13271C218861D6748E26D848B0EB82D249A28980917641294498C231C779",
+  "A965F0185619E4830AE52F799A12D308231BD8C871D63508096B9229432266A7",
+  "F9C4A2297D699AA9A7DBF2E6289AA1EA986A3274B5E1A5474306EB7FF94775E4",
+  "29189363027D1E1886FEC760A328264F0DC966BFF11BC856B52BBE13C065FDBC",
+  "80D92651AB8E889DD91CEFD6B732CF5A0114E282D80B71B5EEC40C4ECEBA8BF9",
+  "68F696F7B383F5E557E62F721175F82CB85497B839B3AFF0A8B977D8150FC22F",
+  "D8CCD0B31A4EFF9A85F0778E62292E3D71B27A8FC4826E358B7F369C618E7B7F",
+  "AC3FA9E87E36C91A86F1F0DA89EFBDD64ED5B2EF039B39AC3303E75215C5EB43",
+  "3F1DB1A9D89052093DC1C97895616056F506CA0CF55E5404A68F83801959DE05",
+  "3DD41FAFEEE1B8A9046A52C89CD18C84535443C3906A41C2776E971521B50A63",
+  "A48F8E868E22ABDC1F933515765E81F9775EDD37F583DC86A3AC1F9B7A2CE945",
+  "F39A884018E1B1F51AA8E241557846626ACF0C1D98ECE977AFA249D60B49EBA0",
+  "AE07313A4159E082612B5314677CF9FF003B51D9AADCAB770C747CAF3CD728D3",
+  "D4DDF61EE0B3C1067DC07A03C72C2684E2B784DC4A5A398FC1B00EF2D85A49CA",
+  "5A41DFFFB4EC9BB34321766FEAE3CACDB946642389D3E5DF0AA690D5AC2B1CD9",
+  "365A40638175980DD5CE1530B14E7EB15038261F25242774DC597D347068F624",
+  "9D0690939F9C0B0549473C8D9AFFD662E640E3D0C3FC4951D69AB9924B2373AA",
+  "F4DA166383B8E55685EA09ED0E11C8D8380EDBC957373AC8BEEEAE8E3CF1CA7B",
+  "70FCA14997629BD4191C303B84C7739C94174F75EF2959EF4407D719E29076DF",
+  "136C41B8D5FFF7B4E29ACE59BD2B5B6995489E44165EEB837A4D081F41AA574B",
+  "B1C77EAF37B24A347760FF38E36BBF1B30C190373D091554BDDAE5F432095EE7",
+  "8D78409D07D0145C968707EAF290DAE60593D56DD3F85E547C10A4970F4F1D7B",
+  "428C517477233FBFC63ED648BF51EC7733DB147E6E1DC41F9889C044CBEC6C82",
+  "F50918FC76CD4830BE0719292F60CD0947DD9E25BC3C175802944517B39FD7B2",
+  "E1B20C4715D40A940A493A70AB93E8C66BEE9BC959D215671EF41FDBB727F9D6",
+  "4392F62A50FE797DA7E3E73E588423F4D049F81DC493BA2AC77B12BB31D6E099",
+  "87611DE21EBFADD6B1394C48C60949AB164E9729ED8485169CCE09DA29B20695",
+  "DFD3E571115415F203B2663DBFE50FD66AEB3200B929ADB09B7928CCC83085E9",
+  "B10A3E142CC3EAFD11E24FA2A0B96C58FE99EE7B68DFB1439AF595F88A91276A",
+  "037A8685C9B22120F547B0B1F63C103B70006816435E07E5BF1148C79BC08792",
+  "A2314D293C7ED55C303CF4002FD84D83C214E81797CB330D170B71828C115C61",
+  "E05B038567B7945F795D54FCFB64F0D36B0F3D3E415B37A42800F6D3D2D90975",
+  "BE7C59E949C54D9809BEC4CE385350B326C35DED2D2769DD21ED452505EABFE1",
+  "A87245C633DB9ADA9B4A0139757B5472872B71D63B53F1389ACE7D081AC04567",
+  "740A8B221E9E57D523B286E4BB579C002877096DB3C176F8B53C06F6D731770F",
+  "88EEFCE8FCCF113A40C4586C4B052F4C44D7ADBD6A1910BECAA381A856CEE27F",
+  "423FAFB46B10E744447ABE151962E2D2C2359F618B5665CA8BEB1FCBC67D830C",
+  "8F25972DD5F2EF18FF74C0FCD9137E80999917DBE39E21B90E3A20AE8EEDCFCA",
+  "E36076DCA5859D6EE109EF80BB60D33A3DD980ABFEED368F69D059481DA541F0",
+  "EB1242FA1038A253ADAC891A55BC571C3EFE7AA2AD094E291C525188FFAAA9FD",
+  "5FE3DBB141F0B319FCF2F926B69CE91316B25AA9BFBB7380ED8169F9111EFB1F",
+  "FA28055D233F73AB59A4BD45A73FB857205693560A3CA8AB7F666A4D23297C98",
+  "29D40FF7DCA66B12BFA238B8FFE32ECB43A6BC06C06BCD1E10B38E7978BA17A1",
+  "47A40FB4A7EBA3D501DAF8D836F20072B054F950AE08A3CBC1D05201932C42CC",
+  "DA6667F03FE0601AB86F8168F56FAA6CEC25FA295A2EB11B0C45F4E38FDF776C",
+  "C4F974292D595591AA6C6A50F310EECCDA587B009F91CC24F51339BA8F439B65",
+  "5B19EC36A20F269E6ED4444BF5054E8641503EE5C284F84A3E8599B23A586CCA",
+  "C754D16E548128AE5F26638B15EBC298A21D2660610AD019A4C8128D0D892973",
+  "10472FF128DBFCEE58272674C5BD931B4CB0F829640D0F06E4410E1637BA7CE0",
+  "BE8BC3B5250126DB07A103BC61008A3DEB3B191873BB530B68948A95288E2EF6",
+  "4898F695F43CE00A36F2A7CCFB2351CD75ECDAF4B763CA19ECF4A4AA7C2922A6",
+  "24A0EB226009A2D11F796AA20AD1CB14AAA3086D92EBD23772B925F4CCF5C469",
+  "9D5E956E6829F9D78D71C22C243542B92305741A28E162BB727D44F91A96091F",
+  "1FF5DE7AF5944E30A45B357DCF3B9B8E706A06C6D840E3F8585E424EBEED0077",
+  "4E842139C97B31726F3D7AE9C9AA598FC165FE43E24E59193510012279DA1848",
+  "4CFB181785F84E3CE83F2B771E17A5FA40463EAC146E329678337992349523C7",
+  "7FB4233C379FE4208015C3EBA66161EBAC959AD3ECFE6A3796B0C4058ED06C31",
+  "CF539D40C1D585DAA390F234913ED4935B00BA80407CCACE6DBCC43F245327E8",
+  "C8B906FB6D295AD1CB06D052AB7D1C454B80C9291BA9189895F51EDEA71435B1",
+  "FBFE929C64334E0F0C7CF067E0CD39DAA6581DF9A778FCBDF6D02121B41F6DB8",
+  "0F857DC92DF281B3F6E63472D3F5AFC01507ED5FA3D0EE86FA6D7FF249A87521",
+  "536949A369F3A121479956B928569533E7FF3223CDB9C856A2FBFA8EE475E15F",
+  "7E40417513E1023AA002F8126C15F2139476808BB352010E0315B9F3100B0C7D",
+  "5477B261BF0705163B7ECD290868D8CECE27EBBA6C953E749B229FF04D0F114B",
+  "4163B0B5B7313388610942C378EF6220E8FB4484C3738F8E96C479D3B91DBD80",
+  "4D817D20217D76B7E56DC1D438A621989F89ED9F677FC846DA074BFB4649416E",
+  "77C5D76140B1FE69ECFC98B14B171C90724839CBAFC723C3F48BBC4ED201BA4A",
+  "CBE5C72720CB452CE17CB8F7D717BF66DABE39FA862406A5140E34046A2DD629",
+  "89A7920E46C741E4D1BE1CB4ECAE10BB10A51813AB39C7E93CC856F35B9F6BEF",
+  "EAF4CECA8D96FAC95984BF58C9DC4084606C62836D2B471A3DE332807F94D157",
+  "98616C820F39A75C9F035B071F595E458EFEC8D1E6B96CF25B4D45EBDB7E6D4E",
+  "434DBEECFB0BEB25EBA367F3C257CB8079FC22634A802893974D8561D43CF0AF",
+  "2A53ED27066D529DFC1C5429A3B1194C7F408242AB331FBD2B67AC7DE7255E8C",
+  "0190455EAA8F585785E203B6331A525C7C8BA2BDE521843D94265DE24E03D324",
+  "9FADB2552FDC0591A2D3301851DC39EC5A639FFFE40E88522D8B8F53B5A3F122",
+  "4FF9245D317A8E6B9D2F294A0A1EABD74748A40BD4510309B76B61BA87653ED5",
+  "CAF3AB39CA0FFFAD4514D3250F901537AD3FD4470527E89DE2C0DD5CBE87629C",
+  "BDC14534852BBEE2A84A4970240D9127364B9DFAEBB6A1FD6ED748D0BA7D65D7",
+  "E7F56F645C1B1160CAA5DFCE88B419DC413E56BB3D484CA9411F78F54D9BBFC6",
+  "7D12FB32478FB587B31FAF1448577392F74ACD6F9C695F168A7BC035B5CE6483",
+  "35BE27FEB5F340923A690B337376BF55F521EE39451006C70DC102EE085CC596",
+  "C39931AA35ECFDD4CFFE51F676D0E7842A3D7C2A1BE3B1DF3BB1144B7F87A39B",
+  "1ABF9E8E8F8E2B5BBF96938570C69DB4E6BF0C0AACFE7BF49A648192DE85445E",
+  "D40FDA5D3D8523F4B480A1B617D0FB43353A08B0570FAAA2413491AA4860B042",
+  "3E93ADD02401FA3F718B65DB4B2E7B185FFCEE9F93FE10D29B4B0DC37DE32336",
+  "43820AAB33DC83934157FF21D1D819628AC35ADAEB045CAB909144C3E1DACE51",
+  "ECFEBB64D4DA290CE90C3E5809E5D5ED8802216BF293EAE3E554F3B044841B85",
+  "1B99D3AE3B39B1F91591FBE6400BA453071DF09461FCF8849B4F80AC495B7A9B",
+  "87AED5721706C004B7A10113CFE6CF58C654D36353903C618CDE4E8C8DF1688E",
+  "D40B5BFF271A8AFD93F8C7EBFBCF30C35C8971D954D1C2CD36436FB0388F6169",
+  "C7B9F48107750DCA8E36F24F5611A0BB102D9AEA44461E01D61C863E97ECBE1C",
+  "34EA56596465133EC9680807858F1EF892DE6BA12A51167CC14560F050E4905F",
+  "49C7E1AC424251E445628AF2F4B1DAA44D565F6CFFA58B98547CB6E8196F64E2",
+  "CA768A2C511B8171BA08177D1A7BA0A248C9DB63D389E70D462349ED80A9D168",
+  "5E692C3D19FD492E56E9E6F4B7D10E682E7D5904C6D086A206D2166A08A6838A",
+  "93AFD3D8BFF3FD738A32C88697617F5289403685B419A825C998E1709A4ABD15",
+  "3C4EC9504FD9C35A55585BFE15C065CCBF5DF135F41688E8A3A5F9BC47FB0044",
+  "243E39700214D4CE051B98FE7FC0B2DD6F2DFDE63659CE1A642FF2B0DE4FA64B",
+  "C176ACC62BF8DFA089D69A8D1E0C764F1A15336C619C1AA8E4BCEB2242CC3E3F",
+  "2439FDAEC2FBCAA279101FAAAED71A9294DEED98B5ADD8D593400D8A0B2C08CA",
+  "56AA7736558154327760CDEFBF24B6F92C42DD5B5A3DB92218039956E6907563",
+  "7897BC5DA8818E3D19C9F0D1467C8BABAF7ADD2B10961950C53EEFD4337DB66E",
+  "CA2967DCA946643AC95C4CDF1094B69B7298E2924F1CB907303217A0094F8200",
+  "4B85A42E6E3F0B69714367F328AFD9036E91870F817F7DEF4CE4C8B3E1AF9666",
+  "FA1F563073D6049399CACA9E6FAD5C7B6AF539F39C393B3F1FDADB7AE9836625",
+  "23C013A337F80B7F5E90F90692526B1984E67E5A255C1763D7E0FC411A43FA0A",
+  "BFF26507B890D67D847B2FD9C7AE0E52D20F4C832C5B440C17364B1D6A26836A",
+  "746990D571F44430283B03332E745EE8216DC39AD9CBB15B3A05CD63A609CED1",
+  "6D74E0024CD6DFC1FCFC7B3704DD2AE60B1573B747D0177D401959814AFE5E7F",
+  "FC3280E6B9E04783934333561711559E7411F8546D18118C1A1991AB11DEB923",
+  "194F28EDA4FE1810049526AEE798AD6FD58604E902F037320BC51D7D81514B70",
+  "F7513837EAB6C63636FF31F87065CCA2F01A49196D5C455004A1558CCD212B61",
+  "BCE6802B7BE348008F4CF2774CF498A06C8A9A574127721606300A896B0B7DF1",
+  "1FC662F4EA438A76785BA349EB59324C922E6CE25D4C2F81433E778BE549DD62",
+  "72E7FD3E17C343B6D9D608A86C1F3418BA774FA4E6B25785878C184D920D66BB",
+  "3264FD56D1E75ECD9B26DF5539D01600FB00D0384828757588C530759A4113DA",
+  "6E321D869402B2D120E74D7FC68D5F165725B21B8F55E3193DD12AD61B4327F8",
+  "37A05A21684EFEC85E5891CCA3D69B4FDCC7BC3EC1E6C89110C01FF4198FE06B",
+  "9806540C6F9C0C00944DC2EDCDBB4B7C49C72F5417CFD4883535EB591E7C460E",
+  "833CAC46234F19369188A893CF46874331B1ED9FB68E85ACD9F40437DA5B2CA2",
+  "04CF62B1F6509E40948D7275E9BB85DB9B60E707E4EF15E8378F5628B7840A37",
+  "D8E17A2CE6FA60EAF5A75EC56A3076ABF87EF13A15E409A743F8191A4E88EBD5",
+  "DEFE0C5338EF56C6AE7E05E11C9C455C9CB99F90A546427D773B726CFA96BC4B",
+  "B8E89B8C43DF65F5928D943B4AB6C8D747011EF3FDE60EE5FCEF2361DB278B86",
+  "2A8BDBE6850EB412C505226777067C507B454EB3C2B2A37FE5C9516B18C7EBAA",
+  "87FF687A91124043659B998B6D8AD42994281D8047DBBA4E44C2DB49D1982335",
+  "AB6BC6A2C4E07BE93221EFDBDA31BEBE5CED23EF04A5E4688164C1190C64AD31",
+  "E914C23B410007A882CA150A3207006F7D9D77C03550C5BEA87288A3A0A17085",
+  "50DEDCFBC0439E6329C7E3EBC0B27A495AC4D388E867C94DE96D6A59279E6955",
+  "E98DA0563D5C1ACCD13B89C0297E8C50BF4E9096FFECEEB58FBAAA5F5A5EAE1F",
+  "93025BD5906CA5C49004975D03FFA63C5712550F09DFC9599FDECD7290FF0521",
+  "03ECD025126151D78F1F1A0782132D7F2D33030BE57660BC76BC664FF507BFC3",
+  "9F3DD62F7DBC8DFAD4E0ACEB773512BD60114F8140AB7946FB1AFC0212A9B929",
+  "29869723F60DFE9B88D541B8012C1A413D4A70C8A8981F80F1A99B1FA479E810",
+  "3914D64E2C38301E877BE1D8EE25E20D1CEE86EB37BFA397E4C8CA722E3C22B4",
+  "E9AC99124F5B99858151D6F3CAFC1CA64CCED8BAE52B4BCD7A6C7C9E99CBE728",
+  "258689969131138BC54D5599CDF0B43F4E5CC46D33DC2BC42BFC7650C518306C",
+  "6D2783EEECF09FF32051B2E0F0A14F9AB37EF5C1E19D0A75F4BB1808DE8FBA2B",
+  "AAB7F2BA1A693B8660303C160D6158E7CD32872310B25281CE174E47FED37DD6",
+  "4D157EC6D48687069791D29EDF08081CB1EBE4241FEEC60917AC6CC4B42BB426",
+  "A78FA07EE5EADF8BFA417E60D6188EB0501A0C4AFCB682092A9C2BBA74E421E8",
+  "06F34CFD389141A33012496FEFBD91E9F2C368901C50CE7583A984EDBDE30311",
+  "BCC9AB871D83B137610BA8C6585DE2DA96C4ADD8ED826D1DEF458942A61E45F1",
+  "E7C68F0BD0E3FCA938BD629A36C5064CB9262AD1044F05F1B453D7341768303D",
+  "B95112C6125D20A56211320FA86A8CCFD3077853DC38EEA3F1B663F3F9C5AAB3",
+  "D2558C261B60DE35D2A3EF11D521645D7C912A5F415BD1A603AFF97DE23DECAB",
+  "909C9F3D690B9B29A555EB1AEC6049B1E49D650EA3A54BBE19B7045BB647AE34",
+  "1575AD38FB00019E75B0C21550F54904C43586CC31B4AA07690FEA7EBFE4E796",
+  "EA7954835A26C5F71716783B72B6FB293E9D4BD76C049475A1766F5F3CF166A7",
+  "A77BBE6A387DF985243FAF5D2774120A4090632DF7AFC83D0995B4E44E1440FA",
+  "037BF073D2F0995EB4050B6C107503EB8676F22186951DA2C7C1931589B30DBF",
+  "BF36E92FDDE1CAFEBB4C81CA49D61ACD07270264266A627F4883DD46673917DD",
+  "245F511B6C16225951A01F40DA875F51D2A93E3DEEE5F353B8AA84EBD7137FB4",
+  "00E3FCC564A1A33C46CED009E1D99500F63E211459F075D204C8E880D47F7968",
+  "48D19E3E5442FC6BF77AB5D99EF63AE2DD65ACFCB0ABCB571491FB88A99B74EB",
+  "3504D2D43EA6BD8C54BA4E4407F6855198E5BE94125913F0F3E5C91A49810EBA",
+  "F58C3DC3068145FDFB008D610F42D829758AF4C22D650FCCB831D59858C2FAE9",
+  "4FEDF552C5A338F7CF31F4F62B9C1314F0219C3943E9B06BE0179771CA277843",
+  "9331C6584521E76DC07DEC84770F085F9138D24DCCDD1A5569B622408458B39A",
+  "D0E4D6388148702CCD738DDAEF3B57A8A3A083ED8F9F7A5963C4F4CD98AFC810",
+  "1CB0FD36D323AF9DE1C4B5451F8C9CFE0D9EC07CF8DB46F94F746FF9E81E7BE5",
+  "B4C8C1A0E9A7339C5BDB109417C4758846E1B45E4623FD174C41FF4C55187FC7",
+  "BD72AADB2D6F09AF5E1ED4870CA4B1A63FB356D9538FB793E9165C83CD3BDC77",
+  "D69F9A825DFC468FCABB60611C557E75D3AC982FF4A5287B934BB340BC078FE3",
+  "9E1037DB9853AB61B8BA47B8BC7FF6A1E49051BE68B81F5846BBC93A17050B72",
+  "A51426F6CE6702AD8E1DCF40417FAB4998A6BA76077DA9B7D8A1A535759F730B",
+  "EDEFC48FAEFDC4884088E870BED70E16ED6EC990E281A6D28852C00EAD0EE24E",
+  "BFD86EC57CE31D280F1D7182781B5B9BBA9260C406739AC35841737F4AFDD957",
+  "125B3F388E4905D82667321D7A570E9C9C34A752E371014FB99C7DBDBB0A1E9B",
+  "D0612DDD5DD82FC0105F5920CEC63FA702D76B871FE09AF702D8846E8D868356",
+  "C102ABDFE057763E5BBE00B0269FEA43EF3DF314AAE6FDF2D19A989EC781FF5F",
+  "1188E9E8D5E6CC82E739118ED375A037DF6ED9616C40D9B9C3FAC0190C266C32",
+  "31D0E155518994ED71F4338968A02F4374E9770ACC18A2D1E55C6E5FAB54A416",
+  "61D853B214F647D051A98E77567C9C92520887858BDAFB9D24CABC09C04D5BD1",
+  "8C96B5313BA02687D1AE449E3AA4157F6AC2410C471D5C580AB05EDA66431400",
+  "E468107A2931678F91D34979D84068EF9EB06DB33400F94FDE5E96988363884B",
+  "596D6E82D6AFB2E57DDC1BE49D7A96922A54885B065B1960F50ED300AFC820FE",
+  "57249B04EF07B0BB5E67687A0C0E8446C7028F41D44165600908E0C6507675D3",
+  "3E0D4B8386FD119E7861D57B4E82EE260A076F4306FF61499773A3892F3537CF",
+  "CD12AEBFEB5F94B5A2A74F052A65222EC207D9A8E4ECFF58F2AF2276C35B5335",
+  "F5FD76E3E7B2F4E7F598FCB9992BF1D89D716F8495D11F9848C461971A3D6147",
+  "10096AF925F23F8ED827DDD8CAEE02FC944991567045FA5D482E682EB73D3E72",
+  "306A34EE133E5D0BF83D049D5D318A0EDC1743291FBD0A988F95E34A75C6770C",
+  "66C4532777D98187FE0E2BE0AF81063ABDA74975239C624E5D875607DA63B844",
+  "7ADCF46CA88E54ED2338A685A4C612B7273D8123B59AF31FBD01F202576090BD",
+  "169C8FB6CBB50D6B3675B65A0C9F0DB8C0E76E8532E0FCA82AE4A49D80236F66",
+  "EE4E34DBFC0A2B17B695962FC2F069FA3189C8091BF0FE5E39BC48F1300CB2BB",
+  "974F7AFD3E9F10B28F6CF96F16A7568D4E5FCDFDDDA56222F9589527A3515E9F",
+  "147C9F43E0A003F259599AD34BD26A2929806E8AC43908BD7C2BF7CA3FAAE3B8",
+  "F5222026B12BDD49BE3321A87FF52E47B9AA55274FF7F1297C40FCA1244F79A8",
+  "80A1DD900A00C27C82514674F7BFCB460ACA092C1EF4E6379E981FD1C07ACFD7",
+  "ACDD88C22CEB9613BCA7BD68C3926BC68A814B13538BE93F9A5241248425BC45",
+  "46652CEE92052410B442EEE7EADCBF2EAFBD7B618929581B085B19638E8BC83F",
+  "7AB269F25AEAAFC1BCF393C520E720E783906E41A39D83DFA35B9A5530F1A8AB",
+  "C33CA5C9FF2472DD4A2C6E9BD965FE5EC4F39658D251C05C02721D20E3390D72",
+  "CF872E07C8CAA9DA5CA4A62E596697435965C9339219FEDAC3CB131AF6473213",
+  "3F987B3A7F154BED7D7BB1B1B37AC3A66E05DB62211CDF137B54E8E624FE0307",
+  "334263A71F9CE0D9125432F6321E8F235E8BFA861FFB2E3A24CA644E917EECBA",
+  "DCAE8BE743E6B57513644AD100620C68208DF49A1509AEAFFE2BDEE5D2E56A9A",
+  "7AF6DB0F3799853520FFD50978EED7D70427DF345B14712B4F2EE17DD58BEB5B",
+  "B6782CD7B0D309DF5C9FB99A360A66CD78D186CCD3D83FFD74AB324683DA5B76",
+  "6BFB10A4FF648D74D10655481F41ED9E0DF97C1722916B33A17035ECE9B448CC",
+  "BA9B060A4C9783371D06A69D5004046E94E1B1716D1D41A454B3CC23AAE927B1",
+  "BF897551047587E673C7C7CF1BD0FBAFEFCB3C524B22BAB991CC88350C87F33F",
+  "04E417F4F26F95049B32C64BA64B45AC5909886CEF7900C3E38BE0A1B1C8886D",
+  "0EC204FF2AD377CA0ADFD4B7F2A16F9CE30DFA4BDFE6A191C8CD1824D75E23AE",
+  "32C5F0DE53B14864B2FBAC7643A1B647F76DBC3C5467754A5F9E4AE0080C5500",
+  "72881A4312FA5079B1AB99103D15E1952989E1E715EA4070C7A0408D310905DB",
+  "5A526721F0000EE8F34C8E125BD7E92C6EED40679617DB707ACCA0290F9B1F46",
+  "ED619252894CC649D7ABE33B822A8EB837405E9A608EEF5415278E81E604CDF8",
+  "8F55FF0AB686FAA44A381391B1CC85FD8ADFA477F1B5D8FC28F453F6B4AD94DA",
+  "2E22E61FAC1E83FBE11F44467D33A06A9B59E53F3EE0B5B0257E96749F6ECC17",
+  "A5111371B0F9BD9E63A83906A6F0AFC87D5401B11158F58B0A20B0467EBCBB77",
+  "776AFF8DFBA64854AE10070D8E1288BA359BBA12D83CB54AA0C7A2D94DDA8FD0",
+  "E2AA18232595D813C74318DD5FC01B6F1F661D4A75D2906EE39147A9FAD56A8C",
+  "C32792BFA2A58FDC237268F9501CB954FC2F62083CBDD034016D4514215EF29E",
+  "FEB8392DA5770360BBA7D46A3FE65009A840E5D4581955FC56F7C2567CC0DEDB",
+  "1C16199B7113C367D95D5A7EA71E9E5D0017F46162B866DC74C1E8C4229BDB4F",
+  "905EC29617BA86819E0E0AFB523BF8F6153E998539007504AE5E5F9D7CC1B46F",
+  "2DC8575DB8208AE98882F8B92CA819286F4AB37E15B7700E787CF530766FB823",
+  "754420B2CDE710319F5328018E292889B644F3B3831E21E4566C6D0895331B21",
+  "C5AE12EBA7ABB8B3697B93015F29CFFC84430131EB00F552E5662DB3519423D0",
+  "3B7AFDD893C42065A981F15C30223C76FA024D0D0E4DE03C5C693131B2E52E39",
+  "AEEDF839FC57830B00581A4B03619C0036906CDE6FC4A72AEECC48C2EE8FC3A1",
+  "7F9F5510BD4D3C316D3A78B63B3DF63772EED827766493A34E5E216170AC4E46",
+  "4E853BE0FB2CF503EA31BAF57D115F6FF50DBB81132E46488BC829EBF7603E5E",
+  "E24F19780F878568FBD9B120220E0B30414645074B9556A23CA16BFB59D2C22A",
+  "913FC5BF40F5EECFDA7CA20B1C3CC1764F282FA79C42444910A3E558523EF9B6",
+  "91444D6732FBE89118C319B353FC8C69511533AB1D1A09795A43B043939A735C",
+  "FB0A9CB6AF40F300212C7C465C82C1320D27D25D4B662486D611A782CA2D03F5",
+  "1D52D5F8A3DFC831863F5D9655C42B55C0C4A29EBC57F33B97FD0A16A65306EA",
+  "1A26DCA590D4F457A9D7986F7EDAE646268A5EE71DE8B29D6F9A15FDF0A6A24D",
+  "59630E178E13A54C605A20785F4FE11FD2DD537312905B2A706847E849D101C6",
+  "576AC39561606C02D8FEDA58950FBD89AEDFD2A95BA5B76EF6671EEA18712DE2",
+  "D0C5CD2878D421461A875A335269596F268705B6BD3D8A8C96E6A20FC770DAF0",
+  "5D3D12183379BD5EFB358947E56D1E7964698D3BFB0CFC7B8F22A7022C9CECDF",
+  "2EFB6782FA4326A0AAA3F3F54DE8D14B5E540BBD896AB62BB69D041AD7A88B71",
+  "A30E1131A7F8111C7319F69CB8372F5E7CE4589C7ECFD8BC5CC94F8A79F20528",
+  "279EF22A5BBBA9E5AFE7C80034F1A78324CB2A87A37D55E970D868690F26BED4",
+  "60A3ECD5459527000C07245D3845A2831062559B6279F027957F72C587A8C6A5",
+  "419721F6799D5D53FEB1BD851035956CD92E633247C634A8E03A98F825A66BA2",
+  "D4EEB3BFA46085A144A0809161D277F68C5480B5BD2F6213E2C65D57612850BA",
+  "CD60C91AAA4501D8471F0DCB650644DD1DF6A01CA6F89BA6FAA9F2463639EBF4",
+  "9C22924FDC0620C46DD38E395E40F0EC6B86287E6CF765E07184EF631F36C829",
+  "A6C96A5D87FEE9AA753459D76FE1AB592185391EB9469519D39DF4EDD2AEF316",
+  "54FEED55A730396EAD781F4BDBE36993C1F20BE34D62E5FDAEA62AC8EC1758DF",
+  "D4A1FE288384D382DC2636C5FBD2E89FE16D62DF6C01799BC443271C3376C306",
+  "E55E0BFA8225E192B199246D4BE88F2BE78F6E32E13B5C884FFD9277D925F867",
+  "DAAD61973072E8C0D36E1780615E830C5B1D423EAAAF2BADC4074A277D926BB5",
+  "B6ACF017C38431282B88FFBB17FD492A155B37EA9ECBB350AF5F13450BF32E79",
+  "0E638743D160B2D13EC737DA0D3361B37532B9871D27FEF021E8AAB41A929EBD",
+  "65F003741834C53F5B3AF339579A8408E75D0CE1EB8D415A3B40F515918D15CB",
+  "21B488DD7E5EF901CCF4D44A0168E4864CF009D88DFFBD890E8896F7B8E0E698",
+  "10596DE3A8D8851429AE3F03246B81E7C3CD8E220D902E877A8761FAF75013C2",
+  "1F2823E55C1377946B99D813EDEBD8C9ADD16F04469F4053AFADA0103E683845",
+  "4C2FBC052F659499D3932FFA647A8BD22162DFD1795E5989D82EDC02BF427BF7",
+  "53819CBA3EA0CF5D18EBFB4BEF60ABEA9E51FB50147E039EB02E3DA02A54F742",
+  "90576BEEB9249B76981F597BFCE66B5E71F93F1D8272E0613CC2AB0E1D11D529",
+  "94D93FFA7BFF4F15361FD967B4A2DEDB03ABA29DEBDDE098D0F6DE37ED4BD14C",
+  "4DD14D0406D6E2E047BEA11CC5143450444758276415FDC2A2F67CBCAD7727EE",
+  "DE05FF8DF4884F2F76907E93C3D3E809BCCE7D9E599689C296F9BD4D15F18579",
+  "EB60C8BAD012B526B089EF729FE29D75BB31F3FE8B80DF579DBBA458A816FA81",
+  "6D2F8E0B5B226CD5A164E82C0DD53A43AE7441EB9C499D5DEFE535E8CB511953",
+  "02B0C21D687F1F4AA538341182C76570FF22C1E1334031817964246A7DAF6DAE",
+  "72C416DDA3ED16F1F57B8B97221E2FF63D0791DDA7AD9CE187F8EF7139F02CDF",
+  "A7E8FC46032052C63BB13E069BF77EDA4F0F7EE3FBC4FFFB8C54755C3F689BFD",
+  "8F18CBF585960CA7D7F32B478BC87B29C9CEE139C1D5CE49356C5FD4149B42FD",
+  "5ADF98F29469AB814DDA3B08169B9053D60E8B619798D006E7A43F220284D21F",
+  "F7EE81409D2918B87D8158F45986DD8F3FD923DBF4A3F7E4D59FA0A8305B6614",
+  "2078EABC47903076BD842386EDCFE184FC1FACF20A93CFC2C0E1DA403FE3FD18",
+  "F8B0D330B1D45F5023D28F9512E8A4265777AB037DACFB7B2A17004DFACE2E8E",
+  "8A26A6D371D85096ED9F4A7C8E78AB530BCC471704D6922668A172F4443B0D0C",
+  "F3726DB902FC79A560BCE1CA62A9FFA785290A242354287B4AC6719FDB935BB5",
+  "80AE6BCD6AAF60051507A8E66EEAF3E3EB5375AC7D2666E628F7FF0B61CE4104",
+  "7950EB6DE492BEEA62C8DAA2D8BC909EA1C17293EA97AE0C1D76499AC98D29F5",
+  "31D124C4F11A6A089DA54B589533DE644012A68D810746F4E47CBE0EA2B07802",
+  "BB691380CDD312622EC45082A0732012FBE17EC0BE051FF3751440F20C0E9701",
+  "82FA3992A0889134BDC3141ABDB70C1B98C660E3CC0220F3382B53CE312BB4B7",
+  "E42CC2B1CD5D63430D7E759929FCCD52D6013702608019B7416CADB6DD91787C",
+  "8217C87DC1ED176D6A9680229E955E455500E22E7CDBC4EC28A0DC2A64F55266",
+  "8178051C2353925737F0DC33BC092BEBF2B7E4A87FB71E94F1BBE013D563C851",
+  "EFE9B1E114EB2F4B93D6685AA3B4D8A8E5531085D2D3B67D8569B7E1FD615618",
+  "F7F4D3E5B8A736C07F281C943D68BBB9E3FF29AF5434AD459DF9D12C262FE020",
+  "FAEB0C5244D675D7F4B2D5FB7E08B73E9ADA82C2C91DF53712E800872F056D81",
+  "938488E33C07CB2AD827853C62F49A10E4ABD1E180DE615E02A23FDC5737696D",
+  "A240217A9CADD2179DC76976BAF2654B8D6706F2D808BA06925E404152DA7574",
+  "45F4106F5AFA1F42E38059580C880C5615A877840FB7BE06F540F99F19343595",
+  "3284A74187D4AE0B35DBD1339E434FCB6828D58C9EF3163FEF70C438B048C64F",
+  "7115E011497F7DDECF6FAA67F217FE62B311690BE2AB18CDA5BCB6EA1EF979E7",
+  "F7A106DAD044F3BAD40F02793906CAC9A2E6FE00357E69C71F1217C894711F46",
+  "67A45C8BE77BC963394528ED5CA3AF0D9615E42396D96CED2B29046632B751BC",
+  "2278E50E089599C1565D08BAA02FA160802BC5DC29C00B3218903329D6F89DA6",
+  "5482D6B8965DB3CC08B164F0AEDE0D37955D0D11DF28B12F849662D5C411F5CF",
+  "88A999F0C07F5AEB703C2BB24A8B08C3D94142040EFA80A4769CD13820B7C22A",
+  "1990CCF4AC17279393EA03E7CC418ADB8E91176E5B8AEEB0C24EDDC88E49BBC0",
+  "49CAE728BABB7DF5985BA3C0EAFEAA3B704C8C4428C7320479FF7CB85C74607A",
+  "FA88DFED5F6BFEBCE1F727AF79DA536AB4DB3665461856FFE7F71D47BEC0CC37",
+  "A3B10D5A25859939A77295C3B6E1B775864ACB483BF5D33A3CE2A09FA9875C15",
+  "A7E5F25505F2B3D85AFA79CE808C2032FA20C40E38F89086FE6AD2BC93C6C889",
+  "3A3B2B33F494C51F6A58B865BCBA681D77A1D3CE23E1CF7232BD28B360EDD5C3",
+  "281BBBE708B6F01CC7DCA64CB62EE2461226F90A821F379604180DE044AA8A18",
+  "08333026603ADB53314B6069D6BF9D4F74678DAC193ADCF8B1EC9533C20D8157",
+  "45BCAC7D6E8E5FF74FBCE441A5D7429EFA906D7EBE9672C86E088C54E0640CEF",
+  "4BDD233FF05EFBD0DEF14FDFC12E3557D990D6F5364DA2DB7E7DBA26E1BEB398",
+  "11D7C7DD8A01E4880328C10BEDC05B1F09B11CB9101736FEB2037BF2DDE58083",
+  "5C12141EE970D44DEBE22CCC4D9AA9C1E683A37EE068AA887AA96DEB5CC722A3",
+  "7A1AE48432B74F1E74F16C0768286450AA1F2200591A1566C6DA8842F8F19259",
+  "CB391A7C42EAA35A04BC9577D1E9AD54501F34EECAE2C082E0A5638CC95FCCDD",
+  "CED379DD0ADF3E8F87E35BDE1DC8BD0AB32D3A2DB887AA7399301EED40667B0A",
+  "67B3E247705F4102681D2B976C2FB85EDBC688B1B08E9D96DCD4E178A22D087D",
+  "229369A0C6979955924F59FC3BA55C14A009C641E26AD8744728B4C3F56662EC",
+  "EE68F0EF87F475485E936A6C9BDC8FDECB86E2CA628E10C83FF34DAA06054F97",
+  "89CAD69F3C4E5A43C2406CB711144D6C2267D86AF4DBBA5BCD69CBB5AA90B089",
+  "7E090A70525BACA34750251E28C20B651F46D982652C68E58066F1053262DABC",
+  "5356EC8222637E22D1AA745572A7E4A5629A44293376F733748026B481D44D32",
+  "41D112D0AE298F3540BADE9A6CDABA246E73CA2AC62B2FE1D1406227118F0B0A",
+  "985FB373F0E9DE6A9CC873A8677518622352190421F2B5C9A24377EAB5F8208D",
+  "F653691027360853B66E79DAF3FF6AEF1E3D6EE243BCAF88ECB8C0BA575943EC",
+  "7D05E043E3D9C90C033A915904AD1DF3D11834C3007A06177793A89FCCF58DCA",
+  "DB05C1AC612BC74C27B77EA3878AB10F3EAF73C6F241FC218A7D269BD935E978",
+  "796C3B47602363DF0CB0345B713A7BD987C51EA552929F6979C1A6C63C0BB36A",
+  "9C23AF5B3DC454748C787AF9BDA47AE7B1B91CD99E872D9B5D1AFA47CCA7F06B",
+  "E4635BC90411527F0F14681E38A251806A0F9E0814FC267C344EF3901FCDEF63",
+  "617B323A1622A817C8C0BE67D62DAE0447959917ABA541A41790C171F281C977",
+  "70043FF477965E08EF234F99FFB93185F55845C44F816A5A1AFA2884CA031EC2",
+  "7759B215A9EF32CD1295974CA0437073C597EC36770172E5BDDCBAE2E0FC074E",
+  "8A96051BFC0EB9406E2B1E01C0395D8C5A1C166136410BAE7EADF5D5D79BFC9B",
+  "3141C8580D26169D561A09EDC3491E2D0CD8D1D08CF26086D5879FB2A1C7CB64",
+  "84BD9D64DDBC8CC9D937EEA0906A6D8735D2EE42B05933A2A21393BBD5AD0D19",
+  "828FA8F458DDBE89C53A226B5EC20E287AB337DAB37E3D1BF92E2F3C69DAF405",
+  "3D1561B65DAD02331D65B65AABF79B320ACDA1BB14C2740987B69272B6EB01B4",
+  "779BD3F2C63DF63719C73FEAEFAB57B56C8CD3F8007978B788E9193C8C58A981",
+  "EA9ECA42F786F29CDD844E49BBB328025397E00FD530677B5D51524ED2400C86",
+  "33F7E76A2F158A8D69F28073DB9343E90010BE6871E90A9326CB2A18278B06AE",
+  "4EB1A8A16C59AD33A9BEF2AD9EBDCB7A55B671373BF4D4305CA105C81DD9E133",
+  "CCACD57DF0DE6636778A94DB29E5AA943592CE7AABF34FB38018E19B7D77D4A1",
+  "52592852F954D96384206E32733B4A177B4C2071C5094D5547893EF64A6572EB",
+  "AA657D2AB5AAB9AA14E636C777FA04511E40D513AD6539AB06F889491A7CB81B",
+  "3AB7D1B3E5BD3285ACD3C251C46088992A0C39EC244AA53C5B16B5C5BDA0302B",
+  "EE9908466DAB9D48627665B0E7D6358978B7A1E7EE74D657AD3ACB2D5B704856",
+  "6C5D86842AE47BCA25660CC25C9AFA5F23843EF3E503E7EB5B6D6BC0A1170671",
+  "3B2AA293A7A59E890C88B8A978DE27A9A0FBCDD0BCD513DFBFC2AF0CE9249B7D",
+  "FE2CD070847DDD82E34728B0F81F9803875A70AEE46624EF8F26A8ED0A210245",
+  "2B21A2C5E73CCE18A2EBF39F649CA048D37DC1B6B45E30F3B0296F5AF8BDB7D4",
+  "9EB1518D15909F86CC81D47B39DFB7B43653362383F4EB1668A5912D04B85AB5",
+  "08FD72A0E605370D30E5274BFAF2B33AAB9F3C47F05BD175B642261D70B670BF",
+  "2711DBB819DAEC4A55B87405E995593ED7E0DC7CACF303C47C016CA9508D9802",
+  "FC5883B87FEF61732B3DF7FF55210F2557929A8607E14AE42710F74B36F9C222",
+  "B1CBF6C56743F77F4B75D0C8CD06EDDED5313806CBABC17C13CE08A9EB30ABEF",
+  "5A0C038615EA9FF8211EEE9953D382C59D1AD7B5552967C95360E36E4D53E2FE",
+  "D17481587F5F61AD1E6139B854BE5F2A4863F35DA97ECF7DAC0A56BEB66F10BD",
+  "5FEBAA4BAE6549172695FB1CB0FE735482C93D3A955088186A7A954C126129EC",
+  "8A459915F7F01EFF6F18DC934BEF9EBCEE30246BD3CE92D12978F7B2EEC90269",
+  "C1FBBC00347DBEBC2E402BC355303129F7D8AAD7492B92062E85DF0DE87D832E",
+  "AC728D3620E7EF77A2E773D32A92B89DADAFE3D51EC50C25F0F245CEED720988",
+  "62E1035076FC14A0645D00B74EC3CF9BE278977BEB164B66D08D52B50A1FC695",
+  "EBC92C291F8EA2FFA1C997AC583E49F763ABE044853CE6BD88DB08466F602326",
+  "9A23349BA673FF4884A1DBE6E31120C701A806D482515C0AB4B75D81721CFFB6",
+  "1A2883F0B8A7D5E3EFEBAAF42C67992218A0822CC631A6E4A59B7B6DB6143F0F",
+  "5A77C39890A6F5F27F88024EDF94FBE3471BAAA828A51F1213977B6AC5C2C6FD",
+  "A6B23ADB6AA6ACD5E1D5A8E8FF012B6D0DD125746E1A69CB1065B48B1306C990",
+  "674490AE8576CD0C0724EBCF25A3875FEED87B989980D54A8FC5E08B94543361",
+  "DA7BBB6ACA2A408B0F1423A1EBFA74521EFC5F689A13BF6CFA896281AA9ED361",
+  "AAE6AC80A113BA38EA2CA0366220B2D7674F7E5E50DBB4328B8B3E19712CB058",
+  "BE6E856A714AF1C5877C3CD89DFA668E68008AD2F2600776F09F52D42DDF5D12",
+  "5E286E713D6149372A55EF154E0E2968926AD751C19F9F7A75B8852179995582",
+  "10F1BA2F0FEA824AE5321C3FE070E449DC679DE3FB3861433F648176729CC52D",
+  "BFFEC95DAD96C38F7FDED7908584055784A0239D5BF7991320539A350310C8EB",
+  "F03A08651510DA78D15DE3F95C94E226AF7A1FC11D77682B0B002C482BC410A9",
+};
+
+// Photon-Beetle-AEAD[32] cipher text || tag ( `CT` )
+constexpr const char* AEAD_32_CT[AEAD_KAT_CNT]{
+  "DF4E0BAC1162408098FA5CF084D8F464",
+  "E840449949081C5378E01EBA6046DBE8",
+  "9535FE42756917B946D74128639AA8A7",
+  "9378FABDE25D64D50106561F4AED8912",
+  "E71C21D5CFFB6D6F5C57725757831467",
+  "F5F08904B490BC8C160AAAA4669D69C7",
+  "39F447C175847368F5C00BC93B7105F0",
+  "7CDA22DAE1AC11630B81B922196F32AF",
+  "2611DF8F927306C600CB6B3AB81529CA",
+  "4927FE2B49492CED4258C23418607E11",
+  "1D06924ABF55E5D232C08B4469247A26",
+  "80D586E12538FB528980A3C15AF5BB9B",
+  "077E29107A573A06BD69A40D94B704AE",
+  "AE0BAE38E4D7825C354CC1541624CF23",
+  "B04EEF532D26A874FA23860012C9722F",
+  "9CC5462EF22082CA8AA0B3D9AF2AF661",
+  "61CF0EC4096B995D669A00642FC5E216",
+  "1784DF910087ED46C428B78B963405B6",
+  "293D9DCAE52390A3DE5F67859712E799",
+  "C3C2EC061E3775F0F66C3BC732DC8F1B",
+  "E24E240492D1A957280931826FFFD1DA",
+  "AC1BCB95B2013478367D687D5DE25661",
+  "B86ECD1F13BAA2A6BD8B34F53FC3217B",
+  "E88A36E2AA716B5D1B5369CBE3BB4A9D",
+  "060F7B261DB46E19125005BD481EA90A",
+  "20A8C753A1D3F12B3B86AEF4826E31C0",
+  "A378A171C277301A4A8BA16ED3EE4D07",
+  "249E980EFFB0C8C1E0970DEB9CB39299",
+  "91765D3FD2DFC4922A6649080ABF7CDB",
+  "FE0A7ED19D3888C203ED56CF26A72D9D",
+  "978B9087AB9442F75698EC43E8EFBB20",
+  "5423277FD9CC6B3CC1B15603C34F1106",
+  "2B8EC8981F947FF661562DA684F67152",
+  "315DF91EA594D719D44F29E78E0AE94872",
+  "BB0D8807C20344C924E2D35382DD3F2D8E",
+  "A611644893711420563D69317CE0B009D3",
+  "3E4A47953028CFAD50807C6AE9C22C71DB",
+  "3F576E323B5ACB4708324093D18FA7D368",
+  "79EA22DF83B9164624F7F1FF10A20163A0",
+  "2C45772DA29B3FF130C93A36E4AD6230A4",
+  "315B49A47423D180563379968E0E224987",
+  "5951CE9C711E9DC2F2E3C05826B92B3F88",
+  "B883BEFEC1E8B5799259DFD15C0542B4AF",
+  "86E41A6A5E326FA28E814D54210A391757",
+  "052C5ACEB71C5E8B991EB26DF6388C4737",
+  "3E320B35E4605E3F6B65854594F45FD7F5",
+  "8BC84BEC7872B0CB34FBBFA74DC8AF7144",
+  "70891FD77E6CEEF0F82021E5879E605AEB",
+  "36A962572CDC449DEBD13983D37721B044",
+  "D2110707102B986DF8FED53EC23F281AFA",
+  "F87251FBC721A57E1F7B00C99FDD1E038A",
+  "784CB4FADF263906E45544154705D4274B",
+  "AFA153B60295214EA73F891B8B7ECA95A6",
+  "3CF219C9A4611B804FC1517E4DCDAAB47F",
+  "27F8D279C4D1AE4C70A3F97B3F2A494A44",
+  "A4C97DFF9DA92F92C918504E1739621DD4",
+  "4E0768373D67468F031A04A3F462C7EB62",
+  "6DA5A497900A257A4F49F84DADCA9972A9",
+  "04602C4F76D847EDD8225C009D81EF98F3",
+  "A33843A98B2CD5DD1FD173107C15FC9424",
+  "4CD2343094B2AF82BC85A6B1268BFA8243",
+  "6A9033275497A713745BB7E830C2E72980",
+  "0FF5D00C73641CC0FF9030668DC2804E91",
+  "3715D359B922385DA1832137DCD47870C4",
+  "D57F3EC8E28028D96D6D8A87273B857D18",
+  "33341F7F2B29A1114D805937FDDD50FEC0",
+  "31445642BCAE4AB7FB274E3502B1CABB6456",
+  "BBAF1B172140D0D060F0E6346FBC0E12088A",
+  "A6EB8A3E70875191E620C86221D9687210C4",
+  "3E5DEEBA1306F99D7646603A578490B66F9F",
+  "3F13AD16C249DEE06C1D5DE49627CB48489B",
+  "7979C3374AEE4A42A89BF35572B650A0E273",
+  "2CDC0650391824994915AA31E899C22452A1",
+  "31DC8658A8D867A60A1C0C5DFB4B5FC471A1",
+  "590CCF6E57875FD1590B906CAFC411140677",
+  "B80F991FA566690CE01EBB95D06D55000FF7",
+  "86CDE342463AFD985856DE2FE67AABC1A13B",
+  "05782E6D1B670CF895B2C70E06542392ACA3",
+  "3EA149E4B1325ED558B5D97C1E414A773336",
+  "8B7D5180347BD700FED5F23FFB1BA2D10FBF",
+  "70D676181E89280C7C4DA34E635AA09D8E12",
+  "3629E5D577955097BDF8E635451761D2D360",
+  "D27DCF2EE67555A53935809508D9A4698ED0",
+  "F8CDE42BADE3CBA135E5607955A48B8E788A",
+  "78F7E06E72D9B55D2B29887BF03D5E0535CF",
+  "AF3DE605C31475885BE7A61A3E9D2AFEF1F3",
+  "3C97158EB27FDC9E47C5AE8539F3EFDD3ABE",
+  "276EEBDBFD2771C7E4E3254D6BC67378C9A5",
+  "A4ADFC0F15AAFEB3B70328E2B19842A82347",
+  "4EED814A4106B3CBBC6440E776FC3549E4FC",
+  "6DD10F702669245D6DE03A92F495E6A30CAE",
+  "04D88411BBC102B23B8D9B0B82371D2EA345",
+  "A3334BA3BA9FB31D43A53426F9D03AED3782",
+  "4C71450242554FF71E6DB80F1F00E86659EF",
+  "6A68742FB39D08A3786C7C513D32C91CB6BA",
+  "0F5F6D0D0A96FCC2222D273E3A2AE2E7DD19",
+  "37AC78A1AA2B2C26B6D0626C940C19807AEB",
+  "D574EA421698A5B1DB9531C72B6F353253C6",
+  "33D7443A1F5D3D3DD784C16BC26C57C42CA4",
+  "31447CF95BDB66F5E8C92C3F604E2EE9C1829D",
+  "BBAF0EA1D138C5DD90B1358706F26ED88E8E21",
+  "A6EB4D12081D7FD48DFAB9080D71A1FB583AB2",
+  "3E5D8FCDA00509EE8F67D5B4A17C3C3BAC943F",
+  "3F1373A0349659EF46665CE1C50B015693F5B1",
+  "7979F007A61535FFE9E436EF38CDB9244F819D",
+  "2CDC028CED38D42A38CE3C9D9172C3A522D5DA",
+  "31DC9B9BCD074F4BE0964FCB9E834DDA648849",
+  "590CC15BAFA72BCECA9B6B9C07F7E6B55FE0C2",
+  "B80F796355776F45CBB8E56F02E64D2276492A",
+  "86CD845D3D2DF4EE49C4691B3AD100FCB0FFDD",
+  "057809749DD0ADE43EC75B8E856C96E5BC0500",
+  "3EA131F2C08D23A5742D16BEF51B8B54213FB6",
+  "8B7D622610EEFE4C50B382328258C10C771216",
+  "70D6AABDFEBB703BFA7484DDB27CE017E40BB6",
+  "3629E5C03265AA637DF227EA2A4366F293F679",
+  "D27D3831C93127DC6CA40026EA62B505F46EBA",
+  "F8CD448744958EEC2D870F4A3B96B78A22159E",
+  "78F715D16088CD366103728977FAD0ABFA9CA5",
+  "AF3D2BB22DFFC9E0B4A6CE963173449D74E734",
+  "3C979140C358693BF5B5D0D083C3F07543496B",
+  "276E55A0E64A63CE60122E271A86F835881AB9",
+  "A4AD6A39D286BF0B2467C2463655BDE7B7914B",
+  "4EED0AB769B7663C0C2E2963AECE947AE805B7",
+  "6DD1A97CB90A240B39D8EF4CF4442DA2678A66",
+  "04D8CBF66081DE0C6DF300E48C6957287D3928",
+  "A333CED52C27888B66E81DC4449EF2BD43A5E9",
+  "4C7120D2F390A5CE1466FC0C9C2ED6C3265713",
+  "6A68B86D86168BE61C572F0DF46B7397EB1E2F",
+  "0F5FB6F2E593429882B06C7080EDAECE333B7E",
+  "37ACF527C89336808EE166C127A4B3D6B91963",
+  "D57456D882D972EDC195D4BEA5B48CBE18B463",
+  "33D7FBE0470BEC14E41AF491FCC36D3BF15E48",
+  "31447C09C54CDEB0FD4D20607B6B733FFC021EC2",
+  "BBAF0E0252F8B347C7B8A8CBEF54625D63ED0A7D",
+  "A6EB4D0DB4AEE7CFB3E11544346438CC64C697F6",
+  "3E5D8FCF4C2562CADB2639FA0489D9389FA2466E",
+  "3F13735DAFD6B207185D4258999EF7CA9FD756B3",
+  "7979F09D90F4A666C5488F55687C04FA9FC7BD15",
+  "2CDC02062F7624A8A400DD785F85CDB5667AA71B",
+  "31DC9B0B0A41825255D179D55945511938D7CA5E",
+  "590CC1EFF9EF5D326F1FAE7D342BBF6261E2A21F",
+  "B80F79E45FA10E158CF663EABF67EF1BF634B420",
+  "86CD8402016729CD7E126AE23959A9EDF21DBD68",
+  "05780949FE19BAA253CC8610C9C9B8B00FD876F8",
+  "3EA13148C443E31B4A70128E9864FD56089960FB",
+  "8B7D62D5B6F7A61A4D1A93359D889B5821E10C62",
+  "70D6AAA788637433E7CB9C77B370192F1B41BE45",
+  "3629E5E451F5C0F94598E3FF826B5461C63AE404",
+  "D27D386A65AA2A2A0E6A211E1ED5C09E934F1118",
+  "F8CD449CFD8840874A57C362B68785698F830A70",
+  "78F715748D0CC2CA16F90E2EB63E0CF8C5217DD3",
+  "AF3D2B30C648F66833EE291CFA60F33C4D3E5E5D",
+  "3C979143DC0069E5CD0F782E0A08A43052D368AD",
+  "276E55733F97DBBC322425D9CEF97199A528CC50",
+  "A4AD6A72CF8D464C088EDBC4AFBEDDA0487F6A07",
+  "4EED0AD26EC61983523F34D9B6A0FE35174D3988",
+  "6DD1A95D1E7854B1BEF462C2A7322B0F1B028BDD",
+  "04D8CB03E2C9E6EDA389502C71C0AF8E13763E85",
+  "A333CEC9F04920571826FD7F92DD71C1290AE91C",
+  "4C7120D4A0FA33484F0556A7D3C55EFBB16C9F9A",
+  "6A68B84FBD1DCB9B2B696EAD513216FE96F8631B",
+  "0F5FB63BB01E11D17497A1735EF27C911BC52D51",
+  "37ACF5799EC9BFAF9D1F0F74E3769DC8F0F299AA",
+  "D5745681A784A72B24ED332A59FD887466194365",
+  "33D7FBDA315A532224BA7F0F79145B88BC9C2955",
+  "31447C09E6989321DFC78F1FAF266E6594EF84B701",
+  "BBAF0E0290DEAF6A0A13B67CD340972A3C1F5A4906",
+  "A6EB4D0D6D54034918A6AC216DD01E3EA8F9451F33",
+  "3E5D8FCFD5843F1838B1842857A1E77E4266BB11A4",
+  "3F13735D07E824430E1CA2044F3F34FEB26F46ECE0",
+  "7979F09DADA7FB2D18F241958D6DB1CB3AE096A17C",
+  "2CDC0206E529B9911BCA6F3AD0C34D98AEAF713A6E",
+  "31DC9B0BAE1780E3D18A871C619A87115A631B1910",
+  "590CC1EF3FDF17E45BF22FF846EBCB1FEBC0EA5636",
+  "B80F79E42B4F11E399E9A14464AC4CB1B6B4BC234B",
+  "86CD84020C117CC420239F9879E7B4D374DB975045",
+  "05780949CD8BD0E8DEFA3D44247D9847B67B57C163",
+  "3EA13148C571156C646FA8B501028663C83F35EF96",
+  "8B7D62D5525A1DA8BE177C9AB1C31335278F5C802B",
+  "70D6AAA7AC1DAB67EE99339FBE91B8AD90ED6E336A",
+  "3629E5E493E2BEEB1EFE6104AA9E336B88BDC8B576",
+  "D27D386A57A86657076D64B0DFEF6708AFAA3DA688",
+  "F8CD449C934A2641BB8B4CFD51B3B336F2C4DE6C40",
+  "78F715744DC1A756A5B4F25CAA200D44888184358C",
+  "AF3D2B301CC67ED5C79BCBF0016D3C8E1F3D7977E5",
+  "3C9791438274C79F971AA70360699BF815497C1579",
+  "276E5573D88AE0CAED0D8B4EEB171F1F319A7F8049",
+  "A4AD6A726D7C397CA7056E1379CB2A7FC292B879A4",
+  "4EED0AD232AE9C9AEF9B02B3342908964F7B203E64",
+  "6DD1A95DDDC0A59CC1DBD3CA1E50176A2E5FD1CCBE",
+  "04D8CB03E637B2E29DBF9EE67ED7237016F96C77B3",
+  "A333CEC99F9EFC57DE25D6BC99A24EAA1D72ABC9AE",
+  "4C7120D4CCAFD0C7E2E55EE4657E0F443E7165DA1E",
+  "6A68B84F2DDD8D1DE3624FCA127CACB1ACA8E34758",
+  "0F5FB63B3E43E2463399686AF0FCAE29CF4B618E1D",
+  "37ACF57989BE52DD1A1B0EDD7EC554F7B620E9A57E",
+  "D5745681640EC9354033D956D4626003E57F9E4AD7",
+  "33D7FBDAD67F24897AE04C765116FB1A10A8A4EA35",
+  "31447C09E6FD871364AB9A7FDC013DB973C037597DA5",
+  "BBAF0E029077B660F02B1F96AF64ACCF52C1E1750DE4",
+  "A6EB4D0D6D140603377D3166F748B375704A0281BF76",
+  "3E5D8FCFD5957400C84AFC79046E0F2942E51D9682E1",
+  "3F13735D0735D7E7E8E677E2124899AFAEC306765898",
+  "7979F09DAD547B0BF50E60DD430E08558C9E356A97BB",
+  "2CDC0206E5EF3E5502BBE330B4E4C6CB84AB4310CE09",
+  "31DC9B0BAEA59C0FB7D4CCAF2B9EF934D55071C91DCF",
+  "590CC1EF3F4DAE2BDA9A3AC28512EAC1AF7D30F7D016",
+  "B80F79E42BA56CAEE5EEA471F8FDD09E13822556623A",
+  "86CD84020C97AA4732594E6BE7D5649EB372C0B96737",
+  "05780949CD88D0DD71A1C36C2ADCBC033366E7BBDD37",
+  "3EA13148C508EB2F9783FD330659348C9A0BFA582CC7",
+  "8B7D62D552DDEED2E717A8D9FC2E46864722F201F622",
+  "70D6AAA7ACED046C02328F60FD7426F7A900A123E63D",
+  "3629E5E493B8574861207FF36BA4A432F07322F59CE1",
+  "D27D386A57024B2F28AEC2E62ABFFB8B5B14888BDB03",
+  "F8CD449C9317BC2B2809E442563C80FDF98D2B4B44D8",
+  "78F715744D1DF13DAE0259DD14912D86BB7F82647560",
+  "AF3D2B301C230D463C7C65460D4BB883285B88AD3C26",
+  "3C97914382F7CC8D3D2456939DFFB91AF41204C5C0BC",
+  "276E5573D8799469E823D4BF564477A9FC867217F330",
+  "A4AD6A726D98263FEE882AA18748DD4A72172FE21EEE",
+  "4EED0AD232349D193D8C40A61A1A64089557E2C64C0B",
+  "6DD1A95DDD7810FA7DF6C7CA44A922FEC1910EC162B4",
+  "04D8CB03E6D2AEB6C00B0329121A7934D13FA3CBD757",
+  "A333CEC99F15AA70C0F161BA6E9D8084CF1ECC7C0167",
+  "4C7120D4CC020AB693A9E85E54E95C7CFA3A3CFAC27C",
+  "6A68B84F2D1FC903110EE0D7C4F48120A2446FCC5AA1",
+  "0F5FB63B3E886EAC2622DBDE2D06633A23E1F78B3D29",
+  "37ACF57989BACB22D8955E67449F676ECBF63CE602F4",
+  "D5745681640BB59E393B721FE44D04E7046F02CB6D53",
+  "33D7FBDAD650A0299E256D5B8ECB1D039546ECA68133",
+  "31447C09E6FDF2B562438B74CBC4B7BAB23EC4E3468F1D",
+  "BBAF0E0290770BC1558AD95EF91100D342AF679A9403C0",
+  "A6EB4D0D6D14A4D2929DEB25E0874B5AD8324C298F843E",
+  "3E5D8FCFD595BDF1F42E70730A4121F54F653A39556A64",
+  "3F13735D07352DD61D942FEE4AC744AE3300641DBB43EA",
+  "7979F09DAD54026062BD946B8197AD460C55A80C61A928",
+  "2CDC0206E5EFF737A2DCF5012D7200FC0D88B407723789",
+  "31DC9B0BAEA57EB30EFA9D8D40945ABCC1ADF5B051D667",
+  "590CC1EF3F4DC3D2686D9EDC332DFCB72FCC11761FDA52",
+  "B80F79E42BA52D8DE15313E1209AC2368B431C27D823CF",
+  "86CD84020C97C06937AD808A074854AD13EDE71A5875A0",
+  "05780949CD88CDEDA632E67B9A55CDE348AD75D1593591",
+  "3EA13148C5081FB713350BCA86A5B12886FF0DEE5FEB51",
+  "8B7D62D552DDD28A856436D67C55FEC59D43558F718C59",
+  "70D6AAA7ACED2011C661C3DF47EF058DEE8F1CB4995B8E",
+  "3629E5E493B8BEB12031391A6FB812FEAFBDF4531BAEB6",
+  "D27D386A5702540AE8662542A8BBD8B7A7585974C46F83",
+  "F8CD449C9317C569E200D11A3FD9B3BCF92746E7F40F35",
+  "78F715744D1D12DC7A2BECA1D4A2A044DBE1B84327CF14",
+  "AF3D2B301C23E0556DE2AF66A7F3FD7A030915CA0B4EEF",
+  "3C97914382F7C15DE45957F48D6E61B2ADC4A1F78047F8",
+  "276E5573D87932F85C3233FD1BAF0FB68A4807DBFB6020",
+  "A4AD6A726D9893C8C787BE61C971B27BA666C5F2E70E76",
+  "4EED0AD23234C0C0AD6A60CFBFA219300CF68922B34D1D",
+  "6DD1A95DDD784225D8F798FA1FB71BE204690100EB9051",
+  "04D8CB03E6D2D8DC422DDF471CB9BB305F9257B1291A59",
+  "A333CEC99F155616FBC69B6C062B57DB1C08F3FF0B22F5",
+  "4C7120D4CC02514EF6590CAED00FC1A9249ACC6B32F135",
+  "6A68B84F2D1FEE5600261B78C0DBA489E01CB4FDF5D07B",
+  "0F5FB63B3E8848F703A2241059F8163A45AA90F4B857DB",
+  "37ACF57989BAFAF762DB54616D0C8C2CE719BD000F9D8F",
+  "D5745681640B85898A19A3DCBBE8E8E770011DE985E9BF",
+  "33D7FBDAD6508101F1C4E56CE71A3652DA16724653C7DE",
+  "31447C09E6FDF23E20FD9D164667793C135BF48FFD80E0B6",
+  "BBAF0E0290770B1569CEAE6C5BC280DC2064C08CE9AF4AD0",
+  "A6EB4D0D6D14A423062F616F7DB2BF42114FD5BAC7E0B9B5",
+  "3E5D8FCFD595BD2E8E306AC33B114BEDF3EEE0FC850AAD7C",
+  "3F13735D07352D2751A0F67DB24EBAC41C3BBB6B835E655C",
+  "7979F09DAD540283400D9B970CF13664475D431D0125457E",
+  "2CDC0206E5EFF71C0FB8329A176CA1A0E216B826931A6CEB",
+  "31DC9B0BAEA57E4C4EEA4D58B30C26E23643ED9F953275C7",
+  "590CC1EF3F4DC332F383ABBE01363BF741232D78B0240191",
+  "B80F79E42BA52DB393390A4EDE671BBBCA5B128BC7B78A3F",
+  "86CD84020C97C035521B5FBCBAFA74D5900C36F6089AEE46",
+  "05780949CD88CDC5C16B4463F22C6194D238480ECC2E8AB6",
+  "3EA13148C5081F76C87652F22CB93CECF28787BE058C6F10",
+  "8B7D62D552DDD2F8AE9628FBBD5C780C1B5AC33F8C12D1E3",
+  "70D6AAA7ACED20739526BDB13AA3BCFA104CE4A61B84F4A9",
+  "3629E5E493B8BEB42BECA85237745B0AF76580AD084AB415",
+  "D27D386A570254CCC77992CE0C767B8EC27A36554DE50880",
+  "F8CD449C9317C5E144C6857B3E8D4EA9BEDB8837320A04D7",
+  "78F715744D1D121138444EE4C0853BF1BF32C41C5CFF80C7",
+  "AF3D2B301C23E061E7C42F59C020FA0E2378EBD1E397F180",
+  "3C97914382F7C152A1D768BF355A44F6839EDF2D2F1B03C5",
+  "276E5573D879324ADCA827577843E940F7BE4B7C8D238DCA",
+  "A4AD6A726D9893D7E5FF027684F88841FC16B13DE3134706",
+  "4EED0AD23234C03FF165939EE99A7099D84B3A6373D13CCC",
+  "6DD1A95DDD7842946344FE7102D09C3F33570C28385054FB",
+  "04D8CB03E6D2D878589ED80AE4DD244FB615AB065D67C431",
+  "A333CEC99F1556769BB9926740F1D8364D822801F880D003",
+  "4C7120D4CC0251BC967F32706F0EFF3FCAD232EAF294826F",
+  "6A68B84F2D1FEE1F1B10F649ABD49D4FDF16F75BE0C7F271",
+  "0F5FB63B3E8848CAD0A11C40A995D5275588132CEAAC0048",
+  "37ACF57989BAFAD68E979B77E41A648A385DE02161CE5B1A",
+  "D5745681640B85E2E85D728809DD78928D04BBD851CF2A55",
+  "33D7FBDAD65081BCD36E82EB82D280F6C20F056B127797D9",
+  "31447C09E6FDF23E3FD48FF4106B185EE3122263B9DB363E45",
+  "BBAF0E0290770B15BA0F83B14DE9FA82D9444FCBA38A8537C5",
+  "A6EB4D0D6D14A42342F2231E0219473ECA59A44B12A3AC81EA",
+  "3E5D8FCFD595BD2EC506CEA883F8225F1676597EF9C403808D",
+  "3F13735D07352D27DD63321B51D4740DAB93D4CC73241595D7",
+  "7979F09DAD5402833B13A6D4BD11072BDD4EFA056EDF2EBE3D",
+  "2CDC0206E5EFF71C6544D6126E2E7067F22165B868F098668C",
+  "31DC9B0BAEA57E4CAEC6D1609AC65E0FD8617C6FD6ECFC5AD0",
+  "590CC1EF3F4DC3325BD63E9600A53E89A51BC86E4BF437C051",
+  "B80F79E42BA52DB393F0B9E1C743059A2B24AD39855C10775E",
+  "86CD84020C97C035FDB280B4DACC55269FE59410B074BAF610",
+  "05780949CD88CDC594E65380BEF9CB1761CE4173811436227C",
+  "3EA13148C5081F760D0134DBF4199929ED3A4C1121BD466FF3",
+  "8B7D62D552DDD2F8C660556E0E5C68E9D1D4E9188E74610C95",
+  "70D6AAA7ACED2073A745CEF68B3C21DEA855B0C9A12C0CED88",
+  "3629E5E493B8BEB43FA5127EEAA4BA1F1B7B1962E840541444",
+  "D27D386A570254CC9F6070977FFDB46105D8C2CBFC7DD9443A",
+  "F8CD449C9317C5E130A88CC2954AE9ECD3D6FAE05F1A742785",
+  "78F715744D1D1211730DF6E675BB60B9F49F3041F158B8E6AB",
+  "AF3D2B301C23E06108FD23829DC909C9794A07151786DE2F66",
+  "3C97914382F7C1527C3629531D2E09FB5ECEAB12219FE3CD0D",
+  "276E5573D879324AFE1003FF814B316BF397C309C234C674C5",
+  "A4AD6A726D9893D7F5CB9C57EB39EF7CE0FCB6FD8478C0D216",
+  "4EED0AD23234C03F8129FD567B57198C8A4C527B3B6A113C93",
+  "6DD1A95DDD78429461D618EF1F049641C43EA294D1ED9E9544",
+  "04D8CB03E6D2D878745C5C8D20DF00AFA40FC9C40FAC0048FD",
+  "A333CEC99F15567614DCFE6CED2E955E53EDC8D0B4896622DC",
+  "4C7120D4CC0251BCE7FBD1190CFB653878C76A6167CEBE7672",
+  "6A68B84F2D1FEE1F4C8284F28149B12D952AB503C0DBF88CB7",
+  "0F5FB63B3E8848CA4E00411CB510CC65BC7AEAE38C215DBB21",
+  "37ACF57989BAFAD6F755C005D8F551D5402A80D7C4139203D0",
+  "D5745681640B85E2D2961FD1C1E0170CA507165A49ABA5ED28",
+  "33D7FBDAD65081BCA6E602849EB4F4D566E60DA136F67836EC",
+  "31447C09E6FDF23E3FBB87E36CE0B4B38845F21764675050E3EC",
+  "BBAF0E0290770B15BA608924FEC0F58D9C6D54E361495C76CDA4",
+  "A6EB4D0D6D14A42342373EA3C1A39F55B55E92456AF16C2384D0",
+  "3E5D8FCFD595BD2EC58606A04DAF22D562D6E806C64D2EEF5BCE",
+  "3F13735D07352D27DD09256FAF4E41BF13D603A7F66E615F38F4",
+  "7979F09DAD5402833B7E93CB66984AA7F5499F52E09698A2C9E7",
+  "2CDC0206E5EFF71C65D236B06E41459CA12693B844DD4C1D5282",
+  "31DC9B0BAEA57E4CAE59B9FA5ADC42B50550010223950180FC48",
+  "590CC1EF3F4DC3325B739F4DE6CC938B2A0135DD8B8267E9B255",
+  "B80F79E42BA52DB39354E523F47CD2DB8FBBC2B1CED1A0BF26D9",
+  "86CD84020C97C035FD1EA18D83104A309DA8C0E189C225309DB5",
+  "05780949CD88CDC5940C4E7DDA8D0AE2248FE8F37F3092FBA0D1",
+  "3EA13148C5081F760D36205A6E3A2AF14EAF3953A501BF363E92",
+  "8B7D62D552DDD2F8C6B09ED8E043AA11E9C7921CAF852DB842C2",
+  "70D6AAA7ACED2073A7D6F151641BA352AC57D2A41B9B51C76FFD",
+  "3629E5E493B8BEB43F14F15EABD72E4A49D9C3DD22BBE91DEF8C",
+  "D27D386A570254CC9F427B0C1138896DC50481471B0D2E9CF0BD",
+  "F8CD449C9317C5E1305DFA64676170646701733BDA9113734D09",
+  "78F715744D1D121173C6024C124AA72BB08FFAD0264332CF7E32",
+  "AF3D2B301C23E0610854A639D0781283E8BDFA2FA891C9C06331",
+  "3C97914382F7C1527C5889F7C782B05FDC321921E1E55FB50BB0",
+  "276E5573D879324AFEC9BC35A6B62200169D45AAD96B4B7DE34E",
+  "A4AD6A726D9893D7F57433B320D68436332D1778A2F341904B6E",
+  "4EED0AD23234C03F8135123AFDEB21B5A7ACCEE3E3B40A6CD87D",
+  "6DD1A95DDD784294613E4C877DE0E515980FC609EE3F96E1AB9B",
+  "04D8CB03E6D2D878740B1B6050D5D5D1AF50BCA1328B8D0E8B7E",
+  "A333CEC99F15567614B393AC20FD7CE88399E41957184FD1CA47",
+  "4C7120D4CC0251BCE780BEDF59FCF4F4FCC31234AA745B3E2DB0",
+  "6A68B84F2D1FEE1F4C7454018F59C51D77D4B73A01B873454A01",
+  "0F5FB63B3E8848CA4E819D10B9348FE7460BB8F31FE2C5F0B55F",
+  "37ACF57989BAFAD6F79499AEEC18DD13AD1694D6513730E0D35B",
+  "D5745681640B85E2D244DE05B4AC820E36E3E731079B1DABA6BE",
+  "33D7FBDAD65081BCA630CC997B54EA0CDF6D1094DBFB0B8C5B50",
+  "31447C09E6FDF23E3FBB50D24950E9443732405C3B64479730FE2F",
+  "BBAF0E0290770B15BA60906F5D213764B715FF47A478357F965EB2",
+  "A6EB4D0D6D14A42342377CD0BE8DD1067135258E25E9ACADE1F17C",
+  "3E5D8FCFD595BD2EC586B5C8B959BF94DE0F1D825494D963247393",
+  "3F13735D07352D27DD09934D81A076DF442468B1D2D9ACD64EB0EB",
+  "7979F09DAD5402833B7E363E4FD8DEC64D2527BD4AB73306A91624",
+  "2CDC0206E5EFF71C65D2D07D505840B7E8227E6D04BB7497D0B44C",
+  "31DC9B0BAEA57E4CAE59F2C24D16B925B110FBAB323604FD48B5B3",
+  "590CC1EF3F4DC3325B731EFB477A305B7B61EE9E6BB965FDB848EC",
+  "B80F79E42BA52DB393549B55EECDAE520102D9469E5D6DC771EBB7",
+  "86CD84020C97C035FD1E8E3F332F1E895FEC7E2D2FB7DE8C030B0F",
+  "05780949CD88CDC5940C40A8D3DD4A236FC5BB5B8A83386E5BB6EA",
+  "3EA13148C5081F760D367862183FA2D66D6390D5B201A43CE3EC81",
+  "8B7D62D552DDD2F8C6B092AE2907B8BC0343C69AAA237D3AD6F385",
+  "70D6AAA7ACED2073A7D641B0EA71E631745967B20CD8A0247B44A3",
+  "3629E5E493B8BEB43F14F93209FECD08402DB2D06DA3B3AA98FAB6",
+  "D27D386A570254CC9F42872F42BEF61AEDDA6720744C566295E7E5",
+  "F8CD449C9317C5E1305DF0C4AC1F9CEFCD1C881942C38B39EF5011",
+  "78F715744D1D121173C639ED8D99B7EBFBFF036DA88B065236C398",
+  "AF3D2B301C23E06108544C036453CEA31FB55D1CC88B979FA1EB3B",
+  "3C97914382F7C1527C581B0D0B6C732C1004877B152E92208232A1",
+  "276E5573D879324AFEC9C09AE7DBA3759D910E21815049A55E13C4",
+  "A4AD6A726D9893D7F57489CBD2DF67D813F937C10148DF9CCEE9AD",
+  "4EED0AD23234C03F81354EDA30A0BF962226B7E3FFF5B62E187BFC",
+  "6DD1A95DDD784294613E983FB2BFCEF14AEBCDA66972424C4DA311",
+  "04D8CB03E6D2D878740B84E41F7A4D5C4C87B13FFA703ED1ACBD51",
+  "A333CEC99F15567614B38FCDD6633CA3D444169CCF7097AC39F77A",
+  "4C7120D4CC0251BCE780428285864FE2165D0130746ABF495ED496",
+  "6A68B84F2D1FEE1F4C740E9BFE026ED74C06623A460BBA7AE3F86B",
+  "0F5FB63B3E8848CA4E813EF576C64114FDC241EA799387685CB754",
+  "37ACF57989BAFAD6F7940317BE0DD4D44EC20B6B96A6FA79BFE32C",
+  "D5745681640B85E2D2448DFCA68446F3A506F14CA085203E605E15",
+  "33D7FBDAD65081BCA6307C2885B579AF9FEC58450EC1C7201EDCC3",
+  "31447C09E6FDF23E3FBB508528A1782D2722416A2EAD4B041DD8C0B3",
+  "BBAF0E0290770B15BA6090C83E1A37F2D2CC39EE756220187EEB1C09",
+  "A6EB4D0D6D14A42342377C84F024EA46E7014E2CDE5148AE77FC6245",
+  "3E5D8FCFD595BD2EC586B5772A89D6E6E009F3952B7223A44A541E00",
+  "3F13735D07352D27DD099319949B00B6BE24AB5276D3D200466A75BB",
+  "7979F09DAD5402833B7E367F71285EA95D85DA0AF166D2DE9C904FFD",
+  "2CDC0206E5EFF71C65D2D0012AF5326A32F775F8C3057722FBFB60CC",
+  "31DC9B0BAEA57E4CAE59F2953C4C0FC9A884316EE207743FE7CD83C5",
+  "590CC1EF3F4DC3325B731E4927DBF4D0AF297FE5C1DB3DE6228F5A4A",
+  "B80F79E42BA52DB393549BA3F2C801A838B80BBFBD4BAC758CB6BD32",
+  "86CD84020C97C035FD1E8E8A1A6974DF62AC1686660DDDEAA19EA7DC",
+  "05780949CD88CDC5940C408D314E979539FDBD1536A82E58A8BE2038",
+  "3EA13148C5081F760D36781557BD70C35DE83CDCE7050511A73A0ED8",
+  "8B7D62D552DDD2F8C6B09261C0A41AFBA38A53E36D7A1D66B23CA03E",
+  "70D6AAA7ACED2073A7D6417AFD8BBA79421907AAC1DFE9810BEFE932",
+  "3629E5E493B8BEB43F14F952FFEDDB260A04E6C011E1F964124273E2",
+  "D27D386A570254CC9F4287E39959C499AFF4B14CE7C597D3BD4954E0",
+  "F8CD449C9317C5E1305DF0BBDF7B2E4C448EDDDF78CC40861E92A3B7",
+  "78F715744D1D121173C639377682C486CDF8B55507A0241BD81C810A",
+  "AF3D2B301C23E06108544C0F87F6BBE2172B746B9E3C94D5587977C4",
+  "3C97914382F7C1527C581BA001190811140E5822C8ADD1F965D6EB0E",
+  "276E5573D879324AFEC9C0EC49D9FBC99F902063A23E841CCD7FB1E6",
+  "A4AD6A726D9893D7F57489F3E67D647FA1D4DF7624B4D5596C032D9B",
+  "4EED0AD23234C03F81354EF57F0246D34F57EA45CFB253FC59B4D8E9",
+  "6DD1A95DDD784294613E981C8BDFB1F2F071DE075222962FC55A8729",
+  "04D8CB03E6D2D878740B844F869381D936F10348B2BD4A455A7B4A10",
+  "A333CEC99F15567614B38FD36F4511C4C55937813728510EF26335FF",
+  "4C7120D4CC0251BCE780423FFEE28EA2F58242FB1ED70F3B4F5994E6",
+  "6A68B84F2D1FEE1F4C740E3067B67D1F702759DBFC64AF1E3687EDD2",
+  "0F5FB63B3E8848CA4E813E973F9508C0C95C2DA9D63F2C10D1FB1D3A",
+  "37ACF57989BAFAD6F794036C516CA11162BD4FF2F4A584D7687A2CD5",
+  "D5745681640B85E2D2448D79FCD90934DF0C66B8242548E8F6168765",
+  "33D7FBDAD65081BCA6307C8E94960CE73034934E423CFDB4015CC292",
+  "31447C09E6FDF23E3FBB508501C69D43EF6E10E90BF81CCB7B704C9AE8",
+  "BBAF0E0290770B15BA6090C8C03193724BAA2F4D361C8B0347BA4F3407",
+  "A6EB4D0D6D14A42342377C849C3433F6E6731D5F627A5BEEE6DA829CF2",
+  "3E5D8FCFD595BD2EC586B57708A03BB506309EB211B322D582857BA2BA",
+  "3F13735D07352D27DD09931976C8204E9A97D2793BC7B7293A22A56F6C",
+  "7979F09DAD5402833B7E367FCF3D4B3FEC6B48089377EF1861FCBB6147",
+  "2CDC0206E5EFF71C65D2D001BE69F9342EFFC50579025AE347B0DB022B",
+  "31DC9B0BAEA57E4CAE59F2957F4EFFE5438D425C22933026D22C096BBA",
+  "590CC1EF3F4DC3325B731E49CDDDC9041652D619ACF58951987A07C2C6",
+  "B80F79E42BA52DB393549BA3D8CA019CCCA947F3957D06C70201FBD648",
+  "86CD84020C97C035FD1E8E8A451A1D4CB5115E77026AE858A1A28BAC27",
+  "05780949CD88CDC5940C408DD9D6BB2DD65C7722C82453549D7557B80A",
+  "3EA13148C5081F760D36781549DE85D13ED36020734C1183756C958B96",
+  "8B7D62D552DDD2F8C6B092610B208499EEF1AC8D892365BFBB11B0BF5D",
+  "70D6AAA7ACED2073A7D6417A1AF100E216A6C1A573924BAE9F870B1EC1",
+  "3629E5E493B8BEB43F14F9523F38EAB382C2BDA1CC1A75EF6E929E2087",
+  "D27D386A570254CC9F4287E33E74E9A61201CA32B76EC2C4834553B399",
+  "F8CD449C9317C5E1305DF0BBC30C0276AACA9DFEEB4685A45A6714F640",
+  "78F715744D1D121173C63937383938217AE328E64D91128EF563B2D4CC",
+  "AF3D2B301C23E06108544C0F9EDA6FDE6CCEC824789767537894F450E4",
+  "3C97914382F7C1527C581BA0912D15C820A36D1847CBCB26C0AB2FB534",
+  "276E5573D879324AFEC9C0EC2202C90F6641CBFB7B6930DD24D89A58BD",
+  "A4AD6A726D9893D7F57489F39A4D81376F86DEE1B96F422F204817A50F",
+  "4EED0AD23234C03F81354EF58989FF39863081A05AB7F1207E2179D069",
+  "6DD1A95DDD784294613E981CE25320BC9A08891314992B2300785AF246",
+  "04D8CB03E6D2D878740B844F0B2341B688284EEF7AF49C2A954CD0E01C",
+  "A333CEC99F15567614B38FD3BD7197BDBE346F9949C2276A9A7564AFDC",
+  "4C7120D4CC0251BCE780423F5CC8C377314B593C1A8564FD3E83C80B74",
+  "6A68B84F2D1FEE1F4C740E30B1B4C42DCB6B63B2051D819783C0EF5C38",
+  "0F5FB63B3E8848CA4E813E970DE6DB4726B25AA8FD32664068EC6F1737",
+  "37ACF57989BAFAD6F794036C4EAA992C2694C0F33E5D7133F841D0CB80",
+  "D5745681640B85E2D2448D79DCE0F48846E7208699DEEBCD354A3A7D67",
+  "33D7FBDAD65081BCA6307C8EF9A6F3C97F1D83F771566F6F0340EE04C9",
+  "31447C09E6FDF23E3FBB50850192A8DD72D22F41CD9318EE3CEF498A12C5",
+  "BBAF0E0290770B15BA6090C8C0DA8F9B9E2532DB17FF9EF8C054D298E6D1",
+  "A6EB4D0D6D14A42342377C849C41D531BE8136690792E05A8C441DD590C2",
+  "3E5D8FCFD595BD2EC586B577085F3B5EAD7BADB001FB123C04690D5F51CC",
+  "3F13735D07352D27DD09931976BA9026E453442E5A982D67230A684D43D6",
+  "7979F09DAD5402833B7E367FCFF8F09E98E963F800EEFFD11B3DAB30C062",
+  "2CDC0206E5EFF71C65D2D001BE889B0AEBD5E3DF39808F607D958C63929B",
+  "31DC9B0BAEA57E4CAE59F2957F5F17140269446CC26E70416582E8433ABD",
+  "590CC1EF3F4DC3325B731E49CD491974FEACE022F42E6395DD495FEB0242",
+  "B80F79E42BA52DB393549BA3D8FE88D69CBB4971D4050E04371F3ED3E62D",
+  "86CD84020C97C035FD1E8E8A45C8A037F936893EFFDC07ABD0ED382FF6FB",
+  "05780949CD88CDC5940C408DD9EDB519A2AF4133D1FE821D33CEDF6717B0",
+  "3EA13148C5081F760D367815496A8709F7CB620386D386991F5C41199B2A",
+  "8B7D62D552DDD2F8C6B092610B3822D2DF7FC3C7C2B010DD59EC9A27966D",
+  "70D6AAA7ACED2073A7D6417A1AD49623DD4571D29394DF02B089C8AD57BE",
+  "3629E5E493B8BEB43F14F9523F28169562A1BC9E343BD349CB81CFB81171",
+  "D27D386A570254CC9F4287E33EE94C4D5331C42C96D86EEC939157219BE5",
+  "F8CD449C9317C5E1305DF0BBC37617365151E0EE8803FDA8A57A5709EEE2",
+  "78F715744D1D121173C6393738A3405607CCDA486BFA40A88FF05AB8C0F5",
+  "AF3D2B301C23E06108544C0F9E08A46BBEF0AE6D669959917F8DEC1FDD43",
+  "3C97914382F7C1527C581BA09102D59485CAD46AB5C7BFF67D475E4ACCF7",
+  "276E5573D879324AFEC9C0EC221FC3C95B421BEDDE9DCDC285FD4F4F0E9C",
+  "A4AD6A726D9893D7F57489F39A7ABD8F2D0BC69E7D02F46F00C39ACA1DE4",
+  "4EED0AD23234C03F81354EF589D21E7D9418FF60F110347AD829FCC992A3",
+  "6DD1A95DDD784294613E981CE2FFB5CBA606B24C4B4F9F3AAA9B736CBED2",
+  "04D8CB03E6D2D878740B844F0BDC363AA00C9B0434F8EB4EC00856F3F416",
+  "A333CEC99F15567614B38FD3BD182625A02F692880EBA6F414D8D51BE576",
+  "4C7120D4CC0251BCE780423F5C084B04F446AA1B568ED3493DC3C7C31D56",
+  "6A68B84F2D1FEE1F4C740E30B183BD6C29B328B9DF9868CAB5CBE5243403",
+  "0F5FB63B3E8848CA4E813E970DC3191DA0FF1540026A4EABA6C8EEDE65F2",
+  "37ACF57989BAFAD6F794036C4E7AE973C62EE35862B7C88F529B858BC3CD",
+  "D5745681640B85E2D2448D79DC952B595D04A0B4EA6B244B2BB86664391B",
+  "33D7FBDAD65081BCA6307C8EF9FC32BB23FFCA5D2EEFD1F95F7635007CB5",
+  "31447C09E6FDF23E3FBB50850192C698601A4A1F15CB1C7D6E92E4C9065D01",
+  "BBAF0E0290770B15BA6090C8C0DA69730CDBE00A798AAED6A699BA4CEA6778",
+  "A6EB4D0D6D14A42342377C849C41220636BCA7099ECC56A3196E9C45741D1E",
+  "3E5D8FCFD595BD2EC586B577085F9C6AB0ABFB3F20E416AB40D4B2B1E0060C",
+  "3F13735D07352D27DD09931976BA8C46D05D995111DDC2366FC057DFEAC2AB",
+  "7979F09DAD5402833B7E367FCFF8F8AF7FE65D503EDDB1328E425BCC858199",
+  "2CDC0206E5EFF71C65D2D001BE8884A525402658D637D6959151483A956FA0",
+  "31DC9B0BAEA57E4CAE59F2957F5FC26629ADC257153668997EA357DC3B0FA4",
+  "590CC1EF3F4DC3325B731E49CD49DF2105648CE811038A8372163E50335C67",
+  "B80F79E42BA52DB393549BA3D8FE8D6C43BDCA66FEF0B11FDC0CE74386DF90",
+  "86CD84020C97C035FD1E8E8A45C8F8729D0EE7C299941A27D173E7ACBBA104",
+  "05780949CD88CDC5940C408DD9ED28D2C6B3C8C56F4BC5DB037766AAB45227",
+  "3EA13148C5081F760D367815496AB23A96D91D0F5A2D2F161AC8882FE49190",
+  "8B7D62D552DDD2F8C6B092610B38809EA1ACFAB378AEE248D7788A0098BE33",
+  "70D6AAA7ACED2073A7D6417A1AD45A3B74DF6C5C5E009A8A814984FE57B4EB",
+  "3629E5E493B8BEB43F14F9523F28DBA7B99C2803E975AE49522D301AC4166A",
+  "D27D386A570254CC9F4287E33EE9F09B6FDBCFA56D939F928C9B49F6FB1853",
+  "F8CD449C9317C5E1305DF0BBC376431AD8AC287ECF8F41060B6F5939188CB7",
+  "78F715744D1D121173C6393738A35F7AFC83669C76E057F6DEC94CE3349117",
+  "AF3D2B301C23E06108544C0F9E08D75CA75219F5319F3EDE7DAFAB540409FA",
+  "3C97914382F7C1527C581BA09102AF1D63057118C7FBCFF4E3B63B30507F21",
+  "276E5573D879324AFEC9C0EC221F2570DCBA0F1B25F963FC181EC5DB657898",
+  "A4AD6A726D9893D7F57489F39A7A8ED2DF523F1837C4E21493768AD96727D7",
+  "4EED0AD23234C03F81354EF589D29488A2733A8706CE1FE1B02EF4CD6C2BEA",
+  "6DD1A95DDD784294613E981CE2FF90A97B9484DBC75F7322315113716F27DD",
+  "04D8CB03E6D2D878740B844F0BDCA892B882A7ADB72D26FAA86EF0F614A1DB",
+  "A333CEC99F15567614B38FD3BD181C413CEC3ACD6484BCCBD9CD1EC8B1374B",
+  "4C7120D4CC0251BCE780423F5C082AB4A5068E05329A6CB130DCC65EBDD558",
+  "6A68B84F2D1FEE1F4C740E30B183F091FD430BDD2BF79F092F62A6AD206591",
+  "0F5FB63B3E8848CA4E813E970DC3557B3A62B92FD95E2C4987B726DFAB8806",
+  "37ACF57989BAFAD6F794036C4E7AB7A233697376DF7B4BAA9956A9DF9BDEFC",
+  "D5745681640B85E2D2448D79DC9562BAC4FCF684AA6FB61B3E4A2A1D79BB4A",
+  "33D7FBDAD65081BCA6307C8EF9FCD79285A87DA094C6DCB5B7D5E3D005FB14",
+  "31447C09E6FDF23E3FBB50850192C62138DC9629E44F9772500DF2BB5D5ED087",
+  "BBAF0E0290770B15BA6090C8C0DA69D24E0165A7B0A1A6C2098880BCC3EE74B4",
+  "A6EB4D0D6D14A42342377C849C41227E32ADEEB6DE67C0A54BFEA385B8609800",
+  "3E5D8FCFD595BD2EC586B577085F9C0A1FF4BE9BCB17CF2FFE605C6ACFEE6B4C",
+  "3F13735D07352D27DD09931976BA8CB69FEAC541D1CCA1D4DD3D203C20B4B410",
+  "7979F09DAD5402833B7E367FCFF8F8BB24F107D95FB6E35C45B1DE304D560C0B",
+  "2CDC0206E5EFF71C65D2D001BE8884F58D8716AA68F68C596AA64E0CC3296144",
+  "31DC9B0BAEA57E4CAE59F2957F5FC28AF361F9E637F852B40BF3FF43C7F02F9C",
+  "590CC1EF3F4DC3325B731E49CD49DF63DAC650D40D600FB09DDFEC6DD79A1880",
+  "B80F79E42BA52DB393549BA3D8FE8DE36F933B2B6292D21814E8F9DAFFBAD8BB",
+  "86CD84020C97C035FD1E8E8A45C8F8AE6C7F739BFCA0F6322E7C5C2D4F877AF2",
+  "05780949CD88CDC5940C408DD9ED28DDC294A86269900559F1BA137CA845DE74",
+  "3EA13148C5081F760D367815496AB227DC61B1A878CDC6033001AAC673E3F6C1",
+  "8B7D62D552DDD2F8C6B092610B388000DDF9D98E1ECE82FB2752CE209E235E48",
+  "70D6AAA7ACED2073A7D6417A1AD45A7294EA80A9CAC34EDFF77263616BE26EC2",
+  "3629E5E493B8BEB43F14F9523F28DBB669F8EFC3CFC42D45DE32FEA45DEA7A92",
+  "D27D386A570254CC9F4287E33EE9F0876BA6EBC95F4D9C0BD17AA96B11E7051B",
+  "F8CD449C9317C5E1305DF0BBC37643452ADBE7582ECB8C7887BF40568A051AE4",
+  "78F715744D1D121173C6393738A35F3F28BC0C08109049072481FE79F5AFD9D6",
+  "AF3D2B301C23E06108544C0F9E08D7856904B81C292893CA9A2D766D1C7325E7",
+  "3C97914382F7C1527C581BA09102AF014FA269F6FF5C53311AC7DC0D29F13661",
+  "276E5573D879324AFEC9C0EC221F25750AD752C7A8262325C9B654637081D304",
+  "A4AD6A726D9893D7F57489F39A7A8EA5C29CCF0C6E5E22C8DC8E58797DF69D3F",
+  "4EED0AD23234C03F81354EF589D294E00728CFE52097749AEB463991CA99B3ED",
+  "6DD1A95DDD784294613E981CE2FF90B60554D5B71EE644D102A370043B9689C1",
+  "04D8CB03E6D2D878740B844F0BDCA8AD91E494AF6E68FB7DA2A3B86F5F2C5302",
+  "A333CEC99F15567614B38FD3BD181C87FDD302760053BD02758EBCC1B5078162",
+  "4C7120D4CC0251BCE780423F5C082A2ACCE7FD3F53C04F8F7BEAE910A4990706",
+  "6A68B84F2D1FEE1F4C740E30B183F01EE8E1B838C333BDE1ADBA39C1AB4B0380",
+  "0F5FB63B3E8848CA4E813E970DC3557BC23BBA561507B82C318AB87B021C66E9",
+  "37ACF57989BAFAD6F794036C4E7AB787E8F403F78705D958D78DD279A3A8FAB2",
+  "D5745681640B85E2D2448D79DC95627F75DBA551068D6BDD9A4278191FCEEFA3",
+  "33D7FBDAD65081BCA6307C8EF9FCD7C2E98AA2DAB97CB6C485669FE3B7C53A48",
+  "31447C09E6FDF23E3FBB50850192C621BEB394863219EA6FE9AE126A6CB09A1A"
+  "47",
+  "BBAF0E0290770B15BA6090C8C0DA69D2D34746ED44934429B0799D420D4BE876"
+  "0B",
+  "A6EB4D0D6D14A42342377C849C41227E85E7F5067B4B6205B7EBFA295643F6C2"
+  "9E",
+  "3E5D8FCFD595BD2EC586B577085F9C0A7D35590A6A463497150D1183673706FB"
+  "AC",
+  "3F13735D07352D27DD09931976BA8CB6E512998856A5151A90803D537689C93F"
+  "54",
+  "7979F09DAD5402833B7E367FCFF8F8BB0457D8E41C3121CD536648D1FC282E80"
+  "80",
+  "2CDC0206E5EFF71C65D2D001BE8884F57CA9E3A19320A3B72A2CC4DAA9FEE1FF"
+  "92",
+  "31DC9B0BAEA57E4CAE59F2957F5FC28A28E53717F550E97697EE46D5746E7DB1"
+  "83",
+  "590CC1EF3F4DC3325B731E49CD49DF63CA18C913C0D46D175586343B2580172A"
+  "58",
+  "B80F79E42BA52DB393549BA3D8FE8DE397BCE5E22CB6F06180A7E31116BF6CF6"
+  "38",
+  "86CD84020C97C035FD1E8E8A45C8F8AE41CB840FC5C168046B6E9DFCE2487627"
+  "A0",
+  "05780949CD88CDC5940C408DD9ED28DD9124687B628271351D7ED2720E18F618"
+  "E9",
+  "3EA13148C5081F760D367815496AB227D0683DAC6A33BA48C04EC944851C9C27"
+  "B6",
+  "8B7D62D552DDD2F8C6B092610B38800021DB4FC80C8ABC8B2E6C968C35DD87A9"
+  "86",
+  "70D6AAA7ACED2073A7D6417A1AD45A7211911D8D8705BCB11AB1BE40E7766EFF"
+  "EB",
+  "3629E5E493B8BEB43F14F9523F28DBB63EB574A52470162ED2C80C94DE330C9D"
+  "4C",
+  "D27D386A570254CC9F4287E33EE9F0873BC1F5580CDAD729D9F0A50DEADE9BA4"
+  "86",
+  "F8CD449C9317C5E1305DF0BBC376434550FE20983B0927D5A35BF730277E7E04"
+  "24",
+  "78F715744D1D121173C6393738A35F3FBC338D2AABE11D4604A8F6B0831EC92C"
+  "FA",
+  "AF3D2B301C23E06108544C0F9E08D785CEB38E2ED98851EEC18B77EE9DA23156"
+  "95",
+  "3C97914382F7C1527C581BA09102AF01F3BC3CEBE87E1F9DC04B7A1F3ED24F93"
+  "BD",
+  "276E5573D879324AFEC9C0EC221F257522F9BED861ACDF1D49FB73B5DA360168"
+  "30",
+  "A4AD6A726D9893D7F57489F39A7A8EA5C3374AE194AEDE330432C62FB8E5077C"
+  "25",
+  "4EED0AD23234C03F81354EF589D294E02FED64C848C563F4E3217DD02AEA68F5"
+  "1C",
+  "6DD1A95DDD784294613E981CE2FF90B6EC8953C6969D104EF760BB6879BF845A"
+  "7D",
+  "04D8CB03E6D2D878740B844F0BDCA8ADCBA1E3A69ADF177C0896E41226F64640"
+  "C5",
+  "A333CEC99F15567614B38FD3BD181C87702406DEA1FC60828DD220808DC89B7F"
+  "50",
+  "4C7120D4CC0251BCE780423F5C082A2A334FF79AFE85E7D45BF4E1446AF81D14"
+  "3D",
+  "6A68B84F2D1FEE1F4C740E30B183F01E1CA1C9340F1071EE57ED2E509BEF5A28"
+  "F7",
+  "0F5FB63B3E8848CA4E813E970DC3557B3681CC726575B5266972162B8805E2DA"
+  "9E",
+  "37ACF57989BAFAD6F794036C4E7AB787B3D88BFA30110A3A4F8A777C071CE995"
+  "E7",
+  "D5745681640B85E2D2448D79DC95627FB444003E29F2B1C9B3080637C4BD48DF"
+  "42",
+  "33D7FBDAD65081BCA6307C8EF9FCD7C257DA9DC337A66354C48D84B80974DF0D"
+  "64",
+  "31447C09E6FDF23E3FBB50850192C621BE88D2A57BC3ED3D9E11A89CF266A251"
+  "5627",
+  "BBAF0E0290770B15BA6090C8C0DA69D2D324836E0C4E66B49693A3EBBD86675D"
+  "BCE1",
+  "A6EB4D0D6D14A42342377C849C41227E858EDE93BD3DFB1B097FDDFB6ABEC99B"
+  "1587",
+  "3E5D8FCFD595BD2EC586B577085F9C0A7D5CC37D534E854E1DC1D28DB911B34B"
+  "9F88",
+  "3F13735D07352D27DD09931976BA8CB6E52F445DEE5F859CD7E990AFEF8E51A4"
+  "341F",
+  "7979F09DAD5402833B7E367FCFF8F8BB044169FB09F6884A16CF9FE64E5A958A"
+  "2E4F",
+  "2CDC0206E5EFF71C65D2D001BE8884F57C6B83C2FEB357AF9934F0165796A6D9"
+  "D11C",
+  "31DC9B0BAEA57E4CAE59F2957F5FC28A2853E49A300111012D50BB9C19735411"
+  "1BDF",
+  "590CC1EF3F4DC3325B731E49CD49DF63CA793CBF9EC2833726C99B43AFE386C2"
+  "B82C",
+  "B80F79E42BA52DB393549BA3D8FE8DE3976E842F33B09A47E4A92EF0D63DD68B"
+  "0689",
+  "86CD84020C97C035FD1E8E8A45C8F8AE414BC5399D643DB25F9FF59692286948"
+  "FAB2",
+  "05780949CD88CDC5940C408DD9ED28DD9123714F77F7782B2BFFBF1EA8659BBE"
+  "8D2E",
+  "3EA13148C5081F760D367815496AB227D07DEFF4D821917572043F492858E92C"
+  "F5A4",
+  "8B7D62D552DDD2F8C6B092610B388000213660B0D83459BAE0FF1FD02E976BB3"
+  "7E45",
+  "70D6AAA7ACED2073A7D6417A1AD45A721173544296030DE85A17F3DF638B72A2"
+  "9E6B",
+  "3629E5E493B8BEB43F14F9523F28DBB63E03A772E9C620E04B0A3C330538CDE5"
+  "6692",
+  "D27D386A570254CC9F4287E33EE9F0873B31CCEDFA34292C7CEC77CE8AFE7527"
+  "3517",
+  "F8CD449C9317C5E1305DF0BBC37643455026C5804F8B9C698D900CE8816C9456"
+  "2DC6",
+  "78F715744D1D121173C6393738A35F3FBC4C76A4CF7074A5ED6F33C939F5A6FB"
+  "BA04",
+  "AF3D2B301C23E06108544C0F9E08D785CE6C77FB43DA61C331A03927FE889359"
+  "B1DD",
+  "3C97914382F7C1527C581BA09102AF01F39D89CAA3586DB40CFB9D6346692199"
+  "EAB7",
+  "276E5573D879324AFEC9C0EC221F257522CBD7AF0DC72CDE44B567C4C9B52B83"
+  "8441",
+  "A4AD6A726D9893D7F57489F39A7A8EA5C30287A345F6BA684D939E11CAD16EBC"
+  "0D5F",
+  "4EED0AD23234C03F81354EF589D294E02F3F6AB3EBE804CBEE078CA6C63B2A77"
+  "BAF4",
+  "6DD1A95DDD784294613E981CE2FF90B6EC48FC614268115106E4272693C5021A"
+  "A054",
+  "04D8CB03E6D2D878740B844F0BDCA8ADCBCE9D1F13658B59AFB7B72E6AF1F05E"
+  "3D4E",
+  "A333CEC99F15567614B38FD3BD181C87705BBF04C1591F6E03BA2A6D19EA8BA1"
+  "49AF",
+  "4C7120D4CC0251BCE780423F5C082A2A33978137AD59A45A5CC890DCF9836A2C"
+  "8BA0",
+  "6A68B84F2D1FEE1F4C740E30B183F01E1CD7B4EC51DE85D1995874F6C4D5597A"
+  "7722",
+  "0F5FB63B3E8848CA4E813E970DC3557B366123AF024B96682C8232A4E5780B08"
+  "4B23",
+  "37ACF57989BAFAD6F794036C4E7AB787B314AE91B4C87DF08967CD00DC81F973"
+  "C691",
+  "D5745681640B85E2D2448D79DC95627FB44076B9A7C8B2C24724D56F7D4E96B8"
+  "EB13",
+  "33D7FBDAD65081BCA6307C8EF9FCD7C2573DE71360AEEB501FDDDDB8740177FE"
+  "E760",
+  "31447C09E6FDF23E3FBB50850192C621BE8885CA2B5C487DF104955AA87C6D30"
+  "655616",
+  "BBAF0E0290770B15BA6090C8C0DA69D2D324F4EC63816F646C28D8FF39520AC9"
+  "EC6648",
+  "A6EB4D0D6D14A42342377C849C41227E858EF32CCA473384ACE36A56E2F671B8"
+  "A98601",
+  "3E5D8FCFD595BD2EC586B577085F9C0A7D5CCE58B2CF13A96D0D323468831BCF"
+  "F8EC96",
+  "3F13735D07352D27DD09931976BA8CB6E52F9A51F8E9F2CCB3B31915F0B0BED7"
+  "90F5E6",
+  "7979F09DAD5402833B7E367FCFF8F8BB0441A985A1DBBCCC309EDAB29782462A"
+  "4F55A8",
+  "2CDC0206E5EFF71C65D2D001BE8884F57C6B68ED07AFA55C372D49D0EB46A2D5"
+  "5D883D",
+  "31DC9B0BAEA57E4CAE59F2957F5FC28A2853CF9FAB36631541D1B4731C60E696"
+  "44B362",
+  "590CC1EF3F4DC3325B731E49CD49DF63CA7961A3490F7FA2D88EB519963ADE01"
+  "1DBAFA",
+  "B80F79E42BA52DB393549BA3D8FE8DE3976E39880E44AB3B9DB82536A1B71704"
+  "69B204",
+  "86CD84020C97C035FD1E8E8A45C8F8AE414BA576729417D0500243A7C1673803"
+  "DED131",
+  "05780949CD88CDC5940C408DD9ED28DD9123862379DEB356CFC6EECDCDBB6DB0"
+  "E3505D",
+  "3EA13148C5081F760D367815496AB227D07D43DCE83C3809618FB54D5B587363"
+  "B52432",
+  "8B7D62D552DDD2F8C6B092610B388000213632D5EF37667CA5816DD5335F5F2E"
+  "D65A9E",
+  "70D6AAA7ACED2073A7D6417A1AD45A721173D39BF7DAD8EEF64F090A21E61DA2"
+  "A6E814",
+  "3629E5E493B8BEB43F14F9523F28DBB63E0368471C6578C14BAC265D07AF9423"
+  "AD6976",
+  "D27D386A570254CC9F4287E33EE9F0873B312C817ED1315345CBC19D196781E5"
+  "B48C0D",
+  "F8CD449C9317C5E1305DF0BBC37643455026FD9B462AABD75FF56E242819AAA2"
+  "2D6BD3",
+  "78F715744D1D121173C6393738A35F3FBC4C9986ED323595D5DD9361AF8AC6F7"
+  "1EDF92",
+  "AF3D2B301C23E06108544C0F9E08D785CE6C8DA8AB61233D3DA1C053A75E14DA"
+  "90A24A",
+  "3C97914382F7C1527C581BA09102AF01F39D28A6BA59A84271B6628AAE25723E"
+  "4CCCEA",
+  "276E5573D879324AFEC9C0EC221F257522CB687DDC38929152AAF00A2CC65CD7"
+  "FDF4F7",
+  "A4AD6A726D9893D7F57489F39A7A8EA5C302CA11899418EF6142024F7E5C24D9"
+  "186384",
+  "4EED0AD23234C03F81354EF589D294E02F3FF7127F2B2A0A8C40859E6E5B167E"
+  "223FC7",
+  "6DD1A95DDD784294613E981CE2FF90B6EC48FE84A2251D8935FED788CBA3A0D5"
+  "A04A16",
+  "04D8CB03E6D2D878740B844F0BDCA8ADCBCED6DDC07D817A54865DD5401E937A"
+  "8F5710",
+  "A333CEC99F15567614B38FD3BD181C87705B67D2EEBD72EEF524574FC19C48AD"
+  "292673",
+  "4C7120D4CC0251BCE780423F5C082A2A3397F2468F33FC27972C161DD73C43C8"
+  "D95F72",
+  "6A68B84F2D1FEE1F4C740E30B183F01E1CD71B362349E7D7D6E3D5438DB00548"
+  "1E825A",
+  "0F5FB63B3E8848CA4E813E970DC3557B3661D49477727E04A7FDD12DF9E34CE0"
+  "28BC78",
+  "37ACF57989BAFAD6F794036C4E7AB787B314004A3E7D839137BC4DC9C35FE785"
+  "F912C1",
+  "D5745681640B85E2D2448D79DC95627FB440A8997EBFE385934576DBCA54D7F6"
+  "8C60C3",
+  "33D7FBDAD65081BCA6307C8EF9FCD7C2573D6EB1C8827353987E9BD5416B94A0"
+  "1B3A7A",
+  "31447C09E6FDF23E3FBB50850192C621BE8885EE3CB7B1F6F3E6D76E5AAEB21A"
+  "E18D4EF5",
+  "BBAF0E0290770B15BA6090C8C0DA69D2D324F40C0F79355ACBE20E58CD41D87E"
+  "6C069E3E",
+  "A6EB4D0D6D14A42342377C849C41227E858EF3FB0940147DC2420C340D0A5A7B"
+  "C296221C",
+  "3E5D8FCFD595BD2EC586B577085F9C0A7D5CCE110020331D14713E652AA9ED97"
+  "10253197",
+  "3F13735D07352D27DD09931976BA8CB6E52F9ACE0372626FF686F95D6A7C6029"
+  "B17FF394",
+  "7979F09DAD5402833B7E367FCFF8F8BB0441A9101C7559705CDA5B960888F98B"
+  "408EECFA",
+  "2CDC0206E5EFF71C65D2D001BE8884F57C6B683D08441B09D9F371A18D55B7F7"
+  "9FAA13F3",
+  "31DC9B0BAEA57E4CAE59F2957F5FC28A2853CF1D8FA3ED2E5B5BA7F888705026"
+  "1F691054",
+  "590CC1EF3F4DC3325B731E49CD49DF63CA79619A78B5F04B84FB00912052A623"
+  "2CA118F0",
+  "B80F79E42BA52DB393549BA3D8FE8DE3976E398D840374281458CC82558E40AE"
+  "BAD8FFFA",
+  "86CD84020C97C035FD1E8E8A45C8F8AE414BA52260EB6CB5C39FA7F63A7D2540"
+  "28E5A575",
+  "05780949CD88CDC5940C408DD9ED28DD912386D454AD175DC813446A5DD8FCEB"
+  "7E0103DB",
+  "3EA13148C5081F760D367815496AB227D07D43494BC19418A15853240E9832F2"
+  "2C6F7920",
+  "8B7D62D552DDD2F8C6B092610B388000213632EEDAAD533DAAC7A0068AEF3009"
+  "951BCA21",
+  "70D6AAA7ACED2073A7D6417A1AD45A721173D31CA44D21E78F6A7CC0DD3D3851"
+  "88683A1D",
+  "3629E5E493B8BEB43F14F9523F28DBB63E03687BF3701C44962EB3629825143E"
+  "0C381270",
+  "D27D386A570254CC9F4287E33EE9F0873B312C65F51DC5768632038ABB6BCEDB"
+  "FA0B3771",
+  "F8CD449C9317C5E1305DF0BBC37643455026FD1DD60454CC358921C39406F571"
+  "ABBE72C5",
+  "78F715744D1D121173C6393738A35F3FBC4C99060B67F87A1618DF2F5F2D76EF"
+  "4C8B3DCC",
+  "AF3D2B301C23E06108544C0F9E08D785CE6C8D335004265B13D60C6558AFE0F9"
+  "3847662D",
+  "3C97914382F7C1527C581BA09102AF01F39D28756CE7C807F3AD9AE78BBE16B4"
+  "91978EA7",
+  "276E5573D879324AFEC9C0EC221F257522CB68A50E59FB90D3401075EA60E2AF"
+  "57D6F1B2",
+  "A4AD6A726D9893D7F57489F39A7A8EA5C302CA1CEEE0F8DBA8E42F5C5C6EEB94"
+  "ACD673F6",
+  "4EED0AD23234C03F81354EF589D294E02F3FF735D7EFB061BEC2D805C88B6BA4"
+  "3C79F17C",
+  "6DD1A95DDD784294613E981CE2FF90B6EC48FE0B34E828E6252B74BAE65D6862"
+  "9EC7ED48",
+  "04D8CB03E6D2D878740B844F0BDCA8ADCBCED65A9B27C82473A2868D0289B2E7"
+  "DD0A0816",
+  "A333CEC99F15567614B38FD3BD181C87705B67514C5256A0D0AB5DF7E4228EAB"
+  "8910C462",
+  "4C7120D4CC0251BCE780423F5C082A2A3397F28994EF6E3B1CD7602D1438C159"
+  "31A64D8E",
+  "6A68B84F2D1FEE1F4C740E30B183F01E1CD71BE2E5AAEDF29312E37E8E9DFC29"
+  "9C66674C",
+  "0F5FB63B3E8848CA4E813E970DC3557B3661D4463BE35EDBA735AC2860FDD4EC"
+  "BA09D721",
+  "37ACF57989BAFAD6F794036C4E7AB787B31400B06F39609ECDDA89F236B6440D"
+  "2ABAB1E7",
+  "D5745681640B85E2D2448D79DC95627FB440A8D816E9B1EC2E3297CA355BDEC3"
+  "36B363D5",
+  "33D7FBDAD65081BCA6307C8EF9FCD7C2573D6E55E168AAEA7652A9F0C2017731"
+  "B9274811",
+  "31447C09E6FDF23E3FBB50850192C621BE8885EE1C0423D93DF9A14D0EC9D105"
+  "A71E440781",
+  "BBAF0E0290770B15BA6090C8C0DA69D2D324F40C9497D8E65C812287BCDB9718"
+  "740BBAECE0",
+  "A6EB4D0D6D14A42342377C849C41227E858EF3FB82BD0D8D6DA865523A55448C"
+  "FF2D91533D",
+  "3E5D8FCFD595BD2EC586B577085F9C0A7D5CCE11501496A0D44D4C294048DEAE"
+  "6AE74F2310",
+  "3F13735D07352D27DD09931976BA8CB6E52F9ACE86C869A06EB7176B65ACBA0B"
+  "774161C974",
+  "7979F09DAD5402833B7E367FCFF8F8BB0441A910C516F2025C0B00A895DED3BD"
+  "AD247954BA",
+  "2CDC0206E5EFF71C65D2D001BE8884F57C6B683DC6ED10171085DFB3A9B1A7D1"
+  "8BF953D0F4",
+  "31DC9B0BAEA57E4CAE59F2957F5FC28A2853CF1DFB67994F011CC4E77099DD4C"
+  "79C8848090",
+  "590CC1EF3F4DC3325B731E49CD49DF63CA79619A93BB07EDF8E73B1D8B01421C"
+  "0FF285B759",
+  "B80F79E42BA52DB393549BA3D8FE8DE3976E398DD51177984BB68767921015EE"
+  "E58B380713",
+  "86CD84020C97C035FD1E8E8A45C8F8AE414BA52201F74447E2EF3367B94EDA8E"
+  "4C8BFEF014",
+  "05780949CD88CDC5940C408DD9ED28DD912386D4374A82AF88B230E13DE850B1"
+  "E0A39B5476",
+  "3EA13148C5081F760D367815496AB227D07D4349745073741498A7B3F7315073"
+  "029DF61498",
+  "8B7D62D552DDD2F8C6B092610B388000213632EE726DE79CCAFA5F6EA25D711F"
+  "6595E39AA0",
+  "70D6AAA7ACED2073A7D6417A1AD45A721173D31C85FC9B03BEF721BF68DA52BB"
+  "94E415B14C",
+  "3629E5E493B8BEB43F14F9523F28DBB63E03687B437EFB741DFBA3755D06F122"
+  "5E225A5E68",
+  "D27D386A570254CC9F4287E33EE9F0873B312C65E927C3D990CA43C024C2F005"
+  "619548F9F2",
+  "F8CD449C9317C5E1305DF0BBC37643455026FD1D61AC0CE3A462CFCB733CD486"
+  "8700901A9A",
+  "78F715744D1D121173C6393738A35F3FBC4C99065E37F0808600A7896FC0B39D"
+  "D04FDD045F",
+  "AF3D2B301C23E06108544C0F9E08D785CE6C8D33CD63012A2E7D1B8A91C572F8"
+  "F1C309EAE7",
+  "3C97914382F7C1527C581BA09102AF01F39D2875E65DE70ACA4E312958532E3A"
+  "1A53FA3E68",
+  "276E5573D879324AFEC9C0EC221F257522CB68A5DE28F22A93FD208BEE46C35C"
+  "5FF73B04CD",
+  "A4AD6A726D9893D7F57489F39A7A8EA5C302CA1C7D0A532899E195157098EBEC"
+  "A174B250F7",
+  "4EED0AD23234C03F81354EF589D294E02F3FF735E15272E696D16E712ED03213"
+  "0B3857971A",
+  "6DD1A95DDD784294613E981CE2FF90B6EC48FE0BFC3E0B1CF401C08EF2DD2157"
+  "C49BCD3090",
+  "04D8CB03E6D2D878740B844F0BDCA8ADCBCED65AF08953B5285FC95E086F5F16"
+  "08811B1C0B",
+  "A333CEC99F15567614B38FD3BD181C87705B67510B10AE6B3346E6D373BEAF6D"
+  "0F9A58D1A0",
+  "4C7120D4CC0251BCE780423F5C082A2A3397F289C518D025CFED636C0642ABD9"
+  "EAACA69C46",
+  "6A68B84F2D1FEE1F4C740E30B183F01E1CD71BE262039A6AA0A89724501146C0"
+  "9A3F5B3268",
+  "0F5FB63B3E8848CA4E813E970DC3557B3661D4460D8D9FAA024C783DC4024CB0"
+  "E790F5A9B7",
+  "37ACF57989BAFAD6F794036C4E7AB787B31400B0C52FEB2A9E7DD97E6A6491C3"
+  "96911BC48C",
+  "D5745681640B85E2D2448D79DC95627FB440A8D8962935AA34F90CF7675F2A48"
+  "A8D95FF411",
+  "33D7FBDAD65081BCA6307C8EF9FCD7C2573D6E55F28844F9C2B3553079F50A6C"
+  "28942AB549",
+  "31447C09E6FDF23E3FBB50850192C621BE8885EE1CE171700562428C4742A895"
+  "D06E2DFB62AE",
+  "BBAF0E0290770B15BA6090C8C0DA69D2D324F40C94C780F0A49A726DDB9C50BA"
+  "B00E41FAD630",
+  "A6EB4D0D6D14A42342377C849C41227E858EF3FB8285A3072B4F6A8BB02F8CF2"
+  "1A14DB4A25D9",
+  "3E5D8FCFD595BD2EC586B577085F9C0A7D5CCE1150EAEE7DFB050E60C71F07C5"
+  "FAC2092504BC",
+  "3F13735D07352D27DD09931976BA8CB6E52F9ACE86615C5DC34451FB7FDB06F4"
+  "E71942EFC620",
+  "7979F09DAD5402833B7E367FCFF8F8BB0441A910C5241B735BDE23C08FF39572"
+  "2F76769CCBCC",
+  "2CDC0206E5EFF71C65D2D001BE8884F57C6B683DC616FEF98658C83E19480A14"
+  "C9ECDE662B98",
+  "31DC9B0BAEA57E4CAE59F2957F5FC28A2853CF1DFB14CD2F15E556F8ECFA5A00"
+  "A8B0F6DCA2D7",
+  "590CC1EF3F4DC3325B731E49CD49DF63CA79619A930CEE92D630D5941269F13B"
+  "94C4B0CDE032",
+  "B80F79E42BA52DB393549BA3D8FE8DE3976E398DD5BE0CFB94575418A0AD0EB9"
+  "C27D49B63E00",
+  "86CD84020C97C035FD1E8E8A45C8F8AE414BA5220189C8610A71AD45969809A6"
+  "E9EBA1E5F2ED",
+  "05780949CD88CDC5940C408DD9ED28DD912386D437488D7BB64D7FF48D6F4487"
+  "4F0607055495",
+  "3EA13148C5081F760D367815496AB227D07D43497456553EC38366E1237E1D08"
+  "826BF213DDFC",
+  "8B7D62D552DDD2F8C6B092610B388000213632EE72FA825799819EDB7FFE1830"
+  "D6494EF6FDD3",
+  "70D6AAA7ACED2073A7D6417A1AD45A721173D31C85504B025A3B8A41EB7C1346"
+  "6C2201124E9B",
+  "3629E5E493B8BEB43F14F9523F28DBB63E03687B43F6856B1F780DF7A8342051"
+  "08B8DFDC2898",
+  "D27D386A570254CC9F4287E33EE9F0873B312C65E9417DD17241B48A5A97919A"
+  "CC6145135458",
+  "F8CD449C9317C5E1305DF0BBC37643455026FD1D617A0E9E742330D88FEF748D"
+  "03863779DF74",
+  "78F715744D1D121173C6393738A35F3FBC4C99065E6A9B37862F6C074203FFF7"
+  "6E6202B83874",
+  "AF3D2B301C23E06108544C0F9E08D785CE6C8D33CD74D59AD19AA2DCD2E477A3"
+  "5C0D032CBEEB",
+  "3C97914382F7C1527C581BA09102AF01F39D2875E615096AE48C645393BA1BFF"
+  "9E030576822A",
+  "276E5573D879324AFEC9C0EC221F257522CB68A5DE1595098E130A2E226FF9C3"
+  "3976C8C13E3A",
+  "A4AD6A726D9893D7F57489F39A7A8EA5C302CA1C7D3A2A6407D0386E8432FE09"
+  "90FE4FE4DB88",
+  "4EED0AD23234C03F81354EF589D294E02F3FF735E101A74115862EECB2A6E284"
+  "E613E52367B5",
+  "6DD1A95DDD784294613E981CE2FF90B6EC48FE0BFCA321BA187D9431BBF6F372"
+  "86DC5D4F53A2",
+  "04D8CB03E6D2D878740B844F0BDCA8ADCBCED65AF052DE539F6C5B104CA452E3"
+  "F79140833153",
+  "A333CEC99F15567614B38FD3BD181C87705B67510BD55EA79027081BE0B518B8"
+  "19074731ACB9",
+  "4C7120D4CC0251BCE780423F5C082A2A3397F289C5028CEEF2B242804C021D03"
+  "6AC0119609F3",
+  "6A68B84F2D1FEE1F4C740E30B183F01E1CD71BE2622CEDF28218B418B9F18FD4"
+  "EC4661B3DD75",
+  "0F5FB63B3E8848CA4E813E970DC3557B3661D4460D036387934CF22F21001D53"
+  "44CAFDE30460",
+  "37ACF57989BAFAD6F794036C4E7AB787B31400B0C564A3A383591AFCB05EA980"
+  "451F67C6AA54",
+  "D5745681640B85E2D2448D79DC95627FB440A8D8967AC633C56F9411D30D102F"
+  "2F057A4A6194",
+  "33D7FBDAD65081BCA6307C8EF9FCD7C2573D6E55F2300F35938564F08CFDD5F5"
+  "10692DEEFE61",
+  "31447C09E6FDF23E3FBB50850192C621BE8885EE1CE1BCD450E61FB4E9191AF1"
+  "0F75DB9A15953F",
+  "BBAF0E0290770B15BA6090C8C0DA69D2D324F40C94C7BE5A93220BB1B422676D"
+  "F694F68974E5FC",
+  "A6EB4D0D6D14A42342377C849C41227E858EF3FB8285966B7A1C1A642EFEF161"
+  "0793D4D317F05E",
+  "3E5D8FCFD595BD2EC586B577085F9C0A7D5CCE1150EACEDD4B9B811C3F6C15B8"
+  "F2015ACAE856BD",
+  "3F13735D07352D27DD09931976BA8CB6E52F9ACE8661EFA7D52673845BBDC363"
+  "9054103B6549F7",
+  "7979F09DAD5402833B7E367FCFF8F8BB0441A910C524DD2278FA81697575B0F3"
+  "4DF72FEAB5FD7D",
+  "2CDC0206E5EFF71C65D2D001BE8884F57C6B683DC616C9332D7B943F032A37D9"
+  "82964634EA420D",
+  "31DC9B0BAEA57E4CAE59F2957F5FC28A2853CF1DFB14F81C9AFB7B2892DB57CE"
+  "D3D7646B256706",
+  "590CC1EF3F4DC3325B731E49CD49DF63CA79619A930C443AF83220C348352873"
+  "A6021095CBFD37",
+  "B80F79E42BA52DB393549BA3D8FE8DE3976E398DD5BEF28B0E62A877822FD70C"
+  "7253AC59C9BE78",
+  "86CD84020C97C035FD1E8E8A45C8F8AE414BA522018989B673038B0FF9913104"
+  "6C7E194BCD686A",
+  "05780949CD88CDC5940C408DD9ED28DD912386D437484DE5D4F65D10397CCE9E"
+  "19F203840ACF2D",
+  "3EA13148C5081F760D367815496AB227D07D43497456B9C7E05F570671953D89"
+  "52A4A7BE245EE2",
+  "8B7D62D552DDD2F8C6B092610B388000213632EE72FA64040948113B7072CFCA"
+  "62936B14861BFC",
+  "70D6AAA7ACED2073A7D6417A1AD45A721173D31C85502DDC0171EE68E4906F63"
+  "DBC81A432E9EB8",
+  "3629E5E493B8BEB43F14F9523F28DBB63E03687B43F6BCC2412F780C5F7F368B"
+  "71513A94024BC8",
+  "D27D386A570254CC9F4287E33EE9F0873B312C65E94141E8EDA7224903EB9C01"
+  "55FD5429FF1ADC",
+  "F8CD449C9317C5E1305DF0BBC37643455026FD1D617ADF0A181F4AAE0E55CB7C"
+  "93B2073DD469F2",
+  "78F715744D1D121173C6393738A35F3FBC4C99065E6A2AB05706D9C26A7484B7"
+  "EFDE9BD6E5C0D1",
+  "AF3D2B301C23E06108544C0F9E08D785CE6C8D33CD7448BECD2FF5191CD12AC7"
+  "655DFFD887A946",
+  "3C97914382F7C1527C581BA09102AF01F39D2875E615AFE8A44708A79CA07D94"
+  "98D67AEFD42B62",
+  "276E5573D879324AFEC9C0EC221F257522CB68A5DE15A9B660C85BDE9C42E13D"
+  "7B1CE0793F19DE",
+  "A4AD6A726D9893D7F57489F39A7A8EA5C302CA1C7D3A385683F72814EB1E460A"
+  "F47D6A9737A58E",
+  "4EED0AD23234C03F81354EF589D294E02F3FF735E1010FD8972478301FBBCF97"
+  "A51511CEF414F8",
+  "6DD1A95DDD784294613E981CE2FF90B6EC48FE0BFCA39ADBD88BD5AD9BAC4845"
+  "3CF957B9BB5AF8",
+  "04D8CB03E6D2D878740B844F0BDCA8ADCBCED65AF0524587C7E93056B5999F59"
+  "83ED1C4F9D1A88",
+  "A333CEC99F15567614B38FD3BD181C87705B67510BD5701F919D7CE8A2009B68"
+  "A3057F00E61494",
+  "4C7120D4CC0251BCE780423F5C082A2A3397F289C502847F9E2372F773081987"
+  "D3ED6A1ADBAC96",
+  "6A68B84F2D1FEE1F4C740E30B183F01E1CD71BE2622C942483FBAF1D16510864"
+  "D2C8602DF014C5",
+  "0F5FB63B3E8848CA4E813E970DC3557B3661D4460D03B9B5EEBD7ADE4FFDC23E"
+  "18762D0E080A41",
+  "37ACF57989BAFAD6F794036C4E7AB787B31400B0C5644DAF2806311105F54B4C"
+  "A736DC9D384E4D",
+  "D5745681640B85E2D2448D79DC95627FB440A8D8967A3C941AB8DA84265F16D7"
+  "545404E5C81ACF",
+  "33D7FBDAD65081BCA6307C8EF9FCD7C2573D6E55F230C0398CF7901FBF648400"
+  "74548866CABCFC",
+  "31447C09E6FDF23E3FBB50850192C621BE8885EE1CE1BC35867662BFA59243E2"
+  "07EBCE31A6C420C8",
+  "BBAF0E0290770B15BA6090C8C0DA69D2D324F40C94C7BE3FF5D915E1251A83C8"
+  "5E94CD03C6EDB158",
+  "A6EB4D0D6D14A42342377C849C41227E858EF3FB8285962FE805CC48F6FBD94A"
+  "C7E50AD1A7356213",
+  "3E5D8FCFD595BD2EC586B577085F9C0A7D5CCE1150EACEEB7FF9B58BFAA53203"
+  "08292B0202F9F42E",
+  "3F13735D07352D27DD09931976BA8CB6E52F9ACE8661EFE1602936ACA81337A5"
+  "07FDA04F2D6E4EAC",
+  "7979F09DAD5402833B7E367FCFF8F8BB0441A910C524DD97EB3D2A6AF22D6BC3"
+  "7D872F68701A71B8",
+  "2CDC0206E5EFF71C65D2D001BE8884F57C6B683DC616C9D201EB1CFF71A60E44"
+  "39AC9751C28F0B30",
+  "31DC9B0BAEA57E4CAE59F2957F5FC28A2853CF1DFB14F8DF8C24BFF5AE8CC8EB"
+  "0487B9E8FCAC389F",
+  "590CC1EF3F4DC3325B731E49CD49DF63CA79619A930C441E1220CC355D7281A1"
+  "A00239D85A799059",
+  "B80F79E42BA52DB393549BA3D8FE8DE3976E398DD5BEF2EE014DC0BB64A60F6B"
+  "A185646BEEBA78E1",
+  "86CD84020C97C035FD1E8E8A45C8F8AE414BA522018989297B75893FBAB9F4C3"
+  "44E169CBDDE50067",
+  "05780949CD88CDC5940C408DD9ED28DD912386D437484DBA1DE29BB7FC3520F4"
+  "771FB4081A67D2D6",
+  "3EA13148C5081F760D367815496AB227D07D43497456B978568757C131065E06"
+  "67DCD576E576C368",
+  "8B7D62D552DDD2F8C6B092610B388000213632EE72FA64E9A744AB6EDD67627C"
+  "7F1938EC8706CBAD",
+  "70D6AAA7ACED2073A7D6417A1AD45A721173D31C85502DBA69432C4219ECEAED"
+  "EC45A74E7C1546B3",
+  "3629E5E493B8BEB43F14F9523F28DBB63E03687B43F6BC168F263871379E03FC"
+  "9DAFB67D2A1268EB",
+  "D27D386A570254CC9F4287E33EE9F0873B312C65E94141918148C3B87A2202EE"
+  "9AD82E8DC82C4530",
+  "F8CD449C9317C5E1305DF0BBC37643455026FD1D617ADF7FE8CD1B176A363579"
+  "CA5AFDBE8A1A359E",
+  "78F715744D1D121173C6393738A35F3FBC4C99065E6A2A015DE1E9AD78A64F65"
+  "575705814E06D4C3",
+  "AF3D2B301C23E06108544C0F9E08D785CE6C8D33CD744854DE14128ACFDDE3BF"
+  "5A70F63F8E31F229",
+  "3C97914382F7C1527C581BA09102AF01F39D2875E615AF16C21B88171F906B0A"
+  "E8219537EBE9A7EC",
+  "276E5573D879324AFEC9C0EC221F257522CB68A5DE15A9838AEB667A2C648EE6"
+  "A61EE66537814BE1",
+  "A4AD6A726D9893D7F57489F39A7A8EA5C302CA1C7D3A381775D669F7746E6C37"
+  "4ABEF05D2BA4A051",
+  "4EED0AD23234C03F81354EF589D294E02F3FF735E1010FA25E5A565BCC4A1F57"
+  "2CF58AF367C06841",
+  "6DD1A95DDD784294613E981CE2FF90B6EC48FE0BFCA39ABF310B8D174A13D4A0"
+  "938180BBD2972C61",
+  "04D8CB03E6D2D878740B844F0BDCA8ADCBCED65AF052454BF3655D38CD660822"
+  "E9E3802B89F64ED0",
+  "A333CEC99F15567614B38FD3BD181C87705B67510BD5701F65A9C933DB52CF50"
+  "1F3B25307695764E",
+  "4C7120D4CC0251BCE780423F5C082A2A3397F289C50284609E1D37BEFC8199C0"
+  "8BFAAB047947C0D8",
+  "6A68B84F2D1FEE1F4C740E30B183F01E1CD71BE2622C94902084B1343A8A06C3"
+  "ADCCE0BD08A71176",
+  "0F5FB63B3E8848CA4E813E970DC3557B3661D4460D03B9864C47D786ED6EE037"
+  "74037B49B069DEA3",
+  "37ACF57989BAFAD6F794036C4E7AB787B31400B0C5644DCF0CDFD579602F6FAF"
+  "8D5C485EB7D4C902",
+  "D5745681640B85E2D2448D79DC95627FB440A8D8967A3C6D36A3067A0ECB811D"
+  "6D7295CEA5C11712",
+  "33D7FBDAD65081BCA6307C8EF9FCD7C2573D6E55F230C06D1907E3765E0157E2"
+  "CCB81BF347D6BA6E",
+  "31447C09E6FDF23E3FBB50850192C621BE8885EE1CE1BC35757F7A572F16AEBE"
+  "033FA451E47BAB6ABF",
+  "BBAF0E0290770B15BA6090C8C0DA69D2D324F40C94C7BE3FB66F1E1DDF06A9D3"
+  "5B21B42535DC00287D",
+  "A6EB4D0D6D14A42342377C849C41227E858EF3FB8285962F4203199CB6E11497"
+  "96D8A88D8361705B1C",
+  "3E5D8FCFD595BD2EC586B577085F9C0A7D5CCE1150EACEEBB37600A8DAEA7F05"
+  "B6AFD070C50B678278",
+  "3F13735D07352D27DD09931976BA8CB6E52F9ACE8661EFE1645D2E19EFFA79F4"
+  "6D49FA7FFF076FE0FD",
+  "7979F09DAD5402833B7E367FCFF8F8BB0441A910C524DD978DBE81EDDC27C0F0"
+  "D02E93E548972C0E7F",
+  "2CDC0206E5EFF71C65D2D001BE8884F57C6B683DC616C9D24DCECD7A101A7C04"
+  "FDE25334B47093F649",
+  "31DC9B0BAEA57E4CAE59F2957F5FC28A2853CF1DFB14F8DFA4AAF3F6F2A5A182"
+  "A1019B4C77EB2D626B",
+  "590CC1EF3F4DC3325B731E49CD49DF63CA79619A930C441E1A575A701DD92823"
+  "3A7256B45C21C912D4",
+  "B80F79E42BA52DB393549BA3D8FE8DE3976E398DD5BEF2EEF3082D813D01281A"
+  "2DC289DA450B17DE48",
+  "86CD84020C97C035FD1E8E8A45C8F8AE414BA522018989298BE8C63F100F6221"
+  "286D7A37E68C0A7558",
+  "05780949CD88CDC5940C408DD9ED28DD912386D437484DBA7368BB035B17A834"
+  "3C92FA1265C8D79427",
+  "3EA13148C5081F760D367815496AB227D07D43497456B97819ABEB093E920FF7"
+  "C1A930267A7748297E",
+  "8B7D62D552DDD2F8C6B092610B388000213632EE72FA64E91C166D83B3ECB91B"
+  "953A411B47FD1476CC",
+  "70D6AAA7ACED2073A7D6417A1AD45A721173D31C85502DBA08896B3B1DC04D9D"
+  "FCF9F9A34B56B8F7EC",
+  "3629E5E493B8BEB43F14F9523F28DBB63E03687B43F6BC1679FB2622D51BFF5A"
+  "8C35C9748834BF9FBF",
+  "D27D386A570254CC9F4287E33EE9F0873B312C65E94141911B179B3F9E0B21A5"
+  "0CCEB98DDFC8CF48DA",
+  "F8CD449C9317C5E1305DF0BBC37643455026FD1D617ADF7F30E06406979D3417"
+  "BDEB5B2DB5432AC618",
+  "78F715744D1D121173C6393738A35F3FBC4C99065E6A2A015DA5294F4C5A39C0"
+  "EC28096E2A17FA782C",
+  "AF3D2B301C23E06108544C0F9E08D785CE6C8D33CD74485463A8425922CD1083"
+  "06BB6B8A8EB2BE4B8A",
+  "3C97914382F7C1527C581BA09102AF01F39D2875E615AF16E4835219C6C97A27"
+  "2E2F5E48803E45C57A",
+  "276E5573D879324AFEC9C0EC221F257522CB68A5DE15A983D2302D336A543CB2"
+  "205426528A86D62036",
+  "A4AD6A726D9893D7F57489F39A7A8EA5C302CA1C7D3A3817DC01B31386D6A13A"
+  "202BFF44B58F06FA87",
+  "4EED0AD23234C03F81354EF589D294E02F3FF735E1010FA227DF3ADF691D771F"
+  "32D625F89C41549B0A",
+  "6DD1A95DDD784294613E981CE2FF90B6EC48FE0BFCA39ABF5F0F17B0C7698FD3"
+  "B55E8706D9F88EA8EB",
+  "04D8CB03E6D2D878740B844F0BDCA8ADCBCED65AF052454B02C81BDF7698EEDC"
+  "A41257556D67EED3F0",
+  "A333CEC99F15567614B38FD3BD181C87705B67510BD5701F6983094AC280263C"
+  "1FBD69F61908485D82",
+  "4C7120D4CC0251BCE780423F5C082A2A3397F289C50284601FC9A0027F8F693C"
+  "9EBA4D2A26C1FF73CD",
+  "6A68B84F2D1FEE1F4C740E30B183F01E1CD71BE2622C9490DC61D54B93C6CEE0"
+  "6BCDA49CE4B31B4D6C",
+  "0F5FB63B3E8848CA4E813E970DC3557B3661D4460D03B986AEC1C56A80DB48DC"
+  "C947157B0515A55AAD",
+  "37ACF57989BAFAD6F794036C4E7AB787B31400B0C5644DCFC22F1BACE82322E4"
+  "3956AA9FDE8C678D8B",
+  "D5745681640B85E2D2448D79DC95627FB440A8D8967A3C6D18E2AFE9B6F0730D"
+  "083C986484C0BDC63F",
+  "33D7FBDAD65081BCA6307C8EF9FCD7C2573D6E55F230C06D88BD215C64EF8953"
+  "EB19EE81A34DEA88F4",
+  "31447C09E6FDF23E3FBB50850192C621BE8885EE1CE1BC35754F76DD8FFC5305"
+  "3A2A40C4A802A5D73E83",
+  "BBAF0E0290770B15BA6090C8C0DA69D2D324F40C94C7BE3FB6D0A53F0C401FC3"
+  "A31795FBAF6C2C91D429",
+  "A6EB4D0D6D14A42342377C849C41227E858EF3FB8285962F42E52D8A8B67D0E6"
+  "32AA5004EB50D87AB796",
+  "3E5D8FCFD595BD2EC586B577085F9C0A7D5CCE1150EACEEBB3B4D3C4E01BF308"
+  "FC483CC7DC21A39B4E44",
+  "3F13735D07352D27DD09931976BA8CB6E52F9ACE8661EFE16488FA14586AB930"
+  "32E4A82C6DFDE9477F5F",
+  "7979F09DAD5402833B7E367FCFF8F8BB0441A910C524DD978DA212D1A6DCC528"
+  "D725F1FB01AB67E881F6",
+  "2CDC0206E5EFF71C65D2D001BE8884F57C6B683DC616C9D24DC92181FF541699"
+  "88C765536D92A1D85A19",
+  "31DC9B0BAEA57E4CAE59F2957F5FC28A2853CF1DFB14F8DFA446A6F381E759CE"
+  "9EF3C89D44B93AA377D2",
+  "590CC1EF3F4DC3325B731E49CD49DF63CA79619A930C441E1AB462AB96CF7778"
+  "FC78487FFDBA1D2C08E7",
+  "B80F79E42BA52DB393549BA3D8FE8DE3976E398DD5BEF2EEF37476B92D171E39"
+  "84B3F10A730E479EE21C",
+  "86CD84020C97C035FD1E8E8A45C8F8AE414BA522018989298BBEBBCB4A5804B9"
+  "A392C8E3EA871BCE31B0",
+  "05780949CD88CDC5940C408DD9ED28DD912386D437484DBA736E9D638FB66474"
+  "5A7941EEC6252A68E72C",
+  "3EA13148C5081F760D367815496AB227D07D43497456B97819E42552F5067885"
+  "D98894D159EF27DB07A7",
+  "8B7D62D552DDD2F8C6B092610B388000213632EE72FA64E91C1F99DE54A96132"
+  "E36EBBCFCF9F26C12318",
+  "70D6AAA7ACED2073A7D6417A1AD45A721173D31C85502DBA083765D2ED34AE2D"
+  "54C48C2BFDB48F715CC7",
+  "3629E5E493B8BEB43F14F9523F28DBB63E03687B43F6BC1679E9963A0F62EB86"
+  "5E681D10236812DE2073",
+  "D27D386A570254CC9F4287E33EE9F0873B312C65E94141911B46D75BFA86B73B"
+  "F55F08CE75321F48D3BB",
+  "F8CD449C9317C5E1305DF0BBC37643455026FD1D617ADF7F3063E8E77FEB49EC"
+  "7BC6A6B9C8BE7340694B",
+  "78F715744D1D121173C6393738A35F3FBC4C99065E6A2A015DE5C76CA88D6D89"
+  "E2E6445340025740669A",
+  "AF3D2B301C23E06108544C0F9E08D785CE6C8D33CD74485463499A32DFAC932E"
+  "B1D9719B0FC86CD9CAE0",
+  "3C97914382F7C1527C581BA09102AF01F39D2875E615AF16E487B33C155E2864"
+  "004BFABF2E66BA71954E",
+  "276E5573D879324AFEC9C0EC221F257522CB68A5DE15A983D25D0A6C3AB29DBE"
+  "A0AE6BACC797ED38F699",
+  "A4AD6A726D9893D7F57489F39A7A8EA5C302CA1C7D3A3817DCB282B97A41FB04"
+  "885A3E91AD7CCE312DC5",
+  "4EED0AD23234C03F81354EF589D294E02F3FF735E1010FA227F670718D31BD91"
+  "F6B28257C0067C83C31D",
+  "6DD1A95DDD784294613E981CE2FF90B6EC48FE0BFCA39ABF5F853D44228358C0"
+  "EB035DA2BEE83A77FCF0",
+  "04D8CB03E6D2D878740B844F0BDCA8ADCBCED65AF052454B022D33CED305FCA5"
+  "371DF1140B3D47CEE48C",
+  "A333CEC99F15567614B38FD3BD181C87705B67510BD5701F695E7BCBC3D85B42"
+  "98518DB804C68EE2FBB4",
+  "4C7120D4CC0251BCE780423F5C082A2A3397F289C50284601F77694197B78C8C"
+  "65EF510871FF46ADA957",
+  "6A68B84F2D1FEE1F4C740E30B183F01E1CD71BE2622C9490DCD95325585BF260"
+  "D1FA1E43A57FC29694BF",
+  "0F5FB63B3E8848CA4E813E970DC3557B3661D4460D03B986AEAC142F2133079B"
+  "6CDE44AD7D91B8DC01FA",
+  "37ACF57989BAFAD6F794036C4E7AB787B31400B0C5644DCFC2FE8AAF1750A564"
+  "079B2BBD4CF53FFBD5EC",
+  "D5745681640B85E2D2448D79DC95627FB440A8D8967A3C6D18673E16F8D3100E"
+  "5A40F119124E1EBD4247",
+  "33D7FBDAD65081BCA6307C8EF9FCD7C2573D6E55F230C06D882F3008A189FF20"
+  "1806DBE1A7DE8B17AC3B",
+  "31447C09E6FDF23E3FBB50850192C621BE8885EE1CE1BC35754F4083E225EA23"
+  "78ABC7676036B22C57DD78",
+  "BBAF0E0290770B15BA6090C8C0DA69D2D324F40C94C7BE3FB6D0AAA5DC48EF84"
+  "BD7E12D02EAE3A988E16D7",
+  "A6EB4D0D6D14A42342377C849C41227E858EF3FB8285962F42E546BC41329799"
+  "268C9A9EBC8F824DECD03E",
+  "3E5D8FCFD595BD2EC586B577085F9C0A7D5CCE1150EACEEBB3B45CE08E379BB9"
+  "7CA682847E1DCE22E44852",
+  "3F13735D07352D27DD09931976BA8CB6E52F9ACE8661EFE16488F1CEFA697B9D"
+  "D28608BEE279F08BA1DD3A",
+  "7979F09DAD5402833B7E367FCFF8F8BB0441A910C524DD978DA2E67631C43494"
+  "C0937547C5AA156AD2FA4F",
+  "2CDC0206E5EFF71C65D2D001BE8884F57C6B683DC616C9D24DC999D3C5775BD4"
+  "B2EDD081F6925C33A5D610",
+  "31DC9B0BAEA57E4CAE59F2957F5FC28A2853CF1DFB14F8DFA44693DAB3CFFAFC"
+  "0090BB30EB37E63FCB8D78",
+  "590CC1EF3F4DC3325B731E49CD49DF63CA79619A930C441E1AB4272269F65C6D"
+  "79E7DDC891572774B3EF44",
+  "B80F79E42BA52DB393549BA3D8FE8DE3976E398DD5BEF2EEF374B9B76EC44A0F"
+  "695ADB070D7CB4E8A34CA2",
+  "86CD84020C97C035FD1E8E8A45C8F8AE414BA522018989298BBE9B2BB80F53A9"
+  "63C6FB15BA48A55E7881C0",
+  "05780949CD88CDC5940C408DD9ED28DD912386D437484DBA736EB742EC965DA8"
+  "537AE3F684E11EF95562AE",
+  "3EA13148C5081F760D367815496AB227D07D43497456B97819E447527F64EEAB"
+  "D2CFB3627006828784B176",
+  "8B7D62D552DDD2F8C6B092610B388000213632EE72FA64E91C1F277A4C77BA44"
+  "3F2F10B0D2D96E2F78DFC1",
+  "70D6AAA7ACED2073A7D6417A1AD45A721173D31C85502DBA0837B742C5AFFA9F"
+  "C8C9BFB1605E4B089F9996",
+  "3629E5E493B8BEB43F14F9523F28DBB63E03687B43F6BC1679E92524BDE919BE"
+  "01737A18A38D4161AAF102",
+  "D27D386A570254CC9F4287E33EE9F0873B312C65E94141911B46F8698636D2B5"
+  "A0B7B266BDD59F4EEE4691",
+  "F8CD449C9317C5E1305DF0BBC37643455026FD1D617ADF7F3063B0D2EDCC0C70"
+  "8C0D69F5767388F0EF9CE3",
+  "78F715744D1D121173C6393738A35F3FBC4C99065E6A2A015DE57A1F62E12987"
+  "B94C6796CF9074D23B9FAF",
+  "AF3D2B301C23E06108544C0F9E08D785CE6C8D33CD74485463490842DD55F1BE"
+  "69CF8089B8E75F2B1F6CBC",
+  "3C97914382F7C1527C581BA09102AF01F39D2875E615AF16E487349E37896B5B"
+  "80C06493A255CEA8575681",
+  "276E5573D879324AFEC9C0EC221F257522CB68A5DE15A983D25D5302A50B4883"
+  "15194CD0B611838657A06F",
+  "A4AD6A726D9893D7F57489F39A7A8EA5C302CA1C7D3A3817DCB2CD4457A1BC83"
+  "D2B9B747BD019388945C6B",
+  "4EED0AD23234C03F81354EF589D294E02F3FF735E1010FA227F62D7F672E298F"
+  "D49FD335025791D08EC626",
+  "6DD1A95DDD784294613E981CE2FF90B6EC48FE0BFCA39ABF5F8542CBE76ED6B4"
+  "A6766F06F3D92F12AD7E66",
+  "04D8CB03E6D2D878740B844F0BDCA8ADCBCED65AF052454B022DA0A58732013F"
+  "BA904A88F9DCEE97818C3D",
+  "A333CEC99F15567614B38FD3BD181C87705B67510BD5701F695E7B7D64D50B1C"
+  "1FA7C056A4055A5CD804AA",
+  "4C7120D4CC0251BCE780423F5C082A2A3397F289C50284601F77C567B38467C8"
+  "269B6323B6246A409DA1D4",
+  "6A68B84F2D1FEE1F4C740E30B183F01E1CD71BE2622C9490DCD9477D48BABBFA"
+  "5535DA4280CE3F33BDBCDA",
+  "0F5FB63B3E8848CA4E813E970DC3557B3661D4460D03B986AEACE0B9D0403F4E"
+  "5B2EFD4A10432F34648A1B",
+  "37ACF57989BAFAD6F794036C4E7AB787B31400B0C5644DCFC2FE217553D416CF"
+  "AF1A72808FDEA55D7358D8",
+  "D5745681640B85E2D2448D79DC95627FB440A8D8967A3C6D1867E9352C87BFEC"
+  "40E4F25B0920014269841D",
+  "33D7FBDAD65081BCA6307C8EF9FCD7C2573D6E55F230C06D882FAD9DA4128DD6"
+  "B789251234F9828EB1AA3B",
+  "31447C09E6FDF23E3FBB50850192C621BE8885EE1CE1BC35754F409604442827"
+  "F0C701F3E7FA6AAF9F0789BD",
+  "BBAF0E0290770B15BA6090C8C0DA69D2D324F40C94C7BE3FB6D0AA4126E6B8C3"
+  "AF55C9E1E51AE7F26824AB34",
+  "A6EB4D0D6D14A42342377C849C41227E858EF3FB8285962F42E546ECAF1D4956"
+  "33603BDA8086D0B6921CEB21",
+  "3E5D8FCFD595BD2EC586B577085F9C0A7D5CCE1150EACEEBB3B45CFA4F300A94"
+  "FBA657E570B619829A69BE75",
+  "3F13735D07352D27DD09931976BA8CB6E52F9ACE8661EFE16488F1ADCC68FE13"
+  "A5ABCC5D1A34F9DEDB019E96",
+  "7979F09DAD5402833B7E367FCFF8F8BB0441A910C524DD978DA2E607EFD4C934"
+  "1C261A514FD68065B1234883",
+  "2CDC0206E5EFF71C65D2D001BE8884F57C6B683DC616C9D24DC999639EF26646"
+  "8BC0550350DE4176F0B4E230",
+  "31DC9B0BAEA57E4CAE59F2957F5FC28A2853CF1DFB14F8DFA44693EFF809672F"
+  "7BAFA6FBDF0D70CCDF0A79BA",
+  "590CC1EF3F4DC3325B731E49CD49DF63CA79619A930C441E1AB427B7E0E11F7C"
+  "9243A9767E773784E991A2E9",
+  "B80F79E42BA52DB393549BA3D8FE8DE3976E398DD5BEF2EEF374B966A5AAFD69"
+  "CC8830F81EF76278FC5CF00D",
+  "86CD84020C97C035FD1E8E8A45C8F8AE414BA522018989298BBE9BF2FF4F3985"
+  "640AC848E019573B539772C8",
+  "05780949CD88CDC5940C408DD9ED28DD912386D437484DBA736EB7B36BB6B747"
+  "47B07BA7F7AEE183E16E0294",
+  "3EA13148C5081F760D367815496AB227D07D43497456B97819E447A4FAFD7BE7"
+  "CDDCF29FD49724E9B1B1E1DE",
+  "8B7D62D552DDD2F8C6B092610B388000213632EE72FA64E91C1F27207EF1B0A8"
+  "A590DBC4F7E99DEC769398CB",
+  "70D6AAA7ACED2073A7D6417A1AD45A721173D31C85502DBA0837B79067B4AE2A"
+  "FBDF7DD54412834377D04053",
+  "3629E5E493B8BEB43F14F9523F28DBB63E03687B43F6BC1679E925FC16600537"
+  "EE51EA181DFD6BCA0478C4B5",
+  "D27D386A570254CC9F4287E33EE9F0873B312C65E94141911B46F81086C172B6"
+  "1834BE5A4067539EF8AFC3EA",
+  "F8CD449C9317C5E1305DF0BBC37643455026FD1D617ADF7F3063B0F4A5D9B674"
+  "86708956567853A2E6A800A3",
+  "78F715744D1D121173C6393738A35F3FBC4C99065E6A2A015DE57ABE4B3C059A"
+  "4777A5B580073D7660C7E025",
+  "AF3D2B301C23E06108544C0F9E08D785CE6C8D33CD74485463490897A3EA92E1"
+  "3ABEDF49BBA2638D0DFF9DFB",
+  "3C97914382F7C1527C581BA09102AF01F39D2875E615AF16E48734F0CB97FB5F"
+  "E93B47F1AD32916391237931",
+  "276E5573D879324AFEC9C0EC221F257522CB68A5DE15A983D25D5387E1182055"
+  "D7F12C7DE642E3081996C31D",
+  "A4AD6A726D9893D7F57489F39A7A8EA5C302CA1C7D3A3817DCB2CDF0F7B566FD"
+  "381EBA1DA26AA52373CBD8A8",
+  "4EED0AD23234C03F81354EF589D294E02F3FF735E1010FA227F62D833337EC05"
+  "1CFC5B4CFB7D004739DCE4C8",
+  "6DD1A95DDD784294613E981CE2FF90B6EC48FE0BFCA39ABF5F85427DE6C6D421"
+  "61734E61C2C1E051925D48DE",
+  "04D8CB03E6D2D878740B844F0BDCA8ADCBCED65AF052454B022DA087E513B080"
+  "1832D7CE8BE6A894C53D9D9B",
+  "A333CEC99F15567614B38FD3BD181C87705B67510BD5701F695E7BA6AFA03AAB"
+  "8060E3924D7A7D1EE5D9FBF0",
+  "4C7120D4CC0251BCE780423F5C082A2A3397F289C50284601F77C597FD0C420B"
+  "D2AF952770A654C7942856FE",
+  "6A68B84F2D1FEE1F4C740E30B183F01E1CD71BE2622C9490DCD947B671870D06"
+  "9D99C89C6813F05D2B61897F",
+  "0F5FB63B3E8848CA4E813E970DC3557B3661D4460D03B986AEACE0941133EFFA"
+  "9E13C4309628164E3A1CD609",
+  "37ACF57989BAFAD6F794036C4E7AB787B31400B0C5644DCFC2FE2172AE54F3BA"
+  "61E60FC4FCA90D21E365FE3E",
+  "D5745681640B85E2D2448D79DC95627FB440A8D8967A3C6D1867E9C0184201DF"
+  "FE0887964D5AE1401DD96E5D",
+  "33D7FBDAD65081BCA6307C8EF9FCD7C2573D6E55F230C06D882FADE5D20F39C6"
+  "5D80611E9BEAF32EB2D1A692",
+  "31447C09E6FDF23E3FBB50850192C621BE8885EE1CE1BC35754F40961E573CB0"
+  "31E2E9F1E5C8D0D2009D4B88D8",
+  "BBAF0E0290770B15BA6090C8C0DA69D2D324F40C94C7BE3FB6D0AA413B3C5EC9"
+  "34DDDCF2DFBAE89687D86A0E1B",
+  "A6EB4D0D6D14A42342377C849C41227E858EF3FB8285962F42E546EC8E227858"
+  "4477201FF3B6A0BFDA80C31A80",
+  "3E5D8FCFD595BD2EC586B577085F9C0A7D5CCE1150EACEEBB3B45CFA9F3BF27B"
+  "BB1513B38D78A563E509590119",
+  "3F13735D07352D27DD09931976BA8CB6E52F9ACE8661EFE16488F1AD42AD3209"
+  "3EC975837C0B87D5FE930BE5AF",
+  "7979F09DAD5402833B7E367FCFF8F8BB0441A910C524DD978DA2E6070A8922EE"
+  "BB2F659C5ACABCE4EC209B1FC3",
+  "2CDC0206E5EFF71C65D2D001BE8884F57C6B683DC616C9D24DC99963A11D2879"
+  "650AFA9086F92EAF43B22E2CE9",
+  "31DC9B0BAEA57E4CAE59F2957F5FC28A2853CF1DFB14F8DFA44693EFB53F2973"
+  "7B3F847FFE57FDA5B0E5CFF7F3",
+  "590CC1EF3F4DC3325B731E49CD49DF63CA79619A930C441E1AB427B784966C48"
+  "22D2CBC44101668ADD23EC3D7D",
+  "B80F79E42BA52DB393549BA3D8FE8DE3976E398DD5BEF2EEF374B96621BBD6EC"
+  "B3EE0F0BDC31C7135DE76A4CC9",
+  "86CD84020C97C035FD1E8E8A45C8F8AE414BA522018989298BBE9BF21AA1F9B4"
+  "2EF4D87517C7301FB869AC00D9",
+  "05780949CD88CDC5940C408DD9ED28DD912386D437484DBA736EB7B3EAB47748"
+  "ACC782A3C107E8F21883B782D9",
+  "3EA13148C5081F760D367815496AB227D07D43497456B97819E447A4535EF545"
+  "F39B8303B562234BA4D674433D",
+  "8B7D62D552DDD2F8C6B092610B388000213632EE72FA64E91C1F2720E6021946"
+  "4F63E3DE73310DE70CFD1ABDBC",
+  "70D6AAA7ACED2073A7D6417A1AD45A721173D31C85502DBA0837B790218C22B4"
+  "6F65B246E5F885AC8B931182EF",
+  "3629E5E493B8BEB43F14F9523F28DBB63E03687B43F6BC1679E925FCD5279A95"
+  "7EAF858415B989BA9793A9AD03",
+  "D27D386A570254CC9F4287E33EE9F0873B312C65E94141911B46F81057002E4C"
+  "4C5FB0773ED1776EBAC1D1C827",
+  "F8CD449C9317C5E1305DF0BBC37643455026FD1D617ADF7F3063B0F458C226AC"
+  "96A5A599CF35DE41F862C001E2",
+  "78F715744D1D121173C6393738A35F3FBC4C99065E6A2A015DE57ABE15B9374F"
+  "6E46D826512E0AA6688E150EAE",
+  "AF3D2B301C23E06108544C0F9E08D785CE6C8D33CD744854634908976FB5EA1C"
+  "25D5D7917D720324311B514E3A",
+  "3C97914382F7C1527C581BA09102AF01F39D2875E615AF16E48734F0FDF558D2"
+  "E190C25705243626AF62460298",
+  "276E5573D879324AFEC9C0EC221F257522CB68A5DE15A983D25D5387A34076C8"
+  "D6BF1716A43D41B02AEE021A53",
+  "A4AD6A726D9893D7F57489F39A7A8EA5C302CA1C7D3A3817DCB2CDF0C74CD9EE"
+  "4F7D5654BA7233687584B2198E",
+  "4EED0AD23234C03F81354EF589D294E02F3FF735E1010FA227F62D83B6C647A1"
+  "B779D3110B7C701C77DD4E74B6",
+  "6DD1A95DDD784294613E981CE2FF90B6EC48FE0BFCA39ABF5F85427D81A31E0E"
+  "16F98DED00BA6C3E75757B2051",
+  "04D8CB03E6D2D878740B844F0BDCA8ADCBCED65AF052454B022DA0872FAF8BB9"
+  "E0D10676F693730394BB4F3909",
+  "A333CEC99F15567614B38FD3BD181C87705B67510BD5701F695E7BA62F882489"
+  "433A695BC244B0E54E716FDABA",
+  "4C7120D4CC0251BCE780423F5C082A2A3397F289C50284601F77C597959A0D97"
+  "64CEB7B25401ADDEAE50E11112",
+  "6A68B84F2D1FEE1F4C740E30B183F01E1CD71BE2622C9490DCD947B6C9F6EA2D"
+  "A20B0637AA3515E1FD517188AF",
+  "0F5FB63B3E8848CA4E813E970DC3557B3661D4460D03B986AEACE094E908C140"
+  "ADE9A6A1837720E7CEE69AF935",
+  "37ACF57989BAFAD6F794036C4E7AB787B31400B0C5644DCFC2FE2172A9042CF9"
+  "97ABEB2664CD1615EF8363FCE3",
+  "D5745681640B85E2D2448D79DC95627FB440A8D8967A3C6D1867E9C027B13CC2"
+  "EC3C8EE1C02BD9CA8061565CAE",
+  "33D7FBDAD65081BCA6307C8EF9FCD7C2573D6E55F230C06D882FADE5B0D1B964"
+  "8E3A17AAA6C04DBE4FE3981D23",
+  "31447C09E6FDF23E3FBB50850192C621BE8885EE1CE1BC35754F40961E8C00EC"
+  "B7AA3AFF0F4058EA51AFECB22053",
+  "BBAF0E0290770B15BA6090C8C0DA69D2D324F40C94C7BE3FB6D0AA413BBC656B"
+  "83E5D249B0EBCF434CE801912C55",
+  "A6EB4D0D6D14A42342377C849C41227E858EF3FB8285962F42E546EC8E0691C6"
+  "D2632FD788E7A9C236D7B6BF0FC9",
+  "3E5D8FCFD595BD2EC586B577085F9C0A7D5CCE1150EACEEBB3B45CFA9F9421C5"
+  "85872B3B1ED4615A4AA2C7E32ECC",
+  "3F13735D07352D27DD09931976BA8CB6E52F9ACE8661EFE16488F1AD420BF872"
+  "1D128C4CB33E4198C8AFD225C11D",
+  "7979F09DAD5402833B7E367FCFF8F8BB0441A910C524DD978DA2E6070AE790DB"
+  "5795163567D57C9F70BFA057D806",
+  "2CDC0206E5EFF71C65D2D001BE8884F57C6B683DC616C9D24DC99963A1A39B50"
+  "1F9BF0E9DE6D723F28EC868257E7",
+  "31DC9B0BAEA57E4CAE59F2957F5FC28A2853CF1DFB14F8DFA44693EFB5A171A3"
+  "4B553B7F70FC0EAF9E0D690885A8",
+  "590CC1EF3F4DC3325B731E49CD49DF63CA79619A930C441E1AB427B7844EC5B2"
+  "D63C84B4C877A4E04379099C8254",
+  "B80F79E42BA52DB393549BA3D8FE8DE3976E398DD5BEF2EEF374B9662147F803"
+  "224C223BB3CE2A74017F59AF24CB",
+  "86CD84020C97C035FD1E8E8A45C8F8AE414BA522018989298BBE9BF21A78C5F2"
+  "BD9E0D30EB2FD62FEAE205F1F3AF",
+  "05780949CD88CDC5940C408DD9ED28DD912386D437484DBA736EB7B3EA7E2FEE"
+  "DD735219F11B58036F96FE83EE1D",
+  "3EA13148C5081F760D367815496AB227D07D43497456B97819E447A4532616B3"
+  "6C5B145C03DE542826FB5256F5B9",
+  "8B7D62D552DDD2F8C6B092610B388000213632EE72FA64E91C1F2720E6558387"
+  "CC536BEA8FF115DBD11F24F65F2B",
+  "70D6AAA7ACED2073A7D6417A1AD45A721173D31C85502DBA0837B79021CB54B2"
+  "8AA53593E23FFF81C743553A4B5C",
+  "3629E5E493B8BEB43F14F9523F28DBB63E03687B43F6BC1679E925FCD501E2D6"
+  "A3B8AC7A58E19F0038AC41EB0776",
+  "D27D386A570254CC9F4287E33EE9F0873B312C65E94141911B46F8105770AB28"
+  "9FE5F515CCF9878D989E4F77E1AD",
+  "F8CD449C9317C5E1305DF0BBC37643455026FD1D617ADF7F3063B0F4588B71F2"
+  "25A1968FB97445FB5A80845A9F32",
+  "78F715744D1D121173C6393738A35F3FBC4C99065E6A2A015DE57ABE151C8A59"
+  "87D6705C2660422D3BFE74F20122",
+  "AF3D2B301C23E06108544C0F9E08D785CE6C8D33CD744854634908976FF3FC55"
+  "C197D9AC3FCD974D8116414919C7",
+  "3C97914382F7C1527C581BA09102AF01F39D2875E615AF16E48734F0FDEA1459"
+  "E06491878672E5E5926D90A75BFF",
+  "276E5573D879324AFEC9C0EC221F257522CB68A5DE15A983D25D5387A30325D1"
+  "8E568CC440B272A08740C40012DA",
+  "A4AD6A726D9893D7F57489F39A7A8EA5C302CA1C7D3A3817DCB2CDF0C70D2460"
+  "DC369FF494CEFB31910D4983FC4E",
+  "4EED0AD23234C03F81354EF589D294E02F3FF735E1010FA227F62D83B6A22119"
+  "17F7AA20CE5CE7A8A3AC7876AA15",
+  "6DD1A95DDD784294613E981CE2FF90B6EC48FE0BFCA39ABF5F85427D81095078"
+  "14D20818973EB909F187D184ADC6",
+  "04D8CB03E6D2D878740B844F0BDCA8ADCBCED65AF052454B022DA0872FDB0D2F"
+  "59F9B5AD91945FF286758EEA36A9",
+  "A333CEC99F15567614B38FD3BD181C87705B67510BD5701F695E7BA62FDFC86A"
+  "DF062ECA99453972A5B70580A96B",
+  "4C7120D4CC0251BCE780423F5C082A2A3397F289C50284601F77C597959BF504"
+  "169A6CFE002962EDAB41DE920539",
+  "6A68B84F2D1FEE1F4C740E30B183F01E1CD71BE2622C9490DCD947B6C9C13734"
+  "AAC5C9B6B585BEC5768EEDCC58BD",
+  "0F5FB63B3E8848CA4E813E970DC3557B3661D4460D03B986AEACE094E98EDFFA"
+  "CE33360A1F01C725A92DA7B863FB",
+  "37ACF57989BAFAD6F794036C4E7AB787B31400B0C5644DCFC2FE2172A9CF6FA1"
+  "F3ECD60763DE40E7180365B98666",
+  "D5745681640B85E2D2448D79DC95627FB440A8D8967A3C6D1867E9C027C6D5D5"
+  "E84A891A1C4DA4D208DB636AB56B",
+  "33D7FBDAD65081BCA6307C8EF9FCD7C2573D6E55F230C06D882FADE5B010F456"
+  "3C1BBB57FB807E7A655590A7E85A",
+  "31447C09E6FDF23E3FBB50850192C621BE8885EE1CE1BC35754F40961E8C3922"
+  "42E03642D5C0E7BB9614E313E8C90A",
+  "BBAF0E0290770B15BA6090C8C0DA69D2D324F40C94C7BE3FB6D0AA413BBCDFE0"
+  "938AB7DC2F60DF4A8895649834D1A1",
+  "A6EB4D0D6D14A42342377C849C41227E858EF3FB8285962F42E546EC8E066DCD"
+  "74B59D5D3D782A615524F9523FFE4D",
+  "3E5D8FCFD595BD2EC586B577085F9C0A7D5CCE1150EACEEBB3B45CFA9F94693A"
+  "A3EF25E5F68C22FB265761191003A1",
+  "3F13735D07352D27DD09931976BA8CB6E52F9ACE8661EFE16488F1AD420BDD31"
+  "8BC68221E10502F76A1F538217BF5F",
+  "7979F09DAD5402833B7E367FCFF8F8BB0441A910C524DD978DA2E6070AE786F7"
+  "1FDAF74A25F20BDF0D87B599110B58",
+  "2CDC0206E5EFF71C65D2D001BE8884F57C6B683DC616C9D24DC99963A1A3E5A3"
+  "7998362A268C11FE949478157BFC24",
+  "31DC9B0BAEA57E4CAE59F2957F5FC28A2853CF1DFB14F8DFA44693EFB5A12D8D"
+  "682AE827915AADB3D336D49F3285D1",
+  "590CC1EF3F4DC3325B731E49CD49DF63CA79619A930C441E1AB427B7844E469B"
+  "A9CE5E880DC9217F41E81C13AEAE96",
+  "B80F79E42BA52DB393549BA3D8FE8DE3976E398DD5BEF2EEF374B9662147DA75"
+  "DF9D0EBFB885AADB574665B3040A5F",
+  "86CD84020C97C035FD1E8E8A45C8F8AE414BA522018989298BBE9BF21A786FD6"
+  "E959DDE9B037195471531875507088",
+  "05780949CD88CDC5940C408DD9ED28DD912386D437484DBA736EB7B3EA7EB033"
+  "B03A58A92AB34EB4FAAAB8EA7B5AAF",
+  "3EA13148C5081F760D367815496AB227D07D43497456B97819E447A45326D22A"
+  "F81C6B342E7A5B690CD1D84BF867F8",
+  "8B7D62D552DDD2F8C6B092610B388000213632EE72FA64E91C1F2720E6550B63"
+  "466C4751FE0007811FD26902E16010",
+  "70D6AAA7ACED2073A7D6417A1AD45A721173D31C85502DBA0837B79021CBB2B3"
+  "2B1D08037BF1B58647A167F4502887",
+  "3629E5E493B8BEB43F14F9523F28DBB63E03687B43F6BC1679E925FCD5012435"
+  "8FE3127B0289267CC55D829B8DFFB4",
+  "D27D386A570254CC9F4287E33EE9F0873B312C65E94141911B46F8105770760E"
+  "9C4AE73044E5E27F086AA0BD60484F",
+  "F8CD449C9317C5E1305DF0BBC37643455026FD1D617ADF7F3063B0F4588B7CDE"
+  "C736C4B53AEE9A3D79F703DE7D3379",
+  "78F715744D1D121173C6393738A35F3FBC4C99065E6A2A015DE57ABE151C433C"
+  "FBC5FD8DBF8F803D858A25A81962E9",
+  "AF3D2B301C23E06108544C0F9E08D785CE6C8D33CD744854634908976FF3ED52"
+  "18EE21874FB845101AA11965D2C524",
+  "3C97914382F7C1527C581BA09102AF01F39D2875E615AF16E48734F0FDEA4205"
+  "8247038A86F99E41E757DCDA9FD430",
+  "276E5573D879324AFEC9C0EC221F257522CB68A5DE15A983D25D5387A303CACA"
+  "F45CE1CF54AB2C56B4F507B4A64D9E",
+  "A4AD6A726D9893D7F57489F39A7A8EA5C302CA1C7D3A3817DCB2CDF0C70DCAD6"
+  "DDA91334315C5C0A58B364BD37C45C",
+  "4EED0AD23234C03F81354EF589D294E02F3FF735E1010FA227F62D83B6A225D9"
+  "1712A4351C2816C3A334EB1999865B",
+  "6DD1A95DDD784294613E981CE2FF90B6EC48FE0BFCA39ABF5F85427D8109047E"
+  "6C5007773ADE881C6CDA56B24945B6",
+  "04D8CB03E6D2D878740B844F0BDCA8ADCBCED65AF052454B022DA0872FDB675C"
+  "E7AE3700829E792C7C74CBBC94BA10",
+  "A333CEC99F15567614B38FD3BD181C87705B67510BD5701F695E7BA62FDFA3DF"
+  "FE4B6F1466FFAB3ECFA19851087F6F",
+  "4C7120D4CC0251BCE780423F5C082A2A3397F289C50284601F77C597959B78B0"
+  "ED5E9A79C9BD6AA57E5E7D20A434C1",
+  "6A68B84F2D1FEE1F4C740E30B183F01E1CD71BE2622C9490DCD947B6C9C1EFCD"
+  "0814B88C84AB946C9D55EE32B01C35",
+  "0F5FB63B3E8848CA4E813E970DC3557B3661D4460D03B986AEACE094E98E6538"
+  "523B20297D7BA59D4DE88FB13C8752",
+  "37ACF57989BAFAD6F794036C4E7AB787B31400B0C5644DCFC2FE2172A9CF44BE"
+  "B8142242EFBFD5EE85FC82FD4E669A",
+  "D5745681640B85E2D2448D79DC95627FB440A8D8967A3C6D1867E9C027C6D846"
+  "05EA72DD2C1006287319CFBC24AA5D",
+  "33D7FBDAD65081BCA6307C8EF9FCD7C2573D6E55F230C06D882FADE5B010626D"
+  "C21447E0C270B6A4B712E657262065",
+  "31447C09E6FDF23E3FBB50850192C621BE8885EE1CE1BC35754F40961E8C398D"
+  "2C97794A90E25961AFA08093E47D08E1",
+  "BBAF0E0290770B15BA6090C8C0DA69D2D324F40C94C7BE3FB6D0AA413BBCDF7F"
+  "92065BC0CF2AB853D8272BA70A3E53B0",
+  "A6EB4D0D6D14A42342377C849C41227E858EF3FB8285962F42E546EC8E066D41"
+  "99D1EF055EE0AE10E7E893CB240E5B14",
+  "3E5D8FCFD595BD2EC586B577085F9C0A7D5CCE1150EACEEBB3B45CFA9F9469E4"
+  "D0D5B708FA9035689D206E8215A22986",
+  "3F13735D07352D27DD09931976BA8CB6E52F9ACE8661EFE16488F1AD420BDDE6"
+  "EBC2254B58DF0635B80D869155797A99",
+  "7979F09DAD5402833B7E367FCFF8F8BB0441A910C524DD978DA2E6070AE786AF"
+  "EE457EA39642557B23F66EA57B093044",
+  "2CDC0206E5EFF71C65D2D001BE8884F57C6B683DC616C9D24DC99963A1A3E5B5"
+  "56F723F0AF052A8227BBFAFFEC7ABA18",
+  "31DC9B0BAEA57E4CAE59F2957F5FC28A2853CF1DFB14F8DFA44693EFB5A12D88"
+  "D2C0FCB70187B68E043C619D0E931C30",
+  "590CC1EF3F4DC3325B731E49CD49DF63CA79619A930C441E1AB427B7844E461A"
+  "E27A48C03298D964FCF526F4B5632ACE",
+  "B80F79E42BA52DB393549BA3D8FE8DE3976E398DD5BEF2EEF374B9662147DAEB"
+  "F76843E94BF71F545DFD02CFE11C0787",
+  "86CD84020C97C035FD1E8E8A45C8F8AE414BA522018989298BBE9BF21A786F09"
+  "0EB51271FC09D042ED9C1B209BB7909C",
+  "05780949CD88CDC5940C408DD9ED28DD912386D437484DBA736EB7B3EA7EB025"
+  "E6468B7B0E3AE61DBC8398477341B90D",
+  "3EA13148C5081F760D367815496AB227D07D43497456B97819E447A45326D2AB"
+  "D8783E49FCBD60240DDA194FD80F69EB",
+  "8B7D62D552DDD2F8C6B092610B388000213632EE72FA64E91C1F2720E6550B82"
+  "75D8DD4C45441C5A942732A81B8DBF3C",
+  "70D6AAA7ACED2073A7D6417A1AD45A721173D31C85502DBA0837B79021CBB201"
+  "6354B6724B7E888ACB4073BD9D087528",
+  "3629E5E493B8BEB43F14F9523F28DBB63E03687B43F6BC1679E925FCD5012439"
+  "F0C3B11B41E50CBCEDA7EE989478BE6A",
+  "D27D386A570254CC9F4287E33EE9F0873B312C65E94141911B46F810577076D4"
+  "FCFB55F8D3329A94F475C255E8B070C8",
+  "F8CD449C9317C5E1305DF0BBC37643455026FD1D617ADF7F3063B0F4588B7CAE"
+  "C20EC2209AC03811945271C16F8A1F36",
+  "78F715744D1D121173C6393738A35F3FBC4C99065E6A2A015DE57ABE151C4323"
+  "759A180C0B24AF074AD0AC282D5B97ED",
+  "AF3D2B301C23E06108544C0F9E08D785CE6C8D33CD744854634908976FF3ED98"
+  "06C328417971FC5BAA730AEE8C073FDF",
+  "3C97914382F7C1527C581BA09102AF01F39D2875E615AF16E48734F0FDEA4261"
+  "EFF9544B39290EC83E8EA66C590FBD71",
+  "276E5573D879324AFEC9C0EC221F257522CB68A5DE15A983D25D5387A303CA04"
+  "3EE55CE9884B4A3F0FF8B05D05EDD33E",
+  "A4AD6A726D9893D7F57489F39A7A8EA5C302CA1C7D3A3817DCB2CDF0C70DCA44"
+  "00A8F0E9418A4F82B55460191BCBBA93",
+  "4EED0AD23234C03F81354EF589D294E02F3FF735E1010FA227F62D83B6A22548"
+  "86891FE6B7AD815859EB507D018A62AC",
+  "6DD1A95DDD784294613E981CE2FF90B6EC48FE0BFCA39ABF5F85427D8109049C"
+  "99FB883E6AB1B5F651E88439571A94E0",
+  "04D8CB03E6D2D878740B844F0BDCA8ADCBCED65AF052454B022DA0872FDB673A"
+  "9ECC5180B0509EAAF092448C7C730B1D",
+  "A333CEC99F15567614B38FD3BD181C87705B67510BD5701F695E7BA62FDFA34A"
+  "374E0EAFBA3349DFABA823EFE7CFC395",
+  "4C7120D4CC0251BCE780423F5C082A2A3397F289C50284601F77C597959B7848"
+  "BDD3ECE2F6B1C6ACDAE941AB657D5EF1",
+  "6A68B84F2D1FEE1F4C740E30B183F01E1CD71BE2622C9490DCD947B6C9C1EFBA"
+  "E54184568719303B6A98E6272FC5440D",
+  "0F5FB63B3E8848CA4E813E970DC3557B3661D4460D03B986AEACE094E98E6531"
+  "0616C46EEF7AC49C5DADD686D7F14615",
+  "37ACF57989BAFAD6F794036C4E7AB787B31400B0C5644DCFC2FE2172A9CF4454"
+  "CD26CB2960D8D36A4A8829BA84C8FD49",
+  "D5745681640B85E2D2448D79DC95627FB440A8D8967A3C6D1867E9C027C6D8E3"
+  "C896917BE10A217279F974865796C19F",
+  "33D7FBDAD65081BCA6307C8EF9FCD7C2573D6E55F230C06D882FADE5B01062DB"
+  "43206E02D43443600BE2C1FB1EE65BD9",
+};
+
+// Photon-Beetle-AEAD[128] cipher text || tag ( `CT` )
+constexpr const char* AEAD_128_CT[AEAD_KAT_CNT]{
+  "DF4E0BAC1162408098FA5CF084D8F464",
+  "E840449949081C5378E01EBA6046DBE8",
+  "9535FE42756917B946D74128639AA8A7",
+  "9378FABDE25D64D50106561F4AED8912",
+  "AD9DE4136D90BD0ADF363E0EDF32A729",
+  "76798192DD9ACF72686CFF5FFC297733",
+  "DB57E61B4AFB2C2590966CEB67848F57",
+  "0EE1876A4CC8B0631504783AE912BB46",
+  "7CBD43199262BCC8859E32793BAC995E",
+  "2C5A2F05F4A633BB1E4C100915CEC85E",
+  "3E70FB74E9855F62E62A461C533A1204",
+  "27FF47336AE74662C243A88C6A5F61B6",
+  "8D83BBD3C4490F9070AA2EDD0DFCE6AF",
+  "E7CB6D4CDD1C151C61C721E74D11A471",
+  "F1E4677E00769D62D7C6CFF796C8C58E",
+  "7EF94D2653FE5D10045DE8EE8CDE92A5",
+  "DE51F3E73E23658A8BAABE65E06EDB62",
+  "462550EB3B287C5FBAF28A755210F551",
+  "CE6B203CE690E8585B03BBD7D73AA5FC",
+  "6EE631E2F5688A886998BEA519479D81",
+  "E5963425E55041565661C4C2444D4594",
+  "4643F0313C40F4F67DBE416F5768CD32",
+  "722871C5F1019EFFEA8F24E7EF536D92",
+  "5500AE78954A75B6ADD0F9B375294C6C",
+  "6310E6AE94FEAEB0692B634BDABDEAF2",
+  "0A649F551F0AD8129A3382CBD7982EBC",
+  "A5E75C1C74A3D29A17A4ADF21F79846F",
+  "5192932EDD51C07FC75520DAC1417EC1",
+  "0F317E90EAE68519E5DDDDEB47593F4D",
+  "90B37634962E399EC627D8A5AD799413",
+  "FCADA8FFFA5884B03EA1591E153CD77A",
+  "0A95AD8B576D4A5B4D9D0568C9D470A5",
+  "7710409DE6CBEBB3C480A2D583DCBB73",
+  "A75DF91EA594D719D44F29E78E0AE94872",
+  "850D8807C20344C924E2D35382DD3F2D8E",
+  "6111644893711420563D69317CE0B009D3",
+  "F44A47953028CFAD50807C6AE9C22C71DB",
+  "FC67B9484A3730EAA84379DA2001E480C5",
+  "B2861305BC1BD4E79B390B1157F1C15177",
+  "F04390064F0F2415BE78D35334487FD465",
+  "FC3F6A2A13DFCF1ACD1219764ED5F5BE35",
+  "B2964BC07F72E4D6E6350F5FB95D403DB9",
+  "65B5223B7CA6F6D0ACEB171A22618D99C9",
+  "E56DC68C35F8366D9A1FF104E76B7592EE",
+  "6860E37AF9264DB21DDC34A4335CA2768A",
+  "D0F89FD27D5CAD045749533E33EF3E0334",
+  "837D4048369054901C86D9428C81BBE8D3",
+  "5C08A3C4F28E5C8F6FA7A4565B81D58A06",
+  "4B723D84C90D46C09EC4E701763A505A3F",
+  "87ACAF9C058BB0EF9FD10C92DFA4D140B5",
+  "9D52B2C6544C629EE17DC6C3E4B1452FC4",
+  "C20DCD8AAC4875113B677A99DCF52350A1",
+  "07CC38D5A0C839E33BB623BEA8F174C49B",
+  "674B46CD12638758B04B1AA71D8DFDE8C9",
+  "9602B696D6EF0D5A9F4C4A4A44E69153EB",
+  "E77943D5589C7166C704B68B8B5E7CDDFD",
+  "C9C7FCCEE543D483328B71B0EF34BB8B99",
+  "948C613CF47825464A4D0A0B59004D997C",
+  "3971B6DB47E6EC7C9398B5DE0040AC5BDE",
+  "3A1C1B6216B07B21B2130CF718E97F6E45",
+  "51DBFD0DFE572B92A224E81A69430007D2",
+  "2C8D7B9DD9BD6293771822B0CEFACEACAA",
+  "037EC2583A5081B5A6E5FC809C30EE19B7",
+  "8CD95F10B48AC4A41C737392FF8D05D1BE",
+  "DA51744000DC014EAF0CE8ECFE76BE8B11",
+  "29F24F7DECB7C4B95A9ABF11DF64DB64BE",
+  "A7B95642BCAE4AB7FB274E3502B1CABB6456",
+  "856B1B172140D0D060F0E6346FBC0E12088A",
+  "61F28A3E70875191E620C86221D9687210C4",
+  "F47AEEBA1306F99D7646603A578490B66F9F",
+  "FC03A49A66BF8412B372A90ACBB3FCB04C91",
+  "B26BDEE55816EBBF0752C6ECACC3352560BE",
+  "F04AA5750D444166C1E2FDA003EEDF17DEC7",
+  "FC232601E74DFF5E3B01AE803242A968BC3D",
+  "B22155FA8E52074061E70EB32684B87854C3",
+  "65206BEABF778F64E09EE6C9CBBB16BB5C80",
+  "E5C7ECC35E16B07BE38103C8CB2B0463FCC3",
+  "687B0ADBA669474A7FD8543F05AFAD9CD052",
+  "D02A52618837C89A85AC75C6A26F4F07EEA2",
+  "83F68FFB30662A78B4464C246332E882F3CB",
+  "5CD44C6EF079C53DDF0EFCCF1F145086A2D0",
+  "4B5BDCEF5523AAA434229DCCC71ABFF8892C",
+  "8796367C370E049112FF6B7FA01924A05993",
+  "9D20E3E1C44AD50954AB930F8846462A1FE3",
+  "C2550BF54E789336A585295E8D1957ADE7ED",
+  "07E5C8A5C18A3C7C4B17BB3054260170D8C3",
+  "67013D0F88F2A4A5084D2C4BEA323B199B32",
+  "9608CECDBD9D172FAE8E55CF73A7C68A6BC9",
+  "E7E60C01BCBEA6451E59922CA461050CE502",
+  "C9DF1DC7B3FF69E9A266914B95C9DDF9079C",
+  "9410AE432D9A5D8F99B871EE3A515CF5C8E5",
+  "395ED7C32327FAB0677A82FA16249F06F7EF",
+  "3A2AC11A8AC601CFE1CAAC4C6DE2799DF1EA",
+  "51C18E8065AEA3CD4E79AC7A80818FA63385",
+  "2C18A16AAB0D80317E1C1511A1AAC2B8E417",
+  "0327E4D1304BEF9B928E24F08FDEAC34223D",
+  "8CB4AF072B886749B8A492D28590DE4A5825",
+  "DA78A1A98D79826D97A44708375B3AED1B41",
+  "29BBC3439A1220631A94B014F2A9C2664205",
+  "A7B9AFF95BDB66F5E8C92C3F604E2EE9C1829D",
+  "856BB7A1D138C5DD90B1358706F26ED88E8E21",
+  "61F21F12081D7FD48DFAB9080D71A1FB583AB2",
+  "F47A27CDA00509EE8F67D5B4A17C3C3BAC943F",
+  "FC03113B6D8ABFE45B2C387867228B05D4E477",
+  "B26BC1C9F7C01883261361E1D317794F1123EE",
+  "F04A6083DD14BEC4819C4DBA2591DE06E7C76C",
+  "FC23B45E341FECB372279842AD7778379FA4EC",
+  "B221264D1149475BDAAC3011D3871FB8E71D56",
+  "6520782C8B89E89BBE808ED96D55BFFF31D69D",
+  "E5C7211B70561D632F18DD232E9D37622F6F62",
+  "687B6B55861A0F3F32FD72A2ECEB481E2F1304",
+  "D02AF89613EC698DFE29F9E9275AC7163AF55C",
+  "83F68D6871768569E604CE97FD8DB213DA6F2F",
+  "5CD4CC2CB65BC3DFD0127AA4149759B922E9DB",
+  "4B5B4AB44ADA5043FB8D3FE2878E8BEAADBF04",
+  "879666AC096B27CDCAB6C0823A7416DD960334",
+  "9D20AC7E70AC03D5B0A8928E02D792DCC74B70",
+  "C255387FA02FDCC4DA86B2C2233E3174B7DCB1",
+  "07E5041B0925394133CD10ED6E3A70B667D519",
+  "67019CFE1F8CD6442B2532154B914417CD6FE2",
+  "9608EF89730A5A2DF20F530A387E656DB9E644",
+  "E7E69C11F87FC021416FD5A636BA0E922FF853",
+  "C9DF963E4CED4707264822D922D4804B62C3F0",
+  "9410374AB9F1FDCE8A4CCCC30486AC91433F63",
+  "395E5B13E68E8F81157158A48BF8D81F72D3A2",
+  "3A2AFB010EC92F9F3A673574E3C7AE6DD12C08",
+  "51C19FE42FCF593419ABCB3D7A04DF285E4F74",
+  "2C18D62A0624874C7BB07C794720B97268FF0B",
+  "0327BF7DEDE422BF8A27A2F4EAE05ABFAF1D69",
+  "8CB4ED5DFE7E582E9E74ACC2A9516BA1948326",
+  "DA7853DC52FE2D4C181138A4055D14F8D003EB",
+  "29BBCDDBCCEFD131AE4F7992B915EDC5C4A865",
+  "A7B9AF5B45A35DEF05EEF937EE4E9C54E207A870",
+  "856BB76CA4AAA409D5288CD656356FE928E2680A",
+  "61F21F523EA6BA69500B1969B0021ED4B8076BD4",
+  "F47A27A72103C492487FCD7FD0437A91E5CB3977",
+  "FC03119985F8C5AAFADA4DCA6B3AB1BC6090F398",
+  "B26BC1BBBE3DA61A957CD50F7F8C884F4599CA60",
+  "F04A60FD8D4A7CFBEF5101CE7455369C85D684D1",
+  "FC23B4932EE7CD11E9FED3782ED97C991FF44031",
+  "B2212662D9BEE22C33E153E23DEC50E6CEDCDEDF",
+  "652078D9D858DA0ED9CF1A572EA0ED88789522B4",
+  "E5C721E660A3082C0611FF159808B0158692BD98",
+  "687B6BFDB3B760BAD1738BF62862BDE16B48E4D7",
+  "D02AF8F3C336B61B5374E2DF6495955C652C21D4",
+  "83F68DD5B6F25D907547CF6B547CB5B881CB5E73",
+  "5CD4CCECE740451681DF62C493E539DF6FA7299F",
+  "4B5B4ABDFD11C947D0183BAEA1DD6F0A675FF628",
+  "87966607D632A403E261272E3514ED5F794BADF4",
+  "9D20AC68418D942708D085E88DDDBA3D649BC7D7",
+  "C25538F26D17AE52D9912DD3E174B7E7E3A11BDF",
+  "07E504971A7FB80811675C52D4FFDFCC4A141774",
+  "67019C519176288F7126829A593A4A655ED1A9A4",
+  "9608EF5139386710044559724910418CF4565DFF",
+  "E7E69C3D959D096DD624384E8E3A28421DA830EB",
+  "C9DF96FE50F636349AB435BEAABD0DB3AFE4A9A4",
+  "9410378924CABEAB7708E2EFE0716B612D84B89E",
+  "395E5BEFA31DF516E55B442AFF253D0C137D4E4C",
+  "3A2AFB91F9F99057F8AFD8F145C037980E6873F1",
+  "51C19FE59C0587B0736D635105BBD9D38750E434",
+  "2C18D666BA0DE11B4018DF191998B9701207D701",
+  "0327BF8FFC02A6FDCF32D0839B184D7CB942B540",
+  "8CB4ED0522987D203E2429B88434EEE898CBBD82",
+  "DA785398F1C43DD5996570870CBF3CD9EA1EA1D7",
+  "29BBCD6BA3B2F8BD560F80417E870AE4C603B529",
+  "A7B9AF5BA1E3662C4D14F0F003FD215DE4ABE7F8C1",
+  "856BB76C83AA70D17F970D1648F88541418AACEE58",
+  "61F21F52F7055775C93099CDAA4A6C8EAEFDD85158",
+  "F47A27A733F5A797868D1AD1DA4FA5B68E951944A6",
+  "FC03119911C0EC02DF3E35FD530B33FDA1BB0A6FEC",
+  "B26BC1BB0ABEB467D0FDFDA68E6BB53450C4AEBEE3",
+  "F04A60FD57F84DB162C6985239928EACD8DEAF2AEF",
+  "FC23B49327C0203B23AAFD344E3FF87AC1EE4CDF64",
+  "B2212662BE42A497D0703CB2375E4F3779CD2079CA",
+  "652078D90713D1FD3989C6CC7079529E8CA2AF779B",
+  "E5C721E616802E3A645963271D949C6BDC5FA6FE1E",
+  "687B6BFD38F5D4CC44F398B939C2E902FD567B3A6D",
+  "D02AF8F31CC483CC5B3E7D8892B3AE5B1AD1279BDF",
+  "83F68DD5B193B7B45F4ABDCC84058416A55CE0729C",
+  "5CD4CCEC248EDE0D2A597D7CEED29351F99A5364A7",
+  "4B5B4ABDFB1F1FADE341EEBA1889186F97F8AFDCD9",
+  "879666073F60289F44FF57D8BF5FBDE0975778840C",
+  "9D20AC68C3032016914B30DBE8BF61CAE953419A2B",
+  "C25538F29C72BD0787C176E972FFBCE57821923163",
+  "07E504972B455CEF1E6F1A1680494BB5B072A8D211",
+  "67019C517BCAAA58C0E13DAD888E0ECFAF75EFFE97",
+  "9608EF51279B366DD9E0F874CFA19695497BE10579",
+  "E7E69C3DCF9212036A10C70B487CA3C806E8CEFAFE",
+  "C9DF96FEB7F11113694E1ABC7F500A699110D86041",
+  "94103789DEE9726474841C8EF434B3A7B027F92E43",
+  "395E5BEF85588E8AEE13C3D33D4A90E815019ABECC",
+  "3A2AFB91AB82D011A2C2436B5EBA7AC549C44902E4",
+  "51C19FE51C12E18F6CCE650B9165135B751B6BD9A8",
+  "2C18D66649DFDB28931E8451A3356C94BB4B903D81",
+  "0327BF8FB3C2FE5D8D9CAA9DA2E3BA065A213EDC1A",
+  "8CB4ED059F9CD244214CD42D55B11BB9D9C1798BEF",
+  "DA785398E944989057918A1750669EBD66C87BF624",
+  "29BBCD6B33E9F48F2DA7C324EE7E342E92A1DF8447",
+  "A7B9AF5BA1AA4CB9D0C52E23D03547CDB7CEA42BD595",
+  "856BB76C830358FC70A792004AAE93351222D87E4231",
+  "61F21F52F7347B2EFB832C698F5E93E7434F74F4CE21",
+  "F47A27A733CA1154DE8C4C4B4A70BBF066ED65CB047C",
+  "FC031199111E215D585A3805D55D94C88BD883BA8811",
+  "B26BC1BB0ADA76C1842E8E944CC97175231CB8151C50",
+  "F04A60FD5774FE079E18C87E5E8AF94EA6595878C544",
+  "FC23B49327728CDF053DF4E3749417325783AA341136",
+  "B2212662BE9FD156584E1AA7207B25BB10BCBA8DE8F0",
+  "652078D907418419CBBC144B3FD82C9D786E2BAD8467",
+  "E5C721E61695C12F81A2F7C1EBF587DE5BDB80373965",
+  "687B6BFD3807DFD59B510052022A4A7A31C6F1527469",
+  "D02AF8F31CBB244C3D5D54626EBE5837196CF55B3953",
+  "83F68DD5B1DF7A378AB307B6C8954E8246FDE15178DD",
+  "5CD4CCEC248A34B17FD2B5D7D2DE4B2B42AA5564DFC4",
+  "4B5B4ABDFB2BAEDC8B9CB5C5DA663423D24E3972A2DD",
+  "879666073F6C38D1646BF9D6749668F9DAA595F36B43",
+  "9D20AC68C374535C1F9B929665F8BD12D22FCF770151",
+  "C25538F29C341637CF5D26D5EB25840B742B54222253",
+  "07E504972B22AF9517E07D41E786BB33EECC5F561D5E",
+  "67019C517B0209A508125F52A01BE29F888A6A1C0FE5",
+  "9608EF51272097036BEA90342D70589179AE87438A2D",
+  "E7E69C3DCFFD74998E6C91A30A27CEE1B27C23EE0D2F",
+  "C9DF96FEB7528F2E0518A129F79641D2C44D2F14D20D",
+  "94103789DE1CE5E27A21F67A62204E0D299A897EC3C5",
+  "395E5BEF85117583B91A4E32817897CCEC94DB3AD082",
+  "3A2AFB91AB727C3DF0B48DB105C52B267DF464175562",
+  "51C19FE51C827F60A18A0B2F2D3A43C5A236A0D79818",
+  "2C18D66649EFA7922954C58404DAC4222B6B7E55E512",
+  "0327BF8FB3E51A586408D68A8AF52E4335BC28C5842B",
+  "8CB4ED059F5601B700C4A83776E10F5AB2E31136E243",
+  "DA785398E99044791352D0AAAA06D3485E3B1EB0D64D",
+  "29BBCD6B3340BC6C73E74E8DB658D78919CF2FB5A9EA",
+  "A7B9AF5BA1AA5810539FF1DD611E05D6E787735AD70619",
+  "856BB76C8303BA331121EEFC2F984FF8D9927F176117F0",
+  "61F21F52F734DE1ACC20C985A326C6E9305C8DB6CCDD7A",
+  "F47A27A733CAD506D4E3370522C779C98BA05A0B3D2D0D",
+  "FC031199111E50ADB167E97AED5B94976B7DB0BE5F357C",
+  "B26BC1BB0ADAD5CA45C524F32A5A2E96A2B17B9BF14083",
+  "F04A60FD57745BEEE71F52F868E79317CD6F3C3A69BFBE",
+  "FC23B4932772523EBCD4F7681FF3C6086A8F8D9C3BE1D6",
+  "B2212662BE9F323B69E7F3D68328E425F07BB1CBC516E4",
+  "652078D9074135A42E4924B576B1B0C47512E9F6EFD301",
+  "E5C721E61695DBC15C2956BE18F7D2C0BEA25B5262A00E",
+  "687B6BFD3807B44E1F0430E23AF7E3225636478BDE511F",
+  "D02AF8F31CBB39234233A7C588A9DD198B3359A597CD64",
+  "83F68DD5B1DF1E80E086C28818717E1AE99EACF6FDF28D",
+  "5CD4CCEC248A2C19D0775D788F28479FFF9AA276AAD680",
+  "4B5B4ABDFB2B7A71CA9A5C8D3188CC1B2B0D3DA3D43585",
+  "879666073F6C9A9248F9EC7907A201921E315AD1504C32",
+  "9D20AC68C374B3F0E6E6DF78E24B01FE21E60491109CD4",
+  "C25538F29C345ADCC66D010E130C80766535263194D186",
+  "07E504972B22C6AAE6D1B50DED79D349535FDF4B31CDE0",
+  "67019C517B020AB0309D36C1607990B03E0B5061FD46EA",
+  "9608EF512720463C10F4A5683574C7C7F972F50E4EA81F",
+  "E7E69C3DCFFDF7120AD2252175CBE75392BBA6990F0D89",
+  "C9DF96FEB752C1A7BFBE163BFB2FB6D4425E22CB849D95",
+  "94103789DE1CFE68B8817E01C7004D37649CE48596E21A",
+  "395E5BEF8511703E35BC657B74442264833F95809A9040",
+  "3A2AFB91AB721D09358FDD70271010064E8EA36EA5C3F4",
+  "51C19FE51C82435905E49B8A83CEA251539D35353A66D8",
+  "2C18D66649EF348ECAC8D5941316CBA73A730509A3CA63",
+  "0327BF8FB3E51628D7730BB9B72A08C489EE4D2401523A",
+  "8CB4ED059F560E48F1375A126FE080D14F34A8C291A192",
+  "DA785398E9900EC17CB0AE724D0DCF6A00A8C305A914CE",
+  "29BBCD6B33407B275096FD94A2E87E12303D1FFB00492A",
+  "A7B9AF5BA1AA580961E102ED01CDB5FD78D1DF643CC7B703",
+  "856BB76C8303BAED62F0FDA2B249970650EE6FDE02D0DC6A",
+  "61F21F52F734DE9766FC4077B51697FCFD6BA1C1D3EB531F",
+  "F47A27A733CAD59F094709A615D5B5D8A90FF69F20191C1D",
+  "FC031199111E50E1B52539DF730548777F6801CCB6986E98",
+  "B26BC1BB0ADAD5E7D9A113D412DCEED9EF7B4CBF6FDE5819",
+  "F04A60FD57745B44991F951218FA3580E58D74BDC21157BE",
+  "FC23B49327725241954DDADBCF518233EE93EAC54252E95F",
+  "B2212662BE9F32CE774D1224246C9F57D176B4F4CC2A59C6",
+  "652078D9074135694DCEFF530CF1EA8B18FB49992C3916F3",
+  "E5C721E61695DB41680080AC0B2B661441015D1589493D56",
+  "687B6BFD3807B447D3B6DCB8DFED652E1DEB0E3A54C8F437",
+  "D02AF8F31CBB393AC8130001756D0A91C3292C167F7C1335",
+  "83F68DD5B1DF1EAC7DC823F457AC79CF4D2F305929888412",
+  "5CD4CCEC248A2C0C301C22F5DDEC54743524F61AEA81E656",
+  "4B5B4ABDFB2B7A2386502FE138AB1F8E5659B1B70E52E12A",
+  "879666073F6C9A1E36496F90F3E9EEA647CE817D4AACB08B",
+  "9D20AC68C374B3731A45586CA7BD384929D299BC7EB03819",
+  "C25538F29C345A8B4A504EDB2C414D2F88B25AACC9367F3A",
+  "07E504972B22C6C5973CE007E64F09841D3E07360840ECCB",
+  "67019C517B020AE1093F5EA03650D6C6919F174CF73A6988",
+  "9608EF5127204615770ED2A451781569BCD49600F5CAD2C5",
+  "E7E69C3DCFFDF7E4500584A0AB3511037C9E9FA5B7FE7ACA",
+  "C9DF96FEB752C111C53D6218EBFE726991A493B8A1336653",
+  "94103789DE1CFE6CCD9CA9E77BD9EC80ED4524653CA9CCEF",
+  "395E5BEF851170FFAE5685A5D5372F0A4D774BCB265EDA57",
+  "3A2AFB91AB721DC272C5FD3E43800031972E29DAFC447CA3",
+  "51C19FE51C8243FA94AFD7EF296DD2A8F82BE23B573A2E57",
+  "2C18D66649EF346159E437DF075C09AAD4D1D26FC4336CC4",
+  "0327BF8FB3E516914AF63F20069BE4D42C7149C0D5675AD9",
+  "8CB4ED059F560EC797F5D6C74B626334AD011670D97B603C",
+  "DA785398E9900E2E25C9E4722522B97EE3296FA898A6E84C",
+  "29BBCD6B33407B0369A1B945907AC44A56B3A3276F13F955",
+  "A7B9AF5BA1AA5809767F5407C6AA2CEE6C2727CD777CB2BFDC",
+  "856BB76C8303BAED04A56213D5C652804E0B5E9D5B2990A272",
+  "61F21F52F734DE9747472E1502ABE02A962164401720132FAF",
+  "F47A27A733CAD59F855AAC1581A905D7A86B6E8117E544C169",
+  "FC031199111E50E10DFF9FB41B786824976BD9DC672CE18DDE",
+  "B26BC1BB0ADAD5E7BECB58A9554A101ACEAF5ECC7A8D8BD439",
+  "F04A60FD57745B44F22D85ACC4101601EFF7C81713FA05C7F9",
+  "FC23B49327725241E6A21D158D3AE77E58F90982EE3C3834D3",
+  "B2212662BE9F32CE45040C0CC1AD171CDCA94F88EA47A4E1A5",
+  "652078D9074135697F654FA56476EB2D99F88D4BAD4C39B1DE",
+  "E5C721E61695DB41FF7EFE9A9010DBFEDEF592D26743CC07D1",
+  "687B6BFD3807B447E477FFF8807480656222075F7868720268",
+  "D02AF8F31CBB393AD87C2B4ED2CAC934F0713E1B7E002210E7",
+  "83F68DD5B1DF1EACB7C0DC4C3663AF98732A74D6ECD13A1A71",
+  "5CD4CCEC248A2C0C06C825922813BE0DBCA1D501B24EBF3137",
+  "4B5B4ABDFB2B7A233526926EFF65C612E595C9523EA4F6EE33",
+  "879666073F6C9A1EEE9376CA7DA40CA83F831F5D9919E80116",
+  "9D20AC68C374B373EF45124106695F799539B4167867319063",
+  "C25538F29C345A8BB0033A6883A2DFC411D28F45ABAE8FDC64",
+  "07E504972B22C6C5AED4AFEAB3171DB78FD70FE5B2E2144350",
+  "67019C517B020AE179636C34BAE575DFAE4646136A4B1024F7",
+  "9608EF5127204615A10D38486B69DB14501AE4D1B59C9B0A25",
+  "E7E69C3DCFFDF7E43E8F9E0B1F61D006EFA46B973FAFC6982F",
+  "C9DF96FEB752C1110ABB9EF55925EFDA2D9AEDE2E369F17868",
+  "94103789DE1CFE6C721364E75961ADA355E6B30278A5AA7DE0",
+  "395E5BEF851170FF7C7B60ABE43E009DAC81148FE65E6A5DC3",
+  "3A2AFB91AB721DC28C6C26BC8AFFF96C5D6B7CE9B9697905EB",
+  "51C19FE51C8243FABA62D5C42C713144937AB45B976DCB42B4",
+  "2C18D66649EF34615C6C9DD973299DB9439207E567818CAF8D",
+  "0327BF8FB3E51691B4672F0FDE0F9B01284C22D31FF2663EE1",
+  "8CB4ED059F560EC72083A67F87C966DB90E7162B6BCCF4E8FD",
+  "DA785398E9900E2EBC6067DC00EF30D7372047318FAC0201B7",
+  "29BBCD6B33407B037979FBA19063154FED15C4A2E58B88ABC1",
+  "A7B9AF5BA1AA5809768380AF63536423F6650DE51214203E6EBE",
+  "856BB76C8303BAED04883486339B1EF0DC69FAB227412B84627F",
+  "61F21F52F734DE9747075F38BF605C804E252935FD2B4D005331",
+  "F47A27A733CAD59F85450F4202385979E40E364F48C5908E0563",
+  "FC031199111E50E10D1A8DC5412D40A911B57A448944A65E281D",
+  "B26BC1BB0ADAD5E7BE5D79F075A933C0DB7E54AA80D929978B2A",
+  "F04A60FD57745B44F25A8598A10A8CB6EA8CEEC350AA9100982F",
+  "FC23B49327725241E6587386A85F6551BB335A87E6E688C96D5F",
+  "B2212662BE9F32CE45749F8F74F40570311852208476E7BCD3CF",
+  "652078D9074135697F77EFECFC1E9B4B39ADEC698201C3CEEF43",
+  "E5C721E61695DB41FF3A6EEB2162D85128AEFBD23D826EF52666",
+  "687B6BFD3807B447E418131B301DAA053B1B1B1341BC0AD4E0BF",
+  "D02AF8F31CBB393AD8123F0673C8EDA6AA43D64F4D47A8915780",
+  "83F68DD5B1DF1EACB7FCEFFA8E8E16CD454D1688746D94817B6F",
+  "5CD4CCEC248A2C0C06BD380869B21B20054D3F8EFFB75E4C8382",
+  "4B5B4ABDFB2B7A23357A4493ED20A7D20828076D96573C80208F",
+  "879666073F6C9A1EEE05B6D1411B1416DF17E4E1B5364D8EA760",
+  "9D20AC68C374B373EF09DA29001F22643F780358425E706E92A0",
+  "C25538F29C345A8BB0874FF03D88F647E0016D6C775FDA78EC08",
+  "07E504972B22C6C5AEA57DDF67852B033CFAD8A1F6C5D9676750",
+  "67019C517B020AE1797DF991B3BB9662CF4A7D82021D50238EE2",
+  "9608EF5127204615A1D59FC1354106B11032E0ABCF372703CFF8",
+  "E7E69C3DCFFDF7E43EA94433A2F1CA0D4EF363A05E8E94E62329",
+  "C9DF96FEB752C1110A972F3EF6A66342336878D0154BE6B6389C",
+  "94103789DE1CFE6C72244084F8DE721F578CC9C8DDA6FC103E0A",
+  "395E5BEF851170FF7CBB97DDE7274C22A963293D176D22AD1665",
+  "3A2AFB91AB721DC28C0C63B495A0536B5A2E7644DEC95818C281",
+  "51C19FE51C8243FABAFB36FA99F0A3C122F73C93933FF45E8FC3",
+  "2C18D66649EF34615CA19DE26FD20AF477F952C7E018610B35DC",
+  "0327BF8FB3E51691B45A3B1F2F863FF2865730C362E804ED52FD",
+  "8CB4ED059F560EC720E485B0F42E5DBFBF98EF069BA82EDC3C5F",
+  "DA785398E9900E2EBC79EA5DEA16CA2FC7B3BAE1844732A0EF16",
+  "29BBCD6B33407B0379EB33E25970723ADFA75F037CA37105C65A",
+  "A7B9AF5BA1AA58097683922CF74C78B5304EDA2D7D2756CA2DDD2D",
+  "856BB76C8303BAED0488570289E3CE24ACD5DB12B9E86A2B2C4737",
+  "61F21F52F734DE9747075988F3F66796C2B2F5B5B646184CAD381A",
+  "F47A27A733CAD59F8545156BFE8CAA2145754F8189149864CD2E3E",
+  "FC031199111E50E10D1AD8B84AF90B90C7C3BFE899498857B504F6",
+  "B26BC1BB0ADAD5E7BE5DBC73377C8E3B3B1FB9BCC13D51D4F8E05E",
+  "F04A60FD57745B44F25AA8C6DBB67833A22D0E14F735B1E4CA5CF5",
+  "FC23B49327725241E6584EA73488A4C1854A9330A0BF1C2350E551",
+  "B2212662BE9F32CE4574E294DEC63D17B8F14B628DE0CF4C894C49",
+  "652078D9074135697F777C2D8EE032B2FBA4683CB41E425789B99F",
+  "E5C721E61695DB41FF3A289D71DA82C0631F9126287889FEFB3D68",
+  "687B6BFD3807B447E418C8F6E266540B76FA6EAE14C04C8C73C3C7",
+  "D02AF8F31CBB393AD81205A84502A0EEDB232BA4AE9C15CA0947A9",
+  "83F68DD5B1DF1EACB7FC68CBD06FCAA8FF468A092C5D76D091E035",
+  "5CD4CCEC248A2C0C06BD4F06916668CC5BADAF6619337284ABF716",
+  "4B5B4ABDFB2B7A23357AED33490B636B9DC7440ADBB6A770C1D3AF",
+  "879666073F6C9A1EEE05FD845BADD97B6823534354F1C9FA3B976F",
+  "9D20AC68C374B373EF098459164CBD1520AA30028EBFCF66B22074",
+  "C25538F29C345A8BB0874CB6D3698D50453E7AD3B833B250C40A9D",
+  "07E504972B22C6C5AEA5791D76331980EDEBB4660EB463F2AC938C",
+  "67019C517B020AE1797D0A08DBD44483F94A669C008F56C451FF35",
+  "9608EF5127204615A1D54D92690C94BE123EBBDD67AB830342DE87",
+  "E7E69C3DCFFDF7E43EA9843E8AFF9B779C73736CF153D381DF6B8B",
+  "C9DF96FEB752C1110A97DFA0FE7A034EB50943DF944EF32886DB8A",
+  "94103789DE1CFE6C7224F1613FF4EC49FED9D618A381A459F3B478",
+  "395E5BEF851170FF7CBBCB252EAD057CE675E1011D03FF75BF079D",
+  "3A2AFB91AB721DC28C0C6FC05E28E0A972E1E2001430C6DC1318F9",
+  "51C19FE51C8243FABAFB5F3B4D52775FA52D4C0AB1A2EDAE7BAA18",
+  "2C18D66649EF34615CA1E08921199432F2DA50E74736D76EC67B6F",
+  "0327BF8FB3E51691B45A9D96AD0E173854CB05826671CF630C7839",
+  "8CB4ED059F560EC720E48A1733ECC20CA2B518CB7D30829D8B5168",
+  "DA785398E9900E2EBC79728548E7AE0DA6AA0DC3231356280B9BE8",
+  "29BBCD6B33407B0379EB0A9DEC333DE93C9EA95F6A4A2BB520477F",
+  "A7B9AF5BA1AA5809768392299445AC71B71519B74D69C332F1AD8B9D",
+  "856BB76C8303BAED048857DCD692C7B3DF1AD47C72F963FD2140FF6F",
+  "61F21F52F734DE97470759FE79B284C8FAB113F8FD88121CA6F9FD6C",
+  "F47A27A733CAD59F854515A5AAFB80857F7954C7E627F8C470889D45",
+  "FC031199111E50E10D1AD886A692B3B6536DC3322B49A4B26B8E5FC5",
+  "B26BC1BB0ADAD5E7BE5DBCA28B64EE38B0E992E8BF8AAAFF799FB43B",
+  "F04A60FD57745B44F25AA8656C9B3A93484D534F4AEC94E8E1D96D71",
+  "FC23B49327725241E6584EEBABABEF1498651BB834F8F7423A5931EA",
+  "B2212662BE9F32CE4574E23B3CB3302D12EDFC640573C44B032C5183",
+  "652078D9074135697F777C8FE3EE757B74E16CAB5D1A7DF60F744B88",
+  "E5C721E61695DB41FF3A288B073EBD174F00D4E96EF469BA6A146E84",
+  "687B6BFD3807B447E418C8003EC3519D6241B026878E3CBFF2A54D48",
+  "D02AF8F31CBB393AD812053B8807A25929E61B8FA7522EF2B7727310",
+  "83F68DD5B1DF1EACB7FC68B1B558CFC3FB783F72D459A553BD73F469",
+  "5CD4CCEC248A2C0C06BD4F9F2BE7361D893008C6AE4AA38193E53030",
+  "4B5B4ABDFB2B7A23357AED8D662C36FC721717964C0DDF87CAAB4D68",
+  "879666073F6C9A1EEE05FDDBA0BBB88F881758A99E1D4AF57C990C70",
+  "9D20AC68C374B373EF09844D59EA5A97F8D7A91519992039A8289D11",
+  "C25538F29C345A8BB0874CDA686C7325FCC4586D53AB6DAE8080028E",
+  "07E504972B22C6C5AEA5794E01679AFE9C3D6924AB12434F594162B7",
+  "67019C517B020AE1797D0AF729C2AE12EBD096D1BD7C1A65261B139C",
+  "9608EF5127204615A1D54DD31A1DAF31D78502B437A35ABAE0782A78",
+  "E7E69C3DCFFDF7E43EA98463F9A9B747472E9D24B3ABDA65386D9C5C",
+  "C9DF96FEB752C1110A97DF33A41061F4E920477D4135A6BD995DE6C7",
+  "94103789DE1CFE6C7224F1E66E6D056CFA4AB4AB11E760AA88237B2F",
+  "395E5BEF851170FF7CBBCBF87435542A55681205AB99ACE50C5ECC90",
+  "3A2AFB91AB721DC28C0C6F1A396F8CD3E4BB93EF81B671582F7BB13A",
+  "51C19FE51C8243FABAFB5FB97FA49E1B6E35E6F7963E623D8A863996",
+  "2C18D66649EF34615CA1E084B5F178DB9474DBC0A59DADD4257B205C",
+  "0327BF8FB3E51691B45A9D74FD6B965D3F0E6A8DAD19283F820CAFFC",
+  "8CB4ED059F560EC720E48A83BA6CC5B6C636E3D616F070F711C844AF",
+  "DA785398E9900E2EBC79724BB4EBAD82D30FD42678D2F523C3BFD2DE",
+  "29BBCD6B33407B0379EB0A1F0B19EBEDD5EC25056054761531CA08B6",
+  "A7B9AF5BA1AA5809768392297480C613958F73817252940CC22C48A4FF",
+  "856BB76C8303BAED048857DC8F7CD024730179B9253EEC75F4FF70841B",
+  "61F21F52F734DE97470759FE3DACF5D5DA11708A2B3E4CF2192F49AB57",
+  "F47A27A733CAD59F854515A503C01DBE623C18815A430A5C5938D1361C",
+  "FC031199111E50E10D1AD8861654693A52875B11C33C74C3DFC3C27210",
+  "B26BC1BB0ADAD5E7BE5DBCA2B648BAE0CCA1BA584B11556F65C911F10E",
+  "F04A60FD57745B44F25AA865B2F8B08021797E9970816F8BECBFE3F9C6",
+  "FC23B49327725241E6584EEB0FF4393B4767305591BC21AEFC9E006A9E",
+  "B2212662BE9F32CE4574E23BB10009E883531C5D82DD1008B2455B432E",
+  "652078D9074135697F777C8F01B5A36D1BE4F0F810EEAB55AE992BE57C",
+  "E5C721E61695DB41FF3A288B94DC2EBF9E5698DE352F85D150893DBE4F",
+  "687B6BFD3807B447E418C8006C69CBA0FA6C2ED961F643B8DF2B2654A4",
+  "D02AF8F31CBB393AD812053B8FCD8F8A18BE1E339DB08F51633FA6F19E",
+  "83F68DD5B1DF1EACB7FC68B15DC5BAEC9F7E882EDFA05B48AC0EC08227",
+  "5CD4CCEC248A2C0C06BD4F9F0C74621A2EBF11FD4487C63710E4519793",
+  "4B5B4ABDFB2B7A23357AED8D47F4F51F07B4EA790D524E7BD78DAD09F0",
+  "879666073F6C9A1EEE05FDDB7997661B0D9256F84EABC297BC55A8AE17",
+  "9D20AC68C374B373EF09844D56563336C16D6FC494F6BAD15F1006C8DF",
+  "C25538F29C345A8BB0874CDA87C825E2ACC265AEB418CCE52DF1A27DB2",
+  "07E504972B22C6C5AEA5794E546A5A52A8342E95861B12A2F248838D95",
+  "67019C517B020AE1797D0AF7054689323C21FBC08A37A2057275B0941B",
+  "9608EF5127204615A1D54DD391AE7A24314FDF290846BABF1B4034C2D8",
+  "E7E69C3DCFFDF7E43EA98463D727001B2C8AAB9F6E84DD0160EDF210FB",
+  "C9DF96FEB752C1110A97DF33B0BC6463A8B37996C356B7052CCE818C8D",
+  "94103789DE1CFE6C7224F1E6EC2A9E64F158B76D40DA75DA5489760A03",
+  "395E5BEF851170FF7CBBCBF80FE2788C6AC94F1D48497D5E1ED5BECE49",
+  "3A2AFB91AB721DC28C0C6F1AF78094228390ADE716883B5FE1C16FDC3E",
+  "51C19FE51C8243FABAFB5FB96D6AAE938800A9CA214F85DCF506FD49A7",
+  "2C18D66649EF34615CA1E0849940983E97E11681124AB51870EB51B460",
+  "0327BF8FB3E51691B45A9D74B45935BBED6D1AB1D8A194FEF5505FCB53",
+  "8CB4ED059F560EC720E48A83C9A6821B434E68D2D28608A6FC2A756BD4",
+  "DA785398E9900E2EBC79724BA228339B4341545B97C00A3DD293B42A63",
+  "29BBCD6B33407B0379EB0A1F75667443B1235ABB8204D630E008BB8553",
+  "A7B9AF5BA1AA580976839229747C41268D594D131EBC0620C6E3DFE01FF4",
+  "856BB76C8303BAED048857DC8F4F4C5657EB75F8183D44A5175EBB46E25B",
+  "61F21F52F734DE97470759FE3D8DA6F14A4B2F4D82B8AF4B3A72E5D0FF4C",
+  "F47A27A733CAD59F854515A50370A9F9EA5D1E8435D354FBC3CDE4D29213",
+  "FC031199111E50E10D1AD88616674A6A12E5EA63E7D38A979B0E89C92954",
+  "B26BC1BB0ADAD5E7BE5DBCA2B697EA29EF349DCE46D23894BC4FDE49E148",
+  "F04A60FD57745B44F25AA865B2B9AA063F5F2DB6F32E0D739395E1E9654F",
+  "FC23B49327725241E6584EEB0F55483594619F0DAECB6E9FC3CD4B58BFFA",
+  "B2212662BE9F32CE4574E23BB10F925BCD4904807871439C0114391339F3",
+  "652078D9074135697F777C8F0131C0C4B97455B3E5D8DA4F3DFB8F8217C2",
+  "E5C721E61695DB41FF3A288B9472F1B71F1AC9D75068B383E74392ECD579",
+  "687B6BFD3807B447E418C8006C8709B4EF0F7C59F587668F16D57CE36099",
+  "D02AF8F31CBB393AD812053B8F8F93286FB03B2671D537502DF71D17F6DE",
+  "83F68DD5B1DF1EACB7FC68B15DDEB42444BED7060B158EE5491DFB851503",
+  "5CD4CCEC248A2C0C06BD4F9F0C96D5C57CA97EAA0E4A909CD7B7F7F19FB8",
+  "4B5B4ABDFB2B7A23357AED8D47F5D6F3FD0330071B1FF2513673D3522F11",
+  "879666073F6C9A1EEE05FDDB79E8F80CA2CDFDD4E172C70D9CF4FFEAD30C",
+  "9D20AC68C374B373EF09844D5607DF4C9BBE9FCD570B374275D814A8546E",
+  "C25538F29C345A8BB0874CDA87D223CE2BFD56B0B5C09C5E8810FD7555EC",
+  "07E504972B22C6C5AEA5794E54B2351933BE18F9B9FC797A04C72AEF4324",
+  "67019C517B020AE1797D0AF705FDE70235D0B228E379A9496CD7ABA51A09",
+  "9608EF5127204615A1D54DD391E78C5E991CD3FBF12150014A660174327E",
+  "E7E69C3DCFFDF7E43EA98463D71DCB04AFFB8ED0312B7B7217E9C5E0FA61",
+  "C9DF96FEB752C1110A97DF33B0131F95B61676593D062DFCE7CE4DF24BEA",
+  "94103789DE1CFE6C7224F1E6EC9D248A9C34523BE09EF736BD743FFC0A10",
+  "395E5BEF851170FF7CBBCBF80F4B262BF163F2FC4ADBC8B815CA2AAA906D",
+  "3A2AFB91AB721DC28C0C6F1AF77EF6013EDDF19327333A88C152C503525F",
+  "51C19FE51C8243FABAFB5FB96D7D4322E2EE003345F23F28575EA3627CCC",
+  "2C18D66649EF34615CA1E08499C3BB06C6AF10CE102852C259DB3421161A",
+  "0327BF8FB3E51691B45A9D74B46835F09859D0E86B71C50440F72251449A",
+  "8CB4ED059F560EC720E48A83C91DD04B615232DBE75C610B5893B7E5971F",
+  "DA785398E9900E2EBC79724BA2065CC7EA895499A5CA8433C571796D8DFD",
+  "29BBCD6B33407B0379EB0A1F75F2508A24145C1659CA4978922147626A70",
+  "A7B9AF5BA1AA580976839229747C9EFF85B887376BCF316AE093488F5F6376",
+  "856BB76C8303BAED048857DC8F4FA64E8E9BF98489A10841E6AF144AD5DC1E",
+  "61F21F52F734DE97470759FE3D8DA768E0EE177F528F21F46A827B0E71D5BA",
+  "F47A27A733CAD59F854515A5037064515DA96CBC3DBCC7BF77C13170635A73",
+  "FC031199111E50E10D1AD8861667E798A002D15AD7ABB0711B528BD2144637",
+  "B26BC1BB0ADAD5E7BE5DBCA2B6977EC759B5F2EE47AD16710C5095E3EE7454",
+  "F04A60FD57745B44F25AA865B2B970F0491ECD6E04C081EB83B9051DE95904",
+  "FC23B49327725241E6584EEB0F55522ED418FFD064B63057849FC1F36E804D",
+  "B2212662BE9F32CE4574E23BB10FCEABC036414D26F028B72DA1B510B45C7A",
+  "652078D9074135697F777C8F0131373EFFCC3F303E66B6C82E7A13CD2EEA50",
+  "E5C721E61695DB41FF3A288B94723A3956AF02761C59FD69256473D1C6FBD9",
+  "687B6BFD3807B447E418C8006C87A348E2D83720D8EEF50E86C4789D1070A9",
+  "D02AF8F31CBB393AD812053B8F8FF50E3590737A8A2B9F961B3DBEEAF7CEA4",
+  "83F68DD5B1DF1EACB7FC68B15DDE61325A0D9C877BAAC45FF36239006798F0",
+  "5CD4CCEC248A2C0C06BD4F9F0C967C2E574EB6E989165FDDF83E0DDD9155A8",
+  "4B5B4ABDFB2B7A23357AED8D47F5836E669D18073F6325EF1C433B57BE8D21",
+  "879666073F6C9A1EEE05FDDB79E8A87F2570F802940795C145B330E8307AA9",
+  "9D20AC68C374B373EF09844D560782D12A6D41113FF3D36EB139CF977E5D91",
+  "C25538F29C345A8BB0874CDA87D2C183A1534770453A2996E79A5E0A92D189",
+  "07E504972B22C6C5AEA5794E54B2A5237B46E04FE5DE4FB3BADB4FF5B32E6D",
+  "67019C517B020AE1797D0AF705FD8BA1149E54C4A56B2E5DEDBC660923C6F7",
+  "9608EF5127204615A1D54DD391E7D917AEC39FE74988075260B9EDA944DD4E",
+  "E7E69C3DCFFDF7E43EA98463D71D34017E9A1B375CDE26D650897F2D085622",
+  "C9DF96FEB752C1110A97DF33B01354F857EB558F88DFCEBDA2C59AD32971CC",
+  "94103789DE1CFE6C7224F1E6EC9D6778DCC869040B03E975517F86A8424809",
+  "395E5BEF851170FF7CBBCBF80F4B1AAC45D80539CEFBEC8A21D7AAFCE1D2B9",
+  "3A2AFB91AB721DC28C0C6F1AF77E9D08F7BCFE846605415BF77C34A41D93E4",
+  "51C19FE51C8243FABAFB5FB96D7D5BF4D246E70D7DFF07D5548F99D102EEF0",
+  "2C18D66649EF34615CA1E08499C3FB59FE46DA3396FA4724C9F72F380CDAA7",
+  "0327BF8FB3E51691B45A9D74B468EC78834FA00C28516C3F7F9634F09E8EC1",
+  "8CB4ED059F560EC720E48A83C91D4C7A0D1E253255A5F8A0F98AFD0BC94675",
+  "DA785398E9900E2EBC79724BA206342295A11C047CC2C9A6983E5F7633D59D",
+  "29BBCD6B33407B0379EB0A1F75F228EAEE29D8F99254C5049081DE5AF1B7CB",
+  "A7B9AF5BA1AA580976839229747C9E32403476D930A13D7AF7299E3681FC702B",
+  "856BB76C8303BAED048857DC8F4FA64FFA1310857E364DFD2EBCEE5961BD19D1",
+  "61F21F52F734DE97470759FE3D8DA771A89C918A6C9476D45A2A66263545270B",
+  "F47A27A733CAD59F854515A5037064EDDCE57D8362FA71E4464647C8CB98D48B",
+  "FC031199111E50E10D1AD8861667E7F8197717E9DAF399B0C86FD97D7F402057",
+  "B26BC1BB0ADAD5E7BE5DBCA2B6977E3CF2BDE8CB345AC333362D7CE00D6CC69F",
+  "F04A60FD57745B44F25AA865B2B970C33CB0A30111D371EAD085CEEB9943AE77",
+  "FC23B49327725241E6584EEB0F55529563868557D73285A744BA4330E1A1D841",
+  "B2212662BE9F32CE4574E23BB10FCE82409F6D1207131F487DFAF493EFF587A9",
+  "652078D9074135697F777C8F01313700F6F7B181354D7113E8C6C59ED2CB0F02",
+  "E5C721E61695DB41FF3A288B94723A35EEAFF7338B8881FB0079B5037AF46B3C",
+  "687B6BFD3807B447E418C8006C87A3750504B21C607582BEA98F9CB3C3BA03C9",
+  "D02AF8F31CBB393AD812053B8F8FF5D23D3946631D0852A9895D37A638EF0FF0",
+  "83F68DD5B1DF1EACB7FC68B15DDE6148A6254E7A83733A29F81D7831E7EB02EB",
+  "5CD4CCEC248A2C0C06BD4F9F0C967C3C0F1AB36CD358DB8B4D3AD97C084735A2",
+  "4B5B4ABDFB2B7A23357AED8D47F5831CA4B1F8F304214363F3AC99D18DB165E3",
+  "879666073F6C9A1EEE05FDDB79E8A88766E12F1E592CA486E7E2751A94003D91",
+  "9D20AC68C374B373EF09844D56078273C4487F8A9A547D433A4F86FCBCF4E687",
+  "C25538F29C345A8BB0874CDA87D2C1E2000F087EB03D30DBBA242E4864125068",
+  "07E504972B22C6C5AEA5794E54B2A58DAB0BE75FA5D2D24AD9664162C7900013",
+  "67019C517B020AE1797D0AF705FD8B6096A070B41E578E862786BF114CAC970B",
+  "9608EF5127204615A1D54DD391E7D9D09FDBA59D1FD07101DEBFB5A61E56F811",
+  "E7E69C3DCFFDF7E43EA98463D71D342D0E1B9EB14F2689CAFB3FBA64A6B7FC62",
+  "C9DF96FEB752C1110A97DF33B01354ACECC288CC007DDA6FD4E12B494772C408",
+  "94103789DE1CFE6C7224F1E6EC9D67704E7F72A6A0795CE2BDCD1C30CC0E988A",
+  "395E5BEF851170FF7CBBCBF80F4B1A4D1F81F844698FD68448BDA97F17C101A8",
+  "3A2AFB91AB721DC28C0C6F1AF77E9D2C1ED2CE1F8CE24E66972260B20DCA3C25",
+  "51C19FE51C8243FABAFB5FB96D7D5BDD1CFBEC584FAA2D1E69B8AA8DB755FCAC",
+  "2C18D66649EF34615CA1E08499C3FBE0BC1F8E22B0C4C950BD4D9424AA043C61",
+  "0327BF8FB3E51691B45A9D74B468ECC64A5587A99A78C2B1B2378CC1CA751BCA",
+  "8CB4ED059F560EC720E48A83C91D4C34042FFBD530970A90CA4F27BD965A265F",
+  "DA785398E9900E2EBC79724BA20634209C6EA3599AA1BFE2A6CBB26BDB589851",
+  "29BBCD6B33407B0379EB0A1F75F2280E05EB0A459D456B582759E5A9F628AD99",
+  "A7B9AF5BA1AA580976839229747C9E3281FEAF85F03E2FF8C4EC82495464C3F6"
+  "28",
+  "856BB76C8303BAED048857DC8F4FA64FDD0CC63425A1CE87175C5EF1C282A1B7"
+  "57",
+  "61F21F52F734DE97470759FE3D8DA7713911D57FBDE59468739ACBB1AA9B3397"
+  "4A",
+  "F47A27A733CAD59F854515A5037064ED5B06589F799557CB66EB820FB227D9BC"
+  "07",
+  "FC031199111E50E10D1AD8861667E7F8CF1EC29B52AA11E34CA924C969EF7855"
+  "1A",
+  "B26BC1BB0ADAD5E7BE5DBCA2B6977E3CCD913F7618EEF7EAF73B72D045B6F794"
+  "E3",
+  "F04A60FD57745B44F25AA865B2B970C3B4F358DE8A7D411CA535F1F4945AE8C4"
+  "46",
+  "FC23B49327725241E6584EEB0F5552954C7017D77285970DE5568A87ABDE062F"
+  "4A",
+  "B2212662BE9F32CE4574E23BB10FCE826FD59AC85C24583841C67CE62076F5DB"
+  "3B",
+  "652078D9074135697F777C8F013137002AD38EF203C47E126C7B90AB04D030EF"
+  "B1",
+  "E5C721E61695DB41FF3A288B94723A355853DB7CFBB2CC913C6C2AD62E63A7ED"
+  "C9",
+  "687B6BFD3807B447E418C8006C87A375ADF5BC5A0FB15048DAE5FCC72CCA34DA"
+  "2A",
+  "D02AF8F31CBB393AD812053B8F8FF5D2433805E820C56C926E47B7EB58CB17A1"
+  "8C",
+  "83F68DD5B1DF1EACB7FC68B15DDE6148569CEB9A4DC99BF482101FB922D7C43D"
+  "63",
+  "5CD4CCEC248A2C0C06BD4F9F0C967C3C62411B29159A4CFD4994176BD43E855F"
+  "F6",
+  "4B5B4ABDFB2B7A23357AED8D47F5831C3B95A9176415BA0C19AA21CFEB80BE38"
+  "0B",
+  "879666073F6C9A1EEE05FDDB79E8A8874CB2BB10AB3F3EDCF2F324A7CA5334F4"
+  "05",
+  "9D20AC68C374B373EF09844D5607827371401B5C864D7061B154233F14F72FE4"
+  "19",
+  "C25538F29C345A8BB0874CDA87D2C1E21D88C162053631F619B1B453816A906A"
+  "00",
+  "07E504972B22C6C5AEA5794E54B2A58D5CE8115AED38BC5C190788AE310CA181"
+  "6E",
+  "67019C517B020AE1797D0AF705FD8B601960F611A38ACC5B76F61A5CD401F12E"
+  "4E",
+  "9608EF5127204615A1D54DD391E7D9D06546A74C6EDEADBD1267A3603FE039B0"
+  "A8",
+  "E7E69C3DCFFDF7E43EA98463D71D342DD87BD17E763045CF376778134A0AC4E4"
+  "83",
+  "C9DF96FEB752C1110A97DF33B01354ACA55A153C1E6E5C9ED30169991C96D849"
+  "89",
+  "94103789DE1CFE6C7224F1E6EC9D67708348ADA4DF9952CBBC1F79464DEDB293"
+  "25",
+  "395E5BEF851170FF7CBBCBF80F4B1A4D4183F7EAF432A2F2FB96EF4377484143"
+  "93",
+  "3A2AFB91AB721DC28C0C6F1AF77E9D2C5D2CEC5BB53ECC62E76D30FDBA1D48F4"
+  "2D",
+  "51C19FE51C8243FABAFB5FB96D7D5BDDCEAC0D319E6DD82D21B66084A8C86DC7"
+  "6A",
+  "2C18D66649EF34615CA1E08499C3FBE09298E4C16601BF3F27628E6C32F2D291"
+  "BF",
+  "0327BF8FB3E51691B45A9D74B468ECC61F833BD7431E3B74EBA5122547DE5A19"
+  "3E",
+  "8CB4ED059F560EC720E48A83C91D4C34588817CE5EF1FD77F4D9A8E500A52BB1"
+  "2D",
+  "DA785398E9900E2EBC79724BA2063420128B6B3B3DE4F97A653B99AB7C8B0324"
+  "97",
+  "29BBCD6B33407B0379EB0A1F75F2280ED6BC18BA1EAACD45F0874268A8625DE2"
+  "2A",
+  "A7B9AF5BA1AA580976839229747C9E32819D92D468B452041A72A523F9029C56"
+  "7109",
+  "856BB76C8303BAED048857DC8F4FA64FDD77F40227482DE8013AE21DABA3909B"
+  "E927",
+  "61F21F52F734DE97470759FE3D8DA7713949785BEBBE437CA4021E74D4649497"
+  "3C24",
+  "F47A27A733CAD59F854515A5037064ED5BD7F6479A114091FD1634A8AFE7BE18"
+  "E177",
+  "FC031199111E50E10D1AD8861667E7F8CF30AF6FDCC547F5DCDA51184F569B80"
+  "D87B",
+  "B26BC1BB0ADAD5E7BE5DBCA2B6977E3CCD849E956B12FA5C8D9F11D39A29876F"
+  "2790",
+  "F04A60FD57745B44F25AA865B2B970C3B47B654C2963ACC4939025A989AC6200"
+  "7206",
+  "FC23B49327725241E6584EEB0F5552954C03874387D6E2589F676AFC781749A4"
+  "6239",
+  "B2212662BE9F32CE4574E23BB10FCE826FBFD7BF7AA82283B62F836F21F4B614"
+  "5446",
+  "652078D9074135697F777C8F013137002A1757442128CB52727384FBC370DF73"
+  "9103",
+  "E5C721E61695DB41FF3A288B94723A355869827FF2F92B517484CDA1E43D312B"
+  "D0E0",
+  "687B6BFD3807B447E418C8006C87A375AD55631AD037F0A29B0BC506E255B259"
+  "910E",
+  "D02AF8F31CBB393AD812053B8F8FF5D243F964FE95A42513B92B32E2355A328D"
+  "E454",
+  "83F68DD5B1DF1EACB7FC68B15DDE6148566C1DDCE54D3FB37F387238BF29DB89"
+  "823B",
+  "5CD4CCEC248A2C0C06BD4F9F0C967C3C6210033B973B97D89567F780946D1FC8"
+  "B35E",
+  "4B5B4ABDFB2B7A23357AED8D47F5831C3B5CEBE19643DEA5148935552C998B60"
+  "BFBF",
+  "879666073F6C9A1EEE05FDDB79E8A8874CDDA03E181F9374DF0EACF203740794"
+  "DE53",
+  "9D20AC68C374B373EF09844D5607827371592A109791AFAB88981DDCEFEBA8D3"
+  "50D2",
+  "C25538F29C345A8BB0874CDA87D2C1E21DEAC1CF9B95A46031BB67660769B446"
+  "D366",
+  "07E504972B22C6C5AEA5794E54B2A58D5C1606850EAD35A5D0D1E5E55EE21859"
+  "F122",
+  "67019C517B020AE1797D0AF705FD8B6019374345D6DB2670834384B9BB5C21DF"
+  "28DC",
+  "9608EF5127204615A1D54DD391E7D9D065479AFED6660C4D40233763CC3140D0"
+  "2654",
+  "E7E69C3DCFFDF7E43EA98463D71D342DD8415505335ACEE1057D6BFBDE2835A9"
+  "10C6",
+  "C9DF96FEB752C1110A97DF33B01354ACA5CA86CD56D39BCD3DC07C1C97D6835D"
+  "73F1",
+  "94103789DE1CFE6C7224F1E6EC9D6770835A828C73377800ED0EDADFA7D6249F"
+  "BB14",
+  "395E5BEF851170FF7CBBCBF80F4B1A4D4160B6F8246E5651C7FA562D126383CA"
+  "4728",
+  "3A2AFB91AB721DC28C0C6F1AF77E9D2C5D68520B3F9EA380437FDF72CF8B51D3"
+  "92B4",
+  "51C19FE51C8243FABAFB5FB96D7D5BDDCE1C200CEFFFF093B0F73DEF293E1D27"
+  "8FC0",
+  "2C18D66649EF34615CA1E08499C3FBE09286102F6B6FCB729DB6413A4581B6D6"
+  "04B7",
+  "0327BF8FB3E51691B45A9D74B468ECC61FAAAF8CE913FCAC3A4E1049685DB4DC"
+  "0058",
+  "8CB4ED059F560EC720E48A83C91D4C34583D7103BC17C83435ABF89BF84A2000"
+  "A827",
+  "DA785398E9900E2EBC79724BA206342012E73150C4B965E5974AA2B58B335C82"
+  "CDC7",
+  "29BBCD6B33407B0379EB0A1F75F2280ED67E8770E897F6DEED33D09FFE32B426"
+  "3D00",
+  "A7B9AF5BA1AA580976839229747C9E32819D076EDF20B53B916DC18710DFEAA3"
+  "955519",
+  "856BB76C8303BAED048857DC8F4FA64FDD77181BC0F055D17A49E114D99283C9"
+  "36E7D7",
+  "61F21F52F734DE97470759FE3D8DA771394954BFA083A7FB86A2F00B2406650F"
+  "CA40FD",
+  "F47A27A733CAD59F854515A5037064ED5BD792EE45D8E39CDB0528FDBEBE50FD"
+  "B7812A",
+  "FC031199111E50E10D1AD8861667E7F8CF308B7AD7A6FA3082CC0B37524488F3"
+  "E71FA8",
+  "B26BC1BB0ADAD5E7BE5DBCA2B6977E3CCD844C32E74FCEF58F988FE30B09A079"
+  "CE904E",
+  "F04A60FD57745B44F25AA865B2B970C3B47B1967DF74A3DEF2E5D516686907A5"
+  "EE6B30",
+  "FC23B49327725241E6584EEB0F5552954C03B0B65F90A94319C333BD14FCC678"
+  "E4DA85",
+  "B2212662BE9F32CE4574E23BB10FCE826FBF93992B162F0D5857FB96AA51EACC"
+  "FFB8C3",
+  "652078D9074135697F777C8F013137002A1704D394C2C8A364293B56FFCB688E"
+  "3EE3A4",
+  "E5C721E61695DB41FF3A288B94723A35586958029EBAC17C72A7265F9B3882E9"
+  "D55491",
+  "687B6BFD3807B447E418C8006C87A375AD55CE5470D891B79188E60C9218D686"
+  "530C93",
+  "D02AF8F31CBB393AD812053B8F8FF5D243F9CA4EDDC03BCB58B6DA8BAF79371F"
+  "9D603D",
+  "83F68DD5B1DF1EACB7FC68B15DDE6148566C6746486BCDB33F9172FC4025A367"
+  "7FADA6",
+  "5CD4CCEC248A2C0C06BD4F9F0C967C3C6210C4D884EF00C3727DCEAFE2FE6C73"
+  "5E65A9",
+  "4B5B4ABDFB2B7A23357AED8D47F5831C3B5C9054B7BF5A03C7BC40A91275CF50"
+  "FF62DF",
+  "879666073F6C9A1EEE05FDDB79E8A8874CDDAC272BE31140ADFAC0C23FB8F198"
+  "C2D1A0",
+  "9D20AC68C374B373EF09844D560782737159DC5C19A6E8B44908B55C8A93BB15"
+  "67F385",
+  "C25538F29C345A8BB0874CDA87D2C1E21DEAA2C841186A46971D8E17F8EDC8DD"
+  "E7C3BB",
+  "07E504972B22C6C5AEA5794E54B2A58D5C16FF857915754BC0C51746F345E253"
+  "B5B5B9",
+  "67019C517B020AE1797D0AF705FD8B6019379FBDAE10B7B4383886052F4B0539"
+  "AA1941",
+  "9608EF5127204615A1D54DD391E7D9D0654750C616C9E5F1A98EFD0629D58B67"
+  "9AFC72",
+  "E7E69C3DCFFDF7E43EA98463D71D342DD841E47CBD3699ADF173B4CEED41B83F"
+  "5F67C8",
+  "C9DF96FEB752C1110A97DF33B01354ACA5CA5130369581964F83BF7536E7327C"
+  "E08E01",
+  "94103789DE1CFE6C7224F1E6EC9D6770835AA1BED998A57D1976EA0C2BA4E413"
+  "0EC7EE",
+  "395E5BEF851170FF7CBBCBF80F4B1A4D4160216E9464263378ADEB5773C45471"
+  "1EEBB2",
+  "3A2AFB91AB721DC28C0C6F1AF77E9D2C5D6871D049AF73DF3793E2B7A412EDAD"
+  "230F85",
+  "51C19FE51C8243FABAFB5FB96D7D5BDDCE1C326A521A2CD24A141E4E6D36BFCC"
+  "2940C9",
+  "2C18D66649EF34615CA1E08499C3FBE09286E6B020F15A5A88CCA98C847B17A9"
+  "69B8E8",
+  "0327BF8FB3E51691B45A9D74B468ECC61FAA87D878764DD6DA688CA2A2647CB2"
+  "993B47",
+  "8CB4ED059F560EC720E48A83C91D4C34583D2558AE0851CDAD90C2AD87A4B561"
+  "2F67B2",
+  "DA785398E9900E2EBC79724BA206342012E7754F2882F5EE07A780D568320221"
+  "A75443",
+  "29BBCD6B33407B0379EB0A1F75F2280ED67ED189F7A3B7A97EA17A63AE89B245"
+  "66DFA5",
+  "A7B9AF5BA1AA580976839229747C9E32819D07409EB9FDD099E529082EE71829"
+  "FC731679",
+  "856BB76C8303BAED048857DC8F4FA64FDD771872924FB0AC5306D5C3D3369396"
+  "41C69FE6",
+  "61F21F52F734DE97470759FE3D8DA771394954F6D30EC2C84639EAA6B261C1BA"
+  "5001CC4F",
+  "F47A27A733CAD59F854515A5037064ED5BD792C992C324E318F7F6A7BC5B5EDB"
+  "4A84868F",
+  "FC031199111E50E10D1AD8861667E7F8CF308B3A626A849DAC5ED7B9C3F934FE"
+  "E76160AD",
+  "B26BC1BB0ADAD5E7BE5DBCA2B6977E3CCD844CA75F89B55893DB03039A5DF2C2"
+  "E6D49620",
+  "F04A60FD57745B44F25AA865B2B970C3B47B19B537BBD48996232B02395D8F15"
+  "64017A37",
+  "FC23B49327725241E6584EEB0F5552954C03B0E100235D7F16BC9796C56C03DA"
+  "3230F90D",
+  "B2212662BE9F32CE4574E23BB10FCE826FBF936074FEA2E06DE757B18855AC3A"
+  "639845DE",
+  "652078D9074135697F777C8F013137002A17042B7BD60C80F952CBFB1EB104CC"
+  "A9852358",
+  "E5C721E61695DB41FF3A288B94723A35586958F93DE1CB4CBAC4C1FC42A05B21"
+  "DDBD456F",
+  "687B6BFD3807B447E418C8006C87A375AD55CEC5EF1B520923DE8B6EB5022C4F"
+  "6F5E7BB7",
+  "D02AF8F31CBB393AD812053B8F8FF5D243F9CA67A8517E18C3E1B9B9A8835309"
+  "E9809039",
+  "83F68DD5B1DF1EACB7FC68B15DDE6148566C67E9C7C234520261EE173C11CAB0"
+  "A7813BF8",
+  "5CD4CCEC248A2C0C06BD4F9F0C967C3C6210C4962455C0FB057FC5E5436C31C9"
+  "77C1608B",
+  "4B5B4ABDFB2B7A23357AED8D47F5831C3B5C903F5B29947839013462D6A844D5"
+  "391B70FE",
+  "879666073F6C9A1EEE05FDDB79E8A8874CDDAC96D429B0F129F0170E253782B8"
+  "42403D59",
+  "9D20AC68C374B373EF09844D560782737159DC63FB1DB66BC39A064D58EFDEFD"
+  "AD223241",
+  "C25538F29C345A8BB0874CDA87D2C1E21DEAA25F45E7735EA558499C3ADE4E33"
+  "C762495B",
+  "07E504972B22C6C5AEA5794E54B2A58D5C16FFD30ADA62FFF94AB8EAA0855DD7"
+  "7DB32181",
+  "67019C517B020AE1797D0AF705FD8B6019379F49B93E45FE67386369732FBB7F"
+  "102F4086",
+  "9608EF5127204615A1D54DD391E7D9D06547501278042EDAA9137290B6C18191"
+  "25A48994",
+  "E7E69C3DCFFDF7E43EA98463D71D342DD841E49D5AE8826C55ED77F845D79688"
+  "C141963E",
+  "C9DF96FEB752C1110A97DF33B01354ACA5CA51C351A5F31496A3D07EE32E79AA"
+  "A065AFF8",
+  "94103789DE1CFE6C7224F1E6EC9D6770835AA1F642D54D56A08C82E78AD243ED"
+  "C2DE0D37",
+  "395E5BEF851170FF7CBBCBF80F4B1A4D41602156561F86592DB70A681AE3DC47"
+  "1FC013E7",
+  "3A2AFB91AB721DC28C0C6F1AF77E9D2C5D6871F17A1019299159F3391F8B68B5"
+  "BBACF0A1",
+  "51C19FE51C8243FABAFB5FB96D7D5BDDCE1C3225E036737650F75A314A2552BB"
+  "7EC91D69",
+  "2C18D66649EF34615CA1E08499C3FBE09286E6CBA864D77DA0CCFDE7F9D5D9DA"
+  "B409C839",
+  "0327BF8FB3E51691B45A9D74B468ECC61FAA871096A0509782303AA658647A47"
+  "FF658297",
+  "8CB4ED059F560EC720E48A83C91D4C34583D25D675948FF3B610268EE0B7C0D3"
+  "E43F41B4",
+  "DA785398E9900E2EBC79724BA206342012E77530B64FA5CA242696CCAFE752D3"
+  "347149CD",
+  "29BBCD6B33407B0379EB0A1F75F2280ED67ED15BFBEC673132CBCB376858288F"
+  "B04C175F",
+  "A7B9AF5BA1AA580976839229747C9E32819D07404E801B0FDDA1CDED8B0D5402"
+  "A074F81859",
+  "856BB76C8303BAED048857DC8F4FA64FDD771872F050E809FE6C1FB43EFF5D41"
+  "F32A729310",
+  "61F21F52F734DE97470759FE3D8DA771394954F6BA914A35FED4FE802C822995"
+  "9D3BFAD8D4",
+  "F47A27A733CAD59F854515A5037064ED5BD792C964B9C90D8E530A47A5394752"
+  "153EF62217",
+  "FC031199111E50E10D1AD8861667E7F8CF308B3AB0B3D2424726289CF78DD123"
+  "6401DCA7A7",
+  "B26BC1BB0ADAD5E7BE5DBCA2B6977E3CCD844CA7DF2E83D465B828717E93C3DE"
+  "49625C77AB",
+  "F04A60FD57745B44F25AA865B2B970C3B47B19B5184FF45D3D97C44CAF188A8A"
+  "EDE6B6FA0B",
+  "FC23B49327725241E6584EEB0F5552954C03B0E1C1F0A7A17DEA8F9DE70AA18D"
+  "04D0DC9E38",
+  "B2212662BE9F32CE4574E23BB10FCE826FBF9360CFD1013A5B7102FC78F5AA38"
+  "024835B709",
+  "652078D9074135697F777C8F013137002A17042BC8C5C594998549A5116EBD19"
+  "9061E5C524",
+  "E5C721E61695DB41FF3A288B94723A35586958F94ADDA714499D20D4FEC4C278"
+  "F3C52D3F09",
+  "687B6BFD3807B447E418C8006C87A375AD55CEC5557CDDDBFA05C63EDC1692BF"
+  "E4178CC30B",
+  "D02AF8F31CBB393AD812053B8F8FF5D243F9CA67151D1B04B28677B03283F74A"
+  "075278BB89",
+  "83F68DD5B1DF1EACB7FC68B15DDE6148566C67E94A16ABBCBFB85FC87D4E109B"
+  "6A03824DA8",
+  "5CD4CCEC248A2C0C06BD4F9F0C967C3C6210C496999E858B20DDB41D84C2A07B"
+  "1781FFDA69",
+  "4B5B4ABDFB2B7A23357AED8D47F5831C3B5C903F4F121019F698717C2C68F63A"
+  "99F157052D",
+  "879666073F6C9A1EEE05FDDB79E8A8874CDDAC96F59A868131349062F9971F6E"
+  "05AFE87B6E",
+  "9D20AC68C374B373EF09844D560782737159DC633E7E7610DB4A31573B86FDB9"
+  "6A261BB6BC",
+  "C25538F29C345A8BB0874CDA87D2C1E21DEAA25F4743E25B7B8FFD999E6D08E8"
+  "59C6A59501",
+  "07E504972B22C6C5AEA5794E54B2A58D5C16FFD31EA68F791AB40D482A72C7F9"
+  "555FBDDBD5",
+  "67019C517B020AE1797D0AF705FD8B6019379F49E047488A03D21D29AAB6AB30"
+  "7DDC00CEB1",
+  "9608EF5127204615A1D54DD391E7D9D0654750122297464826BD48F4F5029660"
+  "D4B412E19D",
+  "E7E69C3DCFFDF7E43EA98463D71D342DD841E49D3CF216EDB0426E6AB0F1D6B8"
+  "B9041621AF",
+  "C9DF96FEB752C1110A97DF33B01354ACA5CA51C3AAE9F4F8ED8AF70FF6DFBC58"
+  "2884806957",
+  "94103789DE1CFE6C7224F1E6EC9D6770835AA1F67E36F8BC25D653DE4F1208D8"
+  "A04B281E10",
+  "395E5BEF851170FF7CBBCBF80F4B1A4D416021564A554D45A643427797585ABE"
+  "0DAF24537D",
+  "3A2AFB91AB721DC28C0C6F1AF77E9D2C5D6871F140145DCAEBF19D7BC52F67F1"
+  "A65E4AC84C",
+  "51C19FE51C8243FABAFB5FB96D7D5BDDCE1C32254BD4C11EFAE563239196D86C"
+  "0DCE9372EB",
+  "2C18D66649EF34615CA1E08499C3FBE09286E6CB4EB09428C2DB28445E8FE6D7"
+  "8B687C9582",
+  "0327BF8FB3E51691B45A9D74B468ECC61FAA8710271E3BD99342BCFEC4671B58"
+  "2E15A498C5",
+  "8CB4ED059F560EC720E48A83C91D4C34583D25D6B8C3AF7FB48094A6B5DB5575"
+  "6CA731983E",
+  "DA785398E9900E2EBC79724BA206342012E77530BC4C51B367D77A321BB6D3C9"
+  "90DC237BD9",
+  "29BBCD6B33407B0379EB0A1F75F2280ED67ED15BFBA8231C167921918DA36A10"
+  "5298AE02F9",
+  "A7B9AF5BA1AA580976839229747C9E32819D07404EB326758478CCBCEB3299C7"
+  "96FD63BBAC2A",
+  "856BB76C8303BAED048857DC8F4FA64FDD771872F015F8C16FE4C934286143D9"
+  "F8CEB6C100EE",
+  "61F21F52F734DE97470759FE3D8DA771394954F6BA86ACD5FFFF6EE0039127AB"
+  "BAD19B6E6407",
+  "F47A27A733CAD59F854515A5037064ED5BD792C96401A544669C1FF0FCB4D202"
+  "C7E635275D7C",
+  "FC031199111E50E10D1AD8861667E7F8CF308B3AB0BE3AC13976C396B3728F85"
+  "9E25EB354744",
+  "B26BC1BB0ADAD5E7BE5DBCA2B6977E3CCD844CA7DF4C0CDBCE24ADA155469762"
+  "92E73CD13CEA",
+  "F04A60FD57745B44F25AA865B2B970C3B47B19B5188E8DAD5A44194C4CC611AE"
+  "590F3BE4B93E",
+  "FC23B49327725241E6584EEB0F5552954C03B0E1C1F682A5E730CDF70253AD8B"
+  "7BA3C02DE8DF",
+  "B2212662BE9F32CE4574E23BB10FCE826FBF9360CFB83555CE44E79D127FD304"
+  "D661D0CAD8B6",
+  "652078D9074135697F777C8F013137002A17042BC8CA6CEAD39DACF8803F98E0"
+  "D35387AD7553",
+  "E5C721E61695DB41FF3A288B94723A35586958F94A48B8E96CAA8A11EAC20913"
+  "4BA8AEB79E94",
+  "687B6BFD3807B447E418C8006C87A375AD55CEC555FAB266FD5C4A1BF3D8BA28"
+  "EECD4A9AFFEF",
+  "D02AF8F31CBB393AD812053B8F8FF5D243F9CA6715154911F9F7F78E3F8F4170"
+  "E6D850AEAB17",
+  "83F68DD5B1DF1EACB7FC68B15DDE6148566C67E94AA48D4F8D6C6F7BC71980CF"
+  "1BA288E218C2",
+  "5CD4CCEC248A2C0C06BD4F9F0C967C3C6210C4969915D509E7581E21F49FEABD"
+  "B88C24C8224A",
+  "4B5B4ABDFB2B7A23357AED8D47F5831C3B5C903F4F58709F7645415C74A64354"
+  "8736B15F02F3",
+  "879666073F6C9A1EEE05FDDB79E8A8874CDDAC96F59CF4A92B75D51EE258A821"
+  "8FD1DAAD77A7",
+  "9D20AC68C374B373EF09844D560782737159DC633E75F4F5BB2B852A5AF14BC0"
+  "03263FDF21D6",
+  "C25538F29C345A8BB0874CDA87D2C1E21DEAA25F47B98B4BF555ECC7F60C182E"
+  "D18020CC7AFE",
+  "07E504972B22C6C5AEA5794E54B2A58D5C16FFD31EBC083998B2C97154BFA542"
+  "01B208DB4818",
+  "67019C517B020AE1797D0AF705FD8B6019379F49E0241EF597CE07FCCAB81755"
+  "B3911D212471",
+  "9608EF5127204615A1D54DD391E7D9D0654750122279EF32B4C92E72B0FADB05"
+  "DB4F3F9A4FF7",
+  "E7E69C3DCFFDF7E43EA98463D71D342DD841E49D3CA73D0BC4B8523CC3E1852E"
+  "3B84757A444F",
+  "C9DF96FEB752C1110A97DF33B01354ACA5CA51C3AA6471C3729AD25D46570BFC"
+  "689696391533",
+  "94103789DE1CFE6C7224F1E6EC9D6770835AA1F67E28185809D76BF3A1A588EE"
+  "D44434B33DE7",
+  "395E5BEF851170FF7CBBCBF80F4B1A4D416021564AD97FEA32A034EE33B40BE7"
+  "10A5F0B3CF40",
+  "3A2AFB91AB721DC28C0C6F1AF77E9D2C5D6871F140E04C96E61E2CAAD819F278"
+  "4783096ABD15",
+  "51C19FE51C8243FABAFB5FB96D7D5BDDCE1C32254B01716BE65202A15308A45F"
+  "1A64E1A6839A",
+  "2C18D66649EF34615CA1E08499C3FBE09286E6CB4E7E13B2C8D81B14A1033764"
+  "4E9D453A310F",
+  "0327BF8FB3E51691B45A9D74B468ECC61FAA871027B2806929713EFE95505A79"
+  "D64EBE61A2CB",
+  "8CB4ED059F560EC720E48A83C91D4C34583D25D6B8987D72B6A011C2509B703A"
+  "B335AEA58F89",
+  "DA785398E9900E2EBC79724BA206342012E77530BC5293FE701DBEA4D843D895"
+  "FF5240FF20D4",
+  "29BBCD6B33407B0379EB0A1F75F2280ED67ED15BFBB2B8BC006CF45328C9A850"
+  "D589B8D1D283",
+  "A7B9AF5BA1AA580976839229747C9E32819D07404EB3C18653791376A4177A4C"
+  "DD72B547F7AD07",
+  "856BB76C8303BAED048857DC8F4FA64FDD771872F015F946BE22C85C60BE6FFB"
+  "4BF34370BE7265",
+  "61F21F52F734DE97470759FE3D8DA771394954F6BA860F01324CB996BFAB0D21"
+  "32F80E15E5FC90",
+  "F47A27A733CAD59F854515A5037064ED5BD792C96401F110289A5B4380C21893"
+  "B969B539E9DB1D",
+  "FC031199111E50E10D1AD8861667E7F8CF308B3AB0BE1B2E79F59FE9A28DA1F1"
+  "093FF9906B1C6F",
+  "B26BC1BB0ADAD5E7BE5DBCA2B6977E3CCD844CA7DF4CF15D1534C44B3F5771A2"
+  "345A6B09AE959E",
+  "F04A60FD57745B44F25AA865B2B970C3B47B19B5188E821A40A320C10DCF2F97"
+  "CFE655C77EF3E5",
+  "FC23B49327725241E6584EEB0F5552954C03B0E1C1F6F36F50C87D26EB46FF80"
+  "5F325B058831D1",
+  "B2212662BE9F32CE4574E23BB10FCE826FBF9360CFB8790352D6E6AC76ECA049"
+  "6807450EB08556",
+  "652078D9074135697F777C8F013137002A17042BC8CA9A0923A451249D3FAEAA"
+  "3512147BF4DC31",
+  "E5C721E61695DB41FF3A288B94723A35586958F94A485F077A320927CA56F071"
+  "D3270455EFC4BE",
+  "687B6BFD3807B447E418C8006C87A375AD55CEC555FA154A73EE361B62BBDA16"
+  "875EDE631F445D",
+  "D02AF8F31CBB393AD812053B8F8FF5D243F9CA6715157B41FA5BBB943CB8B999"
+  "E5D7366DDDBD80",
+  "83F68DD5B1DF1EACB7FC68B15DDE6148566C67E94AA417089D122934A5E58B7B"
+  "16FCE8D4259AFB",
+  "5CD4CCEC248A2C0C06BD4F9F0C967C3C6210C49699158AF8797E1EAEAE2B2E86"
+  "AE5EA09F477CA4",
+  "4B5B4ABDFB2B7A23357AED8D47F5831C3B5C903F4F581FA0E2EBAAE77D4D751A"
+  "CC25908F920C10",
+  "879666073F6C9A1EEE05FDDB79E8A8874CDDAC96F59C3F3018EB2270FB39974C"
+  "31E9A06C90D42F",
+  "9D20AC68C374B373EF09844D560782737159DC633E756F1ECE853767EEF0CC15"
+  "D552513340EC62",
+  "C25538F29C345A8BB0874CDA87D2C1E21DEAA25F47B91AC251BB511B033D39C1"
+  "CE43ADC10E8EBF",
+  "07E504972B22C6C5AEA5794E54B2A58D5C16FFD31EBC1816E2FE5732A7910279"
+  "D0A06D20E1CF0C",
+  "67019C517B020AE1797D0AF705FD8B6019379F49E024469790FB7C2FCCD9D7B3"
+  "E811046F3EE502",
+  "9608EF5127204615A1D54DD391E7D9D06547501222799C83CA59940C2649EF37"
+  "DEC69D6788ACAB",
+  "E7E69C3DCFFDF7E43EA98463D71D342DD841E49D3CA737FDEF42AAA828F71AD2"
+  "3F7A738A3C26FA",
+  "C9DF96FEB752C1110A97DF33B01354ACA5CA51C3AA64A1F4B8ABE1546F4EBF90"
+  "CA4A5C41C7F913",
+  "94103789DE1CFE6C7224F1E6EC9D6770835AA1F67E28B7FC2CA5AA41FD60A22F"
+  "2E3279F302917D",
+  "395E5BEF851170FF7CBBCBF80F4B1A4D416021564AD98ACE3E9575C1E19B8E96"
+  "3639E4D22CD157",
+  "3A2AFB91AB721DC28C0C6F1AF77E9D2C5D6871F140E04B1676CEB1A47B7DA4DA"
+  "F420BF000F8BFF",
+  "51C19FE51C8243FABAFB5FB96D7D5BDDCE1C32254B01D5483E3154BF71E7C6B0"
+  "59E094EBD9FE42",
+  "2C18D66649EF34615CA1E08499C3FBE09286E6CB4E7EA39CD66A966C82513C50"
+  "01DBC860335118",
+  "0327BF8FB3E51691B45A9D74B468ECC61FAA871027B2B5CFD361814F12DA154B"
+  "CB0C51E27212C3",
+  "8CB4ED059F560EC720E48A83C91D4C34583D25D6B898A39B247B3F14951A50FF"
+  "9CE256F8F01905",
+  "DA785398E9900E2EBC79724BA206342012E77530BC52076D3B9FF7CFE8ABB703"
+  "CAA88A3B6BF83E",
+  "29BBCD6B33407B0379EB0A1F75F2280ED67ED15BFBB245D4AD402A2CDD7C68AE"
+  "DE8018FF9F711C",
+  "A7B9AF5BA1AA580976839229747C9E32819D07404EB3C148918B03D85F476A0D"
+  "231DE42D6700EC0B",
+  "856BB76C8303BAED048857DC8F4FA64FDD771872F015F9C32CD7BEB711883DC5"
+  "C681544B76FB40FB",
+  "61F21F52F734DE97470759FE3D8DA771394954F6BA860F7DE2C9C76BFC9D25ED"
+  "AF06206E74853B5B",
+  "F47A27A733CAD59F854515A5037064ED5BD792C96401F134EE0476ADB8FDFD44"
+  "B2844E0C42228FA7",
+  "FC031199111E50E10D1AD8861667E7F8CF308B3AB0BE1B808717F34F41BB5999"
+  "FF419CEA2F11F74A",
+  "B26BC1BB0ADAD5E7BE5DBCA2B6977E3CCD844CA7DF4CF1BFC2B6C148E1FDA75F"
+  "00020DE88F8BACBD",
+  "F04A60FD57745B44F25AA865B2B970C3B47B19B5188E821E9C398465AAFA84D8"
+  "D6E28A49B99650D6",
+  "FC23B49327725241E6584EEB0F5552954C03B0E1C1F6F3F349ED98C7B8DA20BA"
+  "CE6C0B79AD0FC7CE",
+  "B2212662BE9F32CE4574E23BB10FCE826FBF9360CFB879C911BAA340DC82A271"
+  "9538F9653BF4593B",
+  "652078D9074135697F777C8F013137002A17042BC8CA9A302F165DA568D7E10D"
+  "0BCC2A8ABE9AA9EC",
+  "E5C721E61695DB41FF3A288B94723A35586958F94A485FAF6DE9006F516F2B59"
+  "557AA129BF9A4115",
+  "687B6BFD3807B447E418C8006C87A375AD55CEC555FA154FD43D5B3741A75B84"
+  "D7403574E9C5CEA1",
+  "D02AF8F31CBB393AD812053B8F8FF5D243F9CA6715157B98EAE5D3FA6EA1D025"
+  "4DEB0AABD13C5F7B",
+  "83F68DD5B1DF1EACB7FC68B15DDE6148566C67E94AA4176526E837E3CA30DB3F"
+  "0D8C7C2B69A0DAB1",
+  "5CD4CCEC248A2C0C06BD4F9F0C967C3C6210C49699158AEBDCFA567406EAD296"
+  "8F18C6393507AF4E",
+  "4B5B4ABDFB2B7A23357AED8D47F5831C3B5C903F4F581F552101C236EFBE5AD8"
+  "0CF766EA53BB6135",
+  "879666073F6C9A1EEE05FDDB79E8A8874CDDAC96F59C3FBEB47CFC50A58ADA6C"
+  "4B7B2550A4C7FA68",
+  "9D20AC68C374B373EF09844D560782737159DC633E756FBA8E8F11D1B943FF81"
+  "08D5C3A59B5FA76F",
+  "C25538F29C345A8BB0874CDA87D2C1E21DEAA25F47B91A4F299AE4335863DC9A"
+  "819BCE37DDE50F02",
+  "07E504972B22C6C5AEA5794E54B2A58D5C16FFD31EBC188AA49D62DEC1F1D7BC"
+  "4D0F65110FEBD19A",
+  "67019C517B020AE1797D0AF705FD8B6019379F49E02446089304E5A665ED5FAE"
+  "0F59829F0128AA79",
+  "9608EF5127204615A1D54DD391E7D9D06547501222799CE81CFDF42EC369E6E4"
+  "DA2F66A4E7A92884",
+  "E7E69C3DCFFDF7E43EA98463D71D342DD841E49D3CA7375E2251A02C4926CDF2"
+  "E18869EC1424CE1D",
+  "C9DF96FEB752C1110A97DF33B01354ACA5CA51C3AA64A1CFC695146C2DC2B0CA"
+  "1ED3C2F1E34F7DB9",
+  "94103789DE1CFE6C7224F1E6EC9D6770835AA1F67E28B7FE4D893A4C01343A5A"
+  "8A3F029407E72832",
+  "395E5BEF851170FF7CBBCBF80F4B1A4D416021564AD98AD0DF637E52EAE31DBB"
+  "D1CA063360F130AC",
+  "3A2AFB91AB721DC28C0C6F1AF77E9D2C5D6871F140E04B2502AD4B26C7859544"
+  "D37D4553B4DDFB20",
+  "51C19FE51C8243FABAFB5FB96D7D5BDDCE1C32254B01D5A514BD6DA06C696D78"
+  "E73771B206C12C40",
+  "2C18D66649EF34615CA1E08499C3FBE09286E6CB4E7EA3D125482607E2D12707"
+  "FBF91AF29A438BD1",
+  "0327BF8FB3E51691B45A9D74B468ECC61FAA871027B2B59E4268BAD1583FD57C"
+  "9363278F56E69F6E",
+  "8CB4ED059F560EC720E48A83C91D4C34583D25D6B898A3B9EC18027F6B237AF0"
+  "EAD96FC9C0D4F249",
+  "DA785398E9900E2EBC79724BA206342012E77530BC52075B0503F228ECEDD8E3"
+  "2846CBEB83E08152",
+  "29BBCD6B33407B0379EB0A1F75F2280ED67ED15BFBB2454C46E5186D02B984B9"
+  "BBBD13BC4DA6E466",
+  "A7B9AF5BA1AA580976839229747C9E32819D07404EB3C148F2DC5EDB9317AA7E"
+  "BD1F5557328F3E2221",
+  "856BB76C8303BAED048857DC8F4FA64FDD771872F015F9C33DBDBCFA0BCE34A3"
+  "F048BADF0B0CAF2107",
+  "61F21F52F734DE97470759FE3D8DA771394954F6BA860F7DCA374EDCBD613B95"
+  "8B86E5B0FB1919CA2F",
+  "F47A27A733CAD59F854515A5037064ED5BD792C96401F13499D172CF8F3F5919"
+  "C20ED43900EA9D0CAC",
+  "FC031199111E50E10D1AD8861667E7F8CF308B3AB0BE1B804E4E1A43F8ADC9DA"
+  "CC5C1DC68F560EC312",
+  "B26BC1BB0ADAD5E7BE5DBCA2B6977E3CCD844CA7DF4CF1BFE2D573BC443BF317"
+  "E913742D4A133C73EF",
+  "F04A60FD57745B44F25AA865B2B970C3B47B19B5188E821E3455EA13A1178BE4"
+  "3C2F978BE8361224FB",
+  "FC23B49327725241E6584EEB0F5552954C03B0E1C1F6F3F337DDE5CCE02B832F"
+  "4B4F1BCC52AE931E49",
+  "B2212662BE9F32CE4574E23BB10FCE826FBF9360CFB879C993D7832908CD197E"
+  "70280D2DD8435FEAE7",
+  "652078D9074135697F777C8F013137002A17042BC8CA9A30BA2A7EE1D86FA4D1"
+  "083A14720DCE384E1E",
+  "E5C721E61695DB41FF3A288B94723A35586958F94A485FAF584A3C8E2A28F9CE"
+  "BA4A8DBB2351115F33",
+  "687B6BFD3807B447E418C8006C87A375AD55CEC555FA154FA778D40C0E5A2F2D"
+  "437F08C659666C2ED5",
+  "D02AF8F31CBB393AD812053B8F8FF5D243F9CA6715157B984EF51B9F81397535"
+  "A5C2E387A47521B395",
+  "83F68DD5B1DF1EACB7FC68B15DDE6148566C67E94AA417652FE8C6D905B308B1"
+  "37AD5260906DDE3D2C",
+  "5CD4CCEC248A2C0C06BD4F9F0C967C3C6210C49699158AEBAD32E856DAEBBC6A"
+  "2C702C847807AC90AF",
+  "4B5B4ABDFB2B7A23357AED8D47F5831C3B5C903F4F581F55A8DA170C25E84394"
+  "E20CEB1132B4B70CC0",
+  "879666073F6C9A1EEE05FDDB79E8A8874CDDAC96F59C3FBEDE410878439CB694"
+  "F3105769A0588E9DEB",
+  "9D20AC68C374B373EF09844D560782737159DC633E756FBA41D12D3D97DA3467"
+  "C6599222E1748AF88D",
+  "C25538F29C345A8BB0874CDA87D2C1E21DEAA25F47B91A4FC187D45612CA18E2"
+  "9CEAB024377B26E355",
+  "07E504972B22C6C5AEA5794E54B2A58D5C16FFD31EBC188A36063A772084078B"
+  "14CF56F7658DB6EC84",
+  "67019C517B020AE1797D0AF705FD8B6019379F49E02446083C2E6653EAE5A848"
+  "385EEFD1826226EB66",
+  "9608EF5127204615A1D54DD391E7D9D06547501222799CE8537DC1F09E60A0B6"
+  "0C91C40BB8C486DD5A",
+  "E7E69C3DCFFDF7E43EA98463D71D342DD841E49D3CA7375EAE9B3C2AB14F70AC"
+  "9C6335C1E301E3023D",
+  "C9DF96FEB752C1110A97DF33B01354ACA5CA51C3AA64A1CFE9BF429A60315CD9"
+  "A1B852B0DC52F5FE53",
+  "94103789DE1CFE6C7224F1E6EC9D6770835AA1F67E28B7FE2BAFB2BB04555475"
+  "A15DBB119924A94C16",
+  "395E5BEF851170FF7CBBCBF80F4B1A4D416021564AD98AD0E7D69EEDCF517FD5"
+  "82F374D42DCF69A686",
+  "3A2AFB91AB721DC28C0C6F1AF77E9D2C5D6871F140E04B254C11F97DA119DB05"
+  "C1A981EF2F1DD483DF",
+  "51C19FE51C8243FABAFB5FB96D7D5BDDCE1C32254B01D5A525C45B64C58FBD2E"
+  "F66303EABC169A6A7A",
+  "2C18D66649EF34615CA1E08499C3FBE09286E6CB4E7EA3D1189FE50B98FF6378"
+  "551C02A5E8F9F95B43",
+  "0327BF8FB3E51691B45A9D74B468ECC61FAA871027B2B59E6EF98500C75FA1E6"
+  "95AFED6215267E25E1",
+  "8CB4ED059F560EC720E48A83C91D4C34583D25D6B898A3B9BF5F50768C50DEDC"
+  "D0557070B8E66AB418",
+  "DA785398E9900E2EBC79724BA206342012E77530BC52075B7DD9D450659A394E"
+  "0D46BDCE6FEF9F3DE5",
+  "29BBCD6B33407B0379EB0A1F75F2280ED67ED15BFBB2454C7C2F7950D12007EF"
+  "284169D948928461A3",
+  "A7B9AF5BA1AA580976839229747C9E32819D07404EB3C148F20808AE76911BF6"
+  "31E2EBF3CEDE6EF73D18",
+  "856BB76C8303BAED048857DC8F4FA64FDD771872F015F9C33D0EE8AD88D1A977"
+  "51BB3920A4374F8F3D5C",
+  "61F21F52F734DE97470759FE3D8DA771394954F6BA860F7DCAD2C6F06215EEA0"
+  "8DF293325D191F7EA495",
+  "F47A27A733CAD59F854515A5037064ED5BD792C96401F1349995CDDF29B5DE11"
+  "E6116308E69B5ABCC7F8",
+  "FC031199111E50E10D1AD8861667E7F8CF308B3AB0BE1B804E6B73DC408DC41F"
+  "A4BA36BF4BD63E14BDE9",
+  "B26BC1BB0ADAD5E7BE5DBCA2B6977E3CCD844CA7DF4CF1BFE280111364F2787A"
+  "2488FC2A1262FCDC2FE7",
+  "F04A60FD57745B44F25AA865B2B970C3B47B19B5188E821E34BBDBF92BA4A052"
+  "03D2B931E9AD373F75A4",
+  "FC23B49327725241E6584EEB0F5552954C03B0E1C1F6F3F33747765850699072"
+  "AD283F5A6C3637DB3ED9",
+  "B2212662BE9F32CE4574E23BB10FCE826FBF9360CFB879C993F0D20A7EDA2B89"
+  "E777F9F14EEF253474C5",
+  "652078D9074135697F777C8F013137002A17042BC8CA9A30BA0B640579B97D7C"
+  "CDBB6B1B376F294BF40E",
+  "E5C721E61695DB41FF3A288B94723A35586958F94A485FAF58E768E533F1CC70"
+  "0A867E68699393CF4081",
+  "687B6BFD3807B447E418C8006C87A375AD55CEC555FA154FA7CDF935919EA0C6"
+  "B1878DF43946BB208B5A",
+  "D02AF8F31CBB393AD812053B8F8FF5D243F9CA6715157B984EEDF3C04B392704"
+  "EFDD8984B1F198E32BEE",
+  "83F68DD5B1DF1EACB7FC68B15DDE6148566C67E94AA417652FD1CA7A282BC8A3"
+  "F225CE6ECAC181EDC0EF",
+  "5CD4CCEC248A2C0C06BD4F9F0C967C3C6210C49699158AEBADB175834BE457AB"
+  "1B13931D7880458EF103",
+  "4B5B4ABDFB2B7A23357AED8D47F5831C3B5C903F4F581F55A8A6DC5FBF9A877F"
+  "50BDEFF5A8E9C9019529",
+  "879666073F6C9A1EEE05FDDB79E8A8874CDDAC96F59C3FBEDE86AFE12C2CFECD"
+  "302AA821571FD21050EF",
+  "9D20AC68C374B373EF09844D560782737159DC633E756FBA41958891BE197592"
+  "AC415B34876DCF82B5B8",
+  "C25538F29C345A8BB0874CDA87D2C1E21DEAA25F47B91A4FC1A9B3D81A73C8A0"
+  "27B9702C27339D79DB66",
+  "07E504972B22C6C5AEA5794E54B2A58D5C16FFD31EBC188A3682D1BB2C6BAC17"
+  "2D7ADEDD4AD0FEA956F2",
+  "67019C517B020AE1797D0AF705FD8B6019379F49E02446083C4835F9325A99FA"
+  "277BEDE77CD69F0DE1DC",
+  "9608EF5127204615A1D54DD391E7D9D06547501222799CE853AC51D72F044FDF"
+  "ECAD2240A9AF4D149875",
+  "E7E69C3DCFFDF7E43EA98463D71D342DD841E49D3CA7375EAE8B9DCB91724EA6"
+  "C9B2F9EFED1152529014",
+  "C9DF96FEB752C1110A97DF33B01354ACA5CA51C3AA64A1CFE9964081354ABF14"
+  "FE40AB53EA8A0A99C3F7",
+  "94103789DE1CFE6C7224F1E6EC9D6770835AA1F67E28B7FE2B8E972CC3720A6C"
+  "811B6B8546CCF3260642",
+  "395E5BEF851170FF7CBBCBF80F4B1A4D416021564AD98AD0E7E8F0EFF768D688"
+  "F66D7C8B25A2705C0EF1",
+  "3A2AFB91AB721DC28C0C6F1AF77E9D2C5D6871F140E04B254C34C56908717A29"
+  "DC768A5DE801C8DC5003",
+  "51C19FE51C8243FABAFB5FB96D7D5BDDCE1C32254B01D5A52577AF16769BE2D8"
+  "A7628FA9CD668A83BA40",
+  "2C18D66649EF34615CA1E08499C3FBE09286E6CB4E7EA3D1186BECB6F1B1672B"
+  "2EFC3674C93BD9DCF140",
+  "0327BF8FB3E51691B45A9D74B468ECC61FAA871027B2B59E6E422DEA4B423EC1"
+  "BCD9606A6AB7C8C2C530",
+  "8CB4ED059F560EC720E48A83C91D4C34583D25D6B898A3B9BF182ECC2CC26676"
+  "32609A837579E695712F",
+  "DA785398E9900E2EBC79724BA206342012E77530BC52075B7DDB4E182347FC00"
+  "6929B78FE79D646D2E93",
+  "29BBCD6B33407B0379EB0A1F75F2280ED67ED15BFBB2454C7C1B7B566586C039"
+  "CC0AB0927FC268E16064",
+  "A7B9AF5BA1AA580976839229747C9E32819D07404EB3C148F208B08420DE7421"
+  "7F0C558A7DDCEB839FB402",
+  "856BB76C8303BAED048857DC8F4FA64FDD771872F015F9C33D0ED4DE809EC0BB"
+  "954733FBBDFB57390A427C",
+  "61F21F52F734DE97470759FE3D8DA771394954F6BA860F7DCAD2D5C98DF18423"
+  "925564AD837566194A73B7",
+  "F47A27A733CAD59F854515A5037064ED5BD792C96401F134999537FB63F8D7A7"
+  "421AF319F4D359CCD27325",
+  "FC031199111E50E10D1AD8861667E7F8CF308B3AB0BE1B804E6BF42BCB8C2AF2"
+  "7D34CEE582F394FB0ACA34",
+  "B26BC1BB0ADAD5E7BE5DBCA2B6977E3CCD844CA7DF4CF1BFE2803E5D2BF8374B"
+  "C0F51ABE7612032CED0DAD",
+  "F04A60FD57745B44F25AA865B2B970C3B47B19B5188E821E34BB6B022CE25B1C"
+  "8A9079D5136E592D43A269",
+  "FC23B49327725241E6584EEB0F5552954C03B0E1C1F6F3F3374737DF118B1B2D"
+  "BA3F945AF648BE23BA67AD",
+  "B2212662BE9F32CE4574E23BB10FCE826FBF9360CFB879C993F023EF2DDED354"
+  "BC96838B0DCE267A9C16A5",
+  "652078D9074135697F777C8F013137002A17042BC8CA9A30BA0B1ED26BE2EA92"
+  "5B1A0A82FA5A1D99B12BCD",
+  "E5C721E61695DB41FF3A288B94723A35586958F94A485FAF58E7DAD300670516"
+  "A499775DE2B8229ACBB5B9",
+  "687B6BFD3807B447E418C8006C87A375AD55CEC555FA154FA7CD7A5226756E53"
+  "47D218761C92D17DDF8BEC",
+  "D02AF8F31CBB393AD812053B8F8FF5D243F9CA6715157B984EED2B5DE83E9C26"
+  "6BAAB3F905533BA2F057AE",
+  "83F68DD5B1DF1EACB7FC68B15DDE6148566C67E94AA417652FD16EC79E9E084E"
+  "B5BD1824303F29ADD35DBC",
+  "5CD4CCEC248A2C0C06BD4F9F0C967C3C6210C49699158AEBADB18625B39C27A6"
+  "8FB2182381EB9D8D405F93",
+  "4B5B4ABDFB2B7A23357AED8D47F5831C3B5C903F4F581F55A8A6515F84135D8B"
+  "B900D8AD7AA6D90C921806",
+  "879666073F6C9A1EEE05FDDB79E8A8874CDDAC96F59C3FBEDE867F528F4AB96F"
+  "43FBD797C9859745DD01CE",
+  "9D20AC68C374B373EF09844D560782737159DC633E756FBA4195B3DF0CB47A9F"
+  "043665619495339781AC0D",
+  "C25538F29C345A8BB0874CDA87D2C1E21DEAA25F47B91A4FC1A976E0B8E89860"
+  "6A705AB78FB6AE4092F2F8",
+  "07E504972B22C6C5AEA5794E54B2A58D5C16FFD31EBC188A3682AEA2FC6F318F"
+  "EBD8750B0222ED2B22082B",
+  "67019C517B020AE1797D0AF705FD8B6019379F49E02446083C482BC99FEE3973"
+  "1589524EA9F5D2B293A387",
+  "9608EF5127204615A1D54DD391E7D9D06547501222799CE853AC6D2DDADEADDD"
+  "273A68D54EFC2C57738F7C",
+  "E7E69C3DCFFDF7E43EA98463D71D342DD841E49D3CA7375EAE8BC4226078632E"
+  "91C6D895FD02D6C1E63C9A",
+  "C9DF96FEB752C1110A97DF33B01354ACA5CA51C3AA64A1CFE996DBBC8FCDEE2A"
+  "BE52EC850C7BE52719DE4F",
+  "94103789DE1CFE6C7224F1E6EC9D6770835AA1F67E28B7FE2B8EB61F6C4CC188"
+  "5A4AC5EBB1722060D855BB",
+  "395E5BEF851170FF7CBBCBF80F4B1A4D416021564AD98AD0E7E89D706DF4A92B"
+  "2C2F67BF6A83FD4E747CDB",
+  "3A2AFB91AB721DC28C0C6F1AF77E9D2C5D6871F140E04B254C34AFD0A8FAF4D1"
+  "EF8F56EBB34FCA84D7213C",
+  "51C19FE51C8243FABAFB5FB96D7D5BDDCE1C32254B01D5A525779CD97705E0C3"
+  "94F91D7E0480D6BDE59D85",
+  "2C18D66649EF34615CA1E08499C3FBE09286E6CB4E7EA3D1186B099593E823C1"
+  "F563E9B1E5D5D1010AA503",
+  "0327BF8FB3E51691B45A9D74B468ECC61FAA871027B2B59E6E4263838D92CAD6"
+  "B1764512B28809BEBCFC5B",
+  "8CB4ED059F560EC720E48A83C91D4C34583D25D6B898A3B9BF181A04D5330DA3"
+  "DB0C30A6054B47582DDCF7",
+  "DA785398E9900E2EBC79724BA206342012E77530BC52075B7DDBA00742B6674E"
+  "F9B6B89ABC021077F6714E",
+  "29BBCD6B33407B0379EB0A1F75F2280ED67ED15BFBB2454C7C1B73745BA44D9E"
+  "17F06EA4BDD8FA8C55E50F",
+  "A7B9AF5BA1AA580976839229747C9E32819D07404EB3C148F208B0BF27E4C948"
+  "A27BE5E3B61AE72079FDCB84",
+  "856BB76C8303BAED048857DC8F4FA64FDD771872F015F9C33D0ED46729E7518B"
+  "6125707C412940CEF217EB36",
+  "61F21F52F734DE97470759FE3D8DA771394954F6BA860F7DCAD2D5CDCB55D7B1"
+  "132630E35CE985EFF9FBEC31",
+  "F47A27A733CAD59F854515A5037064ED5BD792C96401F134999537E40AB25BDA"
+  "46EE6A13383E2647ED0CA8B3",
+  "FC031199111E50E10D1AD8861667E7F8CF308B3AB0BE1B804E6BF426202BA8C9"
+  "9CE891D1CD3E179973ACE689",
+  "B26BC1BB0ADAD5E7BE5DBCA2B6977E3CCD844CA7DF4CF1BFE2803ECDDFA2F01B"
+  "EC648E3B0C8D4FC77BB73159",
+  "F04A60FD57745B44F25AA865B2B970C3B47B19B5188E821E34BB6BEAFD16E842"
+  "D9C1F87768A8DB4702FF3CA4",
+  "FC23B49327725241E6584EEB0F5552954C03B0E1C1F6F3F33747374C98D1DC37"
+  "08AE0D6A64E3223DF5B62080",
+  "B2212662BE9F32CE4574E23BB10FCE826FBF9360CFB879C993F023800A443C28"
+  "C717B3811E5929113D9EA337",
+  "652078D9074135697F777C8F013137002A17042BC8CA9A30BA0B1E7EE558FCF1"
+  "E56BA237AAC026CB6E77E6CA",
+  "E5C721E61695DB41FF3A288B94723A35586958F94A485FAF58E7DA67A669A39F"
+  "A2CA096954500231CDC0A81D",
+  "687B6BFD3807B447E418C8006C87A375AD55CEC555FA154FA7CD7A24C22300B3"
+  "BDB88776B0571143EEDA060A",
+  "D02AF8F31CBB393AD812053B8F8FF5D243F9CA6715157B984EED2BB6BA62B83F"
+  "227B086A6A09FCC97E778C2A",
+  "83F68DD5B1DF1EACB7FC68B15DDE6148566C67E94AA417652FD16E5AA4E42D5A"
+  "17ACAADD5529BBEF367871A3",
+  "5CD4CCEC248A2C0C06BD4F9F0C967C3C6210C49699158AEBADB186B347906260"
+  "C6EEB913436A6334C8E521C3",
+  "4B5B4ABDFB2B7A23357AED8D47F5831C3B5C903F4F581F55A8A6516645E26E15"
+  "2245055C198902CBBB4D28AE",
+  "879666073F6C9A1EEE05FDDB79E8A8874CDDAC96F59C3FBEDE867F5E8421AC31"
+  "1A3AD5E694B292C45D64F88A",
+  "9D20AC68C374B373EF09844D560782737159DC633E756FBA4195B3F62C1D4AE6"
+  "C4596DD7433FBFFEBB99D0E0",
+  "C25538F29C345A8BB0874CDA87D2C1E21DEAA25F47B91A4FC1A976884A8A20A4"
+  "FF793C8A8F1190293CA5DAE5",
+  "07E504972B22C6C5AEA5794E54B2A58D5C16FFD31EBC188A3682AEECB8B74276"
+  "66D7D54A6F641E08BBECA382",
+  "67019C517B020AE1797D0AF705FD8B6019379F49E02446083C482B2BD8B53491"
+  "451989259B2FA8C04D3C5041",
+  "9608EF5127204615A1D54DD391E7D9D06547501222799CE853AC6D355A159F6F"
+  "5E4234EDAA273658AD092955",
+  "E7E69C3DCFFDF7E43EA98463D71D342DD841E49D3CA7375EAE8BC4A1EE8DCF2F"
+  "09A9932F6D169F5CAB240989",
+  "C9DF96FEB752C1110A97DF33B01354ACA5CA51C3AA64A1CFE996DBC4F3460186"
+  "84BCA1A1483EB79F7B8E6186",
+  "94103789DE1CFE6C7224F1E6EC9D6770835AA1F67E28B7FE2B8EB66052D1EA2F"
+  "9705C21BA6C034608C5639F0",
+  "395E5BEF851170FF7CBBCBF80F4B1A4D416021564AD98AD0E7E89D9881580D8B"
+  "77B1787D43F693C326E90838",
+  "3A2AFB91AB721DC28C0C6F1AF77E9D2C5D6871F140E04B254C34AFD39CEEC1A0"
+  "526D1C7A96EC498FDD569FF5",
+  "51C19FE51C8243FABAFB5FB96D7D5BDDCE1C32254B01D5A525779CA4A107619C"
+  "CBE67ABE77B51BA51032DB23",
+  "2C18D66649EF34615CA1E08499C3FBE09286E6CB4E7EA3D1186B09ACA3171BFF"
+  "15D7B1B2208FAAADBDC272B7",
+  "0327BF8FB3E51691B45A9D74B468ECC61FAA871027B2B59E6E42638729EED94F"
+  "341F568D0EFFF314D8652C2A",
+  "8CB4ED059F560EC720E48A83C91D4C34583D25D6B898A3B9BF181A21FA3BEC11"
+  "A8ADAEF0BF21B23B9AD0B11C",
+  "DA785398E9900E2EBC79724BA206342012E77530BC52075B7DDBA0F67723EA43"
+  "76E27ED760A0663C4CB6424D",
+  "29BBCD6B33407B0379EB0A1F75F2280ED67ED15BFBB2454C7C1B73883A3953FB"
+  "58E5C3204AEA0573A0AB8F01",
+  "A7B9AF5BA1AA580976839229747C9E32819D07404EB3C148F208B0BFFFE4BD08"
+  "EAD10ADA775A93A65E1A9D2659",
+  "856BB76C8303BAED048857DC8F4FA64FDD771872F015F9C33D0ED46766AB2230"
+  "8E7F0ED1D7E89F4D52C31E0EDF",
+  "61F21F52F734DE97470759FE3D8DA771394954F6BA860F7DCAD2D5CD2CD48363"
+  "B951645F2310B6C2B56D9A2C7E",
+  "F47A27A733CAD59F854515A5037064ED5BD792C96401F134999537E422D1B441"
+  "96C7EB4985FEEB9A22B3152DD8",
+  "FC031199111E50E10D1AD8861667E7F8CF308B3AB0BE1B804E6BF42630F3D2B9"
+  "365CBE9D64358C476B3C8E2AAA",
+  "B26BC1BB0ADAD5E7BE5DBCA2B6977E3CCD844CA7DF4CF1BFE2803ECD691CB9DF"
+  "DE349F4735AE4C0800EA021A6E",
+  "F04A60FD57745B44F25AA865B2B970C3B47B19B5188E821E34BB6BEAB44D2ADB"
+  "348B732DAD56B077FD89AD3AA2",
+  "FC23B49327725241E6584EEB0F5552954C03B0E1C1F6F3F33747374C6E0DB8C6"
+  "8CE88A518AD4CA05C377785D80",
+  "B2212662BE9F32CE4574E23BB10FCE826FBF9360CFB879C993F02380D8F2E2EB"
+  "F682584C3FC141D29BA64D398E",
+  "652078D9074135697F777C8F013137002A17042BC8CA9A30BA0B1E7EDB8D8F24"
+  "EB392A5643D1C9256865B43CF0",
+  "E5C721E61695DB41FF3A288B94723A35586958F94A485FAF58E7DA67E53A6826"
+  "4DA2F40EBD10900725684B0A91",
+  "687B6BFD3807B447E418C8006C87A375AD55CEC555FA154FA7CD7A24D784B32E"
+  "18DA31C0DDE5E7ABCF6998D24B",
+  "D02AF8F31CBB393AD812053B8F8FF5D243F9CA6715157B984EED2BB67758F740"
+  "4479A81E1EBF2A79BA8A22180D",
+  "83F68DD5B1DF1EACB7FC68B15DDE6148566C67E94AA417652FD16E5A7DCC204A"
+  "0F0E857846EF53A18299A865B5",
+  "5CD4CCEC248A2C0C06BD4F9F0C967C3C6210C49699158AEBADB186B3601DAE11"
+  "0A10EE01FDF25D796C6E41050B",
+  "4B5B4ABDFB2B7A23357AED8D47F5831C3B5C903F4F581F55A8A6516621AAF74C"
+  "CF6F291B0DC78675074405A65B",
+  "879666073F6C9A1EEE05FDDB79E8A8874CDDAC96F59C3FBEDE867F5EA80014CB"
+  "AC4F300586459C25F997D144D5",
+  "9D20AC68C374B373EF09844D560782737159DC633E756FBA4195B3F6B33FC332"
+  "17D59D475200FC7C2A61FB55DE",
+  "C25538F29C345A8BB0874CDA87D2C1E21DEAA25F47B91A4FC1A97688DEC22A1E"
+  "400414B68121AF5E2F109FD7FE",
+  "07E504972B22C6C5AEA5794E54B2A58D5C16FFD31EBC188A3682AEEC31B35ED8"
+  "A4A64A4FA5B22650B56786AE0A",
+  "67019C517B020AE1797D0AF705FD8B6019379F49E02446083C482B2B720C1D79"
+  "B011A77DF8F5BF2A70EA7ED790",
+  "9608EF5127204615A1D54DD391E7D9D06547501222799CE853AC6D3515FF53BD"
+  "6FDBB2D21E3FCA149978A1ABDE",
+  "E7E69C3DCFFDF7E43EA98463D71D342DD841E49D3CA7375EAE8BC4A100C3C982"
+  "1C685F77819448856FA45F2820",
+  "C9DF96FEB752C1110A97DF33B01354ACA5CA51C3AA64A1CFE996DBC4B4C1D499"
+  "0FF2919683A5C9805BECEEE2B8",
+  "94103789DE1CFE6C7224F1E6EC9D6770835AA1F67E28B7FE2B8EB6606147E9AD"
+  "394128819C967F265BA1B3D62E",
+  "395E5BEF851170FF7CBBCBF80F4B1A4D416021564AD98AD0E7E89D9848507866"
+  "819F9D3BEBE0AED706C7C07AEC",
+  "3A2AFB91AB721DC28C0C6F1AF77E9D2C5D6871F140E04B254C34AFD3828EBA52"
+  "FDE03758FAE2DF143EF412EEF0",
+  "51C19FE51C8243FABAFB5FB96D7D5BDDCE1C32254B01D5A525779CA4F7AE61C2"
+  "0FEEFF00875987C05320BB2D09",
+  "2C18D66649EF34615CA1E08499C3FBE09286E6CB4E7EA3D1186B09ACF6AAFDB0"
+  "B494C58A08EFBA10DED71EB01F",
+  "0327BF8FB3E51691B45A9D74B468ECC61FAA871027B2B59E6E4263878C94F4BF"
+  "E40F3BEE6376BA644AE9AF78CF",
+  "8CB4ED059F560EC720E48A83C91D4C34583D25D6B898A3B9BF181A219311C9E3"
+  "CA3E06116A5A18C85F1F261C94",
+  "DA785398E9900E2EBC79724BA206342012E77530BC52075B7DDBA0F62259F92C"
+  "CC8D29AF370865DCE091519067",
+  "29BBCD6B33407B0379EB0A1F75F2280ED67ED15BFBB2454C7C1B7388BE6ADD64"
+  "A2AEEB99323290A360A41DA943",
+  "A7B9AF5BA1AA580976839229747C9E32819D07404EB3C148F208B0BFFF1668B7"
+  "8AF077A74A617BEECA266951A726",
+  "856BB76C8303BAED048857DC8F4FA64FDD771872F015F9C33D0ED46766BA2858"
+  "67F0E4D367353E63A68945780ED3",
+  "61F21F52F734DE97470759FE3D8DA771394954F6BA860F7DCAD2D5CD2C27D5C1"
+  "B5C8B2475C2F1B0485B5C998569B",
+  "F47A27A733CAD59F854515A5037064ED5BD792C96401F134999537E422674CF6"
+  "5DD9922A282826D34ED1E5B239F4",
+  "FC031199111E50E10D1AD8861667E7F8CF308B3AB0BE1B804E6BF42630E2A9A8"
+  "D52FA382A05BDA8FDD7EEC1FF148",
+  "B26BC1BB0ADAD5E7BE5DBCA2B6977E3CCD844CA7DF4CF1BFE2803ECD699D6F18"
+  "77CCAF5CF6792CC90E9EB2F4A21F",
+  "F04A60FD57745B44F25AA865B2B970C3B47B19B5188E821E34BB6BEAB4E8F6B1"
+  "6039241123CAA67B05E7673E3453",
+  "FC23B49327725241E6584EEB0F5552954C03B0E1C1F6F3F33747374C6E78824C"
+  "9D225897BA7E26BC7CF30C68F467",
+  "B2212662BE9F32CE4574E23BB10FCE826FBF9360CFB879C993F02380D88A84DB"
+  "60F83783316A52B73334B394FFEE",
+  "652078D9074135697F777C8F013137002A17042BC8CA9A30BA0B1E7EDB4994D2"
+  "9818BF5ED314FEB39CEBC3BBF04C",
+  "E5C721E61695DB41FF3A288B94723A35586958F94A485FAF58E7DA67E56ED7CF"
+  "6D63E03DAD3C2E3E01ABDABE7543",
+  "687B6BFD3807B447E418C8006C87A375AD55CEC555FA154FA7CD7A24D7A31C33"
+  "ED290CC97B6FC18162D3ECAFD986",
+  "D02AF8F31CBB393AD812053B8F8FF5D243F9CA6715157B984EED2BB677D66881"
+  "38EF8EB22960533A11174329A42E",
+  "83F68DD5B1DF1EACB7FC68B15DDE6148566C67E94AA417652FD16E5A7D631EA6"
+  "045E839C5318A26D8E290CA4B1D1",
+  "5CD4CCEC248A2C0C06BD4F9F0C967C3C6210C49699158AEBADB186B3606CB640"
+  "F1F534291BFFCBEEC7706E5E4D34",
+  "4B5B4ABDFB2B7A23357AED8D47F5831C3B5C903F4F581F55A8A6516621A0E88B"
+  "F1644FCA6F8E8BA831CCE1A5A788",
+  "879666073F6C9A1EEE05FDDB79E8A8874CDDAC96F59C3FBEDE867F5EA8B6A4A1"
+  "92803040435C202FA69D86EBD2A1",
+  "9D20AC68C374B373EF09844D560782737159DC633E756FBA4195B3F6B343530A"
+  "06162F8D2D1045A54E80294600EB",
+  "C25538F29C345A8BB0874CDA87D2C1E21DEAA25F47B91A4FC1A97688DE0D24CE"
+  "7249BB7F4F2F86DEB5EE08FAF1AB",
+  "07E504972B22C6C5AEA5794E54B2A58D5C16FFD31EBC188A3682AEEC3138CD5A"
+  "3E764995CD5EE0F1B6097EB3583C",
+  "67019C517B020AE1797D0AF705FD8B6019379F49E02446083C482B2B724753B4"
+  "044B121DDF27402BEFD1B79C4F14",
+  "9608EF5127204615A1D54DD391E7D9D06547501222799CE853AC6D3515A36C69"
+  "07209019659158EB8AC9210C684E",
+  "E7E69C3DCFFDF7E43EA98463D71D342DD841E49D3CA7375EAE8BC4A100956457"
+  "96E0F2F4171CC59A06C5EE595197",
+  "C9DF96FEB752C1110A97DF33B01354ACA5CA51C3AA64A1CFE996DBC4B4261CF5"
+  "4F74304703D8F48FC9491D024C0F",
+  "94103789DE1CFE6C7224F1E6EC9D6770835AA1F67E28B7FE2B8EB66061330DFA"
+  "8BD65E0431CD73D76353267BBB0A",
+  "395E5BEF851170FF7CBBCBF80F4B1A4D416021564AD98AD0E7E89D98487A149B"
+  "962021EF6576537BD4BB036700F4",
+  "3A2AFB91AB721DC28C0C6F1AF77E9D2C5D6871F140E04B254C34AFD38282A355"
+  "237349B2E76C4187BA47A83EB507",
+  "51C19FE51C8243FABAFB5FB96D7D5BDDCE1C32254B01D5A525779CA4F7E01815"
+  "EDC1E8792F911461821DDFE16BC6",
+  "2C18D66649EF34615CA1E08499C3FBE09286E6CB4E7EA3D1186B09ACF668D14B"
+  "A39D0CC5611FDBA0E7BA74B5C54F",
+  "0327BF8FB3E51691B45A9D74B468ECC61FAA871027B2B59E6E4263878C2F0336"
+  "074097C856375034F3BAAD7E3846",
+  "8CB4ED059F560EC720E48A83C91D4C34583D25D6B898A3B9BF181A2193BACA06"
+  "4AFB37FCE927DD7AECD7AAE8B5B3",
+  "DA785398E9900E2EBC79724BA206342012E77530BC52075B7DDBA0F622E35A99"
+  "CD889FC56F5E3C7BAA9AC6B7A825",
+  "29BBCD6B33407B0379EB0A1F75F2280ED67ED15BFBB2454C7C1B7388BEBF16D7"
+  "260D0CB9CABD2B7BD98484DDE5EF",
+  "A7B9AF5BA1AA580976839229747C9E32819D07404EB3C148F208B0BFFF16BF05"
+  "360045AA07BA48D789B8801BC09951",
+  "856BB76C8303BAED048857DC8F4FA64FDD771872F015F9C33D0ED46766BAB35B"
+  "D8CFD26A0ED4513975C5B304854D07",
+  "61F21F52F734DE97470759FE3D8DA771394954F6BA860F7DCAD2D5CD2C279D21"
+  "DC924A09243515FD191A7DF59FCF7F",
+  "F47A27A733CAD59F854515A5037064ED5BD792C96401F134999537E42267785F"
+  "79C2633BC003AF436CD43AA98938E4",
+  "FC031199111E50E10D1AD8861667E7F8CF308B3AB0BE1B804E6BF42630E2CDB3"
+  "DF423C966F0E35EAB9367CEF1146B9",
+  "B26BC1BB0ADAD5E7BE5DBCA2B6977E3CCD844CA7DF4CF1BFE2803ECD699DFC9E"
+  "28E439BAC9E2635C644981AD621E82",
+  "F04A60FD57745B44F25AA865B2B970C3B47B19B5188E821E34BB6BEAB4E8AC82"
+  "9A662FB52EC450C2210B52CEAFEC39",
+  "FC23B49327725241E6584EEB0F5552954C03B0E1C1F6F3F33747374C6E783C1C"
+  "E91CC65A7FE76D88DFB7A2F2CFBDDC",
+  "B2212662BE9F32CE4574E23BB10FCE826FBF9360CFB879C993F02380D88AE0A6"
+  "99F82BB7C845C81FD4C76739C8B540",
+  "652078D9074135697F777C8F013137002A17042BC8CA9A30BA0B1E7EDB4904BC"
+  "7C3BC7030E2DE842652FBF5B66C272",
+  "E5C721E61695DB41FF3A288B94723A35586958F94A485FAF58E7DA67E56ED364"
+  "243CFA71CCB2ED769E9E0D2289428C",
+  "687B6BFD3807B447E418C8006C87A375AD55CEC555FA154FA7CD7A24D7A3F670"
+  "B6603C3BDEF1B8D39D435DC9B25CF5",
+  "D02AF8F31CBB393AD812053B8F8FF5D243F9CA6715157B984EED2BB677D6AA62"
+  "631A572FDED4E3510BC1D40BCEBC20",
+  "83F68DD5B1DF1EACB7FC68B15DDE6148566C67E94AA417652FD16E5A7D63C8A3"
+  "8A5D3D0DF90E4F0CB76E8034709998",
+  "5CD4CCEC248A2C0C06BD4F9F0C967C3C6210C49699158AEBADB186B3606C94FA"
+  "1E007B5A95F549878CFF0C58802120",
+  "4B5B4ABDFB2B7A23357AED8D47F5831C3B5C903F4F581F55A8A6516621A0DA7A"
+  "B2C5E1E48EE69CD661F99749DD0DF7",
+  "879666073F6C9A1EEE05FDDB79E8A8874CDDAC96F59C3FBEDE867F5EA8B6A03D"
+  "CF8371BA779166DDA081743FDBECA7",
+  "9D20AC68C374B373EF09844D560782737159DC633E756FBA4195B3F6B343AA28"
+  "A506A756397F588C8204A06BFA480D",
+  "C25538F29C345A8BB0874CDA87D2C1E21DEAA25F47B91A4FC1A97688DE0D386A"
+  "E34B139ED690D2A1398339AFAC1D3D",
+  "07E504972B22C6C5AEA5794E54B2A58D5C16FFD31EBC188A3682AEEC31382827"
+  "502BF1851780D2DF465A70DCC6AC80",
+  "67019C517B020AE1797D0AF705FD8B6019379F49E02446083C482B2B7247ECF7"
+  "2D00D5F4DF9077D9422E2B73B2D0D0",
+  "9608EF5127204615A1D54DD391E7D9D06547501222799CE853AC6D3515A3021A"
+  "A98AE8CCF9F416DBB87369B8C88008",
+  "E7E69C3DCFFDF7E43EA98463D71D342DD841E49D3CA7375EAE8BC4A10095B9BE"
+  "26828E3B3802E77F0B51B349B10963",
+  "C9DF96FEB752C1110A97DF33B01354ACA5CA51C3AA64A1CFE996DBC4B426FA1F"
+  "A94638AC363387EC19E1BD89063BE3",
+  "94103789DE1CFE6C7224F1E6EC9D6770835AA1F67E28B7FE2B8EB66061336C5F"
+  "973B3C221A1BA6A3CB2B46788B52F8",
+  "395E5BEF851170FF7CBBCBF80F4B1A4D416021564AD98AD0E7E89D98487A20A7"
+  "FD86AB46A8133694557DA74BCF59E6",
+  "3A2AFB91AB721DC28C0C6F1AF77E9D2C5D6871F140E04B254C34AFD38282E623"
+  "00E02E3EACA1EA8316CDE5BA44ACAE",
+  "51C19FE51C8243FABAFB5FB96D7D5BDDCE1C32254B01D5A525779CA4F7E02DA0"
+  "5374D8D5FB686B165D779FB7ED0A42",
+  "2C18D66649EF34615CA1E08499C3FBE09286E6CB4E7EA3D1186B09ACF66814F5"
+  "BE626142B786F9C3D9888BF219A327",
+  "0327BF8FB3E51691B45A9D74B468ECC61FAA871027B2B59E6E4263878C2F0637"
+  "7F36EFF04A612B2022B2169D771643",
+  "8CB4ED059F560EC720E48A83C91D4C34583D25D6B898A3B9BF181A2193BA5B7D"
+  "8FC3A80C4B1759216D4E6D81BBE775",
+  "DA785398E9900E2EBC79724BA206342012E77530BC52075B7DDBA0F622E36F45"
+  "09FAAB534651DEF526D435EA0CA8BF",
+  "29BBCD6B33407B0379EB0A1F75F2280ED67ED15BFBB2454C7C1B7388BEBFAA15"
+  "4D7408624E60B0DAB9E4B2656ECA97",
+  "A7B9AF5BA1AA580976839229747C9E32819D07404EB3C148F208B0BFFF16BFDB"
+  "7DFE1EFB45AFC1FCB583D91573065A83",
+  "856BB76C8303BAED048857DC8F4FA64FDD771872F015F9C33D0ED46766BAB334"
+  "35A8F647E756E5993B6E5E8F32A01D24",
+  "61F21F52F734DE97470759FE3D8DA771394954F6BA860F7DCAD2D5CD2C279DBA"
+  "3C224C05049081A62CB9C2A0A98FC46F",
+  "F47A27A733CAD59F854515A5037064ED5BD792C96401F134999537E422677812"
+  "ADCEE3C9F510A34F1B04B50F25CF2BBC",
+  "FC031199111E50E10D1AD8861667E7F8CF308B3AB0BE1B804E6BF42630E2CDB9"
+  "D8C1A583BF75FF887A9E04A9B401F950",
+  "B26BC1BB0ADAD5E7BE5DBCA2B6977E3CCD844CA7DF4CF1BFE2803ECD699DFC89"
+  "FF72DC5918887F67798EFCBFBF16B407",
+  "F04A60FD57745B44F25AA865B2B970C3B47B19B5188E821E34BB6BEAB4E8AC6A"
+  "46D0CDA9B4ACC3656EFC25013EFD5E1B",
+  "FC23B49327725241E6584EEB0F5552954C03B0E1C1F6F3F33747374C6E783C5A"
+  "01B3CB9A8E9AEB2845FFEC839EA05E58",
+  "B2212662BE9F32CE4574E23BB10FCE826FBF9360CFB879C993F02380D88AE01C"
+  "6B224E845A6CBEFF43873E63380D36AF",
+  "652078D9074135697F777C8F013137002A17042BC8CA9A30BA0B1E7EDB4904B2"
+  "7CA141BD85AEEE71212BF10B01B3190E",
+  "E5C721E61695DB41FF3A288B94723A35586958F94A485FAF58E7DA67E56ED335"
+  "3B18C300CB2706DA4FBF589B0F80F3A8",
+  "687B6BFD3807B447E418C8006C87A375AD55CEC555FA154FA7CD7A24D7A3F6AE"
+  "102465C9BC20026208A80D5BDCB25C5D",
+  "D02AF8F31CBB393AD812053B8F8FF5D243F9CA6715157B984EED2BB677D6AA0E"
+  "1EDDF746C554C8DAB206C4A1FA716352",
+  "83F68DD5B1DF1EACB7FC68B15DDE6148566C67E94AA417652FD16E5A7D63C8D9"
+  "6AB2E3CFA95F9A245522A3A0ABEB2E7D",
+  "5CD4CCEC248A2C0C06BD4F9F0C967C3C6210C49699158AEBADB186B3606C948F"
+  "46D618EEDBF0E89B48DDFDF2897EF533",
+  "4B5B4ABDFB2B7A23357AED8D47F5831C3B5C903F4F581F55A8A6516621A0DADE"
+  "1E52EC8CD75C1C9A5E66A9609A0E34CE",
+  "879666073F6C9A1EEE05FDDB79E8A8874CDDAC96F59C3FBEDE867F5EA8B6A0C2"
+  "69E096B402318131C31E6ACB20288C2F",
+  "9D20AC68C374B373EF09844D560782737159DC633E756FBA4195B3F6B343AA04"
+  "9D5E230B3792693B6DCDB6B12AB5C8FF",
+  "C25538F29C345A8BB0874CDA87D2C1E21DEAA25F47B91A4FC1A97688DE0D3864"
+  "00463EEAD5C672EE3980798F3CC4DA00",
+  "07E504972B22C6C5AEA5794E54B2A58D5C16FFD31EBC188A3682AEEC31382882"
+  "0504B95472273FC370426C02939C80F0",
+  "67019C517B020AE1797D0AF705FD8B6019379F49E02446083C482B2B7247EC7D"
+  "EDFAC682B8E5A0430601CEF884567B32",
+  "9608EF5127204615A1D54DD391E7D9D06547501222799CE853AC6D3515A30295"
+  "87F789EF9C6E9453F5F781D95CE488DC",
+  "E7E69C3DCFFDF7E43EA98463D71D342DD841E49D3CA7375EAE8BC4A10095B957"
+  "DF1944B10F96109CCBEDD73ECCA8D7A9",
+  "C9DF96FEB752C1110A97DF33B01354ACA5CA51C3AA64A1CFE996DBC4B426FA1E"
+  "2F4DED0703510871067E41590FED5451",
+  "94103789DE1CFE6C7224F1E6EC9D6770835AA1F67E28B7FE2B8EB66061336C2D"
+  "6CF2487B2C98D72E8BC43B47D49B474F",
+  "395E5BEF851170FF7CBBCBF80F4B1A4D416021564AD98AD0E7E89D98487A20CC"
+  "854C3700705312AC926ED3A81C23E390",
+  "3A2AFB91AB721DC28C0C6F1AF77E9D2C5D6871F140E04B254C34AFD38282E601"
+  "BA864F9735F2D892B55957F6F9ACB6D7",
+  "51C19FE51C8243FABAFB5FB96D7D5BDDCE1C32254B01D5A525779CA4F7E02D8C"
+  "C2048B6BD86BD3255E445C232C5BBDA3",
+  "2C18D66649EF34615CA1E08499C3FBE09286E6CB4E7EA3D1186B09ACF668140C"
+  "87B63AD0B1E4CFFAA2E9C35D8F3B80BE",
+  "0327BF8FB3E51691B45A9D74B468ECC61FAA871027B2B59E6E4263878C2F060F"
+  "0FB6945316336CDD32E639741D52E68D",
+  "8CB4ED059F560EC720E48A83C91D4C34583D25D6B898A3B9BF181A2193BA5B86"
+  "3C7C066EA20D8F2FF3C134D8159536FF",
+  "DA785398E9900E2EBC79724BA206342012E77530BC52075B7DDBA0F622E36F4C"
+  "BCD72FB598300713C4D81A9DB3F4023E",
+  "29BBCD6B33407B0379EB0A1F75F2280ED67ED15BFBB2454C7C1B7388BEBFAA90"
+  "55C2074D2BC87E43DB483B0081429D26",
+};
+
+}
@@ -0,0 +1,1162 @@
+#include "container.hpp"
+#include "fuzz.hpp"
+#include "kat.hpp"
+#include "kat_vectors.hpp"
+#include "lwc.hpp"
+#include "merkle.hpp"
+#include "nonce.hpp"
+#include "pipeline.hpp"
+#include "spsc_ring.hpp"
+#include "uring.hpp"
+#include "xof.hpp"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <getopt.h>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <thread>
+
+// Offline Known Answer Tests & differential fuzzing of Photon-Beetle-{Hash,
+// AEAD}, checking every API variant ( one-shot, in-place, incremental,
+// coroutine based, bulk engine, C-ABI batched & NIST LWC API ) against
+// embedded KAT vectors ( see test/kat_vectors.hpp ) & reference
+// implementation ( see test/reference.hpp ).
+//
+// Permutation backend is chosen at compile-time, so same program is built once
+// per backend, see `make test`.
+//
+// Usage
+//
+//   ./test/a.out [-n <fuzz iterations>] [-s <seed>] [--lwc <dir>]
+//
+// where --lwc points to a directory holding `LWC_HASH_KAT_256.txt`,
+// `LWC_AEAD_KAT_128_128.txt.32` & `LWC_AEAD_KAT_128_128.txt.128`, as shipped
+// with Photon-Beetle submission, in which case they are checked too.
+
+using bytes = std::vector<uint8_t>;
+
+static size_t failures = 0;
+
+static void
+expect(const bool cond, const char* const what, const size_t idx)
+{
+  if (!cond) {
+    std::fprintf(stderr, "KAT mismatch: %s, Count = %zu\n", what, idx + 1);
+    failures++;
+  }
+}
+
+// Checks all Photon-Beetle-Hash routines against given expected digests, one
+// per LWC hash KAT
+static void
+check_hash(const std::vector<bytes>& mds)
+{
+  using namespace photon_beetle;
+  const size_t cnt = mds.size();
+
+  std::vector<bytes> msgs(cnt);
+  for (size_t i = 0; i < cnt; i++) {
+    msgs[i] = photon_kat::kat_bytes(i);
+  }
+
+  bytes md(DIGEST_LEN);
+  for (size_t i = 0; i < cnt; i++) {
+    hash(msgs[i].data(), msgs[i].size(), md.data());
+    expect(md == mds[i], "hash", i);
+
+    for (const size_t chunk : { 1ul, 7ul, 16ul, 61ul }) {
+      hasher h;
+      for (size_t off = 0; off < msgs[i].size(); off += chunk) {
+        h.absorb(msgs[i].data() + off, std::min(chunk, msgs[i].size() - off));
+      }
+      h.finalize(md.data());
+      expect(md == mds[i], "hasher", i);
+    }
+
+    lwc::hash(md.data(), msgs[i].data(), msgs[i].size());
+    expect(md == mds[i], "lwc::hash", i);
+  }
+
+  // coroutine based, bulk engine & C-ABI batched, over all vectors at once
+  std::vector<bytes> coro(cnt, bytes(DIGEST_LEN));
+  std::vector<bytes> bulk(cnt, bytes(DIGEST_LEN));
+  std::vector<sponge_task> tasks;
+  std::vector<job> jobs;
+
+  bytes packed;
+  std::vector<size_t> offs{ 0 };
+
+  for (size_t i = 0; i < cnt; i++) {
+    tasks.push_back(hash_task(msgs[i].data(), msgs[i].size(), coro[i].data()));
+    jobs.push_back(job::hash(msgs[i].data(), msgs[i].size(), bulk[i].data()));
+
+    packed.insert(packed.end(), msgs[i].begin(), msgs[i].end());
+    offs.push_back(packed.size());
+  }
+
+  // empty & already completed tasks are skipped
+  tasks.emplace_back();
+  tasks.insert(tasks.begin(), sponge_task{});
+
+  run_tasks(tasks);
+  run_tasks(tasks);
+
+  engine eng{ 3 };
+  eng.submit(jobs);
+  eng.wait();
+
+  bytes batch(cnt * DIGEST_LEN);
+  photon_beetle_hash_batch(packed.data(), offs.data(), cnt, batch.data(), 3);
+
+  for (size_t i = 0; i < cnt; i++) {
+    const auto it = batch.begin() + i * DIGEST_LEN;
+
+    expect(coro[i] == mds[i], "hash_task", i);
+    expect(bulk[i] == mds[i], "engine hash", i);
+    expect(bytes(it, it + DIGEST_LEN) == mds[i], "hash_batch", i);
+  }
+}
+
+// Checks all Photon-Beetle-AEAD[RATE * 8] routines against given expected
+// cipher text || tag, one per LWC AEAD KAT
+template<const size_t RATE>
+static void
+check_aead(const std::vector<bytes>& cts)
+{
+  using namespace photon_beetle;
+  const size_t cnt = cts.size();
+
+  const auto key = photon_kat::kat_bytes(KEY_LEN);
+  const auto nonce = photon_kat::kat_bytes(NONCE_LEN);
+
+  std::vector<bytes> txts(cnt), data(cnt);
+  for (size_t i = 0; i < cnt; i++) {
+    size_t mlen, dlen;
+    photon_kat::aead_lengths(i, mlen, dlen);
+
+    txts[i] = photon_kat::kat_bytes(mlen);
+    data[i] = photon_kat::kat_bytes(dlen);
+  }
+
+  const auto ct_of = [&](const size_t i, const bytes& enc, const bytes& tag) {
+    bytes ct = enc;
+    ct.insert(ct.end(), tag.begin(), tag.end());
+    return ct == cts[i];
+  };
+
+  for (size_t i = 0; i < cnt; i++) {
+    const size_t mlen = txts[i].size();
+    const size_t dlen = data[i].size();
+
+    const bytes enc_exp(cts[i].begin(), cts[i].begin() + mlen);
+    const bytes tag_exp(cts[i].begin() + mlen, cts[i].end());
+
+    bytes enc(mlen), tag(TAG_LEN), dec(mlen);
+
+    encrypt<RATE>(key.data(),
+                  nonce.data(),
+                  data[i].data(),
+                  dlen,
+                  txts[i].data(),
+                  enc.data(),
+                  mlen,
+                  tag.data());
+    expect(ct_of(i, enc, tag), "encrypt", i);
+
+    const bool flg = decrypt<RATE>(key.data(),
+                                   nonce.data(),
+                                   tag_exp.data(),
+                                   data[i].data(),
+                                   dlen,
+                                   enc_exp.data(),
+                                   dec.data(),
+                                   mlen);
+    expect(flg && dec == txts[i], "decrypt", i);
+
+    // in-place
+    bytes buf = txts[i];
+    encrypt<RATE>(key.data(),
+                  nonce.data(),
+                  data[i].data(),
+                  dlen,
+                  buf.data(),
+                  buf.data(),
+                  mlen,
+                  tag.data());
+    expect(ct_of(i, buf, tag), "in-place encrypt", i);
+
+    const bool flg_ = decrypt<RATE>(key.data(),
+                                    nonce.data(),
+                                    tag.data(),
+                                    data[i].data(),
+                                    dlen,
+                                    buf.data(),
+                                    buf.data(),
+                                    mlen);
+    expect(flg_ && buf == txts[i], "in-place decrypt", i);
+
+    // tampered tag must fail verification & zero decrypted text
+    bytes bad = tag_exp;
+    bad[i % TAG_LEN] ^= 1;
+    dec.assign(mlen, 0xff);
+    const bool bad_flg = decrypt<RATE>(key.data(),
+                                       nonce.data(),
+                                       bad.data(),
+                                       data[i].data(),
+                                       dlen,
+                                       enc_exp.data(),
+                                       dec.data(),
+                                       mlen);
+    expect(!bad_flg && dec == bytes(mlen), "tampered decrypt", i);
+
+    // NIST LWC API
+    bytes c(mlen + TAG_LEN), m(mlen);
+    unsigned long long clen = 0, mlen_ = 0;
+
+    lwc::aead_encrypt<RATE>(c.data(),
+                            &clen,
+                            txts[i].data(),
+                            mlen,
+                            data[i].data(),
+                            dlen,
+                            nonce.data(),
+                            key.data());
+    expect(clen == c.size() && c == cts[i], "lwc::aead_encrypt", i);
+
+    const int ret = lwc::aead_decrypt<RATE>(m.data(),
+                                            &mlen_,
+                                            cts[i].data(),
+                                            cts[i].size(),
+                                            data[i].data(),
+                                            dlen,
+                                            nonce.data(),
+                                            key.data());
+    expect(ret == 0 && mlen_ == mlen && m == txts[i], "lwc::aead_decrypt", i);
+  }
+
+  // coroutine based, bulk engine & C-ABI batched, over all vectors at once
+  std::vector<bytes> encs(cnt), decs(cnt), tags(cnt, bytes(TAG_LEN));
+  std::vector<bytes> b_encs(cnt), b_decs(cnt), b_tags(cnt, bytes(TAG_LEN));
+  std::vector<sponge_task> tasks;
+  std::vector<job> jobs;
+
+  bytes p_data, p_txt, p_enc, nonces, p_tags;
+  std::vector<size_t> d_offs{ 0 }, ct_offs{ 0 };
+
+  for (size_t i = 0; i < cnt; i++) {
+    const size_t mlen = txts[i].size();
+    const size_t dlen = data[i].size();
+    const uint8_t* const enc_exp = cts[i].data();
+    const uint8_t* const tag_exp = cts[i].data() + mlen;
+
+    encs[i].resize(mlen);
+    decs[i].resize(mlen);
+    b_encs[i].resize(mlen);
+    b_decs[i].resize(mlen);
+
+    tasks.push_back(encrypt_task<RATE>(key.data(),
+                                       nonce.data(),
+                                       data[i].data(),
+                                       dlen,
+                                       txts[i].data(),
+                                       encs[i].data(),
+                                       mlen,
+                                       tags[i].data()));
+    tasks.push_back(decrypt_task<RATE>(key.data(),
+                                       nonce.data(),
+                                       tag_exp,
+                                       data[i].data(),
+                                       dlen,
+                                       enc_exp,
+                                       decs[i].data(),
+                                       mlen));
+
+    jobs.push_back(job::encrypt<RATE>(key.data(),
+                                      nonce.data(),
+                                      data[i].data(),
+                                      dlen,
+                                      txts[i].data(),
+                                      b_encs[i].data(),
+                                      mlen,
+                                      b_tags[i].data()));
+    jobs.push_back(job::decrypt<RATE>(key.data(),
+                                      nonce.data(),
+                                      tag_exp,
+                                      data[i].data(),
+                                      dlen,
+                                      enc_exp,
+                                      b_decs[i].data(),
+                                      mlen));
+
+    p_data.insert(p_data.end(), data[i].begin(), data[i].end());
+    p_txt.insert(p_txt.end(), txts[i].begin(), txts[i].end());
+    p_enc.insert(p_enc.end(), enc_exp, enc_exp + mlen);
+    p_tags.insert(p_tags.end(), tag_exp, tag_exp + TAG_LEN);
+    nonces.insert(nonces.end(), nonce.begin(), nonce.end());
+    d_offs.push_back(p_data.size());
+    ct_offs.push_back(p_txt.size());
+  }
+
+  run_tasks(tasks);
+
+  std::unique_ptr<bool[]> flags(new bool[jobs.size()]);
+  engine eng{ 3 };
+  eng.submit(jobs, std::span(flags.get(), jobs.size()));
+  eng.wait();
+
+  constexpr auto enc_batch = RATE == 4 ? photon_beetle_32_encrypt_batch
+                                       : photon_beetle_128_encrypt_batch;
+  constexpr auto dec_batch = RATE == 4 ? photon_beetle_32_decrypt_batch
+                                       : photon_beetle_128_decrypt_batch;
+
+  bytes o_enc(p_txt.size()), o_tags(cnt * TAG_LEN), o_dec(p_txt.size());
+  std::unique_ptr<bool[]> b_flags(new bool[cnt]);
+
+  enc_batch(key.data(),
+            nonces.data(),
+            p_data.data(),
+            d_offs.data(),
+            p_txt.data(),
+            o_enc.data(),
+            ct_offs.data(),
+            o_tags.data(),
+            cnt,
+            3);
+  const bool all = dec_batch(key.data(),
+                             nonces.data(),
+                             p_tags.data(),
+                             p_data.data(),
+                             d_offs.data(),
+                             p_enc.data(),
+                             o_dec.data(),
+                             ct_offs.data(),
+                             b_flags.get(),
+                             cnt,
+                             3);
+  expect(all && o_enc == p_enc && o_tags == p_tags && o_dec == p_txt,
+         "encrypt_batch/ decrypt_batch",
+         cnt - 1);
+
+  for (size_t i = 0; i < cnt; i++) {
+    expect(ct_of(i, encs[i], tags[i]), "encrypt_task", i);
+    expect(tasks[2 * i + 1].result() && decs[i] == txts[i], "decrypt_task", i);
+
+    expect(flags[2 * i] && ct_of(i, b_encs[i], b_tags[i]), "engine encrypt", i);
+    expect(flags[2 * i + 1] && b_decs[i] == txts[i], "engine decrypt", i);
+  }
+}
+
+// Checks Photon256 based XOF against reference implementation, which absorbs
+// seed using `HASH<16>(IV, D, 7)` & squeezes using `TAGτ (T0)`, for seeds of 0
+// to 40 -bytes, filling output either in one go or in chunks
+static void
+check_xof()
+{
+  constexpr size_t olen = 256;
+
+  for (size_t i = 0; i <= 40; i++) {
+    const auto seed = photon_kat::kat_bytes(i);
+
+    uint8_t iv[32]{};
+    bytes expected(olen);
+    photon_reference::hash_r(iv, 16, seed.data(), seed.size(), 7);
+    photon_reference::tag(iv, expected.data(), olen);
+
+    bytes out(olen);
+    photon_xof::xof(seed).fill(out);
+    expect(out == expected, "xof", i);
+
+    for (const size_t chunk : { 1ul, 7ul, 16ul, 61ul }) {
+      photon_xof::xof gen(seed);
+      for (size_t off = 0; off < olen; off += chunk) {
+        gen.fill({ out.data() + off, std::min(chunk, olen - off) });
+      }
+      expect(out == expected, "xof chunked", i);
+    }
+  }
+
+  // 64 -bit seed is same as its 8 -bytes little endian encoding
+  const auto seed = photon_kat::kat_bytes(8);
+  bytes a(olen), b(olen);
+  photon_xof::xof(seed).fill(a);
+  photon_xof::xof(0x0706050403020100ul).fill(b);
+  expect(a == b, "xof u64 seed", 0);
+}
+
+// Merkle tree hash of records [lo, hi), computed recursively, as defined in
+// section 2.1 of RFC 6962, using reference implementation of hash function
+static bytes
+ref_mth(const std::vector<bytes>& recs, const size_t lo, const size_t hi)
+{
+  bytes md(32);
+
+  if (hi - lo == 0) {
+    photon_reference::hash(nullptr, 0, md.data());
+  } else if (hi - lo == 1) {
+    bytes in{ 0x00 };
+    in.insert(in.end(), recs[lo].begin(), recs[lo].end());
+    photon_reference::hash(in.data(), in.size(), md.data());
+  } else {
+    const size_t k = std::bit_floor(hi - lo - 1);
+    const auto l = ref_mth(recs, lo, lo + k);
+    const auto r = ref_mth(recs, lo + k, hi);
+
+    bytes in{ 0x01 };
+    in.insert(in.end(), l.begin(), l.end());
+    in.insert(in.end(), r.begin(), r.end());
+    photon_reference::hash(in.data(), in.size(), md.data());
+  }
+
+  return md;
+}
+
+// Checks Merkle accumulator & tree against reference Merkle tree hash, for
+// logs of 0 to 40 records ( of varying length ), appended one by one & in
+// batches, including inclusion proofs & restoring serialized state
+static void
+check_merkle()
+{
+  using namespace photon_beetle;
+  constexpr size_t cnt = 40;
+
+  std::vector<bytes> recs(cnt);
+  std::vector<std::span<const uint8_t>> views(cnt);
+  for (size_t i = 0; i < cnt; i++) {
+    recs[i] = photon_kat::kat_bytes((i * 7) % 23);
+    views[i] = recs[i];
+  }
+
+  merkle_accumulator acc;
+  merkle_tree tree;
+
+  for (size_t n = 0; n <= cnt; n++) {
+    if (n > 0) {
+      acc.append(recs[n - 1].data(), recs[n - 1].size());
+      tree.append(recs[n - 1].data(), recs[n - 1].size());
+    }
+
+    const auto expected = ref_mth(recs, 0, n);
+    bytes root(DIGEST_LEN);
+
+    acc.root(root.data());
+    expect(root == expected, "merkle accumulator root", n);
+    tree.root(root.data());
+    expect(root == expected, "merkle tree root", n);
+
+    // appending in two batches
+    merkle_tree batched;
+    batched.append(std::span(views.data(), n / 2), 3);
+    batched.append(std::span(views.data() + n / 2, n - n / 2));
+    batched.root(root.data());
+    expect(root == expected, "merkle batched root", n);
+
+    // restoring serialized state
+    merkle_accumulator acc_;
+    merkle_tree tree_;
+    expect(acc_.deserialize(acc.serialize()), "merkle accumulator state", n);
+    expect(tree_.deserialize(tree.serialize()), "merkle tree state", n);
+
+    acc_.root(root.data());
+    expect(root == expected, "merkle restored accumulator", n);
+    tree_.root(root.data());
+    expect(root == expected, "merkle restored tree", n);
+
+    for (uint64_t i = 0; i < n; i++) {
+      merkle_digest leaf;
+      merkle_leaf(recs[i].data(), recs[i].size(), leaf.data());
+
+      std::vector<merkle_digest> proof;
+      expect(tree_.prove(i, proof), "merkle prove", n);
+
+      const bool ok = merkle_verify(expected.data(), n, i, leaf.data(), proof);
+      expect(ok, "merkle verify", n);
+
+      // proof must not verify for another leaf index or when tampered with
+      const bool bad_idx =
+        merkle_verify(expected.data(), n, (i + 1) % n, leaf.data(), proof);
+      expect(n == 1 || !bad_idx, "merkle verify wrong index", n);
+
+      if (!proof.empty()) {
+        proof[i % proof.size()][0] ^= 1;
+        const bool bad_path =
+          merkle_verify(expected.data(), n, i, leaf.data(), proof);
+        expect(!bad_path, "merkle verify tampered proof", n);
+
+        proof[i % proof.size()][0] ^= 1;
+        proof.pop_back();
+        const bool short_path =
+          merkle_verify(expected.data(), n, i, leaf.data(), proof);
+        expect(!short_path, "merkle verify truncated proof", n);
+      }
+    }
+
+    std::vector<merkle_digest> proof;
+    expect(!tree.prove(n, proof), "merkle prove out of range", n);
+  }
+
+  // malformed states are rejected
+  auto state = acc.serialize();
+  state.pop_back();
+  expect(!acc.deserialize(state), "merkle accumulator malformed", 0);
+
+  state = tree.serialize();
+  state.push_back(0);
+  expect(!tree.deserialize(state), "merkle tree malformed", 0);
+
+  // leaf count, whose level sizes sum up to 2^64 ( i.e. wrap to 0 )
+  state.assign(8, 0);
+  state[0] = 1;
+  state[7] = 0x80;
+  expect(!tree.deserialize(state), "merkle tree overflowing count", 0);
+}
+
+// Checks seekable container of RATE -bytes, for few plain text & block
+// lengths, comparing each sealed block against reference implementation,
+// reading back ranges crossing block boundaries & checking that tampered,
+// truncated or reordered containers don't verify
+template<const size_t RATE>
+static void
+check_container()
+{
+  using namespace photon_beetle;
+
+  const bytes key = photon_kat::kat_bytes(16);
+  const uint8_t prefix[]{ 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7 };
+
+  size_t idx = 0;
+  for (const size_t blen : { 16ul, 100ul, 1024ul }) {
+    for (const size_t plen : { 0ul, 1ul, 100ul, 1000ul, 3333ul }) {
+      bytes txt(plen);
+      photon_xof::xof(idx).fill(txt);
+
+      bytes box(container_len(plen, blen));
+      const bool sealed = container_seal<RATE>(
+        key.data(), prefix, blen, txt.data(), plen, box.data());
+      expect(sealed, "container seal", idx);
+
+      const size_t cnt = (plen + blen - 1) / blen;
+      expect(box.size() == CONTAINER_HEADER_LEN + plen + cnt * TAG_LEN,
+             "container length",
+             idx);
+
+      // block i is Photon-Beetle-AEAD of its plain text, under nonce =
+      // prefix || BE64(i), with its tag stored in footer index
+      for (size_t i = 0; i < cnt; i++) {
+        const size_t off = i * blen;
+        const size_t len = std::min(blen, plen - off);
+
+        uint8_t nonce[16]{};
+        std::memcpy(nonce, prefix, sizeof(prefix));
+        nonce[15] = static_cast<uint8_t>(i);
+        nonce[14] = static_cast<uint8_t>(i >> 8);
+
+        bytes enc(len), tag(16);
+        photon_reference::encrypt(RATE,
+                                  key.data(),
+                                  nonce,
+                                  nullptr,
+                                  0,
+                                  txt.data() + off,
+                                  enc.data(),
+                                  len,
+                                  tag.data());
+
+        const auto ct = box.begin() + CONTAINER_HEADER_LEN + off;
+        const auto tg = box.begin() + CONTAINER_HEADER_LEN + plen + i * 16;
+        expect(bytes(ct, ct + len) == enc && bytes(tg, tg + 16) == tag,
+               "container block",
+               idx);
+      }
+
+      container_reader rd;
+      const bool opened = rd.open(key.data(), box.data(), box.size());
+      expect(opened, "container open", idx);
+      expect(rd.size() == plen && rd.blocks() == cnt, "container size", idx);
+
+      for (const size_t off : { 0ul, 1ul, blen - 1, blen, plen / 2, plen }) {
+        for (const size_t len : { 0ul, 1ul, blen, 2 * blen + 3, plen }) {
+          if (off + len > plen) {
+            continue;
+          }
+
+          bytes out(len);
+          const bool ok = rd.read(off, out.data(), len, 1 + (off & 7));
+          expect(ok && std::equal(out.begin(), out.end(), txt.begin() + off),
+                 "container read",
+                 idx);
+        }
+      }
+
+      bytes out(2);
+      expect(!rd.read(plen, out.data(), 1), "container read past end", idx);
+
+      if (cnt >= 2) {
+        // tampered cipher text fails only reads touching that block
+        bytes bad = box;
+        bad[CONTAINER_HEADER_LEN + blen] ^= 1;
+        rd.open(key.data(), bad.data(), bad.size());
+
+        out.assign(2, 0xff);
+        expect(!rd.read(blen - 1, out.data(), 2) && out == bytes(2),
+               "container tampered block",
+               idx);
+        expect(rd.read(0, out.data(), 1), "container untouched block", idx);
+
+        // tampered footer index entry
+        bad = box;
+        bad[CONTAINER_HEADER_LEN + plen + 16] ^= 1;
+        rd.open(key.data(), bad.data(), bad.size());
+        expect(!rd.read(blen, out.data(), 1), "container tampered index", idx);
+
+        // swapped blocks, along with their tags
+        bad = box;
+        const auto ct = bad.begin() + CONTAINER_HEADER_LEN;
+        const auto tg = bad.begin() + CONTAINER_HEADER_LEN + plen;
+        std::swap_ranges(ct, ct + blen, ct + blen);
+        std::swap_ranges(tg, tg + 16, tg + 16);
+        rd.open(key.data(), bad.data(), bad.size());
+        expect(!rd.read(0, out.data(), 1), "container swapped blocks", idx);
+      }
+
+      // tampered header, truncated container & wrong key don't open
+      for (const size_t i : { 8ul, 12ul, 16ul, 24ul, 40ul }) {
+        bytes bad = box;
+        bad[i] ^= 1;
+        expect(!rd.open(key.data(), bad.data(), bad.size()),
+               "container tampered header",
+               idx);
+      }
+
+      expect(!rd.open(key.data(), box.data(), box.size() - 1),
+             "container truncated",
+             idx);
+
+      bytes wrong = key;
+      wrong[0] ^= 1;
+      expect(!rd.open(wrong.data(), box.data(), box.size()),
+             "container wrong key",
+             idx);
+
+      idx++;
+    }
+  }
+
+  // block length must be in range 0 < B < 2^32, otherwise output is untouched
+  for (const size_t blen : { 0ul, 1ul << 32 }) {
+    const uint8_t txt[1]{};
+    bytes box(CONTAINER_HEADER_LEN + 1 + TAG_LEN, 0xff);
+
+    const bool sealed = container_seal<RATE>(
+      key.data(), prefix, blen, txt, sizeof(txt), box.data());
+    expect(!sealed && box == bytes(box.size(), 0xff),
+           "container bad block length",
+           0);
+  }
+}
+
+// Checks nonce sequencer: layout of produced nonces, clamping of reserved
+// blocks at limit, exhaustion ( including close to 2^63 guard ) & uniqueness
+// of nonces handed out to many threads
+static void
+check_nonce()
+{
+  using namespace photon_beetle;
+
+  const uint8_t prefix[NONCE_PREFIX_LEN] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+  // nonce = prefix || BE64(counter)
+  {
+    nonce_block blk;
+    std::memcpy(blk.prefix, prefix, sizeof(prefix));
+    blk.beg = 0x0102030405060708ul;
+    blk.end = blk.beg + 1;
+
+    bytes nonce(NONCE_LEN, 0xff);
+    const bytes expected = { 1, 2, 3, 4, 5, 6, 7, 8, 1, 2, 3, 4, 5, 6, 7, 8 };
+
+    expect(blk.next(nonce.data()) && nonce == expected, "nonce layout", 0);
+    expect(blk.remaining() == 0, "nonce block remaining", 0);
+
+    const bytes before = nonce;
+    expect(!blk.next(nonce.data()) && nonce == before, "nonce block empty", 0);
+  }
+
+  // reserved blocks are clamped at limit, then empty
+  {
+    nonce_sequencer seq(prefix, 10, 15);
+
+    auto blk = seq.reserve(4);
+    expect(blk.beg == 10 && blk.end == 14, "nonce reserve", 0);
+
+    blk = seq.reserve(4);
+    expect(blk.beg == 14 && blk.end == 15, "nonce reserve clamped", 0);
+    expect(seq.exhausted(), "nonce exhausted", 0);
+
+    blk = seq.reserve(1);
+    expect(blk.remaining() == 0, "nonce reserve after exhaustion", 0);
+
+    bytes nonce(NONCE_LEN);
+    blk = {};
+    expect(!seq.next(blk, nonce.data(), 4), "nonce next after exhaustion", 0);
+  }
+
+  // close to 2^63, keeping on reserving after exhaustion neither wraps shared
+  // counter nor hands out counter values at/ beyond limit
+  {
+    nonce_sequencer seq(prefix, MAX_NONCE_CNT - 2);
+
+    auto blk = seq.reserve(1ul << 32);
+    expect(blk.beg == MAX_NONCE_CNT - 2 && blk.end == MAX_NONCE_CNT,
+           "nonce reserve near 2^63",
+           0);
+
+    bytes nonce(NONCE_LEN);
+    expect(seq.next(blk, nonce.data()) && nonce[8] == 0x7f && nonce[15] == 0xfe,
+           "nonce near 2^63",
+           0);
+    expect(seq.next(blk, nonce.data()) && nonce[8] == 0x7f && nonce[15] == 0xff,
+           "nonce near 2^63",
+           1);
+
+    for (size_t i = 0; i < 1024; i++) {
+      blk = seq.reserve(1ul << 32);
+      expect(blk.remaining() == 0 && seq.exhausted(),
+             "nonce reserve past 2^63",
+             i);
+    }
+    expect(!seq.next(blk, nonce.data(), 1ul << 32), "nonce past 2^63", 0);
+  }
+
+  // concurrently handed out nonces are all distinct & cover [0, N)
+  {
+    constexpr size_t THREADS = 4;
+    constexpr size_t PER_THREAD = 1ul << 14;
+    constexpr uint64_t LIMIT = THREADS * PER_THREAD;
+
+    nonce_sequencer seq(prefix, 0, LIMIT);
+    std::vector<std::vector<uint64_t>> ctrs(THREADS);
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < THREADS; t++) {
+      threads.emplace_back([&, t] {
+        nonce_block blk;
+        uint8_t nonce[NONCE_LEN];
+
+        // odd block length, so that last block gets clamped
+        while (seq.next(blk, nonce, 61)) {
+          if (std::memcmp(nonce, prefix, NONCE_PREFIX_LEN) != 0) {
+            ctrs[t].push_back(LIMIT);
+            continue;
+          }
+
+          uint64_t ctr = 0;
+          for (size_t i = NONCE_PREFIX_LEN; i < NONCE_LEN; i++) {
+            ctr = (ctr << 8) | nonce[i];
+          }
+          ctrs[t].push_back(ctr);
+        }
+      });
+    }
+
+    for (auto& th : threads) {
+      th.join();
+    }
+
+    std::vector<uint64_t> all;
+    for (const auto& v : ctrs) {
+      all.insert(all.end(), v.begin(), v.end());
+    }
+    std::sort(all.begin(), all.end());
+
+    bool ok = all.size() == LIMIT;
+    for (size_t i = 0; ok && i < all.size(); i++) {
+      ok = all[i] == i;
+    }
+    expect(ok, "nonce uniqueness across threads", 0);
+  }
+}
+
+// Checks SPSC ring against a double-ended queue, pushing & popping spans of
+// random length, so that full/ empty conditions, partial pushes/ pops and
+// wrap-around of indices ( many times over ) are all exercised
+static void
+check_ring()
+{
+  constexpr size_t CAP = 8;
+  photon_utils::spsc_ring<uint64_t, CAP> ring;
+  std::deque<uint64_t> model;
+
+  std::vector<uint64_t> elms(2 * CAP);
+  uint64_t next = 0;
+
+  // full & empty, at capacity
+  std::iota(elms.begin(), elms.begin() + CAP, next);
+  expect(ring.push(std::span<const uint64_t>(elms.data(), CAP)) == CAP,
+         "ring fill",
+         0);
+  expect(!ring.push(next + CAP), "ring full", 0);
+  expect(ring.pop(std::span(elms.data(), 2 * CAP)) == CAP, "ring drain", 0);
+
+  bool ok = true;
+  for (size_t i = 0; i < CAP; i++) {
+    ok &= elms[i] == next + i;
+  }
+  expect(ok, "ring drain order", 0);
+
+  uint64_t elm = 0;
+  expect(!ring.pop(elm), "ring empty", 0);
+  next += CAP;
+
+  std::mt19937_64 rng(1);
+  for (size_t i = 0; i < 4096; i++) {
+    const size_t len = rng() % (2 * CAP + 1);
+
+    if (rng() & 1) {
+      std::iota(elms.begin(), elms.begin() + len, next);
+
+      const size_t n = ring.push(std::span<const uint64_t>(elms.data(), len));
+      expect(n == std::min(len, CAP - model.size()), "ring partial push", i);
+
+      for (size_t j = 0; j < n; j++) {
+        model.push_back(next++);
+      }
+    } else {
+      const size_t n = ring.pop(std::span(elms.data(), len));
+      expect(n == std::min(len, model.size()), "ring partial pop", i);
+
+      for (size_t j = 0; j < n; j++) {
+        expect(elms[j] == model.front(), "ring pop order", i);
+        model.pop_front();
+      }
+    }
+  }
+}
+
+// Checks streaming pipeline stage: packets are sealed exactly as one-shot
+// encryption does & come out in order, partial burst is flushed after timeout
+// and destroying stage, while consumer has stopped collecting, processes all
+// submitted packets without hanging
+static void
+check_pipeline()
+{
+  using namespace photon_beetle;
+  using namespace std::chrono_literals;
+
+  constexpr size_t CNT = 100;
+  constexpr size_t LEN = 61;
+
+  bytes key(KEY_LEN), data(13);
+  photon_utils::random_data(key.data(), key.size());
+  photon_utils::random_data(data.data(), data.size());
+
+  std::vector<bytes> nonces(CNT, bytes(NONCE_LEN)), txts(CNT, bytes(LEN));
+  std::vector<bytes> encs(CNT, bytes(LEN)), tags(CNT, bytes(TAG_LEN));
+  for (size_t i = 0; i < CNT; i++) {
+    photon_utils::random_data(nonces[i].data(), NONCE_LEN);
+    photon_utils::random_data(txts[i].data(), LEN);
+  }
+
+  const auto pkt = [&](const size_t i) {
+    packet p;
+    p.j = job::encrypt<16>(key.data(),
+                           nonces[i].data(),
+                           data.data(),
+                           data.size(),
+                           txts[i].data(),
+                           encs[i].data(),
+                           LEN,
+                           tags[i].data());
+    p.stamp = i;
+    return p;
+  };
+
+  const auto sealed = [&](const size_t i) {
+    bytes enc(LEN), tag(TAG_LEN);
+    encrypt<16>(key.data(),
+                nonces[i].data(),
+                data.data(),
+                data.size(),
+                txts[i].data(),
+                enc.data(),
+                LEN,
+                tag.data());
+    return enc == encs[i] && tag == tags[i];
+  };
+
+  // outputs match one-shot encryption, in submission order
+  {
+    pipeline_stage<16> stage{ 4 };
+
+    size_t sent = 0, recv = 0;
+    packet p;
+
+    while (recv < CNT) {
+      sent += sent < CNT && stage.submit(pkt(sent));
+
+      if (stage.collect(p)) {
+        expect(p.stamp == recv && p.ok && sealed(recv), "pipeline seal", recv);
+        recv++;
+      }
+    }
+  }
+
+  // partial burst is flushed after timeout
+  {
+    pipeline_stage<16> stage{ 8, 1ms };
+
+    for (size_t i = 0; i < 3; i++) {
+      stage.submit(pkt(i));
+    }
+
+    std::vector<packet> out(8);
+    size_t recv = 0;
+
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (recv < 3 && std::chrono::steady_clock::now() < deadline) {
+      recv += stage.collect(std::span(out.data() + recv, out.size() - recv));
+    }
+
+    expect(recv == 3, "pipeline flush after timeout", 0);
+  }
+
+  // shutdown with a stalled consumer, while both rings are full
+  {
+    for (auto& enc : encs) {
+      std::fill(enc.begin(), enc.end(), 0);
+    }
+
+    {
+      pipeline_stage<8> stage{ 4 };
+
+      size_t sent = 0;
+      const auto deadline = std::chrono::steady_clock::now() + 5s;
+      while (sent < 16 && std::chrono::steady_clock::now() < deadline) {
+        sent += stage.submit(pkt(sent));
+      }
+      expect(sent == 16, "pipeline fill", 0);
+    }
+
+    for (size_t i = 0; i < 16; i++) {
+      expect(sealed(i), "pipeline shutdown drain", i);
+    }
+  }
+}
+
+// Checks io_uring based file reader, hashing temporary files of various
+// lengths ( empty, shorter than, equal to & spanning many read blocks ), both
+// through page cache & using O_DIRECT, against one-shot hashing. Returns
+// note on what couldn't be checked, because kernel/ file system doesn't
+// support it, which is empty when everything was checked.
+static std::string
+check_uring()
+{
+  using namespace photon_beetle;
+
+  photon_utils::uring_reader ring;
+  if (!ring.init(4)) {
+    return " ( io_uring unavailable, skipped )";
+  }
+
+  const auto dir = std::filesystem::temp_directory_path();
+  std::string path = (dir / "photon-beetle-uring-XXXXXX").string();
+
+  const int fd = mkstemp(path.data());
+  if (fd < 0) {
+    expect(false, "uring temporary file", 0);
+    return "";
+  }
+  ::close(fd);
+
+  constexpr size_t BLK_LEN = 1ul << 16;
+  std::string note;
+  size_t idx = 0;
+
+  for (const size_t len :
+       { 0ul, 1ul, 4095ul, BLK_LEN, 3 * BLK_LEN + 4097, 9 * BLK_LEN + 1 }) {
+    bytes msg(len);
+    photon_utils::random_data(msg.data(), msg.size());
+
+    std::FILE* const f = std::fopen(path.c_str(), "wb");
+    const bool written =
+      f != nullptr && std::fwrite(msg.data(), 1, len, f) == len;
+    if (f != nullptr) {
+      std::fclose(f);
+    }
+    expect(written, "uring temporary file", idx);
+
+    bytes expected(DIGEST_LEN), md(DIGEST_LEN);
+    hash(msg.data(), msg.size(), expected.data());
+
+    expect(ring.hash_file(path.c_str(), md.data(), BLK_LEN, false) &&
+             md == expected,
+           "uring_reader",
+           idx);
+
+    if (note.empty()) {
+      std::fill(md.begin(), md.end(), 0);
+
+      if (ring.hash_file(path.c_str(), md.data(), BLK_LEN, true)) {
+        expect(md == expected, "uring_reader O_DIRECT", idx);
+      } else if (errno == EINVAL) {
+        note = " ( O_DIRECT unsupported, skipped )";
+      } else {
+        expect(false, "uring_reader O_DIRECT", idx);
+      }
+    }
+
+    idx++;
+  }
+
+  std::filesystem::remove(path);
+  return note;
+}
+
+// Decodes N -many embedded expected outputs
+static std::vector<bytes>
+embedded(const char* const* const hex, const size_t cnt)
+{
+  std::vector<bytes> res(cnt);
+  for (size_t i = 0; i < cnt; i++) {
+    res[i] = photon_kat::from_hex(hex[i]);
+  }
+
+  return res;
+}
+
+// Reads expected outputs from given field of LWC format KAT file, returning
+// empty vector, if file can't be read
+static std::vector<bytes>
+from_lwc(const std::string& path, const char* const field)
+{
+  std::vector<bytes> res;
+  for (auto& kat : photon_kat::parse_lwc(path)) {
+    res.push_back(photon_kat::from_hex(kat[field]));
+  }
+
+  return res;
+}
+
+// Runs N -many differential fuzzing iterations, on random inputs of random
+// length, using given seed
+static void
+fuzz(const size_t itr, const uint64_t seed)
+{
+  std::mt19937_64 rng(seed);
+
+  for (size_t i = 0; i < itr; i++) {
+    const size_t len = rng() % 320;
+
+    bytes input(len);
+    for (auto& b : input) {
+      b = static_cast<uint8_t>(rng());
+    }
+
+    photon_fuzz::fuzz_one(input.data(), input.size());
+  }
+}
+
+int
+main(int argc, char** argv)
+{
+  size_t itr = 10000;
+  uint64_t seed = std::random_device{}();
+  std::string lwc_dir;
+
+  const option opts[]{ { "lwc", required_argument, nullptr, 'l' },
+                       { nullptr, 0, nullptr, 0 } };
+
+  int opt;
+  while ((opt = getopt_long(argc, argv, "n:s:", opts, nullptr)) != -1) {
+    switch (opt) {
+      case 'n':
+        itr = std::strtoull(optarg, nullptr, 10);
+        break;
+      case 's':
+        seed = std::strtoull(optarg, nullptr, 10);
+        break;
+      case 'l':
+        lwc_dir = optarg;
+        break;
+      default:
+        std::fprintf(stderr,
+                     "usage: %s [-n <fuzz iterations>] [-s <seed>] "
+                     "[--lwc <dir>]\n",
+                     argv[0]);
+        return 1;
+    }
+  }
+
+  std::printf("permutation backend : %s\n", photon_utils::photon_backend());
+
+  using namespace photon_kat;
+
+  check_hash(embedded(HASH_MD, HASH_KAT_CNT));
+  check_aead<4>(embedded(AEAD_32_CT, AEAD_KAT_CNT));
+  check_aead<16>(embedded(AEAD_128_CT, AEAD_KAT_CNT));
+  std::printf("embedded KATs       : %s\n", failures ? "FAILED" : "passed");
+
+  const size_t xof_before = failures;
+  check_xof();
+  std::printf("XOF                 : %s\n",
+              failures > xof_before ? "FAILED" : "passed");
+
+  const size_t merkle_before = failures;
+  check_merkle();
+  std::printf("Merkle accumulator  : %s\n",
+              failures > merkle_before ? "FAILED" : "passed");
+
+  const size_t container_before = failures;
+  check_container<4>();
+  check_container<16>();
+  std::printf("Seekable container  : %s\n",
+              failures > container_before ? "FAILED" : "passed");
+
+  const size_t ring_before = failures;
+  check_ring();
+  check_pipeline();
+  std::printf("SPSC ring/ pipeline : %s\n",
+              failures > ring_before ? "FAILED" : "passed");
+
+  const size_t uring_before = failures;
+  const auto uring_note = check_uring();
+  std::printf("io_uring reader     : %s%s\n",
+              failures > uring_before ? "FAILED" : "passed",
+              uring_note.c_str());
+
+  const size_t nonce_before = failures;
+  check_nonce();
+  std::printf("Nonce sequencer     : %s\n",
+              failures > nonce_before ? "FAILED" : "passed");
+
+  if (!lwc_dir.empty()) {
+    const auto mds = from_lwc(lwc_dir + "/LWC_HASH_KAT_256.txt", "MD");
+    const auto c32 = from_lwc(lwc_dir + "/LWC_AEAD_KAT_128_128.txt.32", "CT");
+    const auto c128 = from_lwc(lwc_dir + "/LWC_AEAD_KAT_128_128.txt.128", "CT");
+
+    if (mds.size() != HASH_KAT_CNT || c32.size() != AEAD_KAT_CNT ||
+        c128.size() != AEAD_KAT_CNT) {
+      std::fprintf(
+        stderr, "couldn't read LWC KAT files from %s\n", lwc_dir.c_str());
+      return 1;
+    }
+
+    const size_t before = failures;
+    check_hash(mds);
+    check_aead<4>(c32);
+    check_aead<16>(c128);
+    std::printf("LWC KATs            : %s\n",
+                failures > before ? "FAILED" : "passed");
+  }
+
+  fuzz(itr, seed);
+  std::printf("differential fuzz   : passed ( %zu iterations, seed %lu )\n",
+              itr,
+              static_cast<unsigned long>(seed));
+
+  return failures == 0 ? 0 : 1;
+}
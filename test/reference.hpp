@@ -0,0 +1,350 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Reference implementation of Photon256 permutation & Photon-Beetle-{Hash,
+// AEAD}, transcribed from the specification as literally as possible, trading
+// off all performance for ease of review. It shares no code with the library,
+// so that it can be used as an oracle for differential testing of optimized
+// code paths.
+//
+// Specification lives at
+// https://csrc.nist.gov/CSRC/media/Projects/lightweight-cryptography/documents/finalist-round/updated-spec-doc/photon-beetle-spec-final.pdf
+namespace photon_reference {
+
+// Permutation state is a DxD matrix of 4 -bit cells, see chapter 2 of the
+// specification
+constexpr size_t D = 8;
+
+// Round constants rc_r & internal constants IC_i, such that constant added to
+// i-th row of r-th round is rc_r ^ IC_i, see figure 2.1 of the specification
+constexpr uint8_t RC[12]{ 1, 3, 7, 14, 13, 11, 6, 12, 9, 2, 5, 10 };
+constexpr uint8_t IC[D]{ 0, 1, 3, 7, 15, 14, 12, 8 };
+
+// PRESENT S-box, see figure 2.1 of the specification
+constexpr uint8_t SBOX[16]{ 0xC, 0x5, 0x6, 0xB, 0x9, 0x0, 0xA, 0xD,
+                            0x3, 0xE, 0xF, 0x8, 0x4, 0x7, 0x1, 0x2 };
+
+// Last row of serial matrix Serial[2, 4, 2, 11, 2, 8, 5, 6], see section 1.1
+// of the specification
+constexpr uint8_t Z[D]{ 2, 4, 2, 11, 2, 8, 5, 6 };
+
+using cells = uint8_t[D][D];
+
+// Multiplication in GF(2^4), with irreducible polynomial x^4 + x + 1, computed
+// bit by bit, using shift & add method
+inline uint8_t
+gf16_mul(uint8_t a, const uint8_t b)
+{
+  uint8_t res = 0;
+
+  for (size_t i = 0; i < 4; i++) {
+    if ((b >> i) & 1) {
+      res ^= a;
+    }
+
+    a <<= 1;
+    if (a & 0x10) {
+      a ^= 0x13;
+    }
+  }
+
+  return res;
+}
+
+// 32 -bytes state to DxD cells, where i-th row lives in bytes [4i, 4i + 4) &
+// j-th cell of a row lives in lower ( when j is even ) or upper ( otherwise )
+// nibble of byte 4i + j/2
+inline void
+to_cells(const uint8_t* const state, cells& x)
+{
+  for (size_t i = 0; i < D; i++) {
+    for (size_t j = 0; j < D; j++) {
+      x[i][j] = (state[4 * i + j / 2] >> (4 * (j % 2))) & 0xf;
+    }
+  }
+}
+
+// DxD cells back to 32 -bytes state, inverse of `to_cells`
+inline void
+from_cells(const cells& x, uint8_t* const state)
+{
+  std::memset(state, 0, 32);
+
+  for (size_t i = 0; i < D; i++) {
+    for (size_t j = 0; j < D; j++) {
+      state[4 * i + j / 2] |= x[i][j] << (4 * (j % 2));
+    }
+  }
+}
+
+// Photon256 permutation, see figure 2.1 of the specification
+inline void
+photon256(uint8_t* const state)
+{
+  cells x;
+  to_cells(state, x);
+
+  for (size_t r = 0; r < 12; r++) {
+    // AddConstant
+    for (size_t i = 0; i < D; i++) {
+      x[i][0] ^= RC[r] ^ IC[i];
+    }
+
+    // SubCells
+    for (size_t i = 0; i < D; i++) {
+      for (size_t j = 0; j < D; j++) {
+        x[i][j] = SBOX[x[i][j]];
+      }
+    }
+
+    // ShiftRows, i-th row is rotated left by i cells
+    for (size_t i = 0; i < D; i++) {
+      uint8_t row[D];
+      for (size_t j = 0; j < D; j++) {
+        row[j] = x[i][(j + i) % D];
+      }
+      std::memcpy(x[i], row, D);
+    }
+
+    // MixColumnSerial, each column is multiplied by Serial[...] D times
+    for (size_t j = 0; j < D; j++) {
+      for (size_t t = 0; t < D; t++) {
+        uint8_t last = 0;
+        for (size_t k = 0; k < D; k++) {
+          last ^= gf16_mul(Z[k], x[k][j]);
+        }
+        for (size_t k = 0; k + 1 < D; k++) {
+          x[k][j] = x[k + 1][j];
+        }
+        x[D - 1][j] = last;
+      }
+    }
+  }
+
+  from_cells(x, state);
+}
+
+// Adds 3 -bit domain separation constant to last 3 bits of state
+inline void
+add_constant(uint8_t* const state, const uint8_t c)
+{
+  state[31] ^= c << 5;
+}
+
+// `HASH_r(IV, D, c0)`, see figure 3.6 of the specification; input is split
+// into r -bytes blocks, where last one is padded using `Ozs`, when partial
+inline void
+hash_r(uint8_t* const iv,
+       const size_t r,
+       const uint8_t* const d,
+       const size_t dlen,
+       const uint8_t c0)
+{
+  for (size_t off = 0; off < dlen; off += r) {
+    photon256(iv);
+
+    const size_t len = dlen - off < r ? dlen - off : r;
+    for (size_t i = 0; i < len; i++) {
+      iv[i] ^= d[off + i];
+    }
+    if (len < r) {
+      iv[len] ^= 1; // Ozs padding
+    }
+  }
+
+  add_constant(iv, c0);
+}
+
+// `TAG_τ(T0)`, see figure 3.6 of the specification
+inline void
+tag(uint8_t* const t0, uint8_t* const t, const size_t tau)
+{
+  for (size_t off = 0; off < tau; off += 16) {
+    photon256(t0);
+    std::memcpy(t + off, t0, 16);
+  }
+}
+
+// `Shuffle(S)`, see figure 3.1 of the specification, where S1 is rotated right
+// by a single bit, treating it as a little endian integer
+inline void
+shuffle(const uint8_t* const s, const size_t r, uint8_t* const out)
+{
+  const size_t half = r / 2;
+  const size_t bits = half * 8;
+
+  std::memcpy(out, s + half, half);
+  std::memset(out + half, 0, half);
+
+  for (size_t k = 0; k < bits; k++) {
+    const size_t from = (k + 1) % bits;
+    const uint8_t bit = (s[from / 8] >> (from % 8)) & 1;
+    out[half + k / 8] |= bit << (k % 8);
+  }
+}
+
+// `PHOTON-Beetle-Hash[r](M)`, with r = 32 -bits, see figure 3.6 of the
+// specification
+inline void
+hash(const uint8_t* const msg, const size_t mlen, uint8_t* const digest)
+{
+  uint8_t iv[32]{};
+
+  if (mlen == 0) {
+    add_constant(iv, 1);
+    tag(iv, digest, 32);
+  } else if (mlen <= 16) {
+    std::memcpy(iv, msg, mlen);
+    if (mlen < 16) {
+      iv[mlen] ^= 1; // Ozs padding
+    }
+
+    add_constant(iv, mlen < 16 ? 1 : 2);
+    tag(iv, digest, 32);
+  } else {
+    std::memcpy(iv, msg, 16);
+
+    const size_t rlen = mlen - 16;
+    hash_r(iv, 4, msg + 16, rlen, rlen % 4 == 0 ? 1 : 2);
+    tag(iv, digest, 32);
+  }
+}
+
+// Computes domain separation constants c0, c1 of AEAD, see figure 3.6 of the
+// specification
+inline void
+aead_constants(const size_t r,
+               const size_t dlen,
+               const size_t mlen,
+               uint8_t& c0,
+               uint8_t& c1)
+{
+  const bool m = mlen > 0;
+  const bool a = dlen > 0;
+
+  c0 = (m && dlen % r == 0) ? 1 : m ? 2 : dlen % r == 0 ? 3 : 4;
+  c1 = (a && mlen % r == 0) ? 1 : a ? 2 : mlen % r == 0 ? 5 : 6;
+}
+
+// `PHOTON-Beetle-AEAD.ENC[r](K, N, A, M)`, with r ∈ {4, 16} -bytes, see figure
+// 3.6 of the specification; writes cipher text & 16 -bytes tag
+inline void
+encrypt(const size_t r,
+        const uint8_t* const key,
+        const uint8_t* const nonce,
+        const uint8_t* const data,
+        const size_t dlen,
+        const uint8_t* const txt,
+        uint8_t* const enc,
+        const size_t mlen,
+        uint8_t* const t)
+{
+  uint8_t iv[32];
+  std::memcpy(iv, nonce, 16);
+  std::memcpy(iv + 16, key, 16);
+
+  if (dlen == 0 && mlen == 0) {
+    add_constant(iv, 1);
+    tag(iv, t, 16);
+    return;
+  }
+
+  uint8_t c0, c1;
+  aead_constants(r, dlen, mlen, c0, c1);
+
+  if (dlen > 0) {
+    hash_r(iv, r, data, dlen, c0);
+  }
+
+  if (mlen > 0) {
+    for (size_t off = 0; off < mlen; off += r) {
+      photon256(iv);
+
+      uint8_t shuffled[16];
+      shuffle(iv, r, shuffled);
+
+      // ρ(S, U) = ( S ^ Ozs(U), Trunc(Shuffle(S), |U|) ^ U )
+      const size_t len = mlen - off < r ? mlen - off : r;
+      for (size_t i = 0; i < len; i++) {
+        enc[off + i] = shuffled[i] ^ txt[off + i];
+        iv[i] ^= txt[off + i];
+      }
+      if (len < r) {
+        iv[len] ^= 1;
+      }
+    }
+
+    add_constant(iv, c1);
+  }
+
+  tag(iv, t, 16);
+}
+
+// `PHOTON-Beetle-AEAD.DEC[r](K, N, A, C, T)`, with r ∈ {4, 16} -bytes, see
+// figure 3.6 of the specification; returns false & zeroes decrypted text, when
+// tag doesn't verify
+inline bool
+decrypt(const size_t r,
+        const uint8_t* const key,
+        const uint8_t* const nonce,
+        const uint8_t* const t,
+        const uint8_t* const data,
+        const size_t dlen,
+        const uint8_t* const enc,
+        uint8_t* const txt,
+        const size_t mlen)
+{
+  uint8_t iv[32];
+  std::memcpy(iv, nonce, 16);
+  std::memcpy(iv + 16, key, 16);
+
+  std::vector<uint8_t> dec(mlen);
+  uint8_t t_[16];
+
+  if (dlen == 0 && mlen == 0) {
+    add_constant(iv, 1);
+    tag(iv, t_, 16);
+  } else {
+    uint8_t c0, c1;
+    aead_constants(r, dlen, mlen, c0, c1);
+
+    if (dlen > 0) {
+      hash_r(iv, r, data, dlen, c0);
+    }
+
+    if (mlen > 0) {
+      for (size_t off = 0; off < mlen; off += r) {
+        photon256(iv);
+
+        uint8_t shuffled[16];
+        shuffle(iv, r, shuffled);
+
+        // ρ^-1(S, V) = ( S ^ Ozs(U), U ), where U = Trunc(Shuffle(S), |V|) ^ V
+        const size_t len = mlen - off < r ? mlen - off : r;
+        for (size_t i = 0; i < len; i++) {
+          dec[off + i] = shuffled[i] ^ enc[off + i];
+          iv[i] ^= dec[off + i];
+        }
+        if (len < r) {
+          iv[len] ^= 1;
+        }
+      }
+
+      add_constant(iv, c1);
+    }
+
+    tag(iv, t_, 16);
+  }
+
+  const bool flg = std::memcmp(t, t_, 16) == 0;
+  for (size_t i = 0; i < mlen; i++) {
+    txt[i] = flg ? dec[i] : 0;
+  }
+
+  return flg;
+}
+
+}
@@ -35,6 +35,19 @@ python3 -m pytest -k aead_32_kat --cache-clear -v
 mv ../../LWC_AEAD_KAT_128_128.txt.128 LWC_AEAD_KAT_128_128.txt
 python3 -m pytest -k aead_128_kat --cache-clear -v
 
+# batched & buffer protocol routines are tested against routines validated above
+python3 -m pytest -k "batch or buffers" --cache-clear -v
+
+# operational counters are only tested when library is built with them enabled
+popd
+make lib STATS=1
+pushd wrapper/python
+python3 -c "import photon_beetle as pb; exit(pb.photon_beetle_stats() is None)" || {
+  echo "shared library object is built without operational counters !"
+  exit 1
+}
+python3 -m pytest -k stats --cache-clear -v
+
 # clean up
 rm LWC_*_KAT_*.txt
 
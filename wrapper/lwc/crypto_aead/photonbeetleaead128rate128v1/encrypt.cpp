@@ -0,0 +1,34 @@
+#include "api.h"
+#include "lwc.hpp"
+
+// NIST LWC/ SUPERCOP compatible entry points of Photon-Beetle-AEAD[128]
+extern "C"
+{
+  int crypto_aead_encrypt(unsigned char* c,
+                          unsigned long long* clen,
+                          const unsigned char* m,
+                          unsigned long long mlen,
+                          const unsigned char* ad,
+                          unsigned long long adlen,
+                          const unsigned char* nsec,
+                          const unsigned char* npub,
+                          const unsigned char* k)
+  {
+    (void)nsec;
+    return lwc::aead_encrypt<16>(c, clen, m, mlen, ad, adlen, npub, k);
+  }
+
+  int crypto_aead_decrypt(unsigned char* m,
+                          unsigned long long* mlen,
+                          unsigned char* nsec,
+                          const unsigned char* c,
+                          unsigned long long clen,
+                          const unsigned char* ad,
+                          unsigned long long adlen,
+                          const unsigned char* npub,
+                          const unsigned char* k)
+  {
+    (void)nsec;
+    return lwc::aead_decrypt<16>(m, mlen, c, clen, ad, adlen, npub, k);
+  }
+}
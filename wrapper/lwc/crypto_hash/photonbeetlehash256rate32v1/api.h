@@ -0,0 +1 @@
+#define CRYPTO_BYTES 32
@@ -0,0 +1,13 @@
+#include "api.h"
+#include "lwc.hpp"
+
+// NIST LWC/ SUPERCOP compatible entry point of Photon-Beetle-Hash
+extern "C"
+{
+  int crypto_hash(unsigned char* out,
+                  const unsigned char* in,
+                  unsigned long long inlen)
+  {
+    return lwc::hash(out, in, inlen);
+  }
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include "aead.hpp"
+#include "hash.hpp"
+
+// NIST LWC/ SUPERCOP compatible `crypto_aead_{encrypt, decrypt}` and
+// `crypto_hash` routines, implemented on top of Photon-Beetle-{Hash, AEAD},
+// so that this implementation can be timed side by side with other candidates
+// in LWC/ SUPERCOP style benchmarking harnesses.
+//
+// Following those APIs, authentication tag is placed right after cipher text,
+// in same output buffer, so that callers don't need a separate tag copy.
+//
+// See https://csrc.nist.gov/CSRC/media/Projects/Lightweight-Cryptography/documents/final-lwc-submission-requirements-august2018.pdf
+namespace lwc {
+
+// Given M (>=0) -bytes plain text, N (>=0) -bytes associated data, 16 -bytes
+// public message nonce & 16 -bytes secret key, this routine computes
+// (M + 16) -bytes cipher text || authentication tag, using
+// Photon-Beetle-AEAD[RATE * 8], always returning 0
+template<const size_t RATE>
+inline int
+aead_encrypt(unsigned char* const c,         // cipher text || tag
+             unsigned long long* const clen, // len(c) = mlen + 16
+             const unsigned char* const m,   // plain text
+             const unsigned long long mlen,  // len(m) >= 0
+             const unsigned char* const ad,  // associated data
+             const unsigned long long adlen, // len(ad) >= 0
+             const unsigned char* const npub, // 16 -bytes nonce
+             const unsigned char* const k     // 16 -bytes secret key
+             )
+  requires(photon_common::check_rate(RATE))
+{
+  using namespace photon_beetle;
+
+  const size_t ml = static_cast<size_t>(mlen);
+  const size_t dl = static_cast<size_t>(adlen);
+
+  encrypt<RATE>(k, npub, ad, dl, m, c, ml, c + ml);
+  *clen = mlen + TAG_LEN;
+
+  return 0;
+}
+
+// Given (M + 16) -bytes cipher text || authentication tag, N (>=0) -bytes
+// associated data, 16 -bytes public message nonce & 16 -bytes secret key, this
+// routine computes M (>=0) -bytes plain text, using
+// Photon-Beetle-AEAD[RATE * 8], returning 0 if authentication succeeds,
+// otherwise -1, in which case no unverified plain text is released
+template<const size_t RATE>
+inline int
+aead_decrypt(unsigned char* const m,          // plain text
+             unsigned long long* const mlen,  // len(m) = clen - 16
+             const unsigned char* const c,    // cipher text || tag
+             const unsigned long long clen,   // len(c) >= 16
+             const unsigned char* const ad,   // associated data
+             const unsigned long long adlen,  // len(ad) >= 0
+             const unsigned char* const npub, // 16 -bytes nonce
+             const unsigned char* const k     // 16 -bytes secret key
+             )
+  requires(photon_common::check_rate(RATE))
+{
+  using namespace photon_beetle;
+
+  if (clen < TAG_LEN) [[unlikely]] {
+    return -1;
+  }
+
+  const size_t ml = static_cast<size_t>(clen - TAG_LEN);
+  const size_t dl = static_cast<size_t>(adlen);
+
+  const bool flg = decrypt<RATE>(k, npub, c + ml, ad, dl, c, m, ml);
+  *mlen = flg ? ml : 0;
+
+  return flg ? 0 : -1;
+}
+
+// Given N (>=0) -bytes input message, this routine computes 32 -bytes
+// Photon-Beetle-Hash digest, always returning 0
+inline int
+hash(unsigned char* const out,        // 32 -bytes digest
+     const unsigned char* const in,   // input message
+     const unsigned long long inlen   // len(in) >= 0
+)
+{
+  photon_beetle::hash(in, static_cast<size_t>(inlen), out);
+  return 0;
+}
+
+}
@@ -1,5 +1,10 @@
 #include "aead.hpp"
 #include "hash.hpp"
+#include "probes.hpp"
+#include "stats.hpp"
+#include <algorithm>
+#include <thread>
+#include <vector>
 
 // Thin C wrapper on top of underlying C++ implementation of
 // Photon-Beetle-{Hash, AEAD} functions, which can be used for producing shared
@@ -16,8 +21,8 @@ extern "C"
                                 const uint8_t* const __restrict,
                                 const uint8_t* const __restrict,
                                 const size_t,
-                                const uint8_t* const __restrict,
-                                uint8_t* const __restrict,
+                                const uint8_t* const,
+                                uint8_t* const,
                                 const size_t,
                                 uint8_t* const __restrict);
 
@@ -26,16 +31,16 @@ extern "C"
                                 const uint8_t* const __restrict,
                                 const uint8_t* const __restrict,
                                 const size_t,
-                                const uint8_t* const __restrict,
-                                uint8_t* const __restrict,
+                                const uint8_t* const,
+                                uint8_t* const,
                                 const size_t);
 
   void photon_beetle_128_encrypt(const uint8_t* const __restrict,
                                  const uint8_t* const __restrict,
                                  const uint8_t* const __restrict,
                                  const size_t,
-                                 const uint8_t* const __restrict,
-                                 uint8_t* const __restrict,
+                                 const uint8_t* const,
+                                 uint8_t* const,
                                  const size_t,
                                  uint8_t* const __restrict);
 
@@ -44,9 +49,211 @@ extern "C"
                                  const uint8_t* const __restrict,
                                  const uint8_t* const __restrict,
                                  const size_t,
-                                 const uint8_t* const __restrict,
-                                 uint8_t* const __restrict,
+                                 const uint8_t* const,
+                                 uint8_t* const,
                                  const size_t);
+
+  void photon_beetle_hash_batch(const uint8_t* const __restrict,
+                                const size_t* const __restrict,
+                                const size_t,
+                                uint8_t* const __restrict,
+                                const size_t);
+
+  void photon_beetle_32_encrypt_batch(const uint8_t* const __restrict,
+                                      const uint8_t* const __restrict,
+                                      const uint8_t* const __restrict,
+                                      const size_t* const __restrict,
+                                      const uint8_t* const __restrict,
+                                      uint8_t* const __restrict,
+                                      const size_t* const __restrict,
+                                      uint8_t* const __restrict,
+                                      const size_t,
+                                      const size_t);
+
+  bool photon_beetle_32_decrypt_batch(const uint8_t* const __restrict,
+                                      const uint8_t* const __restrict,
+                                      const uint8_t* const __restrict,
+                                      const uint8_t* const __restrict,
+                                      const size_t* const __restrict,
+                                      const uint8_t* const __restrict,
+                                      uint8_t* const __restrict,
+                                      const size_t* const __restrict,
+                                      bool* const __restrict,
+                                      const size_t,
+                                      const size_t);
+
+  void photon_beetle_128_encrypt_batch(const uint8_t* const __restrict,
+                                       const uint8_t* const __restrict,
+                                       const uint8_t* const __restrict,
+                                       const size_t* const __restrict,
+                                       const uint8_t* const __restrict,
+                                       uint8_t* const __restrict,
+                                       const size_t* const __restrict,
+                                       uint8_t* const __restrict,
+                                       const size_t,
+                                       const size_t);
+
+  bool photon_beetle_128_decrypt_batch(const uint8_t* const __restrict,
+                                       const uint8_t* const __restrict,
+                                       const uint8_t* const __restrict,
+                                       const uint8_t* const __restrict,
+                                       const size_t* const __restrict,
+                                       const uint8_t* const __restrict,
+                                       uint8_t* const __restrict,
+                                       const size_t* const __restrict,
+                                       bool* const __restrict,
+                                       const size_t,
+                                       const size_t);
+
+  bool photon_beetle_stats(photon_stats::snapshot* const);
+}
+
+// Batched routines
+//
+// N messages/ packets are packed back to back in one contiguous buffer, along
+// with an offsets array of (N + 1) -many entries, such that i-th message lives
+// in [offs[i], offs[i+1]). Fixed length inputs/ outputs ( i.e. nonces, tags,
+// digests ) are packed back to back, without any offsets array.
+//
+// Whole batch is processed in a single foreign function call, optionally
+// spread over T -many threads, where T = 0 means as many threads as available
+// hardware threads.
+namespace {
+
+// Approximate fixed cost ( in bytes ) of processing a message, irrespective of
+// its length, used for balancing work across threads
+constexpr size_t ITEM_COST = 64;
+
+// Splits N -many messages, described using offsets array, into ( at max ) T
+// -many contiguous ranges, carrying roughly equal work, and invokes given
+// function on each of those ranges, on a separate thread, while calling thread
+// takes first range
+template<typename F>
+inline void
+for_each_range(const size_t* const __restrict offs,
+               const size_t cnt,
+               const size_t threads,
+               F&& fn)
+{
+  size_t tcnt = threads == 0 ? std::thread::hardware_concurrency() : threads;
+  tcnt = std::max<size_t>(1, std::min(tcnt, cnt));
+
+  if (tcnt == 1) {
+    fn(0, cnt);
+    return;
+  }
+
+  const size_t total = (offs[cnt] - offs[0]) + cnt * ITEM_COST;
+  const size_t share = (total + tcnt - 1) / tcnt;
+
+  std::vector<size_t> bounds{ 0 };
+  size_t acc = 0;
+  for (size_t i = 0; i < cnt && bounds.size() < tcnt; i++) {
+    acc += (offs[i + 1] - offs[i]) + ITEM_COST;
+    if (acc >= share * bounds.size()) {
+      bounds.push_back(i + 1);
+    }
+  }
+  if (bounds.back() != cnt) {
+    bounds.push_back(cnt);
+  }
+
+  std::vector<std::thread> workers;
+  workers.reserve(bounds.size() - 2);
+
+  for (size_t i = 1; i + 1 < bounds.size(); i++) {
+    workers.emplace_back(fn, bounds[i], bounds[i + 1]);
+  }
+
+  fn(bounds[0], bounds[1]);
+
+  for (auto& w : workers) {
+    w.join();
+  }
+}
+
+template<const size_t R>
+inline void
+encrypt_batch(const uint8_t* const __restrict key,
+              const uint8_t* const __restrict nonces,
+              const uint8_t* const __restrict data,
+              const size_t* const __restrict d_offs,
+              const uint8_t* const __restrict txt,
+              uint8_t* const __restrict enc,
+              const size_t* const __restrict ct_offs,
+              uint8_t* const __restrict tags,
+              const size_t cnt,
+              const size_t threads)
+{
+  using namespace photon_beetle;
+  PHOTON_PROBE(encrypt_batch_entry, R, cnt, threads);
+
+  const auto body = [&](const size_t beg, const size_t end) {
+    for (size_t i = beg; i < end; i++) {
+      const size_t d_off = d_offs == nullptr ? 0 : d_offs[i];
+      const size_t d_len = d_offs == nullptr ? 0 : d_offs[i + 1] - d_off;
+      const size_t ct_off = ct_offs[i];
+      const size_t ct_len = ct_offs[i + 1] - ct_off;
+
+      encrypt<R>(key,
+                 nonces + i * NONCE_LEN,
+                 data + d_off,
+                 d_len,
+                 txt + ct_off,
+                 enc + ct_off,
+                 ct_len,
+                 tags + i * TAG_LEN);
+    }
+  };
+
+  for_each_range(ct_offs, cnt, threads, body);
+
+  PHOTON_PROBE(encrypt_batch_return, R, cnt, threads);
+}
+
+template<const size_t R>
+inline bool
+decrypt_batch(const uint8_t* const __restrict key,
+              const uint8_t* const __restrict nonces,
+              const uint8_t* const __restrict tags,
+              const uint8_t* const __restrict data,
+              const size_t* const __restrict d_offs,
+              const uint8_t* const __restrict enc,
+              uint8_t* const __restrict dec,
+              const size_t* const __restrict ct_offs,
+              bool* const __restrict flags,
+              const size_t cnt,
+              const size_t threads)
+{
+  using namespace photon_beetle;
+  PHOTON_PROBE(decrypt_batch_entry, R, cnt, threads);
+
+  const auto body = [&](const size_t beg, const size_t end) {
+    for (size_t i = beg; i < end; i++) {
+      const size_t d_off = d_offs == nullptr ? 0 : d_offs[i];
+      const size_t d_len = d_offs == nullptr ? 0 : d_offs[i + 1] - d_off;
+      const size_t ct_off = ct_offs[i];
+      const size_t ct_len = ct_offs[i + 1] - ct_off;
+
+      flags[i] = decrypt<R>(key,
+                            nonces + i * NONCE_LEN,
+                            tags + i * TAG_LEN,
+                            data + d_off,
+                            d_len,
+                            enc + ct_off,
+                            dec + ct_off,
+                            ct_len);
+    }
+  };
+
+  for_each_range(ct_offs, cnt, threads, body);
+
+  const bool ok = std::all_of(flags, flags + cnt, [](bool f) { return f; });
+  PHOTON_PROBE(decrypt_batch_return, R, cnt, threads, ok);
+
+  return ok;
+}
+
 }
 
 // Function implementation
@@ -64,12 +271,14 @@ extern "C"
   // Given 16 -bytes secret key, 16 -bytes nonce, N -bytes plain text & M -bytes
   // associated data, this routine computes N -bytes cipher text & 16 -bytes
   // authentication tag, using Photon-Beetle-AEAD[32] algorithm | N, M >= 0
+  //
+  // Plain text and cipher text can be same buffer, for in-place encryption.
   void photon_beetle_32_encrypt(const uint8_t* const __restrict key,
                                 const uint8_t* const __restrict nonce,
                                 const uint8_t* const __restrict data,
                                 const size_t d_len,
-                                const uint8_t* const __restrict txt,
-                                uint8_t* const __restrict enc,
+                                const uint8_t* const txt,
+                                uint8_t* const enc,
                                 const size_t ct_len,
                                 uint8_t* const __restrict tag)
   {
@@ -81,6 +290,9 @@ extern "C"
   // -bytes deciphered text & a boolean verification flag, using
   // Photon-Beetle-AEAD[32] algorithm | N, M >= 0
   //
+  // Cipher text and deciphered text can be same buffer, for in-place
+  // decryption.
+  //
   // Before consuming decrypted bytes ensure presence of truth value in returned
   // boolean flag !
   bool photon_beetle_32_decrypt(const uint8_t* const __restrict key,
@@ -88,8 +300,8 @@ extern "C"
                                 const uint8_t* const __restrict tag,
                                 const uint8_t* const __restrict data,
                                 const size_t d_len,
-                                const uint8_t* const __restrict enc,
-                                uint8_t* const __restrict dec,
+                                const uint8_t* const enc,
+                                uint8_t* const dec,
                                 const size_t ct_len)
   {
     using namespace photon_beetle;
@@ -99,12 +311,14 @@ extern "C"
   // Given 16 -bytes secret key, 16 -bytes nonce, N -bytes plain text & M -bytes
   // associated data, this routine computes N -bytes cipher text & 16 -bytes
   // authentication tag, using Photon-Beetle-AEAD[128] algorithm | N, M >= 0
+  //
+  // Plain text and cipher text can be same buffer, for in-place encryption.
   void photon_beetle_128_encrypt(const uint8_t* const __restrict key,
                                  const uint8_t* const __restrict nonce,
                                  const uint8_t* const __restrict data,
                                  const size_t d_len,
-                                 const uint8_t* const __restrict txt,
-                                 uint8_t* const __restrict enc,
+                                 const uint8_t* const txt,
+                                 uint8_t* const enc,
                                  const size_t ct_len,
                                  uint8_t* const __restrict tag)
   {
@@ -116,6 +330,9 @@ extern "C"
   // -bytes deciphered text & a boolean verification flag, using
   // Photon-Beetle-AEAD[128] algorithm | N, M >= 0
   //
+  // Cipher text and deciphered text can be same buffer, for in-place
+  // decryption.
+  //
   // Before consuming decrypted bytes ensure presence of truth value in returned
   // boolean flag !
   bool photon_beetle_128_decrypt(const uint8_t* const __restrict key,
@@ -123,11 +340,124 @@ extern "C"
                                  const uint8_t* const __restrict tag,
                                  const uint8_t* const __restrict data,
                                  const size_t d_len,
-                                 const uint8_t* const __restrict enc,
-                                 uint8_t* const __restrict dec,
+                                 const uint8_t* const enc,
+                                 uint8_t* const dec,
                                  const size_t ct_len)
   {
     using namespace photon_beetle;
     return decrypt<16>(key, nonce, tag, data, d_len, enc, dec, ct_len);
   }
+
+  // Given N -many messages, packed back to back, along with (N + 1) -many
+  // offsets, this routine computes N -many 32 -bytes digests, packed back to
+  // back, using Photon-Beetle hashing algorithm, spread over T -many threads
+  void photon_beetle_hash_batch(const uint8_t* const __restrict in,
+                                const size_t* const __restrict offs,
+                                const size_t cnt,
+                                uint8_t* const __restrict out,
+                                const size_t threads)
+  {
+    using namespace photon_beetle;
+    PHOTON_PROBE(hash_batch_entry, cnt, threads);
+
+    for_each_range(offs, cnt, threads, [&](const size_t beg, const size_t end) {
+      for (size_t i = beg; i < end; i++) {
+        hash(in + offs[i], offs[i + 1] - offs[i], out + i * DIGEST_LEN);
+      }
+    });
+
+    PHOTON_PROBE(hash_batch_return, cnt, threads);
+  }
+
+  // Given 16 -bytes secret key, N -many 16 -bytes nonces, N -many plain texts
+  // & N -many associated data ( each packed back to back, with (N + 1) -many
+  // offsets ), this routine computes N -many cipher texts ( laid out same as
+  // plain texts ) & N -many 16 -bytes authentication tags, using
+  // Photon-Beetle-AEAD[32] algorithm, spread over T -many threads
+  //
+  // Associated data offsets array can be NULL, when none of the packets carry
+  // associated data.
+  void photon_beetle_32_encrypt_batch(const uint8_t* const __restrict key,
+                                      const uint8_t* const __restrict nonces,
+                                      const uint8_t* const __restrict data,
+                                      const size_t* const __restrict d_offs,
+                                      const uint8_t* const __restrict txt,
+                                      uint8_t* const __restrict enc,
+                                      const size_t* const __restrict ct_offs,
+                                      uint8_t* const __restrict tags,
+                                      const size_t cnt,
+                                      const size_t threads)
+  {
+    encrypt_batch<4>(
+      key, nonces, data, d_offs, txt, enc, ct_offs, tags, cnt, threads);
+  }
+
+  // Given 16 -bytes secret key, N -many 16 -bytes nonces, N -many 16 -bytes
+  // authentication tags, N -many cipher texts & N -many associated data ( each
+  // packed back to back, with (N + 1) -many offsets ), this routine computes N
+  // -many deciphered texts ( laid out same as cipher texts ) & N -many boolean
+  // verification flags, using Photon-Beetle-AEAD[32] algorithm, spread over T
+  // -many threads. Returned boolean is truth value only if all packets are
+  // verified.
+  bool photon_beetle_32_decrypt_batch(const uint8_t* const __restrict key,
+                                      const uint8_t* const __restrict nonces,
+                                      const uint8_t* const __restrict tags,
+                                      const uint8_t* const __restrict data,
+                                      const size_t* const __restrict d_offs,
+                                      const uint8_t* const __restrict enc,
+                                      uint8_t* const __restrict dec,
+                                      const size_t* const __restrict ct_offs,
+                                      bool* const __restrict flags,
+                                      const size_t cnt,
+                                      const size_t threads)
+  {
+    return decrypt_batch<4>(
+      key, nonces, tags, data, d_offs, enc, dec, ct_offs, flags, cnt, threads);
+  }
+
+  // Same as `photon_beetle_32_encrypt_batch`, but using
+  // Photon-Beetle-AEAD[128] algorithm
+  void photon_beetle_128_encrypt_batch(const uint8_t* const __restrict key,
+                                       const uint8_t* const __restrict nonces,
+                                       const uint8_t* const __restrict data,
+                                       const size_t* const __restrict d_offs,
+                                       const uint8_t* const __restrict txt,
+                                       uint8_t* const __restrict enc,
+                                       const size_t* const __restrict ct_offs,
+                                       uint8_t* const __restrict tags,
+                                       const size_t cnt,
+                                       const size_t threads)
+  {
+    encrypt_batch<16>(
+      key, nonces, data, d_offs, txt, enc, ct_offs, tags, cnt, threads);
+  }
+
+  // Same as `photon_beetle_32_decrypt_batch`, but using
+  // Photon-Beetle-AEAD[128] algorithm
+  bool photon_beetle_128_decrypt_batch(const uint8_t* const __restrict key,
+                                       const uint8_t* const __restrict nonces,
+                                       const uint8_t* const __restrict tags,
+                                       const uint8_t* const __restrict data,
+                                       const size_t* const __restrict d_offs,
+                                       const uint8_t* const __restrict enc,
+                                       uint8_t* const __restrict dec,
+                                       const size_t* const __restrict ct_offs,
+                                       bool* const __restrict flags,
+                                       const size_t cnt,
+                                       const size_t threads)
+  {
+    return decrypt_batch<16>(
+      key, nonces, tags, data, d_offs, enc, dec, ct_offs, flags, cnt, threads);
+  }
+
+  // Fills given struct with process-wide operational counters ( bytes hashed,
+  // sealed & opened, permutations executed, tag verification failures & time
+  // spent, in nanoseconds ), aggregated over all threads, returning false, if
+  // shared library object was built without `PHOTON_STATS`, in which case
+  // all counters are zero.
+  bool photon_beetle_stats(photon_stats::snapshot* const out)
+  {
+    *out = photon_stats::collect();
+    return photon_stats::ENABLED;
+  }
 }
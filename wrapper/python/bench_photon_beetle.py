@@ -0,0 +1,279 @@
+#!/usr/bin/python3
+
+"""
+  Benchmarks Python wrapper of Photon-Beetle-{Hash, AEAD}, for given message
+  lengths, and compares each result against native numbers of same routine,
+  for same lengths, reported by `bench/a.out` ( see bench/main.cpp ), so that
+  time spent in ctypes & wrapper code can be told apart from time spent in
+  crypto.
+
+  For each case, it reports
+
+    - time per call of wrapper function ( say `photon_beetle_hash` )
+    - time per call of bare foreign function, with pre-built arguments
+    - time per call of native C++ routine
+    - time spent in Python code of wrapper ( i.e. wrapper - FFI )
+    - per-call overhead of wrapper ( i.e. wrapper - native ) & its share in
+      wrapper's time
+    - throughput of wrapper & native routine
+
+  Usage ( from this directory, after `make lib` & `make bench/a.out` )
+
+    python3 bench_photon_beetle.py
+    python3 bench_photon_beetle.py --lens 0,64,1024,16384 --ad_len 32
+
+    # or, compare against already collected native JSON output
+    python3 bench_photon_beetle.py --native ../../bench/native.json
+
+  Native JSON output is collected, when not provided, by running
+
+    ../../bench/a.out --lens=L,.. --ad_len=N --tiny_max=0 --large= \\
+      --benchmark_filter='^bench_photon_beetle::(hash|aead_)' \\
+      --benchmark_out=<file> --benchmark_out_format=json
+
+  Only Python standard library is required.
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+import timeit
+from ctypes import CDLL, c_bool, c_char, c_char_p, c_size_t
+from os.path import abspath, exists
+from statistics import mean
+from typing import Callable, Dict, List, Optional, Tuple
+
+import photon_beetle as pb
+
+sys.path.insert(0, abspath("../../scripts"))
+from bench_compare import load  # noqa: E402
+
+BENCH_PATH: str = abspath("../../bench/a.out")
+
+# Bare foreign functions are called through own handle of shared library object
+# ( same one, which is loaded by `photon_beetle` module ), so that their
+# signatures are declared here, instead of relying on wrapper's internals
+FFI_LIB: CDLL = CDLL(abspath("../libphoton-beetle.so"))
+
+FFI_LIB.photon_beetle_hash.argtypes = [c_char_p, c_size_t, c_char_p]
+
+for _f in (FFI_LIB.photon_beetle_32_encrypt, FFI_LIB.photon_beetle_128_encrypt):
+    _f.argtypes = [
+        c_char_p,
+        c_char_p,
+        c_char_p,
+        c_size_t,
+        c_char_p,
+        c_char_p,
+        c_size_t,
+        c_char_p,
+    ]
+
+for _f in (FFI_LIB.photon_beetle_32_decrypt, FFI_LIB.photon_beetle_128_decrypt):
+    _f.argtypes = [
+        c_char_p,
+        c_char_p,
+        c_char_p,
+        c_char_p,
+        c_size_t,
+        c_char_p,
+        c_char_p,
+        c_size_t,
+    ]
+    _f.restype = c_bool
+
+# Wrapper routine name & respective native benchmark name, without arguments
+ROUTINES: List[Tuple[str, str]] = [
+    ("photon_beetle_hash", "bench_photon_beetle::hash"),
+    ("photon_beetle_32_encrypt", "bench_photon_beetle::aead_encrypt<4>"),
+    ("photon_beetle_32_decrypt", "bench_photon_beetle::aead_decrypt<4>"),
+    ("photon_beetle_128_encrypt", "bench_photon_beetle::aead_encrypt<16>"),
+    ("photon_beetle_128_decrypt", "bench_photon_beetle::aead_decrypt<16>"),
+]
+
+
+def native_name(base: str, dlen: int, mlen: int) -> str:
+    """
+    Name of native benchmark case, as registered in bench/main.cpp
+    """
+    if base.endswith("::hash"):
+        return f"{base}/{mlen}"
+    return f"{base}/{dlen}/{mlen}"
+
+
+def per_call_ns(fn: Callable[[], object], min_time: float, reps: int) -> float:
+    """
+    Calls given routine, in batches lasting at least `min_time` seconds, `reps`
+    -many times, returning fastest time per call, in nanoseconds
+    """
+    timer = timeit.Timer(fn)
+
+    n, t = timer.autorange()
+    n = max(1, int(n * min_time / max(t, 1e-9)))
+
+    return min(timer.repeat(repeat=reps, number=n)) / n * 1e9
+
+
+def c_buf(buf: bytearray):
+    """
+    Wraps given bytearray in a ctypes array sharing its memory, so that foreign
+    function writes output directly into it
+    """
+    return (c_char * len(buf)).from_buffer(buf)
+
+
+def cases(name: str, dlen: int, mlen: int) -> Tuple[Callable, Callable]:
+    """
+    Returns wrapper call & bare foreign function call of given routine, with
+    random inputs of given lengths, both producing output in pre-allocated
+    buffers
+    """
+    key, nonce = os.urandom(16), os.urandom(16)
+    data, text = os.urandom(dlen), os.urandom(mlen)
+    out, tag = bytearray(mlen), bytearray(16)
+
+    fn = getattr(pb, name)
+    ffi = getattr(FFI_LIB, name)
+
+    c_out = c_buf(out)
+    c_tag = c_buf(tag)
+
+    if name == "photon_beetle_hash":
+        digest = bytearray(32)
+        c_digest = c_buf(digest)
+
+        return (
+            lambda: fn(text, digest),
+            lambda: ffi(text, mlen, c_digest),
+        )
+
+    if name.endswith("_encrypt"):
+        return (
+            lambda: fn(key, nonce, data, text, out, tag),
+            lambda: ffi(key, nonce, data, dlen, text, c_out, mlen, c_tag),
+        )
+
+    enc_fn = getattr(pb, name.replace("_decrypt", "_encrypt"))
+    enc, tag_ = enc_fn(key, nonce, data, text)
+
+    return (
+        lambda: fn(key, nonce, tag_, data, enc, out),
+        lambda: ffi(key, nonce, tag_, data, dlen, enc, c_out, mlen),
+    )
+
+
+def run_native(lens: List[int], ad_len: int, min_time: float) -> str:
+    """
+    Runs native benchmarks for given lengths, returning path of JSON output
+    """
+    assert exists(BENCH_PATH), "Use `make bench/a.out` to build benchmarks !"
+
+    fd, path = tempfile.mkstemp(suffix=".json")
+    os.close(fd)
+
+    subprocess.run(
+        [
+            BENCH_PATH,
+            f"--lens={','.join(map(str, lens))}",
+            f"--ad_len={ad_len}",
+            "--tiny_max=0",
+            "--large=",
+            "--benchmark_filter=^bench_photon_beetle::(hash|aead_)",
+            f"--benchmark_min_time={min_time}",
+            f"--benchmark_out={path}",
+            "--benchmark_out_format=json",
+        ],
+        check=True,
+        stdout=subprocess.DEVNULL,
+        stderr=subprocess.DEVNULL,
+    )
+
+    return path
+
+
+def fmt_ns(ns: Optional[float]) -> str:
+    return "-" if ns is None else f"{ns:.0f}"
+
+
+def fmt_mbps(mlen: int, ns: Optional[float]) -> str:
+    return "-" if ns is None or mlen == 0 else f"{mlen / ns * 1e3:.2f}"
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument(
+        "--lens",
+        default="0,16,64,256,1024,4096",
+        help="comma separated message lengths ( default: 0,16,64,256,1024,4096 )",
+    )
+    parser.add_argument(
+        "--ad_len",
+        type=int,
+        default=32,
+        help="associated data length of AEAD cases ( default: 32 )",
+    )
+    parser.add_argument(
+        "--min_time",
+        type=float,
+        default=0.1,
+        help="minimum seconds per timed batch ( default: 0.1 )",
+    )
+    parser.add_argument(
+        "--reps",
+        type=int,
+        default=5,
+        help="timed batches per case, fastest one is reported ( default: 5 )",
+    )
+    parser.add_argument(
+        "--native",
+        help="JSON output of bench/a.out, which is collected, when not given",
+    )
+    args = parser.parse_args()
+
+    lens = [int(v) for v in args.lens.split(",") if v]
+
+    path = args.native or run_native(lens, args.ad_len, args.min_time)
+    _, runs = load(path, "cpu_time")
+    if args.native is None:
+        os.remove(path)
+
+    native: Dict[str, float] = {k: mean(v) for k, v in runs.items()}
+
+    print(
+        f"{'Routine':<26} {'Length':>7} {'Wrapper':>9} {'FFI':>9} "
+        f"{'Native':>9} {'Glue':>7} {'Overhead':>9} {'Share':>6} "
+        f"{'Wrap MB/s':>10} {'Nat MB/s':>10}"
+    )
+    unit = "( ns )"
+    print(f"{'':<34} {unit:>9} {unit:>9} {unit:>9} {unit:>7} {unit:>9}")
+
+    for name, base in ROUTINES:
+        dlen = 0 if name == "photon_beetle_hash" else args.ad_len
+
+        for mlen in lens:
+            wrap, ffi = cases(name, dlen, mlen)
+
+            wrap_ns = per_call_ns(wrap, args.min_time, args.reps)
+            ffi_ns = per_call_ns(ffi, args.min_time, args.reps)
+            nat_ns = native.get(native_name(base, dlen, mlen))
+
+            over = share = "-"
+            if nat_ns is not None:
+                over = f"{wrap_ns - nat_ns:.0f}"
+                share = f"{(wrap_ns - nat_ns) / wrap_ns:.0%}"
+
+            print(
+                f"{name:<26} {mlen:>7} {fmt_ns(wrap_ns):>9} {fmt_ns(ffi_ns):>9} "
+                f"{fmt_ns(nat_ns):>9} {fmt_ns(wrap_ns - ffi_ns):>7} {over:>9} "
+                f"{share:>6} "
+                f"{fmt_mbps(dlen + mlen, wrap_ns):>10} "
+                f"{fmt_mbps(dlen + mlen, nat_ns):>10}"
+            )
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -11,8 +11,19 @@
   Project: https://github.com/itzmeanjan/photon-beetle
 """
 
-from typing import Tuple
-from ctypes import CDLL, c_size_t, c_char_p, c_bool, create_string_buffer
+from typing import Dict, List, Optional, Sequence, Tuple, Union
+from itertools import accumulate
+from ctypes import (
+    CDLL,
+    POINTER,
+    c_size_t,
+    c_char,
+    c_char_p,
+    c_bool,
+    c_uint64,
+    create_string_buffer,
+    Structure,
+)
 from posixpath import exists, abspath
 
 SO_PATH: str = abspath("../libphoton-beetle.so")
@@ -20,157 +31,464 @@ assert exists(SO_PATH), "Use `make lib` to generate shared library object !"
 
 SO_LIB: CDLL = CDLL(SO_PATH)
 
+# Foreign function signatures are declared only once, when module is loaded,
+# instead of on every call
 
-def photon_beetle_hash(msg: bytes) -> bytes:
+SO_LIB.photon_beetle_hash.argtypes = [c_char_p, c_size_t, c_char_p]
+
+for _f in (SO_LIB.photon_beetle_32_encrypt, SO_LIB.photon_beetle_128_encrypt):
+    _f.argtypes = [
+        c_char_p,
+        c_char_p,
+        c_char_p,
+        c_size_t,
+        c_char_p,
+        c_char_p,
+        c_size_t,
+        c_char_p,
+    ]
+
+for _f in (SO_LIB.photon_beetle_32_decrypt, SO_LIB.photon_beetle_128_decrypt):
+    _f.argtypes = [
+        c_char_p,
+        c_char_p,
+        c_char_p,
+        c_char_p,
+        c_size_t,
+        c_char_p,
+        c_char_p,
+        c_size_t,
+    ]
+    _f.restype = c_bool
+
+SO_LIB.photon_beetle_hash_batch.argtypes = [
+    c_char_p,
+    POINTER(c_size_t),
+    c_size_t,
+    c_char_p,
+    c_size_t,
+]
+
+for _f in (
+    SO_LIB.photon_beetle_32_encrypt_batch,
+    SO_LIB.photon_beetle_128_encrypt_batch,
+):
+    _f.argtypes = [
+        c_char_p,
+        c_char_p,
+        c_char_p,
+        POINTER(c_size_t),
+        c_char_p,
+        c_char_p,
+        POINTER(c_size_t),
+        c_char_p,
+        c_size_t,
+        c_size_t,
+    ]
+
+for _f in (
+    SO_LIB.photon_beetle_32_decrypt_batch,
+    SO_LIB.photon_beetle_128_decrypt_batch,
+):
+    _f.argtypes = [
+        c_char_p,
+        c_char_p,
+        c_char_p,
+        c_char_p,
+        POINTER(c_size_t),
+        c_char_p,
+        c_char_p,
+        POINTER(c_size_t),
+        POINTER(c_bool),
+        c_size_t,
+        c_size_t,
+    ]
+    _f.restype = c_bool
+
+
+class _Stats(Structure):
+    """
+    Mirrors `photon_stats::snapshot`, see include/stats.hpp
+    """
+
+    _fields_ = [
+        ("bytes_hashed", c_uint64),
+        ("bytes_sealed", c_uint64),
+        ("bytes_opened", c_uint64),
+        ("permutations", c_uint64),
+        ("tag_failures", c_uint64),
+        ("nanoseconds", c_uint64),
+    ]
+
+
+SO_LIB.photon_beetle_stats.argtypes = [POINTER(_Stats)]
+SO_LIB.photon_beetle_stats.restype = c_bool
+
+
+Buffer = Union[bytes, bytearray, memoryview]
+
+
+def _in(buf: Buffer):
+    """
+    Returns an object which can be passed, as input pointer, to foreign functions,
+    without copying underlying bytes. `bytes` objects are passed as they are, while
+    any writable, C-contiguous buffer ( say bytearray, memoryview, numpy array )
+    is wrapped in a ctypes array sharing its memory. Read-only buffers, other than
+    `bytes`, are copied.
+    """
+    if isinstance(buf, bytes):
+        return buf
+
+    mv = memoryview(buf).cast("B")
+    if mv.readonly:
+        return mv.tobytes()
+
+    return (c_char * mv.nbytes).from_buffer(mv)
+
+
+def _out(buf: Buffer, n: int):
+    """
+    Wraps caller provided writable, C-contiguous buffer ( say bytearray,
+    memoryview, numpy array ) of exactly N -bytes in a ctypes array sharing its
+    memory, so that foreign function writes output directly into it
+    """
+    mv = memoryview(buf).cast("B")
+    assert not mv.readonly, "Output buffer must be writable !"
+    assert mv.nbytes == n, f"Output buffer must be of {n} -bytes !"
+
+    return (c_char * n).from_buffer(mv)
+
+
+def _len(buf: Buffer) -> int:
+    return memoryview(buf).nbytes
+
+
+def photon_beetle_hash(msg: Buffer, out: Optional[Buffer] = None) -> Buffer:
     """
     Given a N ( >= 0 ) -bytes input message, this function computes 32 -bytes
     Photon-Beetle-Hash digest
+
+    Input message can be any C-contiguous buffer. If 32 -bytes writable `out`
+    buffer is provided, digest is written into it & it's returned, otherwise
+    a new `bytes` object is returned.
     """
-    digest = create_string_buffer(32)
+    digest = create_string_buffer(32) if out is None else _out(out, 32)
+
+    SO_LIB.photon_beetle_hash(_in(msg), _len(msg), digest)
+
+    return digest.raw if out is None else out
+
+
+def _encrypt(fn, key, nonce, data, text, out, tag):
+    tlen = _len(text)
 
-    args = [c_char_p, c_size_t, c_char_p]
-    SO_LIB.photon_beetle_hash.argtypes = args
-    SO_LIB.photon_beetle_hash(msg, len(msg), digest)
+    enc = create_string_buffer(tlen) if out is None else _out(out, tlen)
+    tag_ = create_string_buffer(16) if tag is None else _out(tag, 16)
 
-    return digest.raw
+    # `out` may share memory with `text`, for in-place encryption
+    fn(_in(key), _in(nonce), _in(data), _len(data), _in(text), enc, tlen, tag_)
+
+    return (enc.raw if out is None else out), (tag_.raw if tag is None else tag)
+
+
+def _decrypt(fn, key, nonce, tag, data, enc, out):
+    clen = _len(enc)
+
+    dec = create_string_buffer(clen) if out is None else _out(out, clen)
+
+    # `out` may share memory with `enc`, for in-place decryption
+    ct = _in(enc)
+    f = fn(_in(key), _in(nonce), _in(tag), _in(data), _len(data), ct, dec, clen)
+
+    return f, (dec.raw if out is None else out)
 
 
 def photon_beetle_32_encrypt(
-    key: bytes, nonce: bytes, data: bytes, text: bytes
-) -> Tuple[bytes, bytes]:
+    key: Buffer,
+    nonce: Buffer,
+    data: Buffer,
+    text: Buffer,
+    out: Optional[Buffer] = None,
+    tag: Optional[Buffer] = None,
+) -> Tuple[Buffer, Buffer]:
     """
     Encrypts M ( >=0 ) -many plain text bytes, consuming 16 -bytes secret key,
     16 -bytes public message nonce & N ( >=0 ) -bytes associated data, while producing
     M -bytes cipher text & 16 -bytes authentication tag ( in order )
-    """
-    assert len(key) == 16, "Photon-Beetle-AEAD[32] takes 16 -bytes secret key !"
-    assert len(nonce) == 16, "Photon-Beetle-AEAD[32] takes 16 -bytes nonce !"
 
-    enc = create_string_buffer(len(text))
-    tag = create_string_buffer(16)
-
-    args = [
-        c_char_p,
-        c_char_p,
-        c_char_p,
-        c_size_t,
-        c_char_p,
-        c_char_p,
-        c_size_t,
-        c_char_p,
-    ]
-    SO_LIB.photon_beetle_32_encrypt.argtypes = args
-    SO_LIB.photon_beetle_32_encrypt(
-        key, nonce, data, len(data), text, enc, len(text), tag
-    )
+    All inputs can be any C-contiguous buffer. If writable `out` ( M -bytes ) and/ or
+    `tag` ( 16 -bytes ) buffers are provided, outputs are written into them & they are
+    returned, otherwise new `bytes` objects are returned. Pass `out=text` for
+    encrypting in-place.
+    """
+    assert _len(key) == 16, "Photon-Beetle-AEAD[32] takes 16 -bytes secret key !"
+    assert _len(nonce) == 16, "Photon-Beetle-AEAD[32] takes 16 -bytes nonce !"
 
-    return enc.raw, tag.raw
+    fn = SO_LIB.photon_beetle_32_encrypt
+    return _encrypt(fn, key, nonce, data, text, out, tag)
 
 
 def photon_beetle_32_decrypt(
-    key: bytes, nonce: bytes, tag: bytes, data: bytes, enc: bytes
-) -> Tuple[bool, bytes]:
+    key: Buffer,
+    nonce: Buffer,
+    tag: Buffer,
+    data: Buffer,
+    enc: Buffer,
+    out: Optional[Buffer] = None,
+) -> Tuple[bool, Buffer]:
     """
     Decrypts M ( >=0 ) -many cipher text bytes, consuming 16 -bytes secret key,
     16 -bytes public message nonce, 16 -bytes authentication tag & N ( >=0 ) -bytes
     associated data, while producing boolean flag denoting verification status ( which
     must hold truth value, check before consuming decrypted output bytes ) &
     M -bytes plain text ( in order )
-    """
-    assert len(key) == 16, "Photon-Beetle-AEAD[32] takes 16 -bytes secret key !"
-    assert len(nonce) == 16, "Photon-Beetle-AEAD[32] takes 16 -bytes nonce !"
-    assert len(tag) == 16, "Photon-Beetle-AEAD[32] takes 16 -bytes authentication tag !"
-
-    dec = create_string_buffer(len(enc))
 
-    args = [
-        c_char_p,
-        c_char_p,
-        c_char_p,
-        c_char_p,
-        c_size_t,
-        c_char_p,
-        c_char_p,
-        c_size_t,
-    ]
-    SO_LIB.photon_beetle_32_decrypt.argtypes = args
-    SO_LIB.photon_beetle_32_decrypt.restype = c_bool
-
-    f = SO_LIB.photon_beetle_32_decrypt(
-        key, nonce, tag, data, len(data), enc, dec, len(enc)
-    )
+    All inputs can be any C-contiguous buffer. If writable `out` ( M -bytes ) buffer
+    is provided, plain text is written into it & it's returned, otherwise a new
+    `bytes` object is returned. Pass `out=enc` for decrypting in-place. Note, `out`
+    is zeroed when verification fails.
+    """
+    assert _len(key) == 16, "Photon-Beetle-AEAD[32] takes 16 -bytes secret key !"
+    assert _len(nonce) == 16, "Photon-Beetle-AEAD[32] takes 16 -bytes nonce !"
+    assert (
+        _len(tag) == 16
+    ), "Photon-Beetle-AEAD[32] takes 16 -bytes authentication tag !"
 
-    return f, dec.raw
+    fn = SO_LIB.photon_beetle_32_decrypt
+    return _decrypt(fn, key, nonce, tag, data, enc, out)
 
 
 def photon_beetle_128_encrypt(
-    key: bytes, nonce: bytes, data: bytes, text: bytes
-) -> Tuple[bytes, bytes]:
+    key: Buffer,
+    nonce: Buffer,
+    data: Buffer,
+    text: Buffer,
+    out: Optional[Buffer] = None,
+    tag: Optional[Buffer] = None,
+) -> Tuple[Buffer, Buffer]:
     """
     Encrypts M ( >=0 ) -many plain text bytes, consuming 16 -bytes secret key,
     16 -bytes public message nonce & N ( >=0 ) -bytes associated data, while producing
     M -bytes cipher text & 16 -bytes authentication tag ( in order )
-    """
-    assert len(key) == 16, "Photon-Beetle-AEAD[128] takes 16 -bytes secret key !"
-    assert len(nonce) == 16, "Photon-Beetle-AEAD[128] takes 16 -bytes nonce !"
-
-    enc = create_string_buffer(len(text))
-    tag = create_string_buffer(16)
 
-    args = [
-        c_char_p,
-        c_char_p,
-        c_char_p,
-        c_size_t,
-        c_char_p,
-        c_char_p,
-        c_size_t,
-        c_char_p,
-    ]
-    SO_LIB.photon_beetle_128_encrypt.argtypes = args
-    SO_LIB.photon_beetle_128_encrypt(
-        key, nonce, data, len(data), text, enc, len(text), tag
-    )
+    All inputs can be any C-contiguous buffer. If writable `out` ( M -bytes ) and/ or
+    `tag` ( 16 -bytes ) buffers are provided, outputs are written into them & they are
+    returned, otherwise new `bytes` objects are returned. Pass `out=text` for
+    encrypting in-place.
+    """
+    assert _len(key) == 16, "Photon-Beetle-AEAD[128] takes 16 -bytes secret key !"
+    assert _len(nonce) == 16, "Photon-Beetle-AEAD[128] takes 16 -bytes nonce !"
 
-    return enc.raw, tag.raw
+    fn = SO_LIB.photon_beetle_128_encrypt
+    return _encrypt(fn, key, nonce, data, text, out, tag)
 
 
 def photon_beetle_128_decrypt(
-    key: bytes, nonce: bytes, tag: bytes, data: bytes, enc: bytes
-) -> Tuple[bool, bytes]:
+    key: Buffer,
+    nonce: Buffer,
+    tag: Buffer,
+    data: Buffer,
+    enc: Buffer,
+    out: Optional[Buffer] = None,
+) -> Tuple[bool, Buffer]:
     """
     Decrypts M ( >=0 ) -many cipher text bytes, consuming 16 -bytes secret key,
     16 -bytes public message nonce, 16 -bytes authentication tag & N ( >=0 ) -bytes
     associated data, while producing boolean flag denoting verification status ( which
     must hold truth value, check before consuming decrypted output bytes ) &
     M -bytes plain text ( in order )
+
+    All inputs can be any C-contiguous buffer. If writable `out` ( M -bytes ) buffer
+    is provided, plain text is written into it & it's returned, otherwise a new
+    `bytes` object is returned. Pass `out=enc` for decrypting in-place. Note, `out`
+    is zeroed when verification fails.
     """
-    assert len(key) == 16, "Photon-Beetle-AEAD[128] takes 16 -bytes secret key !"
-    assert len(nonce) == 16, "Photon-Beetle-AEAD[128] takes 16 -bytes nonce !"
+    assert _len(key) == 16, "Photon-Beetle-AEAD[128] takes 16 -bytes secret key !"
+    assert _len(nonce) == 16, "Photon-Beetle-AEAD[128] takes 16 -bytes nonce !"
     assert (
-        len(tag) == 16
+        _len(tag) == 16
     ), "Photon-Beetle-AEAD[128] takes 16 -bytes authentication tag !"
 
-    dec = create_string_buffer(len(enc))
+    fn = SO_LIB.photon_beetle_128_decrypt
+    return _decrypt(fn, key, nonce, tag, data, enc, out)
 
-    args = [
-        c_char_p,
-        c_char_p,
-        c_char_p,
-        c_char_p,
-        c_size_t,
-        c_char_p,
-        c_char_p,
-        c_size_t,
-    ]
-    SO_LIB.photon_beetle_128_decrypt.argtypes = args
-    SO_LIB.photon_beetle_128_decrypt.restype = c_bool
 
-    f = SO_LIB.photon_beetle_128_decrypt(
-        key, nonce, tag, data, len(data), enc, dec, len(enc)
+def _offsets(bufs: Sequence[bytes]):
+    """
+    Given N byte strings, which are to be packed back to back, computes (N + 1)
+    -many offsets, such that i-th byte string lives in [offs[i], offs[i+1])
+    """
+    return (c_size_t * (len(bufs) + 1))(*accumulate(map(len, bufs), initial=0))
+
+
+def _split(buf: bytes, offs) -> List[bytes]:
+    """
+    Splits packed byte string back into N byte strings, using (N + 1) -many offsets
+    """
+    return [buf[offs[i] : offs[i + 1]] for i in range(len(offs) - 1)]
+
+
+def photon_beetle_hash_batch(msgs: Sequence[bytes], threads: int = 0) -> List[bytes]:
+    """
+    Given N -many input messages, this function computes N -many 32 -bytes
+    Photon-Beetle-Hash digests, in a single foreign function call, spread over
+    `threads` -many threads ( 0 means all available hardware threads )
+    """
+    cnt = len(msgs)
+    offs = _offsets(msgs)
+    digests = create_string_buffer(cnt * 32)
+
+    SO_LIB.photon_beetle_hash_batch(b"".join(msgs), offs, cnt, digests, threads)
+
+    raw = digests.raw
+    return [raw[i * 32 : (i + 1) * 32] for i in range(cnt)]
+
+
+def _encrypt_batch(fn, key, nonces, data, texts, threads):
+    assert len(key) == 16, "Photon-Beetle-AEAD takes 16 -bytes secret key !"
+    assert len(nonces) == len(texts), "Each packet needs its own nonce !"
+    assert len(data) == len(texts), "Each packet needs its associated data !"
+    assert all(
+        len(n) == 16 for n in nonces
+    ), "Photon-Beetle-AEAD takes 16 -bytes nonce !"
+
+    cnt = len(texts)
+    d_offs = _offsets(data)
+    ct_offs = _offsets(texts)
+    enc = create_string_buffer(ct_offs[cnt])
+    tags = create_string_buffer(cnt * 16)
+
+    fn(
+        key,
+        b"".join(nonces),
+        b"".join(data),
+        d_offs,
+        b"".join(texts),
+        enc,
+        ct_offs,
+        tags,
+        cnt,
+        threads,
+    )
+
+    raw = tags.raw
+    tags = [raw[i * 16 : (i + 1) * 16] for i in range(cnt)]
+    return _split(enc.raw, ct_offs), tags
+
+
+def _decrypt_batch(fn, key, nonces, tags, data, encs, threads):
+    assert len(key) == 16, "Photon-Beetle-AEAD takes 16 -bytes secret key !"
+    assert len(nonces) == len(encs), "Each packet needs its own nonce !"
+    assert len(tags) == len(encs), "Each packet needs its own authentication tag !"
+    assert len(data) == len(encs), "Each packet needs its associated data !"
+    assert all(
+        len(n) == 16 for n in nonces
+    ), "Photon-Beetle-AEAD takes 16 -bytes nonce !"
+    assert all(
+        len(t) == 16 for t in tags
+    ), "Photon-Beetle-AEAD takes 16 -bytes authentication tag !"
+
+    cnt = len(encs)
+    d_offs = _offsets(data)
+    ct_offs = _offsets(encs)
+    dec = create_string_buffer(ct_offs[cnt])
+    flags = (c_bool * cnt)()
+
+    fn(
+        key,
+        b"".join(nonces),
+        b"".join(tags),
+        b"".join(data),
+        d_offs,
+        b"".join(encs),
+        dec,
+        ct_offs,
+        flags,
+        cnt,
+        threads,
     )
 
-    return f, dec.raw
+    return list(flags), _split(dec.raw, ct_offs)
+
+
+def photon_beetle_32_encrypt_batch(
+    key: bytes,
+    nonces: Sequence[bytes],
+    data: Sequence[bytes],
+    texts: Sequence[bytes],
+    threads: int = 0,
+) -> Tuple[List[bytes], List[bytes]]:
+    """
+    Encrypts N -many packets under same 16 -bytes secret key, where i-th packet
+    consumes i-th 16 -bytes nonce, associated data & plain text, producing N -many
+    cipher texts & 16 -bytes authentication tags ( in order ), using
+    Photon-Beetle-AEAD[32], in a single foreign function call, spread over
+    `threads` -many threads ( 0 means all available hardware threads )
+    """
+    fn = SO_LIB.photon_beetle_32_encrypt_batch
+    return _encrypt_batch(fn, key, nonces, data, texts, threads)
+
+
+def photon_beetle_32_decrypt_batch(
+    key: bytes,
+    nonces: Sequence[bytes],
+    tags: Sequence[bytes],
+    data: Sequence[bytes],
+    encs: Sequence[bytes],
+    threads: int = 0,
+) -> Tuple[List[bool], List[bytes]]:
+    """
+    Decrypts N -many packets under same 16 -bytes secret key, where i-th packet
+    consumes i-th 16 -bytes nonce, authentication tag, associated data & cipher
+    text, producing N -many verification flags ( check before consuming respective
+    plain text ) & plain texts ( in order ), using Photon-Beetle-AEAD[32], in a
+    single foreign function call, spread over `threads` -many threads
+    """
+    fn = SO_LIB.photon_beetle_32_decrypt_batch
+    return _decrypt_batch(fn, key, nonces, tags, data, encs, threads)
+
+
+def photon_beetle_128_encrypt_batch(
+    key: bytes,
+    nonces: Sequence[bytes],
+    data: Sequence[bytes],
+    texts: Sequence[bytes],
+    threads: int = 0,
+) -> Tuple[List[bytes], List[bytes]]:
+    """
+    Same as `photon_beetle_32_encrypt_batch`, but using Photon-Beetle-AEAD[128]
+    """
+    fn = SO_LIB.photon_beetle_128_encrypt_batch
+    return _encrypt_batch(fn, key, nonces, data, texts, threads)
+
+
+def photon_beetle_128_decrypt_batch(
+    key: bytes,
+    nonces: Sequence[bytes],
+    tags: Sequence[bytes],
+    data: Sequence[bytes],
+    encs: Sequence[bytes],
+    threads: int = 0,
+) -> Tuple[List[bool], List[bytes]]:
+    """
+    Same as `photon_beetle_32_decrypt_batch`, but using Photon-Beetle-AEAD[128]
+    """
+    fn = SO_LIB.photon_beetle_128_decrypt_batch
+    return _decrypt_batch(fn, key, nonces, tags, data, encs, threads)
+
+
+def photon_beetle_stats() -> Optional[Dict[str, int]]:
+    """
+    Returns process-wide operational counters ( bytes hashed, sealed & opened,
+    permutations executed, tag verification failures & time spent in nanoseconds ),
+    aggregated over all threads, or None, if shared library object was not built
+    with counters enabled i.e. using `make lib STATS=1`
+    """
+    stats = _Stats()
+    if not SO_LIB.photon_beetle_stats(stats):
+        return None
+
+    return {name: getattr(stats, name) for name, _ in _Stats._fields_}
 
 
 if __name__ == "__main__":
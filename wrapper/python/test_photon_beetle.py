@@ -1,6 +1,9 @@
 #!/usr/bin/python3
 
 import photon_beetle as pb
+import pytest
+import random
+from array import array
 
 
 def test_photon_beetle_hash_kat():
@@ -181,6 +184,145 @@ def test_photon_beetle_aead_128_kat():
             fd.readline()
 
 
+def random_bytes(n: int) -> bytes:
+    return bytes(random.getrandbits(8) for _ in range(n))
+
+
+def test_photon_beetle_hash_batch():
+    """
+    Tests that batched Photon-Beetle-Hash computes same digests as hashing
+    messages one by one, both on calling thread and on multiple threads
+    """
+    msgs = [random_bytes(random.randrange(0, 160)) for _ in range(64)]
+    expected = [pb.photon_beetle_hash(m) for m in msgs]
+
+    for threads in (1, 3, 0):
+        assert pb.photon_beetle_hash_batch(msgs, threads) == expected
+
+    assert pb.photon_beetle_hash_batch([]) == []
+
+
+def test_photon_beetle_aead_batch():
+    """
+    Tests that batched Photon-Beetle-AEAD[32, 128] encryption/ decryption computes
+    same outputs as processing packets one by one, while detecting tampered packets
+    """
+    variants = [
+        (
+            pb.photon_beetle_32_encrypt,
+            pb.photon_beetle_32_encrypt_batch,
+            pb.photon_beetle_32_decrypt_batch,
+        ),
+        (
+            pb.photon_beetle_128_encrypt,
+            pb.photon_beetle_128_encrypt_batch,
+            pb.photon_beetle_128_decrypt_batch,
+        ),
+    ]
+
+    cnt = 48
+    key = random_bytes(16)
+    nonces = [random_bytes(16) for _ in range(cnt)]
+    data = [random_bytes(random.randrange(0, 40)) for _ in range(cnt)]
+    texts = [random_bytes(random.randrange(0, 160)) for _ in range(cnt)]
+
+    for encrypt, encrypt_batch, decrypt_batch in variants:
+        expected = [encrypt(key, n, d, t) for n, d, t in zip(nonces, data, texts)]
+
+        for threads in (1, 3, 0):
+            encs, tags = encrypt_batch(key, nonces, data, texts, threads)
+            assert list(zip(encs, tags)) == expected
+
+            flags, decs = decrypt_batch(key, nonces, tags, data, encs, threads)
+            assert all(flags) and decs == texts
+
+        # tamper with one of the tags
+        bad = tags[:]
+        bad[7] = bytes([bad[7][0] ^ 1]) + bad[7][1:]
+
+        flags, decs = decrypt_batch(key, nonces, bad, data, encs)
+        assert flags == [i != 7 for i in range(cnt)]
+        assert decs[:7] == texts[:7] and decs[8:] == texts[8:]
+
+
+def test_photon_beetle_buffers():
+    """
+    Tests that Photon-Beetle-{Hash, AEAD} routines accept any C-contiguous buffer as
+    input, write into caller provided output buffers & work in-place, computing same
+    outputs as when `bytes` are passed in
+    """
+    msg = random_bytes(97)
+    digest = pb.photon_beetle_hash(msg)
+
+    assert pb.photon_beetle_hash(bytearray(msg)) == digest
+    assert pb.photon_beetle_hash(memoryview(msg)[3:]) == pb.photon_beetle_hash(msg[3:])
+    assert pb.photon_beetle_hash(array("I", msg[:96])) == pb.photon_beetle_hash(msg[:96])
+
+    out = bytearray(32)
+    assert pb.photon_beetle_hash(msg, out=out) is out and out == digest
+
+    variants = [
+        (pb.photon_beetle_32_encrypt, pb.photon_beetle_32_decrypt),
+        (pb.photon_beetle_128_encrypt, pb.photon_beetle_128_decrypt),
+    ]
+
+    key = bytearray(random_bytes(16))
+    nonce = memoryview(random_bytes(16))
+    data = random_bytes(23)
+    text = random_bytes(131)
+
+    for encrypt, decrypt in variants:
+        enc, tag = encrypt(bytes(key), bytes(nonce), data, text)
+
+        # caller provided output buffers
+        out, tag_ = bytearray(len(text)), bytearray(16)
+        assert encrypt(key, nonce, bytearray(data), text, out, tag_) == (out, tag_)
+        assert out == enc and tag_ == tag
+
+        # in-place encryption, over a slice of larger buffer
+        buf = bytearray(8) + bytearray(text) + bytearray(8)
+        view = memoryview(buf)[8:-8]
+        encrypt(key, nonce, data, view, out=view, tag=tag_)
+        assert view == enc and tag_ == tag and buf[:8] == buf[-8:] == bytes(8)
+
+        # in-place decryption
+        f, _ = decrypt(key, nonce, tag, data, view, out=view)
+        assert f and view == text
+
+        # verification failure zeroes output buffer
+        out = bytearray(len(enc))
+        f, _ = decrypt(key, nonce, bytes(16), data, enc, out=out)
+        assert not f and out == bytes(len(enc))
+
+
+def test_photon_beetle_stats():
+    """
+    Tests that operational counters account for work done through Photon-Beetle-{Hash,
+    AEAD} routines, when shared library object is built with counters enabled
+    """
+    before = pb.photon_beetle_stats()
+    if before is None:
+        pytest.skip("shared library object is built without operational counters")
+
+    key, nonce = random_bytes(16), random_bytes(16)
+    data, text = random_bytes(7), random_bytes(40)
+
+    pb.photon_beetle_hash(random_bytes(33))
+    enc, tag = pb.photon_beetle_32_encrypt(key, nonce, data, text)
+    pb.photon_beetle_32_decrypt(key, nonce, tag, data, enc)
+    pb.photon_beetle_32_decrypt(key, nonce, bytes(16), data, enc)
+    pb.photon_beetle_hash_batch([random_bytes(5)] * 4, threads=2)
+
+    after = pb.photon_beetle_stats()
+    delta = {k: after[k] - before[k] for k in after}
+
+    assert delta["bytes_hashed"] == 33 + 4 * 5
+    assert delta["bytes_sealed"] == 7 + 40
+    assert delta["bytes_opened"] == 2 * (7 + 40)
+    assert delta["tag_failures"] == 1
+    assert delta["permutations"] > 0 and delta["nanoseconds"] > 0
+
+
 if __name__ == "__main__":
     print(
         "Use `pytest` for driving Photon-Beetle tests against Known Answer Tests ( KAT ) !"